@@ -8,6 +8,9 @@
 //==============================================================================
 #include "internals_controller.h"
 
+#include <modules/ffmpeg/ffmpeg_frame_pool.h>
+#include <providers/scheduled/scheduled_channel_pool.h>
+
 namespace api
 {
 	namespace v1
@@ -18,6 +21,13 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/framePools)", &InternalsController::OnGetFramePools);
+				RegisterGet(R"(\/sendQueues)", &InternalsController::OnGetSendQueues);
+				RegisterGet(R"(\/tls)", &InternalsController::OnGetTls);
+				RegisterGet(R"(\/startup)", &InternalsController::OnGetStartup);
+				RegisterGet(R"(\/threadPlacement)", &InternalsController::OnGetThreadPlacement);
+				RegisterGet(R"(\/memory)", &InternalsController::OnGetMemory);
+				RegisterGet(R"(\/scheduledChannels)", &InternalsController::OnGetScheduledChannels);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +35,13 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/framePools");
+				response.append("/v1/stats/current/internals/sendQueues");
+				response.append("/v1/stats/current/internals/tls");
+				response.append("/v1/stats/current/internals/startup");
+				response.append("/v1/stats/current/internals/threadPlacement");
+				response.append("/v1/stats/current/internals/memory");
+				response.append("/v1/stats/current/internals/scheduledChannels");
 
 				return response;
 			}
@@ -51,6 +68,224 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetFramePools(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (const auto &stats : ffmpeg::FramePool::GetInstance()->GetStats())
+				{
+					Json::Value obj;
+
+					obj["format"] = stats.format_name.CStr();
+					obj["width"] = stats.width;
+					obj["height"] = stats.height;
+					obj["align"] = stats.align;
+					obj["bufferSize"] = static_cast<Json::UInt64>(stats.buffer_size);
+					obj["requestCount"] = static_cast<Json::UInt64>(stats.request_count);
+					obj["allocatedCount"] = static_cast<Json::UInt64>(stats.allocated_count);
+					obj["hitRate"] = stats.GetHitRate();
+
+					response.append(obj);
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetSendQueues(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response;
+
+				auto stats = ov::Socket::GetTotalSendQueueStats();
+
+				response["queuedBytes"] = static_cast<Json::UInt64>(stats.queued_bytes);
+				response["congestedSocketCount"] = static_cast<Json::UInt64>(stats.congested_socket_count);
+				response["congestionCount"] = static_cast<Json::UInt64>(stats.congestion_count);
+				response["overflowCount"] = static_cast<Json::UInt64>(stats.overflow_count);
+				response["droppedPacketCount"] = static_cast<Json::UInt64>(stats.dropped_packet_count);
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetTls(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (const auto &stats : ov::TlsTicketKeyManager::GetInstance()->GetStats())
+				{
+					Json::Value obj;
+
+					obj["name"] = stats.name.CStr();
+					obj["fullHandshakes"] = static_cast<Json::UInt64>(stats.full_handshakes);
+					obj["resumedHandshakes"] = static_cast<Json::UInt64>(stats.resumed_handshakes);
+					obj["resumptionHitRate"] = stats.GetResumptionHitRate();
+					obj["fullHandshakeCpuTimeUs"] = static_cast<Json::UInt64>(stats.full_handshake_cpu_time_us);
+					obj["resumedHandshakeCpuTimeUs"] = static_cast<Json::UInt64>(stats.resumed_handshake_cpu_time_us);
+					obj["earlyDataAccepted"] = static_cast<Json::UInt64>(stats.early_data_accepted);
+					obj["keyRotations"] = static_cast<Json::UInt64>(stats.key_rotations);
+
+					response.append(obj);
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetStartup(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response;
+
+				auto timings = ocst::Orchestrator::GetInstance()->GetStartupTimings();
+
+				response["vhostCount"] = static_cast<Json::UInt64>(timings.vhost_count);
+				response["certificateCount"] = static_cast<Json::UInt64>(timings.certificate_count);
+				response["applicationCount"] = static_cast<Json::UInt64>(timings.application_count);
+				response["certificateMs"] = static_cast<Json::Int64>(timings.certificate_ms);
+				response["vhostMs"] = static_cast<Json::Int64>(timings.vhost_ms);
+				response["applicationMs"] = static_cast<Json::Int64>(timings.application_ms);
+				response["totalMs"] = static_cast<Json::Int64>(timings.total_ms);
+
+				Json::Value ocsp;
+
+				ocsp["count"] = static_cast<Json::UInt64>(timings.ocsp_count);
+				ocsp["failedCount"] = static_cast<Json::UInt64>(timings.ocsp_failed_count);
+				ocsp["completed"] = timings.ocsp_completed;
+				ocsp["elapsedMs"] = static_cast<Json::Int64>(timings.ocsp_ms);
+
+				response["ocspPrefetch"] = ocsp;
+
+				return response;
+			}
+
+			static Json::Value JsonFromNodePlans(const std::vector<ov::ThreadPlacement::NodePlan> &node_plans)
+			{
+				Json::Value nodes(Json::ValueType::arrayValue);
+
+				for (const auto &node_plan : node_plans)
+				{
+					Json::Value node;
+
+					node["nodeId"] = node_plan.node_id;
+					node["cpus"] = ov::CpuTopology::ToCpuList(node_plan.cpus).CStr();
+					node["threadCount"] = static_cast<Json::UInt64>(node_plan.thread_count);
+
+					nodes.append(node);
+				}
+
+				return nodes;
+			}
+
+			ApiResponse InternalsController::OnGetThreadPlacement(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response;
+
+				auto report = ov::ThreadPlacement::GetInstance()->GetReport();
+
+				response["enabled"] = report.enabled;
+				response["numaLocalArena"] = report.numa_local_arena;
+				response["arenaCount"] = static_cast<Json::UInt64>(report.arena_count);
+				response["nodes"] = JsonFromNodePlans(report.nodes);
+
+				Json::Value plans(Json::ValueType::arrayValue);
+
+				for (const auto &plan : report.plans)
+				{
+					Json::Value item;
+
+					item["role"] = ov::StringFromThreadRole(plan.role);
+					item["nodes"] = JsonFromNodePlans(plan.nodes);
+
+					plans.append(item);
+				}
+
+				response["plans"] = plans;
+
+				return response;
+			}
+
+			static Json::Value JsonFromMemoryAccounts(const std::vector<ov::MemoryAccounting::AccountStats> &accounts)
+			{
+				Json::Value items(Json::ValueType::arrayValue);
+
+				for (const auto &account : accounts)
+				{
+					Json::Value item;
+
+					item["tag"] = ov::StringFromMemoryTag(account.tag);
+					item["liveBytes"] = static_cast<Json::UInt64>(account.live_bytes);
+					item["peakBytes"] = static_cast<Json::UInt64>(account.peak_bytes);
+
+					items.append(item);
+				}
+
+				return items;
+			}
+
+			ApiResponse InternalsController::OnGetMemory(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response;
+
+				auto report = ov::MemoryAccounting::GetInstance()->GetReport();
+
+				response["liveBytes"] = static_cast<Json::UInt64>(report.live_bytes);
+				response["tags"] = JsonFromMemoryAccounts(report.tags);
+
+				Json::Value streams(Json::ValueType::arrayValue);
+
+				for (const auto &stream : report.streams)
+				{
+					Json::Value item;
+
+					item["streamUri"] = stream.stream_uri.CStr();
+					item["liveBytes"] = static_cast<Json::UInt64>(stream.live_bytes);
+					item["accounts"] = JsonFromMemoryAccounts(stream.accounts);
+
+					streams.append(item);
+				}
+
+				response["streams"] = streams;
+
+				// The send queues of the sockets are shared by the streams, so they are not charged
+				// to the accounts above
+				Json::Value socket_send_queue;
+				socket_send_queue["queuedBytes"] = static_cast<Json::UInt64>(ov::Socket::GetTotalSendQueueStats().queued_bytes);
+				response["socketSendQueue"] = socket_send_queue;
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetScheduledChannels(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response;
+
+				auto pool = pvd::ScheduledChannelPool::GetInstance();
+
+				response["workerCount"] = static_cast<Json::UInt64>(pool->GetWorkerCount());
+				response["coalesceWindowUs"] = static_cast<Json::Int64>(pvd::ScheduledChannelPool::COALESCE_WINDOW.count());
+
+				Json::Value channels(Json::ValueType::arrayValue);
+
+				for (const auto &stats : pool->GetStats())
+				{
+					Json::Value item;
+
+					item["id"] = stats.channel_id;
+					item["name"] = stats.name.CStr();
+					item["worker"] = static_cast<Json::UInt64>(stats.worker_index);
+					item["running"] = stats.running;
+					item["idle"] = stats.idle;
+					item["stepCount"] = static_cast<Json::UInt64>(stats.drift_stats.step_count);
+					item["timedStepCount"] = static_cast<Json::UInt64>(stats.drift_stats.timed_step_count);
+					item["lastDriftUs"] = static_cast<Json::Int64>(stats.drift_stats.last_drift_us);
+					item["maxDriftUs"] = static_cast<Json::Int64>(stats.drift_stats.max_drift_us);
+					item["averageDriftUs"] = static_cast<Json::Int64>(stats.drift_stats.GetAverageDriftUs());
+
+					channels.append(item);
+				}
+
+				response["channels"] = channels;
+
+				return response;
+			}
 		}  // namespace stats
 	}  // namespace v1
 }  // namespace api
\ No newline at end of file
@@ -24,6 +24,13 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetFramePools(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetSendQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetTls(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetStartup(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetThreadPlacement(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetMemory(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetScheduledChannels(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}  // namespace v1
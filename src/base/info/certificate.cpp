@@ -93,6 +93,7 @@ namespace info
 
 		_certificate_name = certificate_name;
 		_certificate = certificate;
+		_session_ticket_config = tls_config.GetSessionTicket();
 
 		for (auto &host_name : host_name_list)
 		{
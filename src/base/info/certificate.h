@@ -32,6 +32,11 @@ namespace info
 			return _certificate;
 		}
 
+		const cfg::cmn::SessionTicket &GetSessionTicketConfig() const
+		{
+			return _session_ticket_config;
+		}
+
 		ov::String ToString() const;
 
 	protected:
@@ -55,5 +60,7 @@ namespace info
 		std::vector<HostNameEntry> _host_name_entry_list;
 
 		std::shared_ptr<::Certificate> _certificate;
+
+		cfg::cmn::SessionTicket _session_ticket_config;
 	};
 }  // namespace info
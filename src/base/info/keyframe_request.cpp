@@ -0,0 +1,184 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "keyframe_request.h"
+
+#include <algorithm>
+
+#define OV_LOG_TAG "KeyframeRequest"
+
+namespace info
+{
+	namespace
+	{
+		int64_t GetNowMs()
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>(KeyframeRequest::Clock::now().time_since_epoch()).count();
+		}
+	}  // namespace
+
+	KeyframeRequest::Entry::Entry(int64_t min_interval_ms, RequestHandler request_handler)
+		: _min_interval_ms(min_interval_ms),
+		  _request_handler(std::move(request_handler))
+	{
+	}
+
+	bool KeyframeRequest::Entry::Touch()
+	{
+		auto now_ms = GetNowMs();
+
+		_request_count++;
+
+		auto last_forwarded_time_ms = _last_forwarded_time_ms.load(std::memory_order_acquire);
+
+		while ((last_forwarded_time_ms == 0) || ((now_ms - last_forwarded_time_ms) >= _min_interval_ms))
+		{
+			// Only one of the concurrent requests wins the interval
+			if (_last_forwarded_time_ms.compare_exchange_weak(last_forwarded_time_ms, now_ms, std::memory_order_acq_rel))
+			{
+				_forwarded_count++;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void KeyframeRequest::Entry::Forward()
+	{
+		ov::LockGuard lock_guard(_request_handler_mutex);
+
+		if (_request_handler != nullptr)
+		{
+			_request_handler();
+		}
+	}
+
+	void KeyframeRequest::Entry::ResetRequestHandler()
+	{
+		ov::LockGuard lock_guard(_request_handler_mutex);
+
+		_request_handler = nullptr;
+	}
+
+	KeyframeRequest::Stats KeyframeRequest::Entry::GetStats() const
+	{
+		Stats stats;
+
+		stats.request_count = _request_count;
+		stats.forwarded_count = _forwarded_count;
+
+		return stats;
+	}
+
+	ov::String KeyframeRequest::MakeKey(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id)
+	{
+		return ov::String::FormatString("%s/%s/%u", vhost_app_name.CStr(), stream_name.CStr(), track_id);
+	}
+
+	std::shared_ptr<KeyframeRequest::Entry> KeyframeRequest::Register(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id,
+																	  int64_t min_interval_ms, RequestHandler request_handler)
+	{
+		auto entry = std::make_shared<Entry>(std::max<int64_t>(1, min_interval_ms), std::move(request_handler));
+
+		{
+			ov::LockGuard lock_guard(_entries_mutex);
+			_entries[MakeKey(vhost_app_name, stream_name, track_id)].push_back(entry);
+		}
+
+		logtd("Keyframe requests are enabled for %s/%s/%u (min interval: %" PRId64 "ms)",
+			  vhost_app_name.CStr(), stream_name.CStr(), track_id, min_interval_ms);
+
+		return entry;
+	}
+
+	void KeyframeRequest::Unregister(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id, const std::shared_ptr<Entry> &entry)
+	{
+		if (entry == nullptr)
+		{
+			return;
+		}
+
+		{
+			ov::LockGuard lock_guard(_entries_mutex);
+
+			auto item = _entries.find(MakeKey(vhost_app_name, stream_name, track_id));
+			if (item != _entries.end())
+			{
+				auto &entries = item->second;
+				entries.erase(std::remove(entries.begin(), entries.end(), entry), entries.end());
+
+				if (entries.empty())
+				{
+					_entries.erase(item);
+				}
+			}
+		}
+
+		// A Request() in progress may still hold the entry
+		entry->ResetRequestHandler();
+
+		auto stats = entry->GetStats();
+		logti("Keyframe requests of %s/%s/%u have been disabled. requests: %" PRIu64 ", forwarded: %" PRIu64,
+			  vhost_app_name.CStr(), stream_name.CStr(), track_id, stats.request_count, stats.forwarded_count);
+	}
+
+	KeyframeRequest::RequestResult KeyframeRequest::Request(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id)
+	{
+		std::vector<std::shared_ptr<Entry>> entries;
+
+		{
+			ov::LockGuard lock_guard(_entries_mutex);
+
+			auto item = _entries.find(MakeKey(vhost_app_name, stream_name, track_id));
+			if (item == _entries.end())
+			{
+				return RequestResult::NotRegistered;
+			}
+
+			entries = item->second;
+		}
+
+		auto result = RequestResult::RateLimited;
+
+		for (auto &entry : entries)
+		{
+			if (entry->Touch())
+			{
+				entry->Forward();
+				result = RequestResult::Forwarded;
+			}
+		}
+
+		return result;
+	}
+
+	std::optional<KeyframeRequest::Stats> KeyframeRequest::GetStats(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id) const
+	{
+		ov::LockGuard lock_guard(_entries_mutex);
+
+		auto item = _entries.find(MakeKey(vhost_app_name, stream_name, track_id));
+		if (item == _entries.end())
+		{
+			return std::nullopt;
+		}
+
+		Stats total;
+
+		for (const auto &entry : item->second)
+		{
+			auto stats = entry->GetStats();
+
+			// Every entry of the track sees the same requests
+			total.request_count = std::max(total.request_count, stats.request_count);
+			total.forwarded_count += stats.forwarded_count;
+		}
+
+		return total;
+	}
+}  // namespace info
@@ -0,0 +1,100 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "base/common_types.h"
+#include "base/ovlibrary/ovlibrary.h"
+#include "base/ovlibrary/tsa/mutex.h"
+#include "vhost_app_name.h"
+
+namespace info
+{
+	// On-demand keyframes of the transcoder's video encoders.
+	//
+	// A publisher that serves a rendition encoded by the transcoder (e.g. WebRTC on PLI/FIR) may
+	// ask its encoder for a keyframe. The transcoder and the publishers do not know each other, so
+	// they meet here: a video encoder registers an entry per output track, and a publisher calls
+	// Request() with the track of its stream. Each entry forwards at most one request per minimum
+	// interval, so that many viewers cannot make the encoder produce keyframe after keyframe.
+	class KeyframeRequest : public ov::Singleton<KeyframeRequest>
+	{
+	public:
+		using Clock			 = std::chrono::steady_clock;
+		using RequestHandler = std::function<void()>;
+
+		struct Stats
+		{
+			uint64_t request_count	 = 0;
+			// Number of requests forwarded to the encoder
+			uint64_t forwarded_count = 0;
+		};
+
+		class Entry
+		{
+			friend class KeyframeRequest;
+
+		public:
+			Entry(int64_t min_interval_ms, RequestHandler request_handler);
+
+			Stats GetStats() const;
+
+		private:
+			// Returns true if the request is out of the minimum interval of the last forwarded one
+			bool Touch();
+			void Forward();
+			void ResetRequestHandler();
+
+			const int64_t _min_interval_ms;
+
+			// Clock::time_point in milliseconds, 0 = never forwarded
+			std::atomic<int64_t> _last_forwarded_time_ms{0};
+
+			std::atomic<uint64_t> _request_count{0};
+			std::atomic<uint64_t> _forwarded_count{0};
+
+			ov::Mutex _request_handler_mutex;
+			RequestHandler _request_handler OV_GUARDED_BY(_request_handler_mutex);
+		};
+
+		enum class RequestResult
+		{
+			// No encoder is registered for the track (e.g. the track is bypassed)
+			NotRegistered,
+			// The encoder will insert a keyframe
+			Forwarded,
+			// A keyframe has been requested within the minimum interval, it is on its way
+			RateLimited
+		};
+
+		// Called by the encoder. <request_handler> is called for each forwarded request, and is never
+		// called after Unregister() returns.
+		std::shared_ptr<Entry> Register(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id,
+										int64_t min_interval_ms, RequestHandler request_handler);
+		void Unregister(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id, const std::shared_ptr<Entry> &entry);
+
+		// Called by the publisher
+		RequestResult Request(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id);
+
+		std::optional<Stats> GetStats(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id) const;
+
+	private:
+		static ov::String MakeKey(const VHostAppName &vhost_app_name, const ov::String &stream_name, uint32_t track_id);
+
+		mutable ov::Mutex _entries_mutex;
+		// An encoder that is being replaced may still be registered for a while
+		std::map<ov::String, std::vector<std::shared_ptr<Entry>>> _entries OV_GUARDED_BY(_entries_mutex);
+	};
+}  // namespace info
@@ -0,0 +1,108 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <base/info/keyframe_request.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const info::VHostAppName kVHostAppName("default", "app");
+	const ov::String kStreamName = "stream";
+	constexpr uint32_t kTrackId = 1;
+
+	using RequestResult = info::KeyframeRequest::RequestResult;
+}  // namespace
+
+TEST(KeyframeRequest, NotRegisteredWithoutEncoder)
+{
+	info::KeyframeRequest keyframe_request;
+
+	EXPECT_EQ(keyframe_request.Request(kVHostAppName, kStreamName, kTrackId), RequestResult::NotRegistered);
+	EXPECT_FALSE(keyframe_request.GetStats(kVHostAppName, kStreamName, kTrackId).has_value());
+}
+
+// A storm of PLIs from many viewers asks the encoder for a single keyframe
+TEST(KeyframeRequest, ConcurrentRequestsAreForwardedOnce)
+{
+	constexpr int REQUEST_COUNT = 64;
+
+	info::KeyframeRequest keyframe_request;
+	std::atomic<int> keyframe_count{0};
+
+	auto entry = keyframe_request.Register(kVHostAppName, kStreamName, kTrackId, 60000, [&keyframe_count]() {
+		keyframe_count++;
+	});
+
+	std::atomic<int> forwarded_count{0};
+	std::vector<std::thread> requests;
+	for (int index = 0; index < REQUEST_COUNT; index++)
+	{
+		requests.emplace_back([&]() {
+			if (keyframe_request.Request(kVHostAppName, kStreamName, kTrackId) == RequestResult::Forwarded)
+			{
+				forwarded_count++;
+			}
+		});
+	}
+
+	for (auto &request : requests)
+	{
+		request.join();
+	}
+
+	EXPECT_EQ(keyframe_count, 1);
+	EXPECT_EQ(forwarded_count, 1);
+
+	auto stats = keyframe_request.GetStats(kVHostAppName, kStreamName, kTrackId);
+	ASSERT_TRUE(stats.has_value());
+	EXPECT_EQ(stats->request_count, static_cast<uint64_t>(REQUEST_COUNT));
+	EXPECT_EQ(stats->forwarded_count, 1u);
+
+	keyframe_request.Unregister(kVHostAppName, kStreamName, kTrackId, entry);
+}
+
+TEST(KeyframeRequest, ForwardsAgainAfterMinInterval)
+{
+	info::KeyframeRequest keyframe_request;
+	std::atomic<int> keyframe_count{0};
+
+	auto entry = keyframe_request.Register(kVHostAppName, kStreamName, kTrackId, 50, [&keyframe_count]() {
+		keyframe_count++;
+	});
+
+	EXPECT_EQ(keyframe_request.Request(kVHostAppName, kStreamName, kTrackId), RequestResult::Forwarded);
+	EXPECT_EQ(keyframe_request.Request(kVHostAppName, kStreamName, kTrackId), RequestResult::RateLimited);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(80));
+
+	EXPECT_EQ(keyframe_request.Request(kVHostAppName, kStreamName, kTrackId), RequestResult::Forwarded);
+	EXPECT_EQ(keyframe_count, 2);
+
+	// Other tracks of the stream are not affected
+	EXPECT_EQ(keyframe_request.Request(kVHostAppName, kStreamName, kTrackId + 1), RequestResult::NotRegistered);
+
+	keyframe_request.Unregister(kVHostAppName, kStreamName, kTrackId, entry);
+}
+
+TEST(KeyframeRequest, UnregisteredEncoderIsNotCalled)
+{
+	info::KeyframeRequest keyframe_request;
+	std::atomic<int> keyframe_count{0};
+
+	auto entry = keyframe_request.Register(kVHostAppName, kStreamName, kTrackId, 1, [&keyframe_count]() {
+		keyframe_count++;
+	});
+	keyframe_request.Unregister(kVHostAppName, kStreamName, kTrackId, entry);
+
+	EXPECT_EQ(keyframe_request.Request(kVHostAppName, kStreamName, kTrackId), RequestResult::NotRegistered);
+	EXPECT_EQ(keyframe_count, 0);
+}
@@ -97,6 +97,7 @@ namespace info
 		_representation_type = stream._representation_type;
 
 		_origin_stream_uuid = stream._origin_stream_uuid;
+		_relay_path = stream._relay_path;
 
 		_timestamp_mode = stream._timestamp_mode;
 	}
@@ -231,6 +232,16 @@ namespace info
 		return _origin_stream_uuid;
 	}
 
+	void Stream::SetRelayPath(const std::vector<ov::String> &relay_path)
+	{
+		_relay_path = relay_path;
+	}
+
+	const std::vector<ov::String> &Stream::GetRelayPath() const
+	{
+		return _relay_path;
+	}
+
 	std::chrono::system_clock::time_point Stream::GetInputStreamCreatedTime() const
 	{
 		if (GetLinkedInputStream() != nullptr)
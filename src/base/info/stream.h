@@ -61,6 +61,8 @@ namespace info
 		// Only used in OVT provider
 		void SetOriginStreamUUID(const ov::String &uuid);
 		ov::String GetOriginStreamUUID() const;
+		void SetRelayPath(const std::vector<ov::String> &relay_path);
+		const std::vector<ov::String> &GetRelayPath() const;
 
 		std::chrono::system_clock::time_point GetInputStreamCreatedTime() const;
 		std::chrono::system_clock::time_point GetCreatedTime() const;
@@ -254,6 +256,8 @@ namespace info
 
 		// If the source if this stream is a remote stream of the origin server, store the uuid of origin stream
 		ov::String _origin_stream_uuid;
+		// Host UUIDs of the servers the remote stream has been relayed through, starting from the origin
+		std::vector<ov::String> _relay_path;
 
 		TimestampMode _timestamp_mode = TimestampMode::Auto;
 	};
@@ -0,0 +1,195 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "thumbnail_demand.h"
+
+#include <algorithm>
+
+#define OV_LOG_TAG "ThumbnailDemand"
+
+namespace info
+{
+	namespace
+	{
+		int64_t GetNowMs()
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>(ThumbnailDemand::Clock::now().time_since_epoch()).count();
+		}
+	}  // namespace
+
+	ThumbnailDemand::Entry::Entry(int64_t idle_timeout_ms, WakeupHandler wakeup_handler)
+		: _idle_timeout_ms(idle_timeout_ms),
+		  _wakeup_handler(std::move(wakeup_handler))
+	{
+	}
+
+	bool ThumbnailDemand::Entry::IsActive() const
+	{
+		auto last_request_time_ms = _last_request_time_ms.load(std::memory_order_acquire);
+
+		return (last_request_time_ms > 0) && ((GetNowMs() - last_request_time_ms) < _idle_timeout_ms);
+	}
+
+	bool ThumbnailDemand::Entry::Touch()
+	{
+		auto now_ms = GetNowMs();
+		auto last_request_time_ms = _last_request_time_ms.exchange(now_ms, std::memory_order_acq_rel);
+
+		_request_count++;
+
+		// Only the request that ends the idle period sees the old timestamp
+		bool activated = (last_request_time_ms == 0) || ((now_ms - last_request_time_ms) >= _idle_timeout_ms);
+		if (activated)
+		{
+			_activation_count++;
+		}
+
+		return activated;
+	}
+
+	void ThumbnailDemand::Entry::OnEncoded()
+	{
+		_encode_count++;
+	}
+
+	void ThumbnailDemand::Entry::Wakeup()
+	{
+		ov::LockGuard lock_guard(_wakeup_handler_mutex);
+
+		if (_wakeup_handler != nullptr)
+		{
+			_wakeup_handler();
+		}
+	}
+
+	void ThumbnailDemand::Entry::ResetWakeupHandler()
+	{
+		ov::LockGuard lock_guard(_wakeup_handler_mutex);
+
+		_wakeup_handler = nullptr;
+	}
+
+	ThumbnailDemand::Stats ThumbnailDemand::Entry::GetStats() const
+	{
+		Stats stats;
+
+		stats.request_count = _request_count;
+		stats.activation_count = _activation_count;
+		stats.encode_count = _encode_count;
+
+		return stats;
+	}
+
+	ov::String ThumbnailDemand::MakeKey(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id)
+	{
+		return ov::String::FormatString("%s/%s/%d", vhost_app_name.CStr(), stream_name.CStr(), static_cast<int>(codec_id));
+	}
+
+	std::shared_ptr<ThumbnailDemand::Entry> ThumbnailDemand::Register(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id,
+																	  int64_t idle_timeout_ms, WakeupHandler wakeup_handler)
+	{
+		auto entry = std::make_shared<Entry>(std::max<int64_t>(1, idle_timeout_ms), std::move(wakeup_handler));
+
+		{
+			ov::LockGuard lock_guard(_entries_mutex);
+			_entries[MakeKey(vhost_app_name, stream_name, codec_id)].push_back(entry);
+		}
+
+		logtd("On-demand %s encoder has been registered: %s/%s (idle timeout: %" PRId64 "ms)",
+			  cmn::GetCodecIdString(codec_id), vhost_app_name.CStr(), stream_name.CStr(), idle_timeout_ms);
+
+		return entry;
+	}
+
+	void ThumbnailDemand::Unregister(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id, const std::shared_ptr<Entry> &entry)
+	{
+		if (entry == nullptr)
+		{
+			return;
+		}
+
+		{
+			ov::LockGuard lock_guard(_entries_mutex);
+
+			auto item = _entries.find(MakeKey(vhost_app_name, stream_name, codec_id));
+			if (item != _entries.end())
+			{
+				auto &entries = item->second;
+				entries.erase(std::remove(entries.begin(), entries.end(), entry), entries.end());
+
+				if (entries.empty())
+				{
+					_entries.erase(item);
+				}
+			}
+		}
+
+		// A Request() in progress may still hold the entry
+		entry->ResetWakeupHandler();
+
+		auto stats = entry->GetStats();
+		logti("On-demand %s encoder of %s/%s has been unregistered. requests: %" PRIu64 ", activations: %" PRIu64 ", encodes: %" PRIu64 " (%.2f encodes/request)",
+			  cmn::GetCodecIdString(codec_id), vhost_app_name.CStr(), stream_name.CStr(),
+			  stats.request_count, stats.activation_count, stats.encode_count, stats.GetEncodesPerRequest());
+	}
+
+	ThumbnailDemand::RequestResult ThumbnailDemand::Request(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id)
+	{
+		std::vector<std::shared_ptr<Entry>> entries;
+
+		{
+			ov::LockGuard lock_guard(_entries_mutex);
+
+			auto item = _entries.find(MakeKey(vhost_app_name, stream_name, codec_id));
+			if (item == _entries.end())
+			{
+				return RequestResult::NotOnDemand;
+			}
+
+			entries = item->second;
+		}
+
+		auto result = RequestResult::Active;
+
+		for (auto &entry : entries)
+		{
+			if (entry->Touch())
+			{
+				entry->Wakeup();
+				result = RequestResult::Activated;
+			}
+		}
+
+		return result;
+	}
+
+	std::optional<ThumbnailDemand::Stats> ThumbnailDemand::GetStats(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id) const
+	{
+		ov::LockGuard lock_guard(_entries_mutex);
+
+		auto item = _entries.find(MakeKey(vhost_app_name, stream_name, codec_id));
+		if (item == _entries.end())
+		{
+			return std::nullopt;
+		}
+
+		Stats total;
+
+		for (const auto &entry : item->second)
+		{
+			auto stats = entry->GetStats();
+
+			// Every entry of the image sees the same requests
+			total.request_count = std::max(total.request_count, stats.request_count);
+			total.activation_count += stats.activation_count;
+			total.encode_count += stats.encode_count;
+		}
+
+		return total;
+	}
+}  // namespace info
@@ -0,0 +1,115 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "base/common_types.h"
+#include "base/ovlibrary/ovlibrary.h"
+#include "base/ovlibrary/tsa/mutex.h"
+#include "vhost_app_name.h"
+
+namespace info
+{
+	// Request-driven cadence of the on-demand thumbnail encoders.
+	//
+	// The transcoder and the Thumbnail Publisher do not know each other, so they meet here.
+	// An image encoder of an application whose Thumbnail Publisher runs on demand registers an
+	// entry, and encodes only while the entry is active - that is, while its image has been
+	// requested within the idle timeout. The publisher calls Request() for every thumbnail
+	// request. When an entry goes from idle to active, the encoder is woken up once to encode the
+	// last frame it held, and every request that arrives until that image is ready waits for it.
+	class ThumbnailDemand : public ov::Singleton<ThumbnailDemand>
+	{
+	public:
+		using Clock			= std::chrono::steady_clock;
+		using WakeupHandler = std::function<void()>;
+
+		struct Stats
+		{
+			uint64_t request_count	  = 0;
+			// Number of times the entry went from idle to active
+			uint64_t activation_count = 0;
+			uint64_t encode_count	  = 0;
+
+			double GetEncodesPerRequest() const
+			{
+				return (request_count > 0) ? static_cast<double>(encode_count) / static_cast<double>(request_count) : 0.0;
+			}
+		};
+
+		class Entry
+		{
+			friend class ThumbnailDemand;
+
+		public:
+			Entry(int64_t idle_timeout_ms, WakeupHandler wakeup_handler);
+
+			// Whether a request has arrived within the idle timeout
+			bool IsActive() const;
+
+			// Called by the encoder for each frame it encodes
+			void OnEncoded();
+
+			Stats GetStats() const;
+
+		private:
+			// Returns true if the entry has gone from idle to active
+			bool Touch();
+			void Wakeup();
+			void ResetWakeupHandler();
+
+			const int64_t _idle_timeout_ms;
+
+			// Clock::time_point in milliseconds, 0 = never requested
+			std::atomic<int64_t> _last_request_time_ms{0};
+
+			std::atomic<uint64_t> _request_count{0};
+			std::atomic<uint64_t> _activation_count{0};
+			std::atomic<uint64_t> _encode_count{0};
+
+			ov::Mutex _wakeup_handler_mutex;
+			WakeupHandler _wakeup_handler OV_GUARDED_BY(_wakeup_handler_mutex);
+		};
+
+		enum class RequestResult
+		{
+			// No on-demand encoder is registered for the image; it is encoded at the output frame rate
+			NotOnDemand,
+			// The encoder is running, so the cached image is up to date
+			Active,
+			// The encoder has just been woken up, and the cached image (if any) is stale
+			Activated
+		};
+
+		// Called by the encoder. <wakeup_handler> is called when the entry goes from idle to active,
+		// and is never called after Unregister() returns.
+		std::shared_ptr<Entry> Register(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id,
+										int64_t idle_timeout_ms, WakeupHandler wakeup_handler);
+		void Unregister(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id, const std::shared_ptr<Entry> &entry);
+
+		// Called by the publisher for each thumbnail request
+		RequestResult Request(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id);
+
+		// Sum of the entries registered for the image
+		std::optional<Stats> GetStats(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id) const;
+
+	private:
+		static ov::String MakeKey(const VHostAppName &vhost_app_name, const ov::String &stream_name, cmn::MediaCodecId codec_id);
+
+		mutable ov::Mutex _entries_mutex;
+		// A stream may have more than one encoder of a codec
+		std::map<ov::String, std::vector<std::shared_ptr<Entry>>> _entries OV_GUARDED_BY(_entries_mutex);
+	};
+}  // namespace info
@@ -0,0 +1,115 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <base/info/thumbnail_demand.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const info::VHostAppName kVHostAppName("default", "app");
+	const ov::String kStreamName = "stream";
+
+	using RequestResult = info::ThumbnailDemand::RequestResult;
+}  // namespace
+
+TEST(ThumbnailDemand, NotOnDemandWithoutEncoder)
+{
+	info::ThumbnailDemand demand;
+
+	EXPECT_EQ(demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Jpeg), RequestResult::NotOnDemand);
+	EXPECT_FALSE(demand.GetStats(kVHostAppName, kStreamName, cmn::MediaCodecId::Jpeg).has_value());
+}
+
+// Only the request that ends the idle period wakes the encoder up
+TEST(ThumbnailDemand, ConcurrentRequestsWakeUpOnce)
+{
+	constexpr int REQUEST_COUNT = 64;
+
+	info::ThumbnailDemand demand;
+	std::atomic<int> wakeup_count{0};
+
+	auto entry = demand.Register(kVHostAppName, kStreamName, cmn::MediaCodecId::Jpeg, 10000, [&wakeup_count]() {
+		wakeup_count++;
+	});
+	EXPECT_FALSE(entry->IsActive());
+
+	std::atomic<int> activated_count{0};
+	std::vector<std::thread> requests;
+	for (int index = 0; index < REQUEST_COUNT; index++)
+	{
+		requests.emplace_back([&]() {
+			if (demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Jpeg) == RequestResult::Activated)
+			{
+				activated_count++;
+			}
+		});
+	}
+
+	for (auto &request : requests)
+	{
+		request.join();
+	}
+
+	EXPECT_TRUE(entry->IsActive());
+	EXPECT_EQ(wakeup_count, 1);
+	EXPECT_EQ(activated_count, 1);
+
+	// Other codecs of the stream are not affected
+	EXPECT_EQ(demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Png), RequestResult::NotOnDemand);
+
+	entry->OnEncoded();
+
+	auto stats = demand.GetStats(kVHostAppName, kStreamName, cmn::MediaCodecId::Jpeg);
+	ASSERT_TRUE(stats.has_value());
+	EXPECT_EQ(stats->request_count, static_cast<uint64_t>(REQUEST_COUNT));
+	EXPECT_EQ(stats->activation_count, 1u);
+	EXPECT_EQ(stats->encode_count, 1u);
+	EXPECT_DOUBLE_EQ(stats->GetEncodesPerRequest(), 1.0 / REQUEST_COUNT);
+
+	demand.Unregister(kVHostAppName, kStreamName, cmn::MediaCodecId::Jpeg, entry);
+}
+
+TEST(ThumbnailDemand, GoesIdleAfterTimeout)
+{
+	info::ThumbnailDemand demand;
+	int wakeup_count = 0;
+
+	auto entry = demand.Register(kVHostAppName, kStreamName, cmn::MediaCodecId::Webp, 50, [&wakeup_count]() {
+		wakeup_count++;
+	});
+
+	EXPECT_EQ(demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Webp), RequestResult::Activated);
+	EXPECT_EQ(demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Webp), RequestResult::Active);
+	EXPECT_TRUE(entry->IsActive());
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(80));
+	EXPECT_FALSE(entry->IsActive());
+
+	EXPECT_EQ(demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Webp), RequestResult::Activated);
+	EXPECT_EQ(wakeup_count, 2);
+
+	demand.Unregister(kVHostAppName, kStreamName, cmn::MediaCodecId::Webp, entry);
+}
+
+TEST(ThumbnailDemand, NoWakeupAfterUnregister)
+{
+	info::ThumbnailDemand demand;
+	int wakeup_count = 0;
+
+	auto entry = demand.Register(kVHostAppName, kStreamName, cmn::MediaCodecId::Png, 10000, [&wakeup_count]() {
+		wakeup_count++;
+	});
+	demand.Unregister(kVHostAppName, kStreamName, cmn::MediaCodecId::Png, entry);
+
+	EXPECT_EQ(demand.Request(kVHostAppName, kStreamName, cmn::MediaCodecId::Png), RequestResult::NotOnDemand);
+	EXPECT_EQ(wakeup_count, 0);
+}
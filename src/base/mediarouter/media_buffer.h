@@ -17,6 +17,7 @@
 #include "media_type.h"
 
 class MediaTrack;
+class OvtRelayFragments;
 
 enum class MediaPacketFlag : uint8_t
 {
@@ -215,6 +216,17 @@ public:
 		return _is_internal_created;
 	}
 
+	// The OVT packets this packet was received in, kept by OVT relays (see OvtRelayFragments)
+	void SetOvtRelayFragments(const std::shared_ptr<const OvtRelayFragments> &fragments)
+	{
+		_ovt_relay_fragments = fragments;
+	}
+
+	const std::shared_ptr<const OvtRelayFragments> &GetOvtRelayFragments() const
+	{
+		return _ovt_relay_fragments;
+	}
+
 	std::shared_ptr<MediaPacket> ClonePacket() const
 	{
 		auto packet = std::make_shared<MediaPacket>(
@@ -280,6 +292,9 @@ protected:
 	// such as through the SendEvent API or EventGenerator XML configuration.
 	bool _is_internal_created = false;
 
+	// Not copied by ClonePacket(), since the clone does not share the data the fragments carry
+	std::shared_ptr<const OvtRelayFragments> _ovt_relay_fragments = nullptr;
+
 	// creation timepoint
 	std::chrono::time_point<std::chrono::system_clock> _creation_time = std::chrono::system_clock::now();
 };
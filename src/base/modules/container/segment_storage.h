@@ -26,6 +26,20 @@ namespace base
 			virtual uint64_t GetDataLength() const = 0;
 			virtual const std::shared_ptr<ov::Data> GetData() const = 0;
 
+			// The same bytes as GetData(), as a list of pieces that are sent one after another.
+			// Containers that keep the headers and the sample payloads separately override this
+			// so that they can be sent without concatenating them first.
+			virtual std::vector<std::shared_ptr<const ov::Data>> GetDataList() const
+			{
+				auto data = GetData();
+				if (data == nullptr)
+				{
+					return {};
+				}
+
+				return {data};
+			}
+
 			virtual ov::String GetUrl() const { return ""; }
 			virtual void SetUrl(const ov::String &url) {}
 
@@ -16,53 +16,50 @@ namespace ov
 {
 	std::shared_ptr<OcspContext> OcspCache::ContextForCert(SSL_CTX *ssl_ctx, X509 *cert)
 	{
-		LockGuard lock_guard(_cache_mutex);
-
-		auto item = _cache_map.find(cert);
-
 		std::shared_ptr<OcspContext> ocsp_context;
 
-		if (item != _cache_map.end())
 		{
-			ocsp_context = item->second;
+			LockGuard lock_guard(_cache_mutex);
 
-			if (ocsp_context->IsExpired())
+			auto item = _cache_map.find(cert);
+
+			if (item != _cache_map.end())
 			{
-				// Need to issue new OCSP request
-				logti("Trying to renew OCSP response: %p", cert);
-				auto x509 = item->first;
-				_cache_map.erase(item);
-				::X509_free(x509);
+				ocsp_context = item->second;
 
-				ocsp_context = nullptr;
-			}
-		}
+				if (ocsp_context->IsExpired())
+				{
+					// Need to issue new OCSP request
+					logti("Trying to renew OCSP response: %p", cert);
+					auto x509 = item->first;
+					_cache_map.erase(item);
+					::X509_free(x509);
 
-		if (ocsp_context == nullptr)
-		{
-			// Create new instance
-			ocsp_context = OcspContext::Create(ssl_ctx, cert);
+					ocsp_context = nullptr;
+				}
+			}
 
 			if (ocsp_context == nullptr)
 			{
-				return nullptr;
-			}
+				// Create new instance
+				ocsp_context = OcspContext::Create(cert);
 
-			_cache_map[::X509_dup(cert)] = ocsp_context;
-		}
-
-		if (ocsp_context->IsStatusRequestEnabled())
-		{
-			if (ocsp_context->HasResponse() == false)
-			{
-				if (ocsp_context->Request(cert) == false)
+				if (ocsp_context == nullptr)
 				{
 					return nullptr;
 				}
+
+				_cache_map[::X509_dup(cert)] = ocsp_context;
 			}
-			else
+		}
+
+		// The responder is queried without holding the cache, so that a slow responder of one
+		// certificate does not hold up the handshakes and prefetches of the others
+		if (ocsp_context->IsStatusRequestEnabled())
+		{
+			if (ocsp_context->RequestIfNeeded(ssl_ctx, cert) == false)
 			{
-				logtt("Use cached OCSP response: %p", cert);
+				return nullptr;
 			}
 		}
 
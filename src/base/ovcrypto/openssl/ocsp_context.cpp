@@ -12,8 +12,7 @@
 
 namespace ov
 {
-	OcspContext::OcspContext(SSL_CTX *ssl_ctx, X509 *cert)
-		: _ssl_ctx(ssl_ctx)
+	OcspContext::OcspContext(X509 *cert)
 	{
 		_status_request_enabled = IsStatusRequestEnabled(cert);
 
@@ -117,9 +116,9 @@ namespace ov
 		return false;
 	}
 
-	std::shared_ptr<OcspContext> OcspContext::Create(SSL_CTX *ssl_ctx, X509 *cert)
+	std::shared_ptr<OcspContext> OcspContext::Create(X509 *cert)
 	{
-		return std::make_shared<OcspContext>(ssl_ctx, cert);
+		return std::make_shared<OcspContext>(cert);
 	}
 
 	// Get the responder URL from certificate
@@ -162,8 +161,21 @@ namespace ov
 		return false;
 	}
 
+	bool OcspContext::RequestIfNeeded(SSL_CTX *ssl_ctx, X509 *cert)
+	{
+		LockGuard lock_guard(_request_mutex);
+
+		if (HasResponse())
+		{
+			logtt("Use cached OCSP response: %p", cert);
+			return true;
+		}
+
+		return Request(ssl_ctx, cert);
+	}
+
 	// Create a OCSP query for server certificate
-	bool OcspContext::Request(X509 *cert)
+	bool OcspContext::Request(SSL_CTX *ssl_ctx, X509 *cert)
 	{
 		logtt("Trying to query OCSP request to responder: %s", _url.c_str());
 
@@ -179,7 +191,7 @@ namespace ov
 
 		if (::X509_STORE_CTX_init(
 				store_ctx,
-				::SSL_CTX_get_cert_store(_ssl_ctx),
+				::SSL_CTX_get_cert_store(ssl_ctx),
 				nullptr, nullptr) == 0)
 		{
 			logte("Could not initialize store context");
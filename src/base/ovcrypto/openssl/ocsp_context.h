@@ -21,15 +21,19 @@ namespace ov
 	class OcspContext
 	{
 	public:
-		static std::shared_ptr<OcspContext> Create(SSL_CTX *ssl_ctx, X509 *cert);
+		static std::shared_ptr<OcspContext> Create(X509 *cert);
 
-		OcspContext(SSL_CTX *ssl_ctx, X509 *cert);
+		explicit OcspContext(X509 *cert);
 
 		// Get the responder URL from certificate
 		bool ParseOcspUrl(X509 *cert);
 
 		// Create a OCSP query for server certificate
-		bool Request(X509 *cert);
+		// (the issuer certificate is looked up in the certificate store of ssl_ctx)
+		bool Request(SSL_CTX *ssl_ctx, X509 *cert);
+		// Queries the responder unless a response has been received already. Only one thread
+		// queries at a time, and the others wait for its response rather than sending their own.
+		bool RequestIfNeeded(SSL_CTX *ssl_ctx, X509 *cert);
 
 		bool HasResponse() const;
 		const ov::RaiiPtr<OCSP_RESPONSE> &GetResponse();
@@ -86,7 +90,9 @@ namespace ov
 
 		bool _use_tls = false;
 
-		SSL_CTX *_ssl_ctx = nullptr;
+		// Serializes the queries to the responder
+		Mutex _request_mutex;
+
 		// Used to request to OCSP responder if the responder URL is HTTPS
 		ov::RaiiPtr<SSL_CTX> _ssl_request_ctx = {nullptr, ::SSL_CTX_free};
 
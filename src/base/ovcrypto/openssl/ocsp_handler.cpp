@@ -43,6 +43,19 @@ namespace ov
 		return true;
 	}
 
+	bool OcspHandler::Prefetch(SSL_CTX *ssl_ctx)
+	{
+		auto cert = ::SSL_CTX_get0_certificate(ssl_ctx);
+
+		if (cert == nullptr)
+		{
+			logtw("SSL context has no certificate");
+			return false;
+		}
+
+		return (_ocsp_cache.ContextForCert(ssl_ctx, cert) != nullptr);
+	}
+
 	int OcspHandler::OnOcspCallbackInternal(SSL *ssl)
 	{
 		RaiiPtr<OCSP_RESPONSE> ocsp_response(nullptr, ::OCSP_RESPONSE_free);
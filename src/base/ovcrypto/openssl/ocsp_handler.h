@@ -21,6 +21,10 @@ namespace ov
 	public:
 		bool Setup(SSL_CTX *ssl_ctx);
 
+		// Fetches the OCSP response of the certificate of ssl_ctx into the shared cache ahead of the
+		// first handshake. Returns false when the certificate needs a response and none was received.
+		static bool Prefetch(SSL_CTX *ssl_ctx);
+
 	protected:
 		int OnOcspCallbackInternal(SSL *ssl);
 		static int OnOcspCallback(SSL *s, void *arg);
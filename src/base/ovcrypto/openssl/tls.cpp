@@ -199,12 +199,17 @@ namespace ov
 			return -1;
 		}
 
+		LockGuard lock(_ssl_lock);
+
+		auto cpu_time_us = GetThreadCpuTimeUs();
 		int result = ::SSL_accept(_ssl);
+		_handshake_cpu_time_us += GetThreadCpuTimeUs() - cpu_time_us;
 
 		switch (result)
 		{
 			case 1: {
 				// The TLS/SSL handshake was successfully completed, a TLS/SSL connection has been established.
+				OnHandshakeCompleted();
 				return SSL_ERROR_NONE;
 			}
 
@@ -239,6 +244,125 @@ namespace ov
 		return error;
 	}
 
+	bool Tls::IsEarlyDataEnabled() const
+	{
+		OV_ASSERT2(_ssl != nullptr);
+
+		return (::SSL_get_max_early_data(_ssl) > 0);
+	}
+
+	bool Tls::IsEarlyDataAccepted() const
+	{
+		OV_ASSERT2(_ssl != nullptr);
+
+		return (::SSL_get_early_data_status(_ssl) == SSL_EARLY_DATA_ACCEPTED);
+	}
+
+	// https://www.openssl.org/docs/man3.0/man3/SSL_read_early_data.html
+	int Tls::ReadEarlyData(const std::shared_ptr<Data> &early_data)
+	{
+		OV_ASSERT2(_ssl != nullptr);
+
+		LockGuard lock(_ssl_lock);
+
+		unsigned char buf[1024];
+
+		while (true)
+		{
+			size_t read_bytes = 0;
+
+			auto cpu_time_us = GetThreadCpuTimeUs();
+			int result = ::SSL_read_early_data(_ssl, buf, OV_COUNTOF(buf), &read_bytes);
+			_handshake_cpu_time_us += GetThreadCpuTimeUs() - cpu_time_us;
+
+			if ((read_bytes > 0) && (early_data->Append(buf, read_bytes) == false))
+			{
+				OV_ASSERT2(false);
+				return SSL_ERROR_SSL;
+			}
+
+			switch (result)
+			{
+				case SSL_READ_EARLY_DATA_SUCCESS:
+					// There may be more early data
+					break;
+
+				case SSL_READ_EARLY_DATA_FINISH:
+					// The handshake continues with Accept()
+					return SSL_ERROR_NONE;
+
+				case SSL_READ_EARLY_DATA_ERROR:
+				default:
+					return GetError(0);
+			}
+		}
+	}
+
+	int Tls::WriteEarlyData(const std::shared_ptr<const Data> &data, size_t *written_bytes)
+	{
+		OV_ASSERT2(_ssl != nullptr);
+
+		LockGuard lock(_ssl_lock);
+
+		size_t write_size = 0;
+
+		while (write_size < data->GetLength())
+		{
+			size_t written = 0;
+
+			if (::SSL_write_early_data(_ssl, data->GetDataAs<uint8_t>() + write_size, data->GetLength() - write_size, &written) != 1)
+			{
+				return GetError(0);
+			}
+
+			write_size += written;
+		}
+
+		if (written_bytes != nullptr)
+		{
+			*written_bytes += write_size;
+		}
+
+		return SSL_ERROR_NONE;
+	}
+
+	bool Tls::IsSessionReused() const
+	{
+		OV_ASSERT2(_ssl != nullptr);
+
+		return (::SSL_session_reused(_ssl) == 1);
+	}
+
+	int64_t Tls::GetThreadCpuTimeUs()
+	{
+		struct timespec ts;
+
+		if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+		{
+			return 0;
+		}
+
+		return (static_cast<int64_t>(ts.tv_sec) * 1000000) + (ts.tv_nsec / 1000);
+	}
+
+	void Tls::OnHandshakeCompleted()
+	{
+		// Collect the statistics into the virtual host selected by SNI
+		auto ticket_keys = TlsContext::GetTicketKeys(::SSL_get_SSL_CTX(_ssl));
+
+		if (ticket_keys == nullptr)
+		{
+			return;
+		}
+
+		ticket_keys->RecordHandshake(IsSessionReused(), _handshake_cpu_time_us);
+
+		if (IsEarlyDataAccepted())
+		{
+			ticket_keys->RecordEarlyDataAccepted();
+		}
+	}
+
 	std::shared_ptr<const OpensslError> Tls::Connect()
 	{
 		if (_ssl == nullptr)
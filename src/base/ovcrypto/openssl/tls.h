@@ -27,6 +27,20 @@ namespace ov
 		// @return Returns SSL_ERROR_NONE on success
 		int Accept();
 
+		// Whether the context accepts TLS 1.3 early data (0-RTT)
+		bool IsEarlyDataEnabled() const;
+		bool IsEarlyDataAccepted() const;
+
+		// Reads the early data of a resumed session into <early_data> before calling Accept()
+		// @return Returns SSL_ERROR_NONE when all early data has been read (or there is no early data)
+		int ReadEarlyData(const std::shared_ptr<Data> &early_data);
+
+		// Sends data before the handshake is completed, while early data has been accepted (0.5-RTT data)
+		// @return Returns SSL_ERROR_NONE on success
+		int WriteEarlyData(const std::shared_ptr<const Data> &data, size_t *written_bytes);
+
+		bool IsSessionReused() const;
+
 		void Shutdown();
 
 		std::shared_ptr<const OpensslError> Connect();
@@ -100,6 +114,9 @@ namespace ov
 
 		int GetError(int code);
 
+		static int64_t GetThreadCpuTimeUs();
+		void OnHandshakeCompleted();
+
 	protected:
 		bool _is_nonblocking	= false;
 
@@ -110,6 +127,9 @@ namespace ov
 
 		TlsBioCallback _callback;
 
+		// CPU time spent by the handshake so far
+		int64_t _handshake_cpu_time_us = 0;
+
 		Mutex _ssl_lock;
 	};
 }  // namespace ov
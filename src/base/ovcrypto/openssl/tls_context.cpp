@@ -8,9 +8,20 @@
 //==============================================================================
 #include "tls_context.h"
 
+#include <openssl/core_names.h>
+#include <openssl/rand.h>
+
+#include "../message_digest.h"
 #include "./openssl_private.h"
 #include "./tls.h"
 
+// The session ID context of a context without ticket keys. The contexts of a virtual host use the digest of its name,
+// so that OpenSSL resumes a session only on the virtual host it was created on.
+#define OV_TLS_SESSION_ID_CONTEXT "OvenMediaEngine"
+
+// The size of early data accepted in a resumed session (the same as a TLS record)
+#define OV_TLS_MAX_EARLY_DATA_SIZE 16384
+
 #define DO_CALLBACK_IF_AVAILABLE(return_type, default_value, tls_context, callback_name, ...) \
 	DoCallback<return_type, default_value, decltype(&TlsContextCallback::callback_name), &TlsContextCallback::callback_name>(tls_context, ##__VA_ARGS__)
 
@@ -29,6 +40,7 @@ namespace ov
 		const ov::String &cipher_list,
 		bool enable_h2_alpn,
 		bool enable_ocsp_staping,
+		const TlsSessionResumption *session_resumption,
 		const ov::TlsContextCallback *callback,
 		std::shared_ptr<const ov::Error> *error)
 	{
@@ -44,6 +56,7 @@ namespace ov
 				cipher_list,
 				enable_h2_alpn,
 				enable_ocsp_staping,
+				session_resumption,
 				callback);
 		}
 		catch (const OpensslError &e)
@@ -59,6 +72,38 @@ namespace ov
 		return context;
 	}
 
+	bool TlsContext::PrefetchOcspResponse(const std::shared_ptr<const ::Certificate> &certificate)
+	{
+		if (certificate == nullptr)
+		{
+			return false;
+		}
+
+		// The context only lends its certificate store to the query - the response is kept in the
+		// cache that every context of the certificate looks up
+		auto context = std::make_shared<TlsContext>();
+
+		context->_ssl_ctx = ::SSL_CTX_new(::TLS_server_method());
+
+		if (context->_ssl_ctx == nullptr)
+		{
+			logte("Cannot create SSL context");
+			return false;
+		}
+
+		try
+		{
+			context->SetCertificate(certificate);
+		}
+		catch (const OpensslError &error)
+		{
+			logte("Could not prefetch OCSP response: %s", error.What());
+			return false;
+		}
+
+		return OcspHandler::Prefetch(context->_ssl_ctx);
+	}
+
 	std::shared_ptr<TlsContext> TlsContext::CreateClientContext(
 		std::shared_ptr<const ov::Error> *error)
 	{
@@ -87,6 +132,7 @@ namespace ov
 		const ov::String &cipher_list,
 		bool enable_h2_alpn,
 		bool enable_ocsp_staping,
+		const TlsSessionResumption *session_resumption,
 		const TlsContextCallback *callback)
 	{
 		_h2_alpn_enabled = enable_h2_alpn;
@@ -129,17 +175,9 @@ namespace ov
 			// https://wiki.mozilla.org/Security/Server_Side_TLS
 			::SSL_CTX_set_cipher_list(ssl_ctx, cipher_list.CStr());
 
-			if (enable_h2_alpn == true)
-			{
-				// Now, only enable TLS 1.3 for HTTP/2
-				::SSL_CTX_set_max_proto_version(ssl_ctx, TLS1_3_VERSION);
-			}
-			else
-			{
-				// Disable TLS1.3 because it is not yet supported properly by the HTTP server implementation (HTTP2 support, Session tickets, ...)
-				// This also allows for using less secure cipher suites for lower CPU requirements when using HLS/DASH/LL-DASH streaming
-				::SSL_CTX_set_max_proto_version(ssl_ctx, TLS1_2_VERSION);
-			}
+			// Enable TLS 1.3 for both HTTP/1.1 and HTTP/2 - its handshake takes one round trip less than TLS 1.2.
+			// cipher_list only applies up to TLS 1.2, TLS 1.3 uses the default cipher suites of OpenSSL.
+			::SSL_CTX_set_max_proto_version(ssl_ctx, TLS1_3_VERSION);
 			// Disable old TLS versions which are neither secure nor needed any more
 			::SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_2_VERSION);
 
@@ -178,17 +216,163 @@ namespace ov
 
 			if (_callback.sni_callback != nullptr)
 			{
-				// Use SNI
-				::SSL_CTX_set_tlsext_servername_callback(_ssl_ctx, OnServerNameCallback);
-				::SSL_CTX_set_tlsext_servername_arg(_ssl_ctx, this);
+				// Use SNI. The context is selected from ClientHello rather than by the servername callback, which
+				// OpenSSL calls after a session ticket has been decrypted with the keys of the initial context.
+				::SSL_CTX_set_client_hello_cb(_ssl_ctx, OnClientHelloCallback, this);
 			}
 
 			// Use ALPN
 			::SSL_CTX_set_alpn_select_cb(_ssl_ctx, OnALPNSelectCallback, this);
 
+			SetupSessionResumption(session_resumption);
 		} while (false);
 	}
 
+	void TlsContext::SetupSessionResumption(const TlsSessionResumption *session_resumption)
+	{
+		if (session_resumption == nullptr)
+		{
+			return;
+		}
+
+		auto &ticket_keys = session_resumption->ticket_keys;
+
+		uint8_t session_id_context[SSL_MAX_SID_CTX_LENGTH];
+		static_assert(sizeof(session_id_context) == 32, "The digest of SHA-256 is used as the session ID context");
+
+		if ((ticket_keys != nullptr) &&
+			MessageDigest::ComputeDigest(CryptoAlgorithm::Sha256, ticket_keys->GetName().CStr(), ticket_keys->GetName().GetLength(), session_id_context, sizeof(session_id_context)))
+		{
+			// OpenSSL refuses to resume a session (from a ticket or its cache) of another session ID context, so a session
+			// never crosses into another virtual host
+			::SSL_CTX_set_session_id_context(_ssl_ctx, session_id_context, sizeof(session_id_context));
+		}
+		else
+		{
+			::SSL_CTX_set_session_id_context(_ssl_ctx, reinterpret_cast<const unsigned char *>(OV_TLS_SESSION_ID_CONTEXT), OV_COUNTOF(OV_TLS_SESSION_ID_CONTEXT) - 1);
+		}
+
+		if (ticket_keys != nullptr)
+		{
+			// Freed with the SSL_CTX, which may outlive this instance while a session still refers to it
+			::SSL_CTX_set_ex_data(_ssl_ctx, GetTicketKeysIndex(), new std::shared_ptr<TlsTicketKeys>(ticket_keys));
+		}
+
+		if (session_resumption->enable_session_ticket && (ticket_keys != nullptr))
+		{
+			// Tickets are valid while their key can decrypt them
+			::SSL_CTX_set_timeout(_ssl_ctx, std::max(ticket_keys->GetRotationInterval() / 1000, static_cast<int64_t>(1)));
+		}
+		else
+		{
+			// Fall back to the session cache of OpenSSL
+			::SSL_CTX_set_options(_ssl_ctx, SSL_OP_NO_TICKET);
+		}
+
+		// OpenSSL calls the callback of the context the SSL was created with, even after SNI has selected another one,
+		// so it is registered to every context and takes the keys of the context selected by SNI
+		::SSL_CTX_set_tlsext_ticket_key_evp_cb(_ssl_ctx, OnTicketKeyCallback);
+
+		if (session_resumption->enable_early_data)
+		{
+			// Unless SSL_OP_NO_ANTI_REPLAY is set, OpenSSL issues stateful tickets while early data is enabled and
+			// accepts early data once per ticket. These tickets can only be resumed in this process.
+			::SSL_CTX_set_max_early_data(_ssl_ctx, OV_TLS_MAX_EARLY_DATA_SIZE);
+			::SSL_CTX_set_recv_max_early_data(_ssl_ctx, OV_TLS_MAX_EARLY_DATA_SIZE);
+		}
+	}
+
+	int TlsContext::GetTicketKeysIndex()
+	{
+		static int index = ::SSL_CTX_get_ex_new_index(
+			0, nullptr, nullptr, nullptr,
+			[](void *parent, void *ptr, CRYPTO_EX_DATA *ad, int idx, long argl, void *argp) {
+				delete static_cast<std::shared_ptr<TlsTicketKeys> *>(ptr);
+			});
+
+		return index;
+	}
+
+	std::shared_ptr<TlsTicketKeys> TlsContext::GetTicketKeys(const SSL_CTX *ssl_context)
+	{
+		if (ssl_context == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto ticket_keys = static_cast<std::shared_ptr<TlsTicketKeys> *>(::SSL_CTX_get_ex_data(ssl_context, GetTicketKeysIndex()));
+
+		return (ticket_keys != nullptr) ? *ticket_keys : nullptr;
+	}
+
+	bool TlsContext::SetTicketMacKey(EVP_MAC_CTX *mac_context, const TlsTicketKeys::Key &key)
+	{
+		OSSL_PARAM params[] = {
+			::OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<uint8_t *>(key.hmac_key), sizeof(key.hmac_key)),
+			::OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char *>("SHA256"), 0),
+			::OSSL_PARAM_construct_end()};
+
+		return (::EVP_MAC_CTX_set_params(mac_context, params) == 1);
+	}
+
+	// https://www.openssl.org/docs/man3.0/man3/SSL_CTX_set_tlsext_ticket_key_evp_cb.html
+	int TlsContext::OnTicketKeyCallback(SSL *ssl, unsigned char key_name[16], unsigned char iv[EVP_MAX_IV_LENGTH], EVP_CIPHER_CTX *cipher_context, EVP_MAC_CTX *mac_context, int enc)
+	{
+		TlsTicketKeys::Key key;
+		const EVP_CIPHER *cipher = ::EVP_aes_256_cbc();
+
+		// The context of the virtual host has been selected by OnClientHello() before a ticket is decrypted
+		auto ticket_keys = GetTicketKeys(::SSL_get_SSL_CTX(ssl));
+
+		if (ticket_keys == nullptr)
+		{
+			// Do not issue a ticket, or do a full handshake
+			return 0;
+		}
+
+		if (enc == 1)
+		{
+			if (ticket_keys->GetEncryptionKey(&key) == false)
+			{
+				// Do not issue a ticket
+				return 0;
+			}
+
+			if (::RAND_bytes(iv, ::EVP_CIPHER_get_iv_length(cipher)) != 1)
+			{
+				return -1;
+			}
+
+			::memcpy(key_name, key.name, sizeof(key.name));
+
+			if ((::EVP_EncryptInit_ex(cipher_context, cipher, nullptr, key.aes_key, iv) != 1) ||
+				(SetTicketMacKey(mac_context, key) == false))
+			{
+				return -1;
+			}
+
+			return 1;
+		}
+
+		// A ticket of another virtual host is not found in the keys of this one
+		auto state = ticket_keys->FindDecryptionKey(key_name, &key);
+
+		if (state == TlsTicketKeys::KeyState::NotFound)
+		{
+			// Unknown or expired key - do a full handshake
+			return 0;
+		}
+
+		if ((::EVP_DecryptInit_ex(cipher_context, cipher, nullptr, key.aes_key, iv) != 1) ||
+			(SetTicketMacKey(mac_context, key) == false))
+		{
+			return -1;
+		}
+
+		// Ask OpenSSL to issue a new ticket with the current key
+		return (state == TlsTicketKeys::KeyState::Previous) ? 2 : 1;
+	}
+
 	void TlsContext::Prepare(
 		const SSL_METHOD *method,
 		const TlsContextCallback *callback)
@@ -279,15 +463,42 @@ namespace ov
 		return false;
 	}
 
-	int TlsContext::OnServerNameCallback(SSL *s, int *ad, void *arg)
+	int TlsContext::OnClientHelloCallback(SSL *ssl, int *al, void *arg)
 	{
-		return static_cast<TlsContext *>(arg)->OnServerName(s);
+		return static_cast<TlsContext *>(arg)->OnClientHello(ssl);
+	}
+
+	ov::String TlsContext::GetServerNameFromClientHello(SSL *ssl)
+	{
+		const unsigned char *data = nullptr;
+		size_t length = 0;
+
+		if (::SSL_client_hello_get0_ext(ssl, TLSEXT_TYPE_server_name, &data, &length) != 1)
+		{
+			return "";
+		}
+
+		// ServerNameList (RFC 6066): list length (2), name type (1), name length (2), name
+		if ((length < 5) || ((static_cast<size_t>(data[0] << 8) | data[1]) != (length - 2)) || (data[2] != TLSEXT_NAMETYPE_host_name))
+		{
+			return "";
+		}
+
+		auto name_length = static_cast<size_t>(data[3] << 8) | data[4];
+
+		if ((name_length == 0) || (name_length > (length - 5)))
+		{
+			return "";
+		}
+
+		return ov::String(reinterpret_cast<const char *>(data + 5), name_length);
 	}
 
-	// https://www.openssl.org/docs/man1.1.1/man3/SSL_CTX_set_tlsext_servername_callback.html
-	int TlsContext::OnServerName(SSL *ssl)
+	// https://www.openssl.org/docs/man3.0/man3/SSL_CTX_set_client_hello_cb.html
+	int TlsContext::OnClientHello(SSL *ssl)
 	{
-		ov::String server_name = ::SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+		// SSL_get_servername() is not available until the extensions are parsed, after this callback
+		auto server_name = GetServerNameFromClientHello(ssl);
 
 		if (server_name.IsEmpty() == false)
 		{
@@ -304,7 +515,7 @@ namespace ov
 			logtt("Server name is not specified");
 		}
 
-		return SSL_TLSEXT_ERR_OK;
+		return SSL_CLIENT_HELLO_SUCCESS;
 	}
 
 	void TlsContext::SetCertificate(const std::shared_ptr<const ::Certificate> &certificate)
@@ -336,7 +547,25 @@ namespace ov
 
 	bool TlsContext::UseSslContext(SSL *ssl)
 	{
-		return (::SSL_set_SSL_CTX(ssl, _ssl_ctx) != nullptr);
+		if (::SSL_set_SSL_CTX(ssl, _ssl_ctx) == nullptr)
+		{
+			return false;
+		}
+
+		// SSL_new() copies these from the initial context, and SSL_set_SSL_CTX() does not update them
+		if (::SSL_CTX_get_options(_ssl_ctx) & SSL_OP_NO_TICKET)
+		{
+			::SSL_set_options(ssl, SSL_OP_NO_TICKET);
+		}
+		else
+		{
+			::SSL_clear_options(ssl, SSL_OP_NO_TICKET);
+		}
+
+		::SSL_set_max_early_data(ssl, ::SSL_CTX_get_max_early_data(_ssl_ctx));
+		::SSL_set_recv_max_early_data(ssl, ::SSL_CTX_get_recv_max_early_data(_ssl_ctx));
+
+		return true;
 	}
 
 	void TlsContext::SetVerify(int mode)
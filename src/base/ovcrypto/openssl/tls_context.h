@@ -12,6 +12,7 @@
 #include "./ocsp_handler.h"
 #include "./openssl_error.h"
 #include "./tls_context_callback.h"
+#include "./tls_ticket_keys.h"
 
 namespace ov
 {
@@ -23,6 +24,17 @@ namespace ov
 		Tls
 	};
 
+	struct TlsSessionResumption
+	{
+		// Keys shared by every context of the virtual host. Handshake statistics are also collected here.
+		std::shared_ptr<TlsTicketKeys> ticket_keys;
+
+		// Use stateless session tickets encrypted with <ticket_keys>
+		bool enable_session_ticket = true;
+		// Accept TLS 1.3 early data (0-RTT) from resumed sessions. Early data can be replayed by an attacker.
+		bool enable_early_data = false;
+	};
+
 	// A wrapper of SSL_CTX
 	class TlsContext
 	{
@@ -35,10 +47,16 @@ namespace ov
 			const ov::String &cipher_list,
 			bool enable_h2_alpn,
 			bool enable_ocsp_staping,
+			// nullptr to use the default session cache of OpenSSL
+			const TlsSessionResumption *session_resumption,
 			const ov::TlsContextCallback *callback,
 			// output param
 			std::shared_ptr<const ov::Error> *error);
 
+		// Fetches the OCSP response of the certificate, so the first handshake does not wait for the
+		// responder. A certificate without OCSP stapling needs no response and succeeds as it is.
+		static bool PrefetchOcspResponse(const std::shared_ptr<const ::Certificate> &certificate);
+
 		static std::shared_ptr<TlsContext> CreateClientContext(
 			// output param
 			std::shared_ptr<const ov::Error> *error);
@@ -55,6 +73,9 @@ namespace ov
 
 		bool UseSslContext(SSL *ssl);
 
+		// Returns the ticket keys of the virtual host the context was created for
+		static std::shared_ptr<TlsTicketKeys> GetTicketKeys(const SSL_CTX *ssl_context);
+
 		void SetVerify(int mode);
 
 	protected:
@@ -65,6 +86,7 @@ namespace ov
 			const ov::String &cipher_list,
 			bool enable_h2_alpn,
 			bool enable_ocsp_staping,
+			const TlsSessionResumption *session_resumption,
 			const TlsContextCallback *callback);
 
 		MAY_THROWS(ov::OpensslError)
@@ -92,12 +114,19 @@ namespace ov
 			return default_value;
 		}
 
-		static int OnServerNameCallback(SSL *s, int *ad, void *arg);
-		int OnServerName(SSL *ssl);
+		static int OnClientHelloCallback(SSL *ssl, int *al, void *arg);
+		static ov::String GetServerNameFromClientHello(SSL *ssl);
+		int OnClientHello(SSL *ssl);
 
 		static int OnALPNSelectCallback(SSL *ssl, const unsigned char **out, unsigned char *outlen, const unsigned char *in, unsigned int inlen, void *arg);
 		static bool SelectALPNProtocol(ov::String key, const unsigned char **out, unsigned char *outlen, const unsigned char *in, unsigned int inlen);
 
+		void SetupSessionResumption(const TlsSessionResumption *session_resumption);
+
+		static int GetTicketKeysIndex();
+		static int OnTicketKeyCallback(SSL *ssl, unsigned char key_name[16], unsigned char iv[EVP_MAX_IV_LENGTH], EVP_CIPHER_CTX *cipher_context, EVP_MAC_CTX *mac_context, int enc);
+		static bool SetTicketMacKey(EVP_MAC_CTX *mac_context, const TlsTicketKeys::Key &key);
+
 		MAY_THROWS(ov::OpensslError)
 		void SetCertificate(const std::shared_ptr<const ::Certificate> &certificate);
 
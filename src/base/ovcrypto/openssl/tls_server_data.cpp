@@ -25,6 +25,7 @@ namespace ov
 		if (result)
 		{
 			_state = State::WaitingForAccept;
+			_reading_early_data = _tls.IsEarlyDataEnabled();
 		}
 		else
 		{
@@ -78,7 +79,53 @@ namespace ov
 					OV_ASSERT2(false);
 					return false;
 
-				case State::WaitingForAccept: {
+				case State::WaitingForAccept:
+				case State::EarlyDataAccepted: {
+					if (_reading_early_data)
+					{
+						logtt("Trying to read early data...");
+
+						auto early_data = std::make_shared<Data>();
+						int result = _tls.ReadEarlyData(early_data);
+
+						if ((_state == State::WaitingForAccept) && _tls.IsEarlyDataAccepted())
+						{
+							logtt("Early data is accepted");
+							_state = State::EarlyDataAccepted;
+						}
+
+						if (early_data->IsEmpty() == false)
+						{
+							if (decrypted != nullptr)
+							{
+								decrypted->Append(early_data);
+							}
+							else
+							{
+								decrypted = early_data;
+							}
+						}
+
+						switch (result)
+						{
+							case SSL_ERROR_NONE:
+								// Continue the handshake
+								_reading_early_data = false;
+								break;
+
+							case SSL_ERROR_WANT_READ:
+								logtt("Need more data to read early data");
+								stop = true;
+								break;
+
+							default:
+								logtt("An error occurred while read early data: error code: %d", result);
+								return false;
+						}
+
+						break;
+					}
+
 					logtt("Trying to accept TLS...");
 
 					int result = _tls.Accept();
@@ -148,6 +195,22 @@ namespace ov
 
 	bool TlsServerData::Encrypt(const std::shared_ptr<const Data> &plain_data, std::shared_ptr<const Data> *cipher_data)
 	{
+		if (_state == State::EarlyDataAccepted)
+		{
+			// 0.5-RTT data is sent through the write callback as the handshake messages are
+			size_t written_bytes = 0;
+			auto result = _tls.WriteEarlyData(plain_data, &written_bytes);
+
+			if (result == SSL_ERROR_NONE)
+			{
+				*cipher_data = nullptr;
+				return true;
+			}
+
+			logtt("An error occurred while encrypting early data: data_len(%zu), error code: %d", plain_data->GetLength(), result);
+			return false;
+		}
+
 		if (_state != State::Accepted)
 		{
 			// Before encrypting data, key exchange must be done first
@@ -229,7 +292,7 @@ namespace ov
 
 	ssize_t TlsServerData::OnTlsWrite(Tls *tls, const void *data, size_t length)
 	{
-		if (_state == State::WaitingForAccept)
+		if ((_state == State::WaitingForAccept) || (_state == State::EarlyDataAccepted))
 		{
 			if (_write_callback != nullptr)
 			{
@@ -22,6 +22,9 @@ namespace ov
 		{
 			Invalid,
 			WaitingForAccept,
+			// The handshake is in progress, but the early data of a resumed session has been accepted,
+			// so data can be exchanged before the client finishes the handshake
+			EarlyDataAccepted,
 			Accepted,
 		};
 
@@ -94,6 +97,7 @@ namespace ov
 
 	protected:
 		State _state = State::Invalid;
+		bool _reading_early_data = false;
 
 		ov::String _server_name;
 
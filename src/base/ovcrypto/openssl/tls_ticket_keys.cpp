@@ -0,0 +1,192 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "tls_ticket_keys.h"
+
+#include <openssl/rand.h>
+
+#include "./openssl_private.h"
+
+namespace ov
+{
+	TlsTicketKeys::TlsTicketKeys(const ov::String &name, int64_t rotation_interval_ms)
+		: _name(name),
+		  _rotation_interval_ms(std::max(rotation_interval_ms, static_cast<int64_t>(1)))
+	{
+	}
+
+	void TlsTicketKeys::SetRotationInterval(int64_t rotation_interval_ms)
+	{
+		LockGuard lock_guard(_key_mutex);
+		_rotation_interval_ms = std::max(rotation_interval_ms, static_cast<int64_t>(1));
+	}
+
+	int64_t TlsTicketKeys::GetRotationInterval() const
+	{
+		LockGuard lock_guard(_key_mutex);
+		return _rotation_interval_ms;
+	}
+
+	bool TlsTicketKeys::RotateIfNeeded(int64_t now_ms)
+	{
+		if (_key_list.empty() || ((now_ms - _key_list.front().created_time_ms) >= _rotation_interval_ms))
+		{
+			Key key;
+
+			if ((::RAND_bytes(key.name, sizeof(key.name)) != 1) ||
+				(::RAND_bytes(key.aes_key, sizeof(key.aes_key)) != 1) ||
+				(::RAND_bytes(key.hmac_key, sizeof(key.hmac_key)) != 1))
+			{
+				logte("Could not generate a session ticket key for %s", _name.CStr());
+
+				if (_key_list.empty())
+				{
+					return false;
+				}
+
+				// Keep using the current key
+			}
+			else
+			{
+				key.created_time_ms = now_ms;
+
+				if (_key_list.empty() == false)
+				{
+					_key_rotations++;
+					logtd("Session ticket key of %s has been rotated", _name.CStr());
+				}
+
+				_key_list.push_front(key);
+			}
+		}
+
+		// Drop the keys that can no longer decrypt a valid ticket
+		while ((_key_list.size() > 1) && ((now_ms - _key_list.back().created_time_ms) >= (_rotation_interval_ms * 2)))
+		{
+			_key_list.pop_back();
+		}
+
+		return true;
+	}
+
+	bool TlsTicketKeys::GetEncryptionKey(Key *key)
+	{
+		return GetEncryptionKey(static_cast<int64_t>(Clock::NowMSec()), key);
+	}
+
+	bool TlsTicketKeys::GetEncryptionKey(int64_t now_ms, Key *key)
+	{
+		LockGuard lock_guard(_key_mutex);
+
+		if (RotateIfNeeded(now_ms) == false)
+		{
+			return false;
+		}
+
+		*key = _key_list.front();
+
+		return true;
+	}
+
+	TlsTicketKeys::KeyState TlsTicketKeys::FindDecryptionKey(const uint8_t name[16], Key *key)
+	{
+		return FindDecryptionKey(static_cast<int64_t>(Clock::NowMSec()), name, key);
+	}
+
+	TlsTicketKeys::KeyState TlsTicketKeys::FindDecryptionKey(int64_t now_ms, const uint8_t name[16], Key *key)
+	{
+		LockGuard lock_guard(_key_mutex);
+
+		if (RotateIfNeeded(now_ms) == false)
+		{
+			return KeyState::NotFound;
+		}
+
+		for (size_t index = 0; index < _key_list.size(); index++)
+		{
+			const auto &candidate = _key_list[index];
+
+			if (::memcmp(candidate.name, name, sizeof(candidate.name)) == 0)
+			{
+				*key = candidate;
+				return (index == 0) ? KeyState::Current : KeyState::Previous;
+			}
+		}
+
+		return KeyState::NotFound;
+	}
+
+	void TlsTicketKeys::RecordHandshake(bool resumed, int64_t cpu_time_us)
+	{
+		auto cpu_time = static_cast<uint64_t>(std::max(cpu_time_us, static_cast<int64_t>(0)));
+
+		if (resumed)
+		{
+			_resumed_handshakes++;
+			_resumed_handshake_cpu_time_us += cpu_time;
+		}
+		else
+		{
+			_full_handshakes++;
+			_full_handshake_cpu_time_us += cpu_time;
+		}
+	}
+
+	void TlsTicketKeys::RecordEarlyDataAccepted()
+	{
+		_early_data_accepted++;
+	}
+
+	TlsTicketKeys::Stats TlsTicketKeys::GetStats() const
+	{
+		Stats stats;
+
+		stats.name = _name;
+		stats.full_handshakes = _full_handshakes;
+		stats.resumed_handshakes = _resumed_handshakes;
+		stats.full_handshake_cpu_time_us = _full_handshake_cpu_time_us;
+		stats.resumed_handshake_cpu_time_us = _resumed_handshake_cpu_time_us;
+		stats.early_data_accepted = _early_data_accepted;
+		stats.key_rotations = _key_rotations;
+
+		return stats;
+	}
+
+	std::shared_ptr<TlsTicketKeys> TlsTicketKeyManager::GetKeys(const ov::String &name, int64_t rotation_interval_ms)
+	{
+		LockGuard lock_guard(_keys_map_mutex);
+
+		auto item = _keys_map.find(name);
+
+		if (item != _keys_map.end())
+		{
+			// The interval may have been changed by reloading the configuration
+			item->second->SetRotationInterval(rotation_interval_ms);
+			return item->second;
+		}
+
+		auto keys = std::make_shared<TlsTicketKeys>(name, rotation_interval_ms);
+		_keys_map.emplace(name, keys);
+
+		return keys;
+	}
+
+	std::vector<TlsTicketKeys::Stats> TlsTicketKeyManager::GetStats() const
+	{
+		std::vector<TlsTicketKeys::Stats> stats_list;
+
+		LockGuard lock_guard(_keys_map_mutex);
+
+		for (const auto &[name, keys] : _keys_map)
+		{
+			stats_list.push_back(keys->GetStats());
+		}
+
+		return stats_list;
+	}
+}  // namespace ov
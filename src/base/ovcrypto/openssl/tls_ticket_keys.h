@@ -0,0 +1,117 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <deque>
+
+namespace ov
+{
+	// Session ticket keys of a virtual host, shared by every SSL_CTX created for it,
+	// and the handshake statistics of the connections using them.
+	//
+	// A new key is generated when the current one is older than the rotation interval.
+	// Tickets are issued with a lifetime of one interval, so a key is kept for
+	// decryption until it is two intervals old.
+	class TlsTicketKeys
+	{
+	public:
+		struct Key
+		{
+			uint8_t name[16];
+			uint8_t aes_key[32];
+			uint8_t hmac_key[32];
+
+			int64_t created_time_ms = 0;
+		};
+
+		enum class KeyState
+		{
+			// The key name is unknown or the key has expired
+			NotFound,
+			// Encrypted with the current key
+			Current,
+			// Encrypted with a previous key - the ticket should be renewed
+			Previous
+		};
+
+		struct Stats
+		{
+			ov::String name;
+
+			uint64_t full_handshakes = 0;
+			uint64_t resumed_handshakes = 0;
+			uint64_t full_handshake_cpu_time_us = 0;
+			uint64_t resumed_handshake_cpu_time_us = 0;
+			uint64_t early_data_accepted = 0;
+			uint64_t key_rotations = 0;
+
+			double GetResumptionHitRate() const
+			{
+				auto total = full_handshakes + resumed_handshakes;
+				return (total > 0) ? (static_cast<double>(resumed_handshakes) / static_cast<double>(total)) : 0.0;
+			}
+		};
+
+		TlsTicketKeys(const ov::String &name, int64_t rotation_interval_ms);
+
+		const ov::String &GetName() const
+		{
+			return _name;
+		}
+
+		void SetRotationInterval(int64_t rotation_interval_ms);
+		int64_t GetRotationInterval() const;
+
+		// Returns the key to issue a new ticket with, rotating the keys if the current key is old
+		bool GetEncryptionKey(Key *key);
+		bool GetEncryptionKey(int64_t now_ms, Key *key);
+
+		KeyState FindDecryptionKey(const uint8_t name[16], Key *key);
+		KeyState FindDecryptionKey(int64_t now_ms, const uint8_t name[16], Key *key);
+
+		void RecordHandshake(bool resumed, int64_t cpu_time_us);
+		void RecordEarlyDataAccepted();
+
+		Stats GetStats() const;
+
+	protected:
+		bool RotateIfNeeded(int64_t now_ms) OV_REQUIRES(_key_mutex);
+
+	protected:
+		ov::String _name;
+
+		mutable Mutex _key_mutex;
+		int64_t _rotation_interval_ms OV_GUARDED_BY(_key_mutex);
+		// The newest key is at the front
+		std::deque<Key> _key_list OV_GUARDED_BY(_key_mutex);
+
+		std::atomic<uint64_t> _full_handshakes{0};
+		std::atomic<uint64_t> _resumed_handshakes{0};
+		std::atomic<uint64_t> _full_handshake_cpu_time_us{0};
+		std::atomic<uint64_t> _resumed_handshake_cpu_time_us{0};
+		std::atomic<uint64_t> _early_data_accepted{0};
+		std::atomic<uint64_t> _key_rotations{0};
+	};
+
+	class TlsTicketKeyManager : public Singleton<TlsTicketKeyManager>
+	{
+	public:
+		// Returns the keys of <name>, creating them if they do not exist yet
+		std::shared_ptr<TlsTicketKeys> GetKeys(const ov::String &name, int64_t rotation_interval_ms);
+
+		std::vector<TlsTicketKeys::Stats> GetStats() const;
+
+	protected:
+		mutable Mutex _keys_map_mutex;
+		std::map<ov::String, std::shared_ptr<TlsTicketKeys>> _keys_map OV_GUARDED_BY(_keys_map_mutex);
+	};
+}  // namespace ov
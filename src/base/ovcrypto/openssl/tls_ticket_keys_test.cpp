@@ -0,0 +1,395 @@
+//==============================================================================
+//
+//  OvenMediaEngine - Unit Tests
+//
+//  Covers: ov::TlsTicketKeys (key rotation and lookup) and session resumption
+//  of TlsServerData between the contexts of a virtual host, but not across
+//  virtual hosts.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <base/ovcrypto/ovcrypto.h>
+
+namespace
+{
+	constexpr int64_t kRotationIntervalMs = 60 * 1000;
+
+	// A TLS client on memory BIOs talking to TlsServerData
+	class TlsTestClient
+	{
+	public:
+		explicit TlsTestClient(SSL_CTX *client_context, const char *server_name = nullptr)
+		{
+			_ssl = ::SSL_new(client_context);
+
+			if (server_name != nullptr)
+			{
+				::SSL_set_tlsext_host_name(_ssl, server_name);
+			}
+
+			_read_bio = ::BIO_new(::BIO_s_mem());
+			_write_bio = ::BIO_new(::BIO_s_mem());
+
+			::SSL_set_bio(_ssl, _read_bio, _write_bio);
+			::SSL_set_connect_state(_ssl);
+		}
+
+		~TlsTestClient()
+		{
+			// Without close_notify, SSL_free() marks the session as not resumable
+			::SSL_shutdown(_ssl);
+			::SSL_free(_ssl);
+		}
+
+		// Exchanges the handshake messages until both sides are done
+		bool Handshake(const std::shared_ptr<ov::TlsServerData> &server, SSL_SESSION *session = nullptr)
+		{
+			if (session != nullptr)
+			{
+				::SSL_set_session(_ssl, session);
+			}
+
+			server->SetWriteCallback([this](const void *data, int64_t length) -> ssize_t {
+				return ::BIO_write(_read_bio, data, static_cast<int>(length));
+			});
+
+			for (int i = 0; i < 10; i++)
+			{
+				bool client_done = (::SSL_do_handshake(_ssl) == 1);
+
+				auto data = TakeOutput();
+
+				if (data->IsEmpty() == false)
+				{
+					if (server->Decrypt(data, nullptr) == false)
+					{
+						return false;
+					}
+				}
+
+				if (client_done && (server->GetState() == ov::TlsServerData::State::Accepted))
+				{
+					// Process NewSessionTicket messages sent after the handshake
+					uint8_t buffer[256];
+					::SSL_read(_ssl, buffer, sizeof(buffer));
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		SSL *GetSsl()
+		{
+			return _ssl;
+		}
+
+		std::shared_ptr<ov::Data> TakeOutput()
+		{
+			auto data = std::make_shared<ov::Data>();
+			uint8_t buffer[4096];
+			int read_bytes;
+
+			while ((read_bytes = ::BIO_read(_write_bio, buffer, sizeof(buffer))) > 0)
+			{
+				data->Append(buffer, read_bytes);
+			}
+
+			return data;
+		}
+
+	protected:
+		SSL *_ssl = nullptr;
+		BIO *_read_bio = nullptr;
+		BIO *_write_bio = nullptr;
+	};
+
+	std::shared_ptr<ov::TlsContext> CreateServerContext(const std::shared_ptr<Certificate> &certificate, const ov::String &name, bool enable_early_data = false, const ov::TlsContextCallback *callback = nullptr)
+	{
+		ov::TlsSessionResumption session_resumption = {
+			.ticket_keys = ov::TlsTicketKeyManager::GetInstance()->GetKeys(name, kRotationIntervalMs),
+			.enable_session_ticket = true,
+			.enable_early_data = enable_early_data};
+
+		std::shared_ptr<const ov::Error> error;
+		return ov::TlsContext::CreateServerContext(
+			ov::TlsMethod::Tls, certificate, "AES128-SHA", false, false, &session_resumption, callback, &error);
+	}
+}  // namespace
+
+TEST(TlsTicketKeys, RotatesAfterInterval)
+{
+	ov::TlsTicketKeys keys("rotation", kRotationIntervalMs);
+
+	ov::TlsTicketKeys::Key first, key;
+
+	ASSERT_TRUE(keys.GetEncryptionKey(0, &first));
+	ASSERT_TRUE(keys.GetEncryptionKey(kRotationIntervalMs - 1, &key));
+	EXPECT_EQ(::memcmp(first.name, key.name, sizeof(key.name)), 0);
+
+	ov::TlsTicketKeys::Key second;
+	ASSERT_TRUE(keys.GetEncryptionKey(kRotationIntervalMs, &second));
+	EXPECT_NE(::memcmp(first.name, second.name, sizeof(second.name)), 0);
+	EXPECT_EQ(keys.GetStats().key_rotations, 1u);
+
+	// Tickets of the previous key are still accepted, but should be renewed
+	EXPECT_EQ(keys.FindDecryptionKey(kRotationIntervalMs, first.name, &key), ov::TlsTicketKeys::KeyState::Previous);
+	EXPECT_EQ(::memcmp(first.aes_key, key.aes_key, sizeof(key.aes_key)), 0);
+	EXPECT_EQ(keys.FindDecryptionKey(kRotationIntervalMs, second.name, &key), ov::TlsTicketKeys::KeyState::Current);
+
+	// The first key expires two intervals after its creation
+	EXPECT_EQ(keys.FindDecryptionKey(kRotationIntervalMs * 2, first.name, &key), ov::TlsTicketKeys::KeyState::NotFound);
+	EXPECT_EQ(keys.FindDecryptionKey(kRotationIntervalMs * 2, second.name, &key), ov::TlsTicketKeys::KeyState::Previous);
+}
+
+TEST(TlsTicketKeys, ManagerSharesKeysByName)
+{
+	auto manager = ov::TlsTicketKeyManager::GetInstance();
+
+	auto keys = manager->GetKeys("shared.example.com", kRotationIntervalMs);
+	EXPECT_EQ(manager->GetKeys("shared.example.com", kRotationIntervalMs * 2), keys);
+	EXPECT_EQ(keys->GetRotationInterval(), kRotationIntervalMs * 2);
+
+	ov::TlsTicketKeys::Key key, found;
+	ASSERT_TRUE(keys->GetEncryptionKey(&key));
+	EXPECT_EQ(keys->FindDecryptionKey(key.name, &found), ov::TlsTicketKeys::KeyState::Current);
+
+	// The keys of another virtual host never decrypt the ticket
+	auto other_keys = manager->GetKeys("other.example.com", kRotationIntervalMs);
+	EXPECT_NE(other_keys, keys);
+	EXPECT_EQ(other_keys->FindDecryptionKey(key.name, &found), ov::TlsTicketKeys::KeyState::NotFound);
+}
+
+TEST(TlsTicketKeys, ResumesSessionOnAnotherContextOfVirtualHost)
+{
+	auto certificate = std::make_shared<Certificate>();
+	ASSERT_EQ(certificate->Generate(), nullptr);
+
+	auto first_context = CreateServerContext(certificate, "resumption.example.com");
+	auto second_context = CreateServerContext(certificate, "resumption.example.com");
+	ASSERT_NE(first_context, nullptr);
+	ASSERT_NE(second_context, nullptr);
+
+	SSL_CTX *client_context = ::SSL_CTX_new(::TLS_client_method());
+	ASSERT_NE(client_context, nullptr);
+
+	SSL_SESSION *session = nullptr;
+
+	{
+		TlsTestClient client(client_context);
+		auto server = std::make_shared<ov::TlsServerData>(first_context, true);
+
+		ASSERT_TRUE(client.Handshake(server));
+		EXPECT_EQ(::SSL_version(client.GetSsl()), TLS1_3_VERSION);
+		EXPECT_FALSE(server->GetTls().IsSessionReused());
+
+		session = ::SSL_get1_session(client.GetSsl());
+		ASSERT_NE(session, nullptr);
+		EXPECT_TRUE(::SSL_SESSION_is_resumable(session));
+	}
+
+	{
+		TlsTestClient client(client_context);
+		auto server = std::make_shared<ov::TlsServerData>(second_context, true);
+
+		ASSERT_TRUE(client.Handshake(server, session));
+		EXPECT_TRUE(::SSL_session_reused(client.GetSsl()));
+		EXPECT_TRUE(server->GetTls().IsSessionReused());
+	}
+
+	auto stats = ov::TlsTicketKeyManager::GetInstance()->GetKeys("resumption.example.com", kRotationIntervalMs)->GetStats();
+	EXPECT_EQ(stats.full_handshakes, 1u);
+	EXPECT_EQ(stats.resumed_handshakes, 1u);
+	EXPECT_DOUBLE_EQ(stats.GetResumptionHitRate(), 0.5);
+	EXPECT_GT(stats.full_handshake_cpu_time_us, 0u);
+
+	::SSL_SESSION_free(session);
+	::SSL_CTX_free(client_context);
+}
+
+TEST(TlsTicketKeys, DoesNotResumeSessionOfAnotherVirtualHost)
+{
+	auto certificate = std::make_shared<Certificate>();
+	ASSERT_EQ(certificate->Generate(), nullptr);
+
+	auto first_context = CreateServerContext(certificate, "first-vhost.example.com");
+	auto second_context = CreateServerContext(certificate, "second-vhost.example.com");
+	ASSERT_NE(first_context, nullptr);
+	ASSERT_NE(second_context, nullptr);
+
+	SSL_CTX *client_context = ::SSL_CTX_new(::TLS_client_method());
+	ASSERT_NE(client_context, nullptr);
+
+	SSL_SESSION *session = nullptr;
+
+	{
+		TlsTestClient client(client_context);
+		auto server = std::make_shared<ov::TlsServerData>(first_context, true);
+
+		ASSERT_TRUE(client.Handshake(server));
+
+		session = ::SSL_get1_session(client.GetSsl());
+		ASSERT_NE(session, nullptr);
+	}
+
+	{
+		TlsTestClient client(client_context);
+		auto server = std::make_shared<ov::TlsServerData>(second_context, true);
+
+		ASSERT_TRUE(client.Handshake(server, session));
+		EXPECT_FALSE(::SSL_session_reused(client.GetSsl()));
+		EXPECT_FALSE(server->GetTls().IsSessionReused());
+	}
+
+	auto stats = ov::TlsTicketKeyManager::GetInstance()->GetKeys("second-vhost.example.com", kRotationIntervalMs)->GetStats();
+	EXPECT_EQ(stats.full_handshakes, 1u);
+	EXPECT_EQ(stats.resumed_handshakes, 0u);
+
+	::SSL_SESSION_free(session);
+	::SSL_CTX_free(client_context);
+}
+
+TEST(TlsTicketKeys, ResumesSessionOnlyOnVirtualHostSelectedBySni)
+{
+	auto certificate = std::make_shared<Certificate>();
+	ASSERT_EQ(certificate->Generate(), nullptr);
+
+	// The listener is created with the context of the default virtual host, and SNI selects the other one
+	auto sni_context = CreateServerContext(certificate, "sni-vhost.example.com");
+	ASSERT_NE(sni_context, nullptr);
+
+	ov::TlsContextCallback callback;
+	callback.sni_callback = [sni_context](ov::TlsContext *tls, SSL *ssl, const ov::String &server_name) -> bool {
+		return (server_name == "sni-vhost.example.com") ? sni_context->UseSslContext(ssl) : true;
+	};
+
+	auto default_context = CreateServerContext(certificate, "default-vhost.example.com", false, &callback);
+	ASSERT_NE(default_context, nullptr);
+
+	SSL_CTX *client_context = ::SSL_CTX_new(::TLS_client_method());
+	ASSERT_NE(client_context, nullptr);
+
+	SSL_SESSION *sni_session = nullptr;
+	SSL_SESSION *default_session = nullptr;
+
+	{
+		TlsTestClient client(client_context, "sni-vhost.example.com");
+		auto server = std::make_shared<ov::TlsServerData>(default_context, true);
+
+		ASSERT_TRUE(client.Handshake(server));
+
+		sni_session = ::SSL_get1_session(client.GetSsl());
+		ASSERT_NE(sni_session, nullptr);
+	}
+
+	{
+		TlsTestClient client(client_context, "default-vhost.example.com");
+		auto server = std::make_shared<ov::TlsServerData>(default_context, true);
+
+		ASSERT_TRUE(client.Handshake(server));
+
+		default_session = ::SSL_get1_session(client.GetSsl());
+		ASSERT_NE(default_session, nullptr);
+	}
+
+	// The ticket is decrypted with the keys of the virtual host selected by SNI
+	{
+		TlsTestClient client(client_context, "sni-vhost.example.com");
+		auto server = std::make_shared<ov::TlsServerData>(default_context, true);
+
+		ASSERT_TRUE(client.Handshake(server, sni_session));
+		EXPECT_TRUE(::SSL_session_reused(client.GetSsl()));
+	}
+
+	// A ticket of the default virtual host is not accepted by the one selected by SNI
+	{
+		TlsTestClient client(client_context, "sni-vhost.example.com");
+		auto server = std::make_shared<ov::TlsServerData>(default_context, true);
+
+		ASSERT_TRUE(client.Handshake(server, default_session));
+		EXPECT_FALSE(::SSL_session_reused(client.GetSsl()));
+	}
+
+	auto sni_stats = ov::TlsTicketKeyManager::GetInstance()->GetKeys("sni-vhost.example.com", kRotationIntervalMs)->GetStats();
+	EXPECT_EQ(sni_stats.full_handshakes, 2u);
+	EXPECT_EQ(sni_stats.resumed_handshakes, 1u);
+
+	auto default_stats = ov::TlsTicketKeyManager::GetInstance()->GetKeys("default-vhost.example.com", kRotationIntervalMs)->GetStats();
+	EXPECT_EQ(default_stats.full_handshakes, 1u);
+	EXPECT_EQ(default_stats.resumed_handshakes, 0u);
+
+	::SSL_SESSION_free(default_session);
+	::SSL_SESSION_free(sni_session);
+	::SSL_CTX_free(client_context);
+}
+
+TEST(TlsTicketKeys, AcceptsEarlyDataOfResumedSession)
+{
+	auto certificate = std::make_shared<Certificate>();
+	ASSERT_EQ(certificate->Generate(), nullptr);
+
+	auto context = CreateServerContext(certificate, "early-data.example.com", true);
+	ASSERT_NE(context, nullptr);
+
+	SSL_CTX *client_context = ::SSL_CTX_new(::TLS_client_method());
+	ASSERT_NE(client_context, nullptr);
+
+	SSL_SESSION *session = nullptr;
+
+	{
+		TlsTestClient client(client_context);
+		auto server = std::make_shared<ov::TlsServerData>(context, true);
+
+		ASSERT_TRUE(client.Handshake(server));
+
+		session = ::SSL_get1_session(client.GetSsl());
+		ASSERT_NE(session, nullptr);
+		EXPECT_GT(::SSL_SESSION_get_max_early_data(session), 0u);
+	}
+
+	{
+		TlsTestClient client(client_context);
+		auto server = std::make_shared<ov::TlsServerData>(context, true);
+
+		::SSL_set_session(client.GetSsl(), session);
+		server->SetWriteCallback([&client](const void *data, int64_t length) -> ssize_t {
+			return ::BIO_write(::SSL_get_rbio(client.GetSsl()), data, static_cast<int>(length));
+		});
+
+		// The request is sent with ClientHello
+		const ov::String request = "GET / HTTP/1.1\r\n\r\n";
+		size_t written = 0;
+		ASSERT_EQ(::SSL_write_early_data(client.GetSsl(), request.CStr(), request.GetLength(), &written), 1);
+
+		std::shared_ptr<const ov::Data> plain_data;
+		ASSERT_TRUE(server->Decrypt(client.TakeOutput(), &plain_data));
+		ASSERT_NE(plain_data, nullptr);
+		EXPECT_EQ(ov::String(plain_data->GetDataAs<char>(), plain_data->GetLength()), request);
+		EXPECT_EQ(server->GetState(), ov::TlsServerData::State::EarlyDataAccepted);
+
+		// The response is sent before the client finishes the handshake
+		const ov::String response = "HTTP/1.1 200 OK\r\n\r\n";
+		std::shared_ptr<const ov::Data> cipher_data;
+		ASSERT_TRUE(server->Encrypt(response.ToData(false), &cipher_data));
+		EXPECT_EQ(cipher_data, nullptr);
+
+		ASSERT_EQ(::SSL_do_handshake(client.GetSsl()), 1);
+		ASSERT_TRUE(server->Decrypt(client.TakeOutput(), &plain_data));
+		EXPECT_EQ(server->GetState(), ov::TlsServerData::State::Accepted);
+
+		char buffer[256];
+		int read_bytes = ::SSL_read(client.GetSsl(), buffer, sizeof(buffer));
+		ASSERT_GT(read_bytes, 0);
+		EXPECT_EQ(ov::String(buffer, read_bytes), response);
+		EXPECT_EQ(::SSL_get_early_data_status(client.GetSsl()), SSL_EARLY_DATA_ACCEPTED);
+	}
+
+	auto stats = ov::TlsTicketKeyManager::GetInstance()->GetKeys("early-data.example.com", kRotationIntervalMs)->GetStats();
+	EXPECT_EQ(stats.resumed_handshakes, 1u);
+	EXPECT_EQ(stats.early_data_accepted, 1u);
+
+	::SSL_SESSION_free(session);
+	::SSL_CTX_free(client_context);
+}
@@ -19,3 +19,4 @@
 #include "./openssl/tls.h"
 #include "./openssl/tls_client_data.h"
 #include "./openssl/tls_server_data.h"
+#include "./openssl/tls_ticket_keys.h"
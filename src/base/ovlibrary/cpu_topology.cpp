@@ -0,0 +1,255 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "./cpu_topology.h"
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+
+#include "./converter.h"
+#include "./log.h"
+
+#define OV_LOG_TAG "CpuTopology"
+
+namespace ov
+{
+	namespace
+	{
+		bool ReadLine(const ov::String &path, ov::String *line)
+		{
+			std::ifstream stream(path.CStr());
+			std::string value;
+
+			if ((stream.is_open() == false) || (std::getline(stream, value).fail()))
+			{
+				return false;
+			}
+
+			*line = ov::String(value.c_str()).Trim();
+			return true;
+		}
+
+		int ReadInt(const ov::String &path, int default_value)
+		{
+			ov::String line;
+
+			if ((ReadLine(path, &line) == false) || line.IsEmpty())
+			{
+				return default_value;
+			}
+
+			return ov::Converter::ToInt32(line.CStr());
+		}
+
+		bool IsNumber(const ov::String &value)
+		{
+			if (value.IsEmpty())
+			{
+				return false;
+			}
+
+			for (size_t index = 0; index < value.GetLength(); index++)
+			{
+				if (::isdigit(static_cast<unsigned char>(value[index])) == 0)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// A CPU directory has a "node<N>" link to the NUMA node it belongs to
+		int FindNodeOfCpu(const ov::String &cpu_path)
+		{
+			auto directory = ::opendir(cpu_path.CStr());
+
+			if (directory == nullptr)
+			{
+				return 0;
+			}
+
+			int node_id = 0;
+
+			while (auto entry = ::readdir(directory))
+			{
+				ov::String name = entry->d_name;
+
+				if (name.HasPrefix("node") && IsNumber(name.Substring(4)))
+				{
+					node_id = ov::Converter::ToInt32(name.Substring(4).CStr());
+					break;
+				}
+			}
+
+			::closedir(directory);
+
+			return node_id;
+		}
+	}  // namespace
+
+	CpuTopology CpuTopology::Load(const ov::String &cpu_root)
+	{
+		CpuTopology topology;
+		ov::String online_list;
+		std::vector<int> cpu_ids;
+
+		if ((ReadLine(cpu_root + "/online", &online_list) == false) || (ParseCpuList(online_list, &cpu_ids) == false))
+		{
+			logtw("Could not read the online CPUs from %s", cpu_root.CStr());
+			return topology;
+		}
+
+		for (auto cpu_id : cpu_ids)
+		{
+			auto cpu_path = ov::String::FormatString("%s/cpu%d", cpu_root.CStr(), cpu_id);
+
+			Cpu cpu;
+
+			cpu.id = cpu_id;
+			cpu.node_id = FindNodeOfCpu(cpu_path);
+			cpu.package_id = ReadInt(cpu_path + "/topology/physical_package_id", 0);
+			cpu.core_id = ReadInt(cpu_path + "/topology/core_id", cpu_id);
+
+			topology.AddCpu(cpu);
+		}
+
+		return topology;
+	}
+
+	bool CpuTopology::ParseCpuList(const ov::String &cpu_list, std::vector<int> *cpus)
+	{
+		std::set<int> cpu_set;
+
+		for (const auto &token : cpu_list.Split(","))
+		{
+			auto range = token.Trim();
+
+			if (range.IsEmpty())
+			{
+				continue;
+			}
+
+			auto bounds = range.Split("-");
+
+			if ((bounds.size() > 2) || (IsNumber(bounds[0]) == false) || ((bounds.size() == 2) && (IsNumber(bounds[1]) == false)))
+			{
+				return false;
+			}
+
+			int first = ov::Converter::ToInt32(bounds[0].CStr());
+			int last = (bounds.size() == 2) ? ov::Converter::ToInt32(bounds[1].CStr()) : first;
+
+			if ((first < 0) || (last < first))
+			{
+				return false;
+			}
+
+			for (int cpu_id = first; cpu_id <= last; cpu_id++)
+			{
+				cpu_set.insert(cpu_id);
+			}
+		}
+
+		cpus->assign(cpu_set.begin(), cpu_set.end());
+
+		return true;
+	}
+
+	ov::String CpuTopology::ToCpuList(const std::vector<int> &cpus)
+	{
+		std::vector<ov::String> ranges;
+		size_t index = 0;
+
+		while (index < cpus.size())
+		{
+			auto first = cpus[index];
+			auto last = first;
+
+			while (((index + 1) < cpus.size()) && (cpus[index + 1] == (last + 1)))
+			{
+				last = cpus[++index];
+			}
+
+			ranges.push_back((first == last) ? ov::String::FormatString("%d", first) : ov::String::FormatString("%d-%d", first, last));
+			index++;
+		}
+
+		return ov::String::Join(ranges, ",");
+	}
+
+	std::vector<int> CpuTopology::GetCpuIds() const
+	{
+		std::vector<int> cpu_ids;
+
+		for (const auto &cpu : _cpus)
+		{
+			cpu_ids.push_back(cpu.id);
+		}
+
+		return cpu_ids;
+	}
+
+	std::vector<int> CpuTopology::GetNodeIds() const
+	{
+		std::set<int> node_ids;
+
+		for (const auto &cpu : _cpus)
+		{
+			node_ids.insert(cpu.node_id);
+		}
+
+		return {node_ids.begin(), node_ids.end()};
+	}
+
+	std::vector<int> CpuTopology::GetCpuIdsOfNode(int node_id) const
+	{
+		std::vector<int> cpu_ids;
+
+		for (const auto &cpu : _cpus)
+		{
+			if (cpu.node_id == node_id)
+			{
+				cpu_ids.push_back(cpu.id);
+			}
+		}
+
+		return cpu_ids;
+	}
+
+	int CpuTopology::GetNodeOfCpu(int cpu_id) const
+	{
+		for (const auto &cpu : _cpus)
+		{
+			if (cpu.id == cpu_id)
+			{
+				return cpu.node_id;
+			}
+		}
+
+		return -1;
+	}
+
+	void CpuTopology::AddCpu(const Cpu &cpu)
+	{
+		auto position = std::lower_bound(_cpus.begin(), _cpus.end(), cpu.id, [](const Cpu &item, int id) {
+			return item.id < id;
+		});
+
+		if ((position != _cpus.end()) && (position->id == cpu.id))
+		{
+			*position = cpu;
+			return;
+		}
+
+		_cpus.insert(position, cpu);
+	}
+}  // namespace ov
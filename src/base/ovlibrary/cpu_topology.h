@@ -0,0 +1,62 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <vector>
+
+#include "./string.h"
+
+namespace ov
+{
+	// The online CPUs of the machine and the NUMA node, package and core each of them belongs to,
+	// as /sys/devices/system/cpu describes them
+	class CpuTopology
+	{
+	public:
+		struct Cpu
+		{
+			int id = 0;
+			int node_id = 0;
+			int package_id = 0;
+			int core_id = 0;
+		};
+
+		// Reads the online CPUs below <cpu_root>. A machine or a container that does not expose the
+		// NUMA nodes is taken as a single node 0.
+		static CpuTopology Load(const ov::String &cpu_root = "/sys/devices/system/cpu");
+
+		// Parses a CPU list such as "0-3,8,10-11" into sorted, unique CPU ids. Returns false on a
+		// malformed list.
+		static bool ParseCpuList(const ov::String &cpu_list, std::vector<int> *cpus);
+		static ov::String ToCpuList(const std::vector<int> &cpus);
+
+		bool IsEmpty() const
+		{
+			return _cpus.empty();
+		}
+
+		// Sorted by the CPU id
+		const std::vector<Cpu> &GetCpus() const
+		{
+			return _cpus;
+		}
+
+		std::vector<int> GetCpuIds() const;
+		std::vector<int> GetNodeIds() const;
+		std::vector<int> GetCpuIdsOfNode(int node_id) const;
+
+		// Returns -1 for a CPU that is not online
+		int GetNodeOfCpu(int cpu_id) const;
+
+		void AddCpu(const Cpu &cpu);
+
+	protected:
+		std::vector<Cpu> _cpus;
+	};
+}  // namespace ov
@@ -0,0 +1,236 @@
+//==============================================================================
+//
+//  OvenMediaEngine - Unit Tests
+//
+//  src/base/ovlibrary/cpu_topology_test.cpp
+//  Covers: CpuTopology (CPU lists, sysfs), ThreadPlacement (plans, pinning)
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <base/ovlibrary/cpu_topology.h>
+#include <base/ovlibrary/thread_placement.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace
+{
+	// A fake /sys/devices/system/cpu below a temporary directory
+	class FakeCpuRoot
+	{
+	public:
+		FakeCpuRoot()
+		{
+			char path[] = "/tmp/ome_cpu_topology_XXXXXX";
+			_root = ::mkdtemp(path);
+		}
+
+		~FakeCpuRoot()
+		{
+			std::filesystem::remove_all(_root);
+		}
+
+		void Write(const std::string &relative_path, const std::string &content)
+		{
+			auto path = std::filesystem::path(_root) / relative_path;
+
+			std::filesystem::create_directories(path.parent_path());
+			std::ofstream(path) << content << "\n";
+		}
+
+		void AddCpu(int cpu_id, int node_id, int package_id, int core_id)
+		{
+			auto cpu = "cpu" + std::to_string(cpu_id);
+
+			std::filesystem::create_directories(std::filesystem::path(_root) / cpu / ("node" + std::to_string(node_id)));
+			Write(cpu + "/topology/physical_package_id", std::to_string(package_id));
+			Write(cpu + "/topology/core_id", std::to_string(core_id));
+		}
+
+		ov::String GetPath() const
+		{
+			return _root.c_str();
+		}
+
+	private:
+		std::string _root;
+	};
+
+	ov::CpuTopology MakeTwoNodeTopology()
+	{
+		ov::CpuTopology topology;
+
+		topology.AddCpu({3, 1, 1, 1});
+		topology.AddCpu({0, 0, 0, 0});
+		topology.AddCpu({2, 1, 1, 0});
+		topology.AddCpu({1, 0, 0, 1});
+
+		return topology;
+	}
+
+	// The online CPUs of this machine as one node, so the threads can be pinned to them
+	ov::CpuTopology MakeSingleNodeTopology()
+	{
+		ov::CpuTopology topology;
+		auto online_topology = ov::CpuTopology::Load();
+
+		for (auto cpu : online_topology.GetCpus())
+		{
+			cpu.node_id = 0;
+			topology.AddCpu(cpu);
+		}
+
+		return topology;
+	}
+}  // namespace
+
+TEST(CpuTopology, ParsesCpuLists)
+{
+	std::vector<int> cpus;
+
+	ASSERT_TRUE(ov::CpuTopology::ParseCpuList("0-3,8, 10-11,2", &cpus));
+	EXPECT_EQ(cpus, (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+	EXPECT_EQ(ov::CpuTopology::ToCpuList(cpus), "0-3,8,10-11");
+
+	ASSERT_TRUE(ov::CpuTopology::ParseCpuList("", &cpus));
+	EXPECT_TRUE(cpus.empty());
+	EXPECT_EQ(ov::CpuTopology::ToCpuList(cpus), "");
+
+	EXPECT_FALSE(ov::CpuTopology::ParseCpuList("3-1", &cpus));
+	EXPECT_FALSE(ov::CpuTopology::ParseCpuList("1-2-3", &cpus));
+	EXPECT_FALSE(ov::CpuTopology::ParseCpuList("a", &cpus));
+	EXPECT_FALSE(ov::CpuTopology::ParseCpuList("-1", &cpus));
+}
+
+TEST(CpuTopology, LoadsFromSysfs)
+{
+	FakeCpuRoot root;
+
+	root.Write("online", "0-2,4");
+	root.AddCpu(0, 0, 0, 0);
+	root.AddCpu(1, 0, 0, 1);
+	root.AddCpu(2, 1, 1, 0);
+	root.AddCpu(4, 1, 1, 1);
+	// Offline CPUs are not taken
+	root.AddCpu(3, 1, 1, 2);
+
+	auto topology = ov::CpuTopology::Load(root.GetPath());
+
+	ASSERT_FALSE(topology.IsEmpty());
+	EXPECT_EQ(topology.GetCpuIds(), (std::vector<int>{0, 1, 2, 4}));
+	EXPECT_EQ(topology.GetNodeIds(), (std::vector<int>{0, 1}));
+	EXPECT_EQ(topology.GetCpuIdsOfNode(1), (std::vector<int>{2, 4}));
+	EXPECT_EQ(topology.GetNodeOfCpu(4), 1);
+	EXPECT_EQ(topology.GetNodeOfCpu(3), -1);
+	EXPECT_EQ(topology.GetCpus()[3].package_id, 1);
+	EXPECT_EQ(topology.GetCpus()[3].core_id, 1);
+}
+
+TEST(CpuTopology, TakesAMachineWithoutNodesAsOneNode)
+{
+	FakeCpuRoot root;
+
+	root.Write("online", "0-1");
+	root.Write("cpu0/topology/core_id", "0");
+	root.Write("cpu1/topology/core_id", "1");
+
+	auto topology = ov::CpuTopology::Load(root.GetPath());
+
+	EXPECT_EQ(topology.GetNodeIds(), (std::vector<int>{0}));
+	EXPECT_EQ(topology.GetCpuIdsOfNode(0), (std::vector<int>{0, 1}));
+
+	// Nothing can be read from a missing root
+	EXPECT_TRUE(ov::CpuTopology::Load(root.GetPath() + "/missing").IsEmpty());
+}
+
+TEST(ThreadPlacement, PlansTheRolesByNode)
+{
+	auto placement = ov::ThreadPlacement::GetInstance();
+
+	ov::ThreadPlacement::Config config;
+	config.enabled = true;
+	config.numa_local_arena = false;
+	config.cpus[ov::ThreadRole::Network] = {0, 2, 3};
+	config.cpus[ov::ThreadRole::Codec] = {2, 3, 7};
+
+	placement->Configure(config, MakeTwoNodeTopology());
+	ASSERT_TRUE(placement->IsEnabled());
+
+	auto report = placement->GetReport();
+
+	ASSERT_EQ(report.nodes.size(), 2u);
+	EXPECT_EQ(report.nodes[1].cpus, (std::vector<int>{2, 3}));
+
+	ASSERT_EQ(report.plans.size(), 4u);
+
+	for (const auto &plan : report.plans)
+	{
+		switch (plan.role)
+		{
+			case ov::ThreadRole::Network:
+				ASSERT_EQ(plan.nodes.size(), 2u);
+				EXPECT_EQ(plan.nodes[0].cpus, (std::vector<int>{0}));
+				EXPECT_EQ(plan.nodes[1].cpus, (std::vector<int>{2, 3}));
+				break;
+
+			case ov::ThreadRole::Codec:
+				// CPUs that are not online are left out
+				ASSERT_EQ(plan.nodes.size(), 1u);
+				EXPECT_EQ(plan.nodes[0].node_id, 1);
+				break;
+
+			default:
+				// Every online CPU
+				ASSERT_EQ(plan.nodes.size(), 2u);
+				EXPECT_EQ(plan.nodes[0].cpus, (std::vector<int>{0, 1}));
+				break;
+		}
+	}
+
+	placement->Configure({}, MakeTwoNodeTopology());
+}
+
+TEST(ThreadPlacement, PinsThreadsWhileEnabled)
+{
+	auto placement = ov::ThreadPlacement::GetInstance();
+
+	placement->Configure({}, MakeSingleNodeTopology());
+	EXPECT_FALSE(placement->IsEnabled());
+	EXPECT_EQ(placement->GetCurrentNode(), -1);
+
+	std::thread([&]() {
+		EXPECT_EQ(placement->PlaceCurrentThread(ov::ThreadRole::Network), -1);
+	}).join();
+
+	auto topology = MakeSingleNodeTopology();
+	if (topology.IsEmpty())
+	{
+		GTEST_SKIP() << "The online CPUs are unknown";
+	}
+
+	ov::ThreadPlacement::Config config;
+	config.enabled = true;
+	config.numa_local_arena = false;
+	placement->Configure(config, topology);
+
+	std::thread([&]() {
+		EXPECT_EQ(placement->PlaceCurrentThread(ov::ThreadRole::Network), 0);
+		EXPECT_EQ(placement->GetCurrentNode(), 0);
+
+		// A thread of another role on the node of its creator
+		std::thread([&]() {
+			EXPECT_EQ(placement->PlaceCurrentThreadOnNode(ov::ThreadRole::Codec, -1), 0);
+		}).join();
+
+		EXPECT_EQ(placement->GetReport().nodes[0].thread_count, 1u);
+	}).join();
+
+	// The threads are taken out of the counts when they exit
+	EXPECT_EQ(placement->GetReport().nodes[0].thread_count, 0u);
+
+	placement->Configure({}, topology);
+}
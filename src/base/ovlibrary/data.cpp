@@ -9,9 +9,11 @@
 #include "data.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "./assert.h"
 #include "./dump_utilities.h"
+#include "./mapped_file.h"
 
 namespace ov
 {
@@ -22,7 +24,11 @@ namespace ov
 
 	Data::Data(size_t capacity)
 	{
-		Reserve(capacity);
+		// An empty instance allocates nothing until something is stored
+		if (capacity > 0)
+		{
+			Reserve(capacity);
+		}
 	}
 
 	Data::Data(const void *data, size_t length, bool reference_only)
@@ -47,22 +53,44 @@ namespace ov
 		}
 	}
 
+	Data::Data(const std::shared_ptr<MappedFile> &mapped_file, size_t offset, size_t length)
+	{
+		if ((mapped_file == nullptr) || (mapped_file->GetAddress() == nullptr))
+		{
+			OV_ASSERT2(false);
+			return;
+		}
+
+		OV_ASSERT2((offset + length) <= mapped_file->GetSize());
+
+		_reference_data = mapped_file->GetAddress();
+		_mapped_file = mapped_file;
+		_offset = offset;
+		_length = length;
+	}
+
 	Data::Data(const Data &data)
 	{
 		_reference_data = data._reference_data;
-		if (data._allocated_data != nullptr)
+		_mapped_file = data._mapped_file;
+
+		if (_reference_data != nullptr)
+		{
+			_offset = data._offset;
+			_length = data._length;
+		}
+		else if (data._allocated_data != nullptr)
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			// Copied to the beginning of a new buffer
 			Append(&data);
 		}
-		_offset = data._offset;
-		_length = data._length;
 	}
 
 	Data::Data(Data &&data) noexcept
 	{
 		std::swap(_reference_data, data._reference_data);
-		std::swap(_allocated_data, data._allocated_data);
+		std::swap(_mapped_file, data._mapped_file);
+		_allocated_data.Swap(data._allocated_data);
 		std::swap(_offset, data._offset);
 		std::swap(_length, data._length);
 	}
@@ -105,6 +133,7 @@ namespace ov
 		{
 			// Refer _reference_data
 			instance->_reference_data = _reference_data;
+			instance->_mapped_file = _mapped_file;
 		}
 		else
 		{
@@ -153,6 +182,7 @@ namespace ov
 
 		// ov::Data supports COW (Copy-on-write), so we just assign the variables of data to member variables.
 		_reference_data = data._reference_data;
+		_mapped_file = data._mapped_file;
 		_allocated_data = data._allocated_data;
 		_offset = data._offset;
 		_length = data._length;
@@ -225,12 +255,14 @@ namespace ov
 		return (GetLength() == 0);
 	}
 
-	bool Data::Detach()
+	bool Data::Detach(size_t min_capacity)
 	{
 		if (_reference_data != nullptr)
 		{
 			// Copy from original data
 			const void *original_data = _reference_data;
+			// Keep the mapping alive until the data is copied
+			auto mapped_file = std::move(_mapped_file);
 			off_t offset = _offset;
 			size_t length = _length;
 
@@ -238,67 +270,158 @@ namespace ov
 			_offset = 0;
 			_length = 0;
 
-			return Reserve(length) && Append(static_cast<const uint8_t *>(original_data) + offset, length);
+			return Reserve(std::max(min_capacity, length)) && Append(static_cast<const uint8_t *>(original_data) + offset, length);
 		}
 
 		if (_allocated_data == nullptr)
 		{
-			OV_ASSERT2(false);
-			return false;
+			// Nothing is stored yet
+			return true;
 		}
 
-		if (_allocated_data.use_count() == 1)
+		if ((_allocated_data.UseCount() == 1) && (_allocated_data->GetSize() == GetLength()))
 		{
 			// Nobody references _allocated_data. So do not need to copy the data
-			if (_allocated_data->size() == GetLength())
-			{
-				return true;
-			}
+			return true;
+		}
+
+		// Shared with another instance, or needs to shrink: copy data from <_offset> to <_offset + length>
+		return Reallocate(std::max(min_capacity, _allocated_data->GetCapacity() - _offset));
+	}
+
+	bool Data::Reallocate(size_t capacity)
+	{
+		auto buffer = DataBuffer::Allocate(std::max(capacity, _length));
+		if (buffer == nullptr)
+		{
+			return false;
+		}
 
-			// Need to shrink the vector size
+		if (_length > 0)
+		{
+			::memcpy(buffer->GetData(), GetData(), _length);
 		}
 
-		// Copy data from <_offset> to <_offset + length>
-		auto old_data = _allocated_data;
-		auto old_offset = _offset;
-		auto begin = old_data->begin() + _offset;
-		auto end = begin + _length;
+		buffer->SetSize(_length);
+
+		if ((_allocated_data != nullptr) && (_allocated_data.UseCount() == 1))
+		{
+			// The data grows or shrinks in place, so it stays charged to where it was
+			buffer->ChargeTo(_allocated_data->GetAccount());
+		}
 
 		// Reset the offset
+		_allocated_data.Reset(buffer);
 		_offset = 0L;
 
-		_allocated_data = std::make_shared<std::vector<uint8_t>>(begin, end);
-		_allocated_data->reserve(old_data->capacity() - old_offset);
+		return true;
+	}
+
+	bool Data::ChargeMemoryTo(const std::shared_ptr<MemoryAccount> &account) const
+	{
+		if (_allocated_data == nullptr)
+		{
+			return false;
+		}
+
+		_allocated_data->ChargeTo(account.get());
+		return true;
+	}
+
+	bool Data::ClaimMemoryFor(const std::shared_ptr<MemoryAccount> &account) const
+	{
+		return (_allocated_data != nullptr) && _allocated_data->ClaimFor(account.get());
+	}
 
-		return (_allocated_data != nullptr);
+	void Data::UnclaimMemoryFor(const std::shared_ptr<MemoryAccount> &account) const
+	{
+		if (_allocated_data != nullptr)
+		{
+			_allocated_data->UnclaimFor(account.get());
+		}
 	}
 
 	bool Data::Reserve(size_t capacity)
 	{
 		if ((_reference_data != nullptr) || (_allocated_data != nullptr))
 		{
-			if (Detach() == false)
+			if (Detach(capacity) == false)
 			{
 				// Could not copy data from _reference_data
 				OV_ASSERT2(false);
 				return false;
 			}
 		}
-		else
+
+		if (_allocated_data == nullptr)
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			if (capacity == 0)
+			{
+				return true;
+			}
+
+			auto buffer = DataBuffer::Allocate(capacity);
+			if (buffer == nullptr)
+			{
+				return false;
+			}
+
+			_allocated_data.Reset(buffer);
+			_offset = 0L;
+
+			return true;
 		}
 
-		_allocated_data->reserve(capacity);
+		if (capacity > _allocated_data->GetCapacity())
+		{
+			return Reallocate(capacity);
+		}
+
+		return true;
+	}
+
+	bool Data::SetLength(size_t length)
+	{
+		return SetLengthInternal(length, true);
+	}
+
+	bool Data::SetLengthUninitialized(size_t length)
+	{
+		return SetLengthInternal(length, false);
+	}
+
+	bool Data::SetLengthInternal(size_t length, bool zero_fill)
+	{
+		// Detach() will called in Reserve()
+		if (Reserve(length) == false)
+		{
+			return false;
+		}
+
+		if (_allocated_data == nullptr)
+		{
+			// Still empty (length is 0)
+			_length = 0;
+			return true;
+		}
+
+		if (zero_fill && (length > _length))
+		{
+			::memset(_allocated_data->GetData() + _offset + _length, 0, length - _length);
+		}
+
+		_length = length;
+		_allocated_data->SetSize(_offset + _length);
 
 		return true;
 	}
 
 	bool Data::Clear() noexcept
 	{
-		// Reallocate the buffer (this method is faster than Detach() & clear());
+		// Release the buffer (this method is faster than Detach() & clear());
 		_reference_data = nullptr;
-		_allocated_data = std::make_shared<std::vector<uint8_t>>();
+		_mapped_file = nullptr;
+		_allocated_data.Reset();
 		_offset = 0;
 		_length = 0;
 
@@ -334,10 +457,41 @@ namespace ov
 			return false;
 		}
 
+		if (length == 0)
+		{
+			return true;
+		}
+
 		auto source = static_cast<const uint8_t *>(data);
+		auto required_length = _length + length;
 
-		_allocated_data->insert(_allocated_data->begin() + (_offset + offset), source, source + length);
-		_length += length;
+		// <data> may point into the current buffer, which must outlive the copy below
+		DataBufferPtr previous_data;
+
+		if (required_length > GetCapacity())
+		{
+			previous_data = _allocated_data;
+
+			// Grows geometrically like std::vector
+			if (Reallocate(std::max(required_length, _length * 2)) == false)
+			{
+				return false;
+			}
+
+			// Detach() left this instance as the only owner, so it stays charged to where it was
+			if (previous_data != nullptr)
+			{
+				_allocated_data->ChargeTo(previous_data->GetAccount());
+			}
+		}
+
+		auto buffer = _allocated_data->GetData() + _offset;
+
+		::memmove(buffer + offset + length, buffer + offset, _length - offset);
+		::memcpy(buffer + offset, source, length);
+
+		_length = required_length;
+		_allocated_data->SetSize(_offset + _length);
 
 		return true;
 	}
@@ -391,12 +545,11 @@ namespace ov
 			return false;
 		}
 
-		auto begin = _allocated_data->begin() + offset;
+		auto buffer = _allocated_data->GetData();
 
-		_allocated_data->erase(begin, begin + length);
+		::memmove(buffer + offset, buffer + offset + length, _length - (offset + length));
 		_length -= length;
-
-		OV_ASSERT(_length == _allocated_data->size(), "length: %zu, allocated size: %zu", _length, _allocated_data->size());
+		_allocated_data->SetSize(_length);
 
 		return true;
 	}
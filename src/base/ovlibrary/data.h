@@ -11,7 +11,7 @@
 #include "./string.h"
 #include "./assert.h"
 #include "./memory_utilities.h"
-#include "./data.h"
+#include "./data_buffer.h"
 
 #include <memory>
 #include <algorithm>
@@ -19,6 +19,9 @@
 
 namespace ov
 {
+	class MappedFile;
+	class MemoryAccount;
+
 	class Data
 	{
 	public:
@@ -41,6 +44,13 @@ namespace ov
 		/// If reference_only is false, it will not be affected if the data changes because it allocates a new memory and copies it there.
 		Data(const void *data, size_t length, bool reference_only = false);
 
+		/// Constructs a instance that refers to a region of a memory-mapped file without copying
+		///
+		/// @param mapped_file the mapping to refer (kept alive by this instance and its Subdata()/Clone())
+		/// @param offset offset in the file
+		/// @param length length of the region
+		Data(const std::shared_ptr<MappedFile> &mapped_file, size_t offset, size_t length);
+
 		// Copy constructor
 		Data(const Data &data);
 
@@ -59,7 +69,12 @@ namespace ov
 		/// @return read-only pointer
 		inline const void *GetData() const
 		{
-			return static_cast<const uint8_t *>((_reference_data != nullptr) ? _reference_data : _allocated_data->data()) + _offset;
+			if (_reference_data != nullptr)
+			{
+				return static_cast<const uint8_t *>(_reference_data) + _offset;
+			}
+
+			return (_allocated_data != nullptr) ? (_allocated_data->GetData() + _offset) : nullptr;
 		}
 
 		template<typename T>
@@ -91,9 +106,9 @@ namespace ov
 		/// @return writable pointer
 		inline void *GetWritableData()
 		{
-			if(Detach())
+			if(Detach() && (_allocated_data != nullptr))
 			{
-				return _allocated_data->data() + _offset;
+				return _allocated_data->GetData() + _offset;
 			}
 
 			return nullptr;
@@ -113,25 +128,44 @@ namespace ov
 			return _length;
 		}
 
-		// For debugging
-		inline size_t GetAllocatedDataSize() const
+		/// The memory-mapped file this instance refers to, if any. Becomes nullptr once the data is modified.
+		inline const std::shared_ptr<MappedFile> &GetMappedFile() const noexcept
 		{
-			return (_allocated_data != nullptr) ? _allocated_data->size() : 0ULL;
+			return _mapped_file;
 		}
 
-		inline bool SetLength(size_t length)
+		/// Offset of GetData() in the file of GetMappedFile()
+		inline off_t GetMappedFileOffset() const noexcept
 		{
-			// Detach() will called in Reserve()
-			if(Reserve(length))
-			{
-				_allocated_data->resize(length);
-				_length = length;
-				return true;
-			}
+			return _offset;
+		}
 
-			return false;
+		// For debugging
+		inline size_t GetAllocatedDataSize() const
+		{
+			return (_allocated_data != nullptr) ? _allocated_data->GetSize() : 0ULL;
 		}
 
+		/// Charges the buffer of this data to <account>, taking the charge over from the account it
+		/// was charged to. Other instances sharing the buffer are charged together.
+		///
+		/// @return false if there is no buffer to charge, e.g. for the data of a memory-mapped file
+		bool ChargeMemoryTo(const std::shared_ptr<MemoryAccount> &account) const;
+
+		/// Charges the buffer of this data to <account> only if it is not charged to any account,
+		/// for a queue that holds the data for a while without owning it
+		bool ClaimMemoryFor(const std::shared_ptr<MemoryAccount> &account) const;
+		/// Uncharges the buffer if it is still charged to <account> by ClaimMemoryFor()
+		void UnclaimMemoryFor(const std::shared_ptr<MemoryAccount> &account) const;
+
+		/// Changes the length of the data. The grown part is filled with zeros.
+		bool SetLength(size_t length);
+
+		/// Changes the length of the data, leaving the grown part uninitialized.
+		///
+		/// @remarks Use this only when the grown part is overwritten right away, e.g. by recv() into GetWritableData().
+		bool SetLengthUninitialized(size_t length);
+
 		/// capacity byte만큼 데이터가 저장될 수 있는 공간을 미리 확보.
 		///
 		/// @param capacity 할당할 메모리 크기를 결정하기 위한 개수 (최소한 capacity만큼 메모리를 할당함)
@@ -147,7 +181,7 @@ namespace ov
 		/// @return 할당되어 있는 메모리 크기
 		inline size_t GetCapacity() const noexcept
 		{
-			return (_allocated_data != nullptr) ? _allocated_data->capacity() : 0;
+			return (_allocated_data != nullptr) ? _allocated_data->GetCapacity() : 0;
 		}
 
 		/// 버퍼에 있는 데이터 모두 삭제
@@ -217,20 +251,30 @@ namespace ov
 
 		/// Called to separate from the origin data
 		///
+		/// @param min_capacity capacity of the buffer if it has to be copied
+		///
 		/// @return true on success, false on failure
-		bool Detach();
+		bool Detach(size_t min_capacity = 0);
+
+		/// Moves the data into a new buffer of at least <capacity> bytes
+		bool Reallocate(size_t capacity);
+
+		bool SetLengthInternal(size_t length, bool zero_fill);
 
 		const void *_reference_data = nullptr;
+		// Keeps the mapping of _reference_data alive when it points to a memory-mapped file
+		std::shared_ptr<MappedFile> _mapped_file = nullptr;
 
-		// Allocated data. If this data is subdata, _current_data and _data can be different.
-		std::shared_ptr<std::vector<uint8_t>> _allocated_data = nullptr;
+		// Allocated data, shared with Subdata()/Clone() until either side is modified.
+		// nullptr until something is stored.
+		DataBufferPtr _allocated_data;
 		// Offset from _allocated_data
 		off_t _offset = 0;
 
 		// Length of data
 		// _length =
 		// if(_allocated_data != nullptr)
-		//     _allocated_data->size() - _offset
+		//     _allocated_data->GetSize() - _offset
 		// else
 		//     <length of _reference_data>
 		size_t _length = 0;
@@ -0,0 +1,171 @@
+//==============================================================================
+//
+//  OvenMediaEngine - Unit Tests
+//
+//  Covers: ov::Data allocation cost
+//
+//  Disabled by default, since the numbers depend on the machine. Run with:
+//    ome_test_base --gtest_also_run_disabled_tests --gtest_filter='OvDataBenchmark.*'
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <base/ovlibrary/data.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr int ITERATIONS = 200000;
+	// Large buffers are slow to fill, so they run fewer times
+	constexpr int LARGE_ITERATIONS = 2000;
+
+	// Keeps the compiler from optimizing away what is measured. Only values are stored, so no
+	// address outlives the operation.
+	volatile size_t benchmark_sink = 0;
+
+	uint64_t GetBufferHeapAllocateCount()
+	{
+		uint64_t count = 0;
+
+		for (const auto &stats : ov::DataBuffer::GetStats())
+		{
+			count += stats.heap_allocate_count;
+		}
+
+		return count;
+	}
+
+	// Runs <operation> <iterations> times after a warm-up, and prints the time and the buffers
+	// DataBuffer took from malloc() (rather than its pools) for each run
+	void Measure(const char *name, int iterations, const std::function<void()> &operation)
+	{
+		for (int i = 0; i < iterations / 10; i++)
+		{
+			operation();
+		}
+
+		auto buffer_count = GetBufferHeapAllocateCount();
+		auto start = std::chrono::steady_clock::now();
+
+		for (int i = 0; i < iterations; i++)
+		{
+			operation();
+		}
+
+		auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		auto buffer_mallocs = static_cast<double>(GetBufferHeapAllocateCount() - buffer_count) / iterations;
+
+		::printf("%-28s %10.1f ns/op %8.3f malloc/op\n",
+				 name, static_cast<double>(elapsed_ns) / iterations, buffer_mallocs);
+	}
+
+	std::vector<uint8_t> MakePayload(size_t length)
+	{
+		std::vector<uint8_t> payload(length);
+
+		for (size_t i = 0; i < length; i++)
+		{
+			payload[i] = static_cast<uint8_t>(i);
+		}
+
+		return payload;
+	}
+}  // namespace
+
+TEST(OvDataBenchmark, DISABLED_Scenarios)
+{
+	const auto small = MakePayload(16);
+	const auto mtu = MakePayload(1500);
+	const auto packet = MakePayload(60 * 1024);
+	const auto frame = MakePayload(1000 * 1000);
+
+	Measure("DefaultConstruct", ITERATIONS, []() {
+		ov::Data data;
+		benchmark_sink = data.GetLength();
+	});
+
+	Measure("MakeSharedFromBuffer(5)", ITERATIONS, [&]() {
+		auto data = std::make_shared<ov::Data>(small.data(), 5);
+		benchmark_sink = data->GetLength();
+	});
+
+	Measure("CopyConstructor", ITERATIONS, [&]() {
+		ov::Data source(small.data(), small.size());
+		ov::Data copy(source);
+		benchmark_sink = copy.GetLength();
+	});
+
+	Measure("CloneAndWrite", ITERATIONS, [&]() {
+		ov::Data source(small.data(), small.size());
+		auto clone = source.Clone();
+		static_cast<uint8_t *>(clone->GetWritableData())[0] = 0xFF;
+	});
+
+	Measure("AppendRawData", ITERATIONS, [&]() {
+		ov::Data data;
+		data.Append(small.data(), 2);
+		data.Append(small.data() + 2, 2);
+	});
+
+	Measure("SocketRecv(1500)", ITERATIONS, [&]() {
+		auto data = std::make_shared<ov::Data>(mtu.size());
+		data->SetLengthUninitialized(mtu.size());
+		::memcpy(data->GetWritableData(), mtu.data(), mtu.size());
+	});
+
+	Measure("Subdata", ITERATIONS, [&]() {
+		auto data = std::make_shared<ov::Data>(mtu.data(), mtu.size());
+		auto sub = data->Subdata(100, 1000);
+		benchmark_sink = sub->GetLength();
+	});
+
+	Measure("Packet(60K)", LARGE_ITERATIONS, [&]() {
+		auto data = std::make_shared<ov::Data>(packet.data(), packet.size());
+		benchmark_sink = data->GetLength();
+	});
+
+	Measure("Frame(1M)", LARGE_ITERATIONS, [&]() {
+		auto data = std::make_shared<ov::Data>(frame.data(), frame.size());
+		benchmark_sink = data->GetLength();
+	});
+
+	// Allocated by one thread, released by another, as packets handed to a publisher are. An
+	// operation is a batch of 10000 packets.
+	Measure("CrossThreadRelease(1500)", 20, [&]() {
+		std::vector<std::shared_ptr<ov::Data>> batch;
+		batch.reserve(10000);
+
+		for (int i = 0; i < 10000; i++)
+		{
+			batch.push_back(std::make_shared<ov::Data>(mtu.data(), mtu.size()));
+		}
+
+		std::thread([&batch]() { batch.clear(); }).join();
+	});
+}
+
+// Keyframes and audio/video frames land anywhere between 64 KB and 1 MB. Reports how much of
+// the capacity of their buffers goes unused.
+TEST(OvDataBenchmark, DISABLED_LargeBufferCapacity)
+{
+	for (size_t length : {64 * 1024 + 1, 96 * 1024, 150 * 1024, 200 * 1024, 300 * 1024, 400 * 1024, 600 * 1024, 900 * 1024})
+	{
+		const auto payload = MakePayload(length);
+		size_t capacity = 0;
+
+		auto name = ov::String::FormatString("Frame(%zuK)", length / 1024);
+		Measure(name.CStr(), LARGE_ITERATIONS, [&]() {
+			auto data = std::make_shared<ov::Data>(payload.data(), payload.size());
+			capacity = data->GetCapacity();
+		});
+
+		::printf("%-28s %10zu capacity %6.2fx of the length\n",
+				 "", capacity, static_cast<double>(capacity) / length);
+	}
+}
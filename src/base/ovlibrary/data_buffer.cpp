@@ -0,0 +1,346 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "data_buffer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include "./memory_accounting.h"
+#include "./tsa/mutex.h"
+
+namespace ov
+{
+	namespace
+	{
+		// Buffers a thread keeps for itself, and the buffers the shared pool keeps for all threads.
+		// Anything beyond these is freed. From 64 KB up, the shared pool of each class keeps at most 16 MB.
+		constexpr size_t THREAD_CACHE_LIMITS[] = {256, 128, 8, 4, 4, 2, 2};
+		constexpr size_t POOL_LIMITS[] = {4096, 4096, 256, 128, 64, 32, 16};
+
+		static_assert(sizeof(THREAD_CACHE_LIMITS) / sizeof(THREAD_CACHE_LIMITS[0]) == DataBuffer::SIZE_CLASS_COUNT);
+		static_assert(sizeof(POOL_LIMITS) / sizeof(POOL_LIMITS[0]) == DataBuffer::SIZE_CLASS_COUNT);
+
+		struct SizeClassStats
+		{
+			std::atomic<uint64_t> allocate_count{0};
+			std::atomic<uint64_t> thread_cache_hit_count{0};
+			std::atomic<uint64_t> pool_hit_count{0};
+			std::atomic<uint64_t> heap_allocate_count{0};
+			std::atomic<uint64_t> heap_free_count{0};
+		};
+
+		struct SharedPool
+		{
+			ov::Mutex mutex;
+			std::vector<void *> free_list OV_GUARDED_BY(mutex);
+		};
+
+		struct GlobalState
+		{
+			SharedPool pools[DataBuffer::SIZE_CLASS_COUNT];
+			SizeClassStats stats[DataBuffer::SIZE_CLASS_COUNT + 1];
+		};
+
+		GlobalState &GetGlobalState()
+		{
+			// Never destroyed, so buffers released while other statics are being destroyed
+			// (or by threads outliving main()) still have somewhere to go
+			static auto state = new GlobalState();
+			return *state;
+		}
+
+		void ReturnToPool(uint32_t size_class, void *const *blocks, size_t count)
+		{
+			auto &state = GetGlobalState();
+			auto &pool = state.pools[size_class];
+			size_t freed_from = count;
+
+			{
+				ov::LockGuard lock(pool.mutex);
+
+				auto room = (pool.free_list.size() < POOL_LIMITS[size_class]) ? (POOL_LIMITS[size_class] - pool.free_list.size()) : 0;
+				freed_from = std::min(count, room);
+
+				pool.free_list.insert(pool.free_list.end(), blocks, blocks + freed_from);
+			}
+
+			for (size_t index = freed_from; index < count; index++)
+			{
+				::free(blocks[index]);
+			}
+
+			state.stats[size_class].heap_free_count.fetch_add(count - freed_from, std::memory_order_relaxed);
+		}
+
+		enum class ThreadCacheState : uint8_t
+		{
+			NotCreated,
+			Alive,
+			Destroyed
+		};
+
+		thread_local ThreadCacheState thread_cache_state = ThreadCacheState::NotCreated;
+
+		struct ThreadCache
+		{
+			ThreadCache()
+			{
+				for (size_t size_class = 0; size_class < DataBuffer::SIZE_CLASS_COUNT; size_class++)
+				{
+					// One more than the limit, which is pushed before the cache is trimmed
+					free_lists[size_class].reserve(THREAD_CACHE_LIMITS[size_class] + 1);
+				}
+
+				thread_cache_state = ThreadCacheState::Alive;
+			}
+
+			~ThreadCache()
+			{
+				// Buffers released after this point bypass the cache
+				thread_cache_state = ThreadCacheState::Destroyed;
+
+				for (uint32_t size_class = 0; size_class < DataBuffer::SIZE_CLASS_COUNT; size_class++)
+				{
+					auto &free_list = free_lists[size_class];
+					ReturnToPool(size_class, free_list.data(), free_list.size());
+				}
+			}
+
+			std::vector<void *> free_lists[DataBuffer::SIZE_CLASS_COUNT];
+		};
+
+		ThreadCache *GetThreadCache()
+		{
+			if (thread_cache_state == ThreadCacheState::Destroyed)
+			{
+				return nullptr;
+			}
+
+			thread_local ThreadCache thread_cache;
+			return &thread_cache;
+		}
+
+		uint32_t GetSizeClass(size_t capacity)
+		{
+			for (uint32_t size_class = 0; size_class < DataBuffer::SIZE_CLASS_COUNT; size_class++)
+			{
+				if (capacity <= DataBuffer::SIZE_CLASSES[size_class])
+				{
+					return size_class;
+				}
+			}
+
+			return DataBuffer::UNPOOLED;
+		}
+
+		void *TakeBlock(uint32_t size_class)
+		{
+			auto &state = GetGlobalState();
+			auto &stats = state.stats[size_class];
+
+			auto thread_cache = GetThreadCache();
+			if (thread_cache != nullptr)
+			{
+				auto &free_list = thread_cache->free_lists[size_class];
+
+				if (free_list.empty())
+				{
+					// Refill half of the cache at once, so the lock is taken once per batch
+					auto &pool = state.pools[size_class];
+					ov::LockGuard lock(pool.mutex);
+
+					auto count = std::min(pool.free_list.size(), std::max<size_t>(THREAD_CACHE_LIMITS[size_class] / 2, 1));
+					free_list.insert(free_list.end(), pool.free_list.end() - count, pool.free_list.end());
+					pool.free_list.resize(pool.free_list.size() - count);
+
+					if (count > 0)
+					{
+						stats.pool_hit_count.fetch_add(1, std::memory_order_relaxed);
+						auto block = free_list.back();
+						free_list.pop_back();
+						return block;
+					}
+				}
+				else
+				{
+					stats.thread_cache_hit_count.fetch_add(1, std::memory_order_relaxed);
+					auto block = free_list.back();
+					free_list.pop_back();
+					return block;
+				}
+			}
+			else
+			{
+				auto &pool = state.pools[size_class];
+				ov::LockGuard lock(pool.mutex);
+
+				if (pool.free_list.empty() == false)
+				{
+					stats.pool_hit_count.fetch_add(1, std::memory_order_relaxed);
+					auto block = pool.free_list.back();
+					pool.free_list.pop_back();
+					return block;
+				}
+			}
+
+			return nullptr;
+		}
+	}  // namespace
+
+	DataBuffer *DataBuffer::Allocate(size_t capacity)
+	{
+		auto size_class = GetSizeClass(capacity);
+		auto &stats = GetGlobalState().stats[size_class];
+
+		stats.allocate_count.fetch_add(1, std::memory_order_relaxed);
+
+		void *block = nullptr;
+
+		if (size_class != UNPOOLED)
+		{
+			capacity = SIZE_CLASSES[size_class];
+			block = TakeBlock(size_class);
+		}
+
+		if (block == nullptr)
+		{
+			block = ::malloc(sizeof(DataBuffer) + capacity);
+			if (block == nullptr)
+			{
+				return nullptr;
+			}
+
+			stats.heap_allocate_count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		return new (block) DataBuffer(size_class, capacity);
+	}
+
+	void DataBuffer::ChargeTo(MemoryAccount *account) noexcept
+	{
+		if (_account.load(std::memory_order_relaxed) == account)
+		{
+			return;
+		}
+
+		// Charged first, so the account never has a buffer that it does not count
+		if (account != nullptr)
+		{
+			account->Charge(GetChargedBytes());
+		}
+
+		auto previous_account = _account.exchange(account, std::memory_order_acq_rel);
+
+		if (previous_account != nullptr)
+		{
+			previous_account->Uncharge(GetChargedBytes());
+		}
+	}
+
+	bool DataBuffer::ClaimFor(MemoryAccount *account) noexcept
+	{
+		if ((account == nullptr) || (_account.load(std::memory_order_relaxed) != nullptr))
+		{
+			return false;
+		}
+
+		account->Charge(GetChargedBytes());
+
+		MemoryAccount *expected = nullptr;
+
+		if (_account.compare_exchange_strong(expected, account, std::memory_order_acq_rel) == false)
+		{
+			// Charged to another account in the meantime
+			account->Uncharge(GetChargedBytes());
+			return false;
+		}
+
+		return true;
+	}
+
+	void DataBuffer::UnclaimFor(MemoryAccount *account) noexcept
+	{
+		if ((account == nullptr) || (_account.load(std::memory_order_relaxed) != account))
+		{
+			return;
+		}
+
+		auto expected = account;
+
+		if (_account.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel))
+		{
+			account->Uncharge(GetChargedBytes());
+		}
+	}
+
+	void DataBuffer::Free(DataBuffer *buffer) noexcept
+	{
+		auto size_class = buffer->_size_class;
+		void *block = buffer;
+
+		auto account = buffer->_account.load(std::memory_order_acquire);
+		if (account != nullptr)
+		{
+			account->Uncharge(buffer->GetChargedBytes());
+		}
+
+		buffer->~DataBuffer();
+
+		if (size_class == UNPOOLED)
+		{
+			::free(block);
+			GetGlobalState().stats[UNPOOLED].heap_free_count.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		auto thread_cache = GetThreadCache();
+		if (thread_cache == nullptr)
+		{
+			ReturnToPool(size_class, &block, 1);
+			return;
+		}
+
+		auto &free_list = thread_cache->free_lists[size_class];
+		free_list.push_back(block);
+
+		auto limit = THREAD_CACHE_LIMITS[size_class];
+		if (free_list.size() > limit)
+		{
+			// Hand half over to the shared pool, so a thread that only releases buffers
+			// (e.g. the sender of packets received on another thread) does not hoard them
+			auto count = free_list.size() - (limit / 2);
+			ReturnToPool(size_class, free_list.data() + (free_list.size() - count), count);
+			free_list.resize(free_list.size() - count);
+		}
+	}
+
+	std::vector<DataBuffer::Stats> DataBuffer::GetStats()
+	{
+		auto &state = GetGlobalState();
+		std::vector<Stats> stats_list;
+
+		for (size_t size_class = 0; size_class <= SIZE_CLASS_COUNT; size_class++)
+		{
+			auto &source = state.stats[size_class];
+			Stats stats;
+
+			stats.capacity = (size_class < SIZE_CLASS_COUNT) ? SIZE_CLASSES[size_class] : 0;
+			stats.allocate_count = source.allocate_count.load(std::memory_order_relaxed);
+			stats.thread_cache_hit_count = source.thread_cache_hit_count.load(std::memory_order_relaxed);
+			stats.pool_hit_count = source.pool_hit_count.load(std::memory_order_relaxed);
+			stats.heap_allocate_count = source.heap_allocate_count.load(std::memory_order_relaxed);
+			stats.heap_free_count = source.heap_free_count.load(std::memory_order_relaxed);
+
+			stats_list.push_back(stats);
+		}
+
+		return stats_list;
+	}
+}  // namespace ov
@@ -0,0 +1,234 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ov
+{
+	class MemoryAccount;
+
+	/// Storage of ov::Data: an intrusive reference count and the payload in one allocation.
+	///
+	/// Buffers up to 1 MB come from size-class pools with a per-thread cache in front of them,
+	/// so the per-packet Data instances of sockets and packetizers do not go through malloc().
+	/// Above 64 KB the classes double, so a frame never takes more than twice its size.
+	/// Larger buffers are allocated and freed directly.
+	///
+	/// A buffer may be charged to an ov::MemoryAccount, which counts its capacity and header as
+	/// live bytes until the buffer is freed or charged to another account.
+	class DataBuffer
+	{
+	public:
+		// Capacity of each pooled size class; anything larger is not pooled
+		static constexpr size_t SIZE_CLASSES[] = {256, 1536, 64 * 1024, 128 * 1024, 256 * 1024, 512 * 1024, 1024 * 1024};
+		static constexpr size_t SIZE_CLASS_COUNT = sizeof(SIZE_CLASSES) / sizeof(SIZE_CLASSES[0]);
+		static constexpr uint32_t UNPOOLED = SIZE_CLASS_COUNT;
+
+		struct Stats
+		{
+			// 0 for the unpooled class
+			size_t capacity = 0;
+
+			uint64_t allocate_count = 0;
+			// Served from the cache of the calling thread
+			uint64_t thread_cache_hit_count = 0;
+			// Served from the shared pool
+			uint64_t pool_hit_count = 0;
+			// Went through malloc()/free()
+			uint64_t heap_allocate_count = 0;
+			uint64_t heap_free_count = 0;
+		};
+
+		/// Allocates a buffer of at least <capacity> bytes with a reference count of 1
+		///
+		/// @return nullptr if the memory could not be allocated
+		static DataBuffer *Allocate(size_t capacity);
+
+		/// Statistics of each size class, followed by the unpooled class
+		static std::vector<Stats> GetStats();
+
+		inline void AddRef() noexcept
+		{
+			_ref_count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/// Returns the buffer to its pool when the last reference is released
+		inline void Release() noexcept
+		{
+			if (_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				Free(this);
+			}
+		}
+
+		inline uint32_t GetRefCount() const noexcept
+		{
+			return _ref_count.load(std::memory_order_acquire);
+		}
+
+		inline uint8_t *GetData() noexcept
+		{
+			return reinterpret_cast<uint8_t *>(this) + sizeof(DataBuffer);
+		}
+
+		inline const uint8_t *GetData() const noexcept
+		{
+			return reinterpret_cast<const uint8_t *>(this) + sizeof(DataBuffer);
+		}
+
+		inline size_t GetCapacity() const noexcept
+		{
+			return _capacity;
+		}
+
+		/// Number of bytes in use from the beginning of the payload
+		inline size_t GetSize() const noexcept
+		{
+			return _size;
+		}
+
+		inline void SetSize(size_t size) noexcept
+		{
+			_size = size;
+		}
+
+		inline MemoryAccount *GetAccount() const noexcept
+		{
+			return _account.load(std::memory_order_acquire);
+		}
+
+		/// Bytes the buffer counts for in its account
+		inline size_t GetChargedBytes() const noexcept
+		{
+			return sizeof(DataBuffer) + _capacity;
+		}
+
+		/// Moves the charge of the buffer to <account>, or uncharges it if <account> is nullptr.
+		/// The caller must keep <account> alive.
+		void ChargeTo(MemoryAccount *account) noexcept;
+
+		/// Charges the buffer to <account> if it is not charged to any account
+		///
+		/// @return true if the buffer is charged to <account> now
+		bool ClaimFor(MemoryAccount *account) noexcept;
+
+		/// Uncharges the buffer if it is still charged to <account>
+		void UnclaimFor(MemoryAccount *account) noexcept;
+
+	private:
+		DataBuffer(uint32_t size_class, size_t capacity)
+			: _size_class(size_class),
+			  _capacity(capacity)
+		{
+		}
+
+		static void Free(DataBuffer *buffer) noexcept;
+
+		std::atomic<uint32_t> _ref_count{1};
+		uint32_t _size_class = UNPOOLED;
+		size_t _capacity = 0;
+		size_t _size = 0;
+		// Also keeps the payload 16-byte aligned like malloc()
+		std::atomic<MemoryAccount *> _account{nullptr};
+	};
+
+	static_assert((sizeof(DataBuffer) % 16) == 0, "The payload of DataBuffer must be 16-byte aligned");
+
+	/// Holds a reference to a DataBuffer, like std::shared_ptr without a separate control block
+	class DataBufferPtr
+	{
+	public:
+		DataBufferPtr() = default;
+
+		/// Adopts the reference of Allocate()
+		explicit DataBufferPtr(DataBuffer *buffer) noexcept
+			: _buffer(buffer)
+		{
+		}
+
+		DataBufferPtr(const DataBufferPtr &other) noexcept
+			: _buffer(other._buffer)
+		{
+			if (_buffer != nullptr)
+			{
+				_buffer->AddRef();
+			}
+		}
+
+		DataBufferPtr(DataBufferPtr &&other) noexcept
+			: _buffer(std::exchange(other._buffer, nullptr))
+		{
+		}
+
+		~DataBufferPtr()
+		{
+			Reset();
+		}
+
+		DataBufferPtr &operator=(const DataBufferPtr &other) noexcept
+		{
+			DataBufferPtr(other).Swap(*this);
+			return *this;
+		}
+
+		DataBufferPtr &operator=(DataBufferPtr &&other) noexcept
+		{
+			DataBufferPtr(std::move(other)).Swap(*this);
+			return *this;
+		}
+
+		void Reset(DataBuffer *buffer = nullptr) noexcept
+		{
+			if (_buffer != nullptr)
+			{
+				_buffer->Release();
+			}
+
+			_buffer = buffer;
+		}
+
+		void Swap(DataBufferPtr &other) noexcept
+		{
+			std::swap(_buffer, other._buffer);
+		}
+
+		inline DataBuffer *Get() const noexcept
+		{
+			return _buffer;
+		}
+
+		inline DataBuffer *operator->() const noexcept
+		{
+			return _buffer;
+		}
+
+		inline bool operator==(std::nullptr_t) const noexcept
+		{
+			return _buffer == nullptr;
+		}
+
+		inline bool operator!=(std::nullptr_t) const noexcept
+		{
+			return _buffer != nullptr;
+		}
+
+		inline uint32_t UseCount() const noexcept
+		{
+			return (_buffer != nullptr) ? _buffer->GetRefCount() : 0;
+		}
+
+	private:
+		DataBuffer *_buffer = nullptr;
+	};
+}  // namespace ov
@@ -9,8 +9,11 @@
 #include <gtest/gtest.h>
 
 #include <base/ovlibrary/data.h>
+#include <base/ovlibrary/mapped_file.h>
 
+#include <cstdio>
 #include <cstring>
+#include <unistd.h>
 
 // ---------------------------------------------------------------------------
 // Construction
@@ -171,3 +174,231 @@ TEST(OvData, MakeSharedFromBuffer)
 	EXPECT_EQ(d->GetLength(), 2u);
 	EXPECT_EQ(d->At(0), 0xAAu);
 }
+
+// ---------------------------------------------------------------------------
+// Storage
+// ---------------------------------------------------------------------------
+
+TEST(OvData, SetLengthZeroFillsGrowth)
+{
+	ov::Data d;
+	ASSERT_TRUE(d.SetLengthUninitialized(16));
+	::memset(d.GetWritableData(), 0xCC, 16);
+
+	ASSERT_TRUE(d.SetLength(4));
+	ASSERT_TRUE(d.SetLength(8));
+	EXPECT_EQ(d.At(3), 0xCCu);
+	EXPECT_EQ(d.At(4), 0u);
+	EXPECT_EQ(d.At(7), 0u);
+
+	// Growth within the capacity keeps the buffer in place
+	auto before = d.GetData();
+	ASSERT_TRUE(d.SetLengthUninitialized(12));
+	EXPECT_EQ(d.GetData(), before);
+	EXPECT_EQ(d.GetLength(), 12u);
+}
+
+TEST(OvData, SubdataIsCopiedOnWrite)
+{
+	const uint8_t buf[] = {1, 2, 3, 4, 5, 6};
+	auto d = std::make_shared<ov::Data>(buf, sizeof(buf));
+	auto sub = d->Subdata(2, 3);
+
+	// Shares the buffer until either side is modified
+	EXPECT_EQ(sub->GetData(), d->GetDataAs<uint8_t>() + 2);
+
+	static_cast<uint8_t *>(sub->GetWritableData())[0] = 30;
+	EXPECT_EQ(sub->At(0), 30u);
+	EXPECT_EQ(d->At(2), 3u);
+	EXPECT_EQ(sub->GetLength(), 3u);
+
+	d->Append(buf, 2);
+	EXPECT_EQ(d->GetLength(), 8u);
+	EXPECT_EQ(d->At(7), 2u);
+	EXPECT_EQ(sub->At(2), 5u);
+}
+
+TEST(OvData, InsertEraseAndSelfAppend)
+{
+	const uint8_t buf[] = {1, 2, 3, 4};
+	ov::Data d(buf, sizeof(buf));
+
+	const uint8_t middle[] = {9, 9};
+	ASSERT_TRUE(d.Insert(middle, 2, sizeof(middle)));
+	const uint8_t inserted[] = {1, 2, 9, 9, 3, 4};
+	EXPECT_TRUE(d.IsEqual(inserted, sizeof(inserted)));
+
+	ASSERT_TRUE(d.Erase(1, 3));
+	const uint8_t erased[] = {1, 3, 4};
+	EXPECT_TRUE(d.IsEqual(erased, sizeof(erased)));
+
+	// Appending its own bytes while the buffer grows
+	for (int i = 0; i < 10; i++)
+	{
+		ASSERT_TRUE(d.Append(&d));
+	}
+
+	EXPECT_EQ(d.GetLength(), 3u * 1024);
+	EXPECT_EQ(d.At(3 * 1023), 1u);
+	EXPECT_EQ(d.At(3 * 1024 - 1), 4u);
+}
+
+TEST(OvData, ReusesPooledBuffers)
+{
+	// 64 KB size class, which nothing else in this test uses
+	auto find_stats = []() {
+		for (const auto &stats : ov::DataBuffer::GetStats())
+		{
+			if (stats.capacity == 64 * 1024)
+			{
+				return stats;
+			}
+		}
+
+		return ov::DataBuffer::Stats();
+	};
+
+	auto before = find_stats();
+
+	for (int i = 0; i < 100; i++)
+	{
+		auto d = std::make_shared<ov::Data>(60 * 1024);
+		ASSERT_TRUE(d->SetLengthUninitialized(60 * 1024));
+		EXPECT_EQ(d->GetCapacity(), 64u * 1024);
+	}
+
+	auto after = find_stats();
+
+	EXPECT_EQ(after.allocate_count - before.allocate_count, 100u);
+	// Only the first buffer can come from the heap; the rest are the same buffer returned to the cache
+	EXPECT_LE(after.heap_allocate_count - before.heap_allocate_count, 1u);
+	EXPECT_GE(after.thread_cache_hit_count - before.thread_cache_hit_count, 99u);
+}
+
+TEST(OvData, EmptyDataAllocatesNothing)
+{
+	ov::Data d;
+	EXPECT_EQ(d.GetCapacity(), 0u);
+	EXPECT_EQ(d.GetWritableData(), nullptr);
+
+	const uint8_t byte = 1;
+	ASSERT_TRUE(d.Append(&byte, sizeof(byte)));
+	EXPECT_GT(d.GetCapacity(), 0u);
+
+	ASSERT_TRUE(d.Clear());
+	EXPECT_EQ(d.GetCapacity(), 0u);
+	EXPECT_TRUE(d.IsEmpty());
+}
+
+// ---------------------------------------------------------------------------
+// Memory-mapped file
+// ---------------------------------------------------------------------------
+
+namespace
+{
+	ov::String WriteTempFile(const char *content)
+	{
+		char path[] = "/tmp/ov_data_test_XXXXXX";
+		int fd = ::mkstemp(path);
+		EXPECT_GE(fd, 0);
+		EXPECT_EQ(::write(fd, content, ::strlen(content)), static_cast<ssize_t>(::strlen(content)));
+		::close(fd);
+		return path;
+	}
+}  // namespace
+
+TEST(OvData, MappedFileSubdataKeepsMapping)
+{
+	auto path = WriteTempFile("0123456789");
+
+	std::shared_ptr<const ov::Data> subdata;
+	{
+		auto file = ov::MappedFile::Open(path);
+		ASSERT_NE(file, nullptr);
+
+		auto d = file->GetData(2, 5);
+		ASSERT_NE(d, nullptr);
+		EXPECT_EQ(d->GetMappedFile(), file);
+		EXPECT_EQ(d->GetMappedFileOffset(), 2);
+
+		subdata = d->Subdata(1, 3);
+	}
+
+	// The mapping outlives the MappedFile handle and the original Data
+	ASSERT_NE(subdata->GetMappedFile(), nullptr);
+	EXPECT_EQ(subdata->GetMappedFileOffset(), 3);
+	EXPECT_TRUE(subdata->IsEqual("345", 3));
+
+	std::remove(path);
+}
+
+TEST(OvData, MappedFileCopyOnWrite)
+{
+	auto path = WriteTempFile("abcdef");
+	auto file = ov::MappedFile::Open(path);
+	ASSERT_NE(file, nullptr);
+
+	auto d = file->GetData();
+	auto writable = d->GetWritableDataAs<uint8_t>();
+	ASSERT_NE(writable, nullptr);
+	writable[0] = 'X';
+
+	// Modified data no longer refers to the file, and the file is untouched
+	EXPECT_EQ(d->GetMappedFile(), nullptr);
+	EXPECT_TRUE(d->IsEqual("Xbcdef", 6));
+	EXPECT_TRUE(file->GetData()->IsEqual("abcdef", 6));
+
+	EXPECT_EQ(file->GetData(4, 3), nullptr);
+
+	std::remove(path);
+}
+
+TEST(OvData, MappedFileCacheDetectsReplacedFile)
+{
+	auto cache = ov::MappedFileCache::GetInstance();
+	auto path = WriteTempFile("first");
+
+	auto first = cache->Get(path);
+	ASSERT_NE(first, nullptr);
+	EXPECT_EQ(cache->Get(path), first);
+
+	// Replace the file the way FMP4Storage does (write + rename)
+	auto replacement = WriteTempFile("second!");
+	ASSERT_EQ(std::rename(replacement, path), 0);
+
+	auto second = cache->Get(path);
+	ASSERT_NE(second, nullptr);
+	EXPECT_NE(second, first);
+	EXPECT_TRUE(second->GetData()->IsEqual("second!", 7));
+	EXPECT_TRUE(first->GetData()->IsEqual("first", 5));
+
+	std::remove(path);
+	EXPECT_EQ(cache->Get(path), nullptr);
+}
+
+TEST(OvData, MappedFileCacheEvictsLeastRecentlyUsed)
+{
+	auto cache = ov::MappedFileCache::GetInstance();
+	cache->SetCapacity(2);
+
+	auto a = WriteTempFile("a");
+	auto b = WriteTempFile("b");
+	auto c = WriteTempFile("c");
+
+	auto file_a = cache->Get(a);
+	cache->Get(b);
+	// Touch <a> so <b> becomes the least recently used
+	EXPECT_EQ(cache->Get(a), file_a);
+	cache->Get(c);
+
+	EXPECT_EQ(cache->GetCount(), 2u);
+	EXPECT_EQ(cache->Get(a), file_a);
+
+	cache->SetCapacity(ov::MappedFileCache::DEFAULT_CAPACITY);
+
+	for (const auto &path : {a, b, c})
+	{
+		cache->Remove(path);
+		std::remove(path);
+	}
+}
@@ -0,0 +1,201 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "./data.h"
+#include "./log.h"
+
+#define OV_LOG_TAG "MappedFile"
+
+namespace ov
+{
+	std::shared_ptr<MappedFile> MappedFile::Open(const String &path)
+	{
+		auto file = std::shared_ptr<MappedFile>(new MappedFile());
+
+		file->_path = path;
+		file->_fd = ::open(path.CStr(), O_RDONLY | O_CLOEXEC);
+
+		if (file->_fd < 0)
+		{
+			logtd("Could not open file: %s (%s)", path.CStr(), ::strerror(errno));
+			return nullptr;
+		}
+
+		if ((::fstat(file->_fd, &(file->_stat)) != 0) || (S_ISREG(file->_stat.st_mode) == false))
+		{
+			logtd("Could not map file: %s is not a regular file", path.CStr());
+			return nullptr;
+		}
+
+		file->_size = static_cast<size_t>(file->_stat.st_size);
+
+		if (file->_size == 0)
+		{
+			// mmap() does not accept an empty mapping
+			return file;
+		}
+
+		auto address = ::mmap(nullptr, file->_size, PROT_READ, MAP_SHARED, file->_fd, 0);
+		if (address == MAP_FAILED)
+		{
+			logtw("Could not map file: %s (%s)", path.CStr(), ::strerror(errno));
+			return nullptr;
+		}
+
+		file->_address = address;
+
+		return file;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (_address != nullptr)
+		{
+			::munmap(_address, _size);
+		}
+
+		if (_fd >= 0)
+		{
+			::close(_fd);
+		}
+	}
+
+	bool MappedFile::IsSameFile(const struct stat &stat) const
+	{
+		return (stat.st_dev == _stat.st_dev) &&
+			   (stat.st_ino == _stat.st_ino) &&
+			   (stat.st_size == _stat.st_size) &&
+			   (stat.st_mtim.tv_sec == _stat.st_mtim.tv_sec) &&
+			   (stat.st_mtim.tv_nsec == _stat.st_mtim.tv_nsec);
+	}
+
+	std::shared_ptr<Data> MappedFile::GetData(size_t offset, size_t length)
+	{
+		if ((offset > _size) || (length > (_size - offset)))
+		{
+			logtw("Invalid range of %s: offset: %zu, length: %zu (size: %zu)", _path.CStr(), offset, length, _size);
+			return nullptr;
+		}
+
+		if (length == 0)
+		{
+			return std::make_shared<Data>();
+		}
+
+		return std::make_shared<Data>(GetSharedPtr(), offset, length);
+	}
+
+	std::shared_ptr<Data> MappedFile::GetData()
+	{
+		return GetData(0, _size);
+	}
+
+	std::shared_ptr<MappedFile> MappedFileCache::Get(const String &path)
+	{
+		// stat() is far cheaper than open() + mmap() and tells whether the cached mapping is stale
+		struct stat stat;
+		if (::stat(path.CStr(), &stat) != 0)
+		{
+			Remove(path);
+			return nullptr;
+		}
+
+		{
+			LockGuard lock_guard(_mutex);
+
+			auto item = _file_map.find(path);
+			if (item != _file_map.end())
+			{
+				auto file = *(item->second);
+
+				if (file->IsSameFile(stat))
+				{
+					_lru_list.splice(_lru_list.begin(), _lru_list, item->second);
+					_hit_count++;
+					return file;
+				}
+
+				_lru_list.erase(item->second);
+				_file_map.erase(item);
+			}
+		}
+
+		_miss_count++;
+
+		// Map the file outside of the lock
+		auto file = MappedFile::Open(path);
+		if (file == nullptr)
+		{
+			return nullptr;
+		}
+
+		LockGuard lock_guard(_mutex);
+
+		auto item = _file_map.find(path);
+		if (item != _file_map.end())
+		{
+			// Another thread mapped the same file in the meantime
+			_lru_list.erase(item->second);
+			_file_map.erase(item);
+		}
+
+		_lru_list.push_front(file);
+		_file_map.emplace(path, _lru_list.begin());
+
+		EvictIfNeeded();
+
+		return file;
+	}
+
+	void MappedFileCache::Remove(const String &path)
+	{
+		LockGuard lock_guard(_mutex);
+
+		auto item = _file_map.find(path);
+		if (item != _file_map.end())
+		{
+			_lru_list.erase(item->second);
+			_file_map.erase(item);
+		}
+	}
+
+	void MappedFileCache::SetCapacity(size_t capacity)
+	{
+		LockGuard lock_guard(_mutex);
+
+		_capacity = capacity;
+		EvictIfNeeded();
+	}
+
+	size_t MappedFileCache::GetCapacity() const
+	{
+		LockGuard lock_guard(_mutex);
+		return _capacity;
+	}
+
+	size_t MappedFileCache::GetCount() const
+	{
+		LockGuard lock_guard(_mutex);
+		return _lru_list.size();
+	}
+
+	void MappedFileCache::EvictIfNeeded()
+	{
+		while (_lru_list.size() > _capacity)
+		{
+			_file_map.erase(_lru_list.back()->GetPath());
+			_lru_list.pop_back();
+		}
+	}
+}  // namespace ov
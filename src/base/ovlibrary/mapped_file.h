@@ -0,0 +1,123 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sys/stat.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "./enable_shared_from_this.h"
+#include "./singleton.h"
+#include "./string.h"
+#include "./tsa/mutex.h"
+
+namespace ov
+{
+	class Data;
+
+	// Read-only memory mapping of a whole file.
+	//
+	// The file descriptor stays open while the instance is alive, so a plaintext TCP socket
+	// can send a region of it with sendfile() (see Socket::SendData()), and anything else
+	// (TLS, HTTP/2 framing) reads the mapped pages without copying them into the heap.
+	//
+	// The mapping is only safe for files that are replaced (write to a temporary file
+	// and rename()) rather than truncated in place, since touching a page past the new
+	// end of a truncated file raises SIGBUS.
+	class MappedFile : public EnableSharedFromThis<MappedFile>
+	{
+	public:
+		static std::shared_ptr<MappedFile> Open(const String &path);
+
+		~MappedFile() override;
+
+		const String &GetPath() const
+		{
+			return _path;
+		}
+
+		int GetFd() const
+		{
+			return _fd;
+		}
+
+		size_t GetSize() const
+		{
+			return _size;
+		}
+
+		const void *GetAddress() const
+		{
+			return _address;
+		}
+
+		// Whether <stat> still describes the file that was mapped
+		bool IsSameFile(const struct stat &stat) const;
+
+		// Returns a Data that refers to [offset, offset + length) of the mapping without copying.
+		// The mapping is kept alive as long as the Data (or any Subdata() of it) exists, and
+		// modifying the Data copies it out of the mapping (copy-on-write).
+		std::shared_ptr<Data> GetData(size_t offset, size_t length);
+		std::shared_ptr<Data> GetData();
+
+	private:
+		MappedFile() = default;
+
+		String _path;
+		int _fd = -1;
+		void *_address = nullptr;
+		size_t _size = 0;
+		struct stat _stat = {};
+	};
+
+	// LRU cache of open mappings, so files that are requested repeatedly (DVR segments,
+	// recordings, static assets) are not reopened and remapped on every request.
+	//
+	// An evicted mapping stays valid until the last Data that refers to it is released.
+	class MappedFileCache : public Singleton<MappedFileCache>
+	{
+	public:
+		static constexpr size_t DEFAULT_CAPACITY = 256;
+
+		// Returns the cached mapping of <path>. The file is (re)mapped if it is not cached
+		// or if it has been replaced since it was mapped.
+		std::shared_ptr<MappedFile> Get(const String &path);
+		void Remove(const String &path);
+
+		void SetCapacity(size_t capacity);
+		size_t GetCapacity() const;
+		size_t GetCount() const;
+
+		uint64_t GetHitCount() const
+		{
+			return _hit_count;
+		}
+
+		uint64_t GetMissCount() const
+		{
+			return _miss_count;
+		}
+
+	private:
+		void EvictIfNeeded() OV_REQUIRES(_mutex);
+
+		mutable Mutex _mutex;
+
+		size_t _capacity OV_GUARDED_BY(_mutex) = DEFAULT_CAPACITY;
+		// Most recently used mapping is at the front
+		std::list<std::shared_ptr<MappedFile>> _lru_list OV_GUARDED_BY(_mutex);
+		std::unordered_map<String, std::list<std::shared_ptr<MappedFile>>::iterator> _file_map OV_GUARDED_BY(_mutex);
+
+		std::atomic<uint64_t> _hit_count{0};
+		std::atomic<uint64_t> _miss_count{0};
+	};
+}  // namespace ov
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "./memory_accounting.h"
+
+namespace ov
+{
+	const char *StringFromMemoryTag(MemoryTag tag)
+	{
+		switch (tag)
+		{
+			case MemoryTag::Fmp4Storage:
+				return "fmp4Storage";
+			case MemoryTag::MirrorBuffer:
+				return "mirrorBuffer";
+			case MemoryTag::RtpHistory:
+				return "rtpHistory";
+			case MemoryTag::HlsSegment:
+				return "hlsSegment";
+			case MemoryTag::QueueBacklog:
+				return "queueBacklog";
+			case MemoryTag::GopCache:
+				return "gopCache";
+		}
+
+		return "unknown";
+	}
+
+	std::shared_ptr<MemoryAccount> MemoryAccounting::GetAccount(MemoryTag tag, const ov::String &stream_uri)
+	{
+		LockGuard lock_guard(_mutex);
+
+		auto &account = _account_map[{stream_uri, tag}];
+
+		if (account == nullptr)
+		{
+			account = std::make_shared<MemoryAccount>(tag, stream_uri);
+		}
+
+		return account;
+	}
+
+	void MemoryAccounting::RemoveUnusedAccounts()
+	{
+		for (auto item = _account_map.begin(); item != _account_map.end();)
+		{
+			auto &account = item->second;
+
+			// A buffer is uncharged before it lets the account go, so an account without live
+			// bytes and without any other holder is not referred to by anything
+			if ((account.use_count() == 1) && (account->GetLiveBytes() == 0))
+			{
+				item = _account_map.erase(item);
+			}
+			else
+			{
+				++item;
+			}
+		}
+	}
+
+	MemoryAccounting::Report MemoryAccounting::GetReport()
+	{
+		LockGuard lock_guard(_mutex);
+
+		RemoveUnusedAccounts();
+
+		Report report;
+		size_t live_bytes_of_tags[MEMORY_TAG_COUNT] = {};
+		StreamStats *stream_stats = nullptr;
+
+		// The accounts of a stream are next to each other, since the map is ordered by the stream
+		for (const auto &[key, account] : _account_map)
+		{
+			AccountStats stats;
+
+			stats.tag = account->GetTag();
+			stats.live_bytes = account->GetLiveBytes();
+			stats.peak_bytes = account->GetPeakBytes();
+
+			live_bytes_of_tags[static_cast<size_t>(stats.tag)] += stats.live_bytes;
+			report.live_bytes += stats.live_bytes;
+
+			if (account->GetStreamUri().IsEmpty())
+			{
+				continue;
+			}
+
+			if ((stream_stats == nullptr) || (stream_stats->stream_uri != account->GetStreamUri()))
+			{
+				report.streams.emplace_back();
+				stream_stats = &report.streams.back();
+				stream_stats->stream_uri = account->GetStreamUri();
+			}
+
+			stream_stats->live_bytes += stats.live_bytes;
+			stream_stats->accounts.push_back(stats);
+		}
+
+		for (size_t index = 0; index < MEMORY_TAG_COUNT; index++)
+		{
+			AccountStats stats;
+
+			_peak_bytes_of_tags[index] = std::max(_peak_bytes_of_tags[index], live_bytes_of_tags[index]);
+
+			stats.tag = static_cast<MemoryTag>(index);
+			stats.live_bytes = live_bytes_of_tags[index];
+			stats.peak_bytes = _peak_bytes_of_tags[index];
+
+			report.tags.push_back(stats);
+		}
+
+		return report;
+	}
+}  // namespace ov
@@ -0,0 +1,145 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "./singleton.h"
+#include "./string.h"
+#include "./tsa/mutex.h"
+
+namespace ov
+{
+	// What holds the memory of an account
+	enum class MemoryTag : uint8_t
+	{
+		// Segments and partial segments of the fMP4 storage of LLHLS
+		Fmp4Storage,
+		// Packets the MediaRouter keeps for the taps of a stream
+		MirrorBuffer,
+		// RTP packets a WebRTC stream keeps for the retransmissions
+		RtpHistory,
+		// MPEG-TS segments of the HLS packager
+		HlsSegment,
+		// Packets waiting in the queue of a MediaRouter stream
+		QueueBacklog,
+		// RTP packets of the current GOP a WebRTC stream keeps for new sessions
+		GopCache
+	};
+
+	constexpr size_t MEMORY_TAG_COUNT = 6;
+
+	const char *StringFromMemoryTag(MemoryTag tag);
+
+	// Live bytes of the ov::Data buffers charged to one tag of one stream.
+	//
+	// A buffer is charged to at most one account at a time, so the accounts never count the same
+	// memory twice:
+	//  - A container that retains the data, such as a segment storage, takes the charge of the
+	//    buffer over with ov::Data::ChargeMemoryTo()
+	//  - A queue that only passes the data on claims the buffers nobody is charged for with
+	//    ov::Data::ClaimMemoryFor(), and gives them back with ov::Data::UnclaimMemoryFor()
+	//
+	// A buffer is uncharged when it is freed.
+	class MemoryAccount
+	{
+	public:
+		MemoryAccount(MemoryTag tag, const ov::String &stream_uri)
+			: _tag(tag),
+			  _stream_uri(stream_uri)
+		{
+		}
+
+		MemoryTag GetTag() const
+		{
+			return _tag;
+		}
+
+		// Empty for an account that does not belong to a stream
+		const ov::String &GetStreamUri() const
+		{
+			return _stream_uri;
+		}
+
+		inline void Charge(size_t bytes) noexcept
+		{
+			auto live_bytes = _live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+			auto peak_bytes = _peak_bytes.load(std::memory_order_relaxed);
+
+			while ((live_bytes > peak_bytes) && (_peak_bytes.compare_exchange_weak(peak_bytes, live_bytes, std::memory_order_relaxed) == false))
+			{
+			}
+		}
+
+		inline void Uncharge(size_t bytes) noexcept
+		{
+			_live_bytes.fetch_sub(bytes, std::memory_order_acq_rel);
+		}
+
+		size_t GetLiveBytes() const
+		{
+			return _live_bytes.load(std::memory_order_acquire);
+		}
+
+		size_t GetPeakBytes() const
+		{
+			return _peak_bytes.load(std::memory_order_relaxed);
+		}
+
+	private:
+		const MemoryTag _tag;
+		const ov::String _stream_uri;
+
+		std::atomic<size_t> _live_bytes{0};
+		std::atomic<size_t> _peak_bytes{0};
+	};
+
+	// The accounts of the server, by tag and stream
+	class MemoryAccounting : public Singleton<MemoryAccounting>
+	{
+	public:
+		struct AccountStats
+		{
+			MemoryTag tag = MemoryTag::Fmp4Storage;
+			size_t live_bytes = 0;
+			size_t peak_bytes = 0;
+		};
+
+		struct StreamStats
+		{
+			ov::String stream_uri;
+			size_t live_bytes = 0;
+			std::vector<AccountStats> accounts;
+		};
+
+		struct Report
+		{
+			// Totals of each tag. The peak is the highest total seen by GetReport().
+			std::vector<AccountStats> tags;
+			size_t live_bytes = 0;
+			std::vector<StreamStats> streams;
+		};
+
+		// Returns the account of <tag> for <stream_uri>, shared by everything that asks for it.
+		// The account is dropped once nobody holds it and nothing is charged to it.
+		std::shared_ptr<MemoryAccount> GetAccount(MemoryTag tag, const ov::String &stream_uri = "");
+
+		Report GetReport();
+
+	protected:
+		void RemoveUnusedAccounts() OV_REQUIRES(_mutex);
+
+		Mutex _mutex;
+		std::map<std::pair<ov::String, MemoryTag>, std::shared_ptr<MemoryAccount>> _account_map OV_GUARDED_BY(_mutex);
+		size_t _peak_bytes_of_tags[MEMORY_TAG_COUNT] OV_GUARDED_BY(_mutex) = {};
+	};
+}  // namespace ov
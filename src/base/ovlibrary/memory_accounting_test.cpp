@@ -0,0 +1,163 @@
+//==============================================================================
+//
+//  OvenMediaEngine - Unit Tests
+//
+//  src/base/ovlibrary/memory_accounting_test.cpp
+//  Covers: MemoryAccount, MemoryAccounting, ov::Data charges
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <base/ovlibrary/data.h>
+#include <base/ovlibrary/memory_accounting.h>
+
+namespace
+{
+	std::shared_ptr<ov::Data> MakeData(size_t length)
+	{
+		auto data = std::make_shared<ov::Data>(length);
+		data->SetLength(length);
+
+		return data;
+	}
+
+	const ov::MemoryAccounting::StreamStats *FindStream(const ov::MemoryAccounting::Report &report, const ov::String &stream_uri)
+	{
+		for (const auto &stream : report.streams)
+		{
+			if (stream.stream_uri == stream_uri)
+			{
+				return &stream;
+			}
+		}
+
+		return nullptr;
+	}
+}  // namespace
+
+TEST(MemoryAccounting, ChargesUntilTheBufferIsFreed)
+{
+	auto account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::Fmp4Storage, "#test#charge/stream");
+	auto data = MakeData(1000);
+
+	ASSERT_TRUE(data->ChargeMemoryTo(account));
+	EXPECT_GE(account->GetLiveBytes(), 1000u);
+
+	auto charged_bytes = account->GetLiveBytes();
+
+	// Charging the same buffer again does not count it twice, neither does a clone sharing it
+	auto clone = data->Clone();
+	ASSERT_TRUE(data->ChargeMemoryTo(account));
+	ASSERT_TRUE(clone->ChargeMemoryTo(account));
+	EXPECT_EQ(account->GetLiveBytes(), charged_bytes);
+
+	data.reset();
+	EXPECT_EQ(account->GetLiveBytes(), charged_bytes);
+
+	clone.reset();
+	EXPECT_EQ(account->GetLiveBytes(), 0u);
+	EXPECT_EQ(account->GetPeakBytes(), charged_bytes);
+}
+
+TEST(MemoryAccounting, MovesTheChargeToTheNextAccount)
+{
+	auto accounting = ov::MemoryAccounting::GetInstance();
+	auto queue_account = accounting->GetAccount(ov::MemoryTag::QueueBacklog, "#test#move/stream");
+	auto storage_account = accounting->GetAccount(ov::MemoryTag::HlsSegment, "#test#move/stream");
+	auto data = MakeData(500);
+
+	ASSERT_TRUE(data->ClaimMemoryFor(queue_account));
+	auto charged_bytes = queue_account->GetLiveBytes();
+	EXPECT_GE(charged_bytes, 500u);
+
+	// A storage that retains the data takes the charge over
+	ASSERT_TRUE(data->ChargeMemoryTo(storage_account));
+	EXPECT_EQ(queue_account->GetLiveBytes(), 0u);
+	EXPECT_EQ(storage_account->GetLiveBytes(), charged_bytes);
+
+	// ...and the queue neither claims it nor takes it back
+	EXPECT_FALSE(data->ClaimMemoryFor(queue_account));
+	data->UnclaimMemoryFor(queue_account);
+	EXPECT_EQ(queue_account->GetLiveBytes(), 0u);
+	EXPECT_EQ(storage_account->GetLiveBytes(), charged_bytes);
+
+	// A buffer nobody retains is uncharged when the queue lets it go
+	auto passing_data = MakeData(100);
+	ASSERT_TRUE(passing_data->ClaimMemoryFor(queue_account));
+	EXPECT_GT(queue_account->GetLiveBytes(), 0u);
+	passing_data->UnclaimMemoryFor(queue_account);
+	EXPECT_EQ(queue_account->GetLiveBytes(), 0u);
+
+	// Charging to nullptr uncharges the buffer
+	ASSERT_TRUE(data->ChargeMemoryTo(nullptr));
+	EXPECT_EQ(storage_account->GetLiveBytes(), 0u);
+}
+
+TEST(MemoryAccounting, KeepsTheChargeOfReallocatedData)
+{
+	auto account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::RtpHistory, "#test#reallocate/stream");
+	auto data = MakeData(100);
+
+	ASSERT_TRUE(data->ChargeMemoryTo(account));
+	auto charged_bytes = account->GetLiveBytes();
+
+	data->Append(MakeData(64 * 1024));
+	EXPECT_GT(account->GetLiveBytes(), charged_bytes);
+
+	data.reset();
+	EXPECT_EQ(account->GetLiveBytes(), 0u);
+}
+
+TEST(MemoryAccounting, DoesNotChargeReferencedMemory)
+{
+	auto account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::MirrorBuffer, "#test#reference/stream");
+	const uint8_t buffer[16] = {};
+	ov::Data data(buffer, sizeof(buffer), true);
+
+	EXPECT_FALSE(data.ChargeMemoryTo(account));
+	EXPECT_FALSE(data.ClaimMemoryFor(account));
+	EXPECT_EQ(account->GetLiveBytes(), 0u);
+}
+
+TEST(MemoryAccounting, ReportsByTagAndStream)
+{
+	auto accounting = ov::MemoryAccounting::GetInstance();
+	const ov::String stream_uri = "#test#report/stream";
+
+	auto storage_account = accounting->GetAccount(ov::MemoryTag::Fmp4Storage, stream_uri);
+	auto history_account = accounting->GetAccount(ov::MemoryTag::RtpHistory, stream_uri);
+	EXPECT_EQ(accounting->GetAccount(ov::MemoryTag::Fmp4Storage, stream_uri), storage_account);
+
+	auto storage_data = MakeData(2000);
+	auto history_data = MakeData(300);
+	storage_data->ChargeMemoryTo(storage_account);
+	history_data->ChargeMemoryTo(history_account);
+
+	auto report = accounting->GetReport();
+	auto stream = FindStream(report, stream_uri);
+
+	ASSERT_NE(stream, nullptr);
+	EXPECT_EQ(stream->live_bytes, storage_account->GetLiveBytes() + history_account->GetLiveBytes());
+	EXPECT_EQ(stream->accounts.size(), 2u);
+
+	ASSERT_EQ(report.tags.size(), ov::MEMORY_TAG_COUNT);
+	EXPECT_GE(report.tags[static_cast<size_t>(ov::MemoryTag::Fmp4Storage)].live_bytes, storage_account->GetLiveBytes());
+	EXPECT_GE(report.live_bytes, stream->live_bytes);
+
+	// An account is kept while something is charged to it, even if nobody holds it
+	storage_account.reset();
+	history_account.reset();
+	history_data.reset();
+
+	report = accounting->GetReport();
+	stream = FindStream(report, stream_uri);
+
+	ASSERT_NE(stream, nullptr);
+	ASSERT_EQ(stream->accounts.size(), 1u);
+	EXPECT_EQ(stream->accounts[0].tag, ov::MemoryTag::Fmp4Storage);
+	EXPECT_EQ(stream->accounts[0].peak_bytes, stream->accounts[0].live_bytes);
+
+	storage_data.reset();
+
+	EXPECT_EQ(FindStream(accounting->GetReport(), stream_uri), nullptr);
+}
@@ -17,6 +17,7 @@
 #include "./byte_stream.h"
 #include "./clock.h"
 #include "./converter.h"
+#include "./cpu_topology.h"
 #include "./data.h"
 #include "./delay_queue.h"
 #include "./dump_utilities.h"
@@ -24,8 +25,10 @@
 #include "./error.h"
 #include "./json.h"
 #include "./log.h"
+#include "./memory_accounting.h"
 #include "./memory_utilities.h"
 #include "./map_utilities.h"
+#include "./mapped_file.h"
 #include "./ovdata_structure.h"
 #include "./path_manager.h"
 #include "./pcm_utilities.h"
@@ -52,6 +55,7 @@
 #include "./files.h"
 #include "./sequencial_map.h"
 #include "./thread_checker.h"
+#include "./thread_placement.h"
 #include "./tsa/mutex.h"
 #include "./interval_gate.h"
 
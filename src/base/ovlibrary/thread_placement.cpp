@@ -0,0 +1,353 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "./thread_placement.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "./log.h"
+
+#ifdef OME_USE_JEMALLOC
+#	include <jemalloc/jemalloc.h>
+#endif	// OME_USE_JEMALLOC
+
+#define OV_LOG_TAG "ThreadPlacement"
+
+namespace ov
+{
+	namespace
+	{
+		constexpr ThreadRole kThreadRoles[] = {ThreadRole::Network, ThreadRole::Routing, ThreadRole::FanOut, ThreadRole::Codec};
+	}
+
+	const char *StringFromThreadRole(ThreadRole role)
+	{
+		switch (role)
+		{
+			case ThreadRole::Network:
+				return "Network";
+			case ThreadRole::Routing:
+				return "Routing";
+			case ThreadRole::FanOut:
+				return "FanOut";
+			case ThreadRole::Codec:
+				return "Codec";
+		}
+
+		return "Unknown";
+	}
+
+	// Where the calling thread has been pinned. The thread is taken out of the counts of its node
+	// when it exits.
+	class PlacedThread
+	{
+	public:
+		~PlacedThread()
+		{
+			if (_node_id >= 0)
+			{
+				ThreadPlacement::GetInstance()->OnThreadExit(_role, _node_id);
+			}
+		}
+
+		void Set(ThreadRole role, int node_id)
+		{
+			_role = role;
+			_node_id = node_id;
+		}
+
+		ThreadRole GetRole() const
+		{
+			return _role;
+		}
+
+		int GetNodeId() const
+		{
+			return _node_id;
+		}
+
+	protected:
+		ThreadRole _role = ThreadRole::Network;
+		int _node_id = -1;
+	};
+
+	static thread_local PlacedThread placed_thread;
+
+	void ThreadPlacement::Configure(const Config &config, const CpuTopology &topology)
+	{
+		LockGuard lock_guard(_mutex);
+
+		_config = config;
+		_topology = topology;
+		_plan_map.clear();
+		_next_node_index_map.clear();
+
+		if (_config.enabled == false)
+		{
+			logti("Thread placement is disabled");
+			return;
+		}
+
+		if (_topology.IsEmpty())
+		{
+			logtw("Thread placement is disabled because the CPU topology is unknown");
+			_config.enabled = false;
+			return;
+		}
+
+		for (auto role : kThreadRoles)
+		{
+			auto item = _config.cpus.find(role);
+			auto cpus = ((item != _config.cpus.end()) && (item->second.empty() == false)) ? item->second : _topology.GetCpuIds();
+
+			RolePlan plan;
+			plan.role = role;
+
+			std::vector<ov::String> description_list;
+
+			for (auto node_id : _topology.GetNodeIds())
+			{
+				NodePlan node_plan;
+				node_plan.node_id = node_id;
+
+				for (auto cpu_id : _topology.GetCpuIdsOfNode(node_id))
+				{
+					if (std::find(cpus.begin(), cpus.end(), cpu_id) != cpus.end())
+					{
+						node_plan.cpus.push_back(cpu_id);
+					}
+				}
+
+				if (node_plan.cpus.empty() == false)
+				{
+					description_list.push_back(ov::String::FormatString("node %d: %s", node_id, CpuTopology::ToCpuList(node_plan.cpus).CStr()));
+					plan.nodes.push_back(std::move(node_plan));
+				}
+			}
+
+			if (plan.nodes.empty())
+			{
+				logtw("None of the CPUs (%s) of %s threads are online, so they are not pinned", CpuTopology::ToCpuList(cpus).CStr(), StringFromThreadRole(role));
+			}
+			else
+			{
+				logti("%s threads are placed on %s", StringFromThreadRole(role), ov::String::Join(description_list, ", ").CStr());
+			}
+
+			_plan_map[role] = std::move(plan);
+		}
+	}
+
+	bool ThreadPlacement::IsEnabled() const
+	{
+		LockGuard lock_guard(_mutex);
+		return _config.enabled;
+	}
+
+	int ThreadPlacement::GetCurrentNode() const
+	{
+		LockGuard lock_guard(_mutex);
+
+		if (_config.enabled == false)
+		{
+			return -1;
+		}
+
+		if (placed_thread.GetNodeId() >= 0)
+		{
+			return placed_thread.GetNodeId();
+		}
+
+		auto cpu_id = ::sched_getcpu();
+
+		return (cpu_id >= 0) ? _topology.GetNodeOfCpu(cpu_id) : -1;
+	}
+
+	int ThreadPlacement::PlaceCurrentThread(ThreadRole role)
+	{
+		LockGuard lock_guard(_mutex);
+
+		if (_config.enabled == false)
+		{
+			return -1;
+		}
+
+		auto &nodes = _plan_map[role].nodes;
+
+		if (nodes.empty())
+		{
+			return -1;
+		}
+
+		auto &node_index = _next_node_index_map[role];
+
+		return Place(role, nodes[(node_index++) % nodes.size()]);
+	}
+
+	int ThreadPlacement::PlaceCurrentThreadOnNode(ThreadRole role, int node_id)
+	{
+		{
+			LockGuard lock_guard(_mutex);
+
+			if (_config.enabled == false)
+			{
+				return -1;
+			}
+
+			if (node_id < 0)
+			{
+				auto cpu_id = ::sched_getcpu();
+				node_id = (placed_thread.GetNodeId() >= 0) ? placed_thread.GetNodeId() : ((cpu_id >= 0) ? _topology.GetNodeOfCpu(cpu_id) : -1);
+			}
+
+			for (auto &node_plan : _plan_map[role].nodes)
+			{
+				if (node_plan.node_id == node_id)
+				{
+					return Place(role, node_plan);
+				}
+			}
+		}
+
+		return PlaceCurrentThread(role);
+	}
+
+	int ThreadPlacement::Place(ThreadRole role, NodePlan &node_plan)
+	{
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+
+		for (auto cpu_id : node_plan.cpus)
+		{
+			CPU_SET(cpu_id, &cpu_set);
+		}
+
+		auto result = ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+
+		if (result != 0)
+		{
+			logtw("Could not pin a %s thread to node %d (CPUs: %s): %s",
+				  StringFromThreadRole(role), node_plan.node_id, CpuTopology::ToCpuList(node_plan.cpus).CStr(), ::strerror(result));
+			return -1;
+		}
+
+		if (placed_thread.GetNodeId() >= 0)
+		{
+			// The thread moves from where it was placed before
+			for (auto &previous_plan : _plan_map[placed_thread.GetRole()].nodes)
+			{
+				if ((previous_plan.node_id == placed_thread.GetNodeId()) && (previous_plan.thread_count > 0))
+				{
+					previous_plan.thread_count--;
+				}
+			}
+		}
+
+		node_plan.thread_count++;
+		placed_thread.Set(role, node_plan.node_id);
+
+		if (_config.numa_local_arena)
+		{
+			UseNodeArena(node_plan.node_id);
+		}
+
+		return node_plan.node_id;
+	}
+
+	void ThreadPlacement::OnThreadExit(ThreadRole role, int node_id)
+	{
+		LockGuard lock_guard(_mutex);
+
+		for (auto &node_plan : _plan_map[role].nodes)
+		{
+			if ((node_plan.node_id == node_id) && (node_plan.thread_count > 0))
+			{
+				node_plan.thread_count--;
+			}
+		}
+	}
+
+	void ThreadPlacement::UseNodeArena(int node_id)
+	{
+#ifdef OME_USE_JEMALLOC
+		unsigned arena = 0;
+		auto item = _arena_map.find(node_id);
+
+		if (item == _arena_map.end())
+		{
+			size_t size = sizeof(arena);
+			auto result = ::mallctl("arenas.create", &arena, &size, nullptr, 0);
+
+			if (result != 0)
+			{
+				logtw("Could not create a jemalloc arena for node %d (mallctl returned %d)", node_id, result);
+				return;
+			}
+
+			_arena_map[node_id] = arena;
+			logti("jemalloc arena %u has been created for node %d", arena, node_id);
+		}
+		else
+		{
+			arena = item->second;
+		}
+
+		auto result = ::mallctl("thread.arena", nullptr, nullptr, &arena, sizeof(arena));
+
+		if (result != 0)
+		{
+			logtw("Could not use the jemalloc arena %u of node %d (mallctl returned %d)", arena, node_id, result);
+		}
+#else	// OME_USE_JEMALLOC
+		(void)node_id;
+#endif	// OME_USE_JEMALLOC
+	}
+
+	ThreadPlacement::Report ThreadPlacement::GetReport() const
+	{
+		LockGuard lock_guard(_mutex);
+
+		Report report;
+
+		report.enabled = _config.enabled;
+		report.numa_local_arena = _config.numa_local_arena;
+		report.arena_count = _arena_map.size();
+
+		for (auto node_id : _topology.GetNodeIds())
+		{
+			NodePlan node;
+
+			node.node_id = node_id;
+			node.cpus = _topology.GetCpuIdsOfNode(node_id);
+
+			for (const auto &[role, plan] : _plan_map)
+			{
+				for (const auto &node_plan : plan.nodes)
+				{
+					if (node_plan.node_id == node_id)
+					{
+						node.thread_count += node_plan.thread_count;
+					}
+				}
+			}
+
+			report.nodes.push_back(std::move(node));
+		}
+
+		for (const auto &[role, plan] : _plan_map)
+		{
+			report.plans.push_back(plan);
+		}
+
+		return report;
+	}
+}  // namespace ov
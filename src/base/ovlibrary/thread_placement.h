@@ -0,0 +1,128 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "./cpu_topology.h"
+#include "./singleton.h"
+#include "./tsa/mutex.h"
+
+namespace ov
+{
+	enum class ThreadRole
+	{
+		// Socket pool workers that receive and send the packets
+		Network,
+		// MediaRouter workers that pass the packets of a stream between the modules
+		Routing,
+		// Publisher workers that packetize a stream and send it to the sessions
+		FanOut,
+		// Transcoder decoders, filters and encoders
+		Codec
+	};
+
+	const char *StringFromThreadRole(ThreadRole role);
+
+	// Pins the worker threads to CPUs by their role, so that a stream is handled on one NUMA node
+	// from the socket that receives it to the sessions it is sent to.
+	//
+	// Each role has a plan: the CPUs the role may run on, split by NUMA node. A thread is pinned to
+	// the CPUs of one node of its plan rather than to a single CPU, so the scheduler still balances
+	// it over the cores of the node.
+	//
+	//  - A thread that serves every stream, such as a socket pool worker, takes the nodes of its
+	//    plan in turn: PlaceCurrentThread(role)
+	//  - A thread that serves a stream follows the node of the stream:
+	//    PlaceCurrentThreadOnNode(role, node_id), where the node is GetCurrentNode() of the thread
+	//    that created the stream. A new thread starts with the CPUs of the thread that started it,
+	//    so -1 (the node it runs on) keeps it on the node of its creator.
+	//
+	// With jemalloc, the threads of a node allocate from an arena of the node, so the memory they
+	// touch first is not shared with the threads of other nodes.
+	//
+	// Nothing is pinned until Configure() enables it.
+	class ThreadPlacement : public Singleton<ThreadPlacement>
+	{
+	public:
+		struct Config
+		{
+			bool enabled = false;
+			bool numa_local_arena = true;
+			// CPUs each role may run on. A role that is not here runs on every online CPU.
+			std::map<ThreadRole, std::vector<int>> cpus;
+		};
+
+		struct NodePlan
+		{
+			int node_id = 0;
+			std::vector<int> cpus;
+			// Threads pinned to the node right now
+			size_t thread_count = 0;
+		};
+
+		struct RolePlan
+		{
+			ThreadRole role = ThreadRole::Network;
+			std::vector<NodePlan> nodes;
+		};
+
+		struct Report
+		{
+			bool enabled = false;
+			bool numa_local_arena = false;
+			size_t arena_count = 0;
+			// The online CPUs by node, before the plans of the roles are applied
+			std::vector<NodePlan> nodes;
+			std::vector<RolePlan> plans;
+		};
+
+		void Configure(const Config &config, const CpuTopology &topology);
+		void Configure(const Config &config)
+		{
+			Configure(config, CpuTopology::Load());
+		}
+
+		bool IsEnabled() const;
+
+		// Returns the node the calling thread is pinned to, or the node of the CPU it runs on if it
+		// is not pinned. Returns -1 while the placement is disabled.
+		int GetCurrentNode() const;
+
+		// The functions below return the node the calling thread has been pinned to, or -1 if it
+		// has not been pinned
+
+		// Pins the calling thread to the next node of the plan of <role>
+		int PlaceCurrentThread(ThreadRole role);
+		// Pins the calling thread to <node_id> of the plan of <role>, or to the node it runs on if
+		// <node_id> is negative. A node the plan does not have is replaced by the next node of it.
+		int PlaceCurrentThreadOnNode(ThreadRole role, int node_id);
+
+		Report GetReport() const;
+
+	protected:
+		friend class PlacedThread;
+
+		int Place(ThreadRole role, NodePlan &node_plan) OV_REQUIRES(_mutex);
+		void OnThreadExit(ThreadRole role, int node_id);
+
+		void UseNodeArena(int node_id) OV_REQUIRES(_mutex);
+
+		mutable Mutex _mutex;
+
+		Config _config OV_GUARDED_BY(_mutex);
+		CpuTopology _topology OV_GUARDED_BY(_mutex);
+		std::map<ThreadRole, RolePlan> _plan_map OV_GUARDED_BY(_mutex);
+		// The next node PlaceCurrentThread() takes, by role
+		std::map<ThreadRole, size_t> _next_node_index_map OV_GUARDED_BY(_mutex);
+		// jemalloc arena of each node
+		std::map<int, unsigned> _arena_map OV_GUARDED_BY(_mutex);
+	};
+}  // namespace ov
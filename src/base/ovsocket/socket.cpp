@@ -10,8 +10,11 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <limits.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
@@ -63,6 +66,15 @@ static void SendStallLog(int handle, long sent_now, long left)
 
 namespace ov
 {
+	namespace
+	{
+		std::atomic<size_t> g_total_send_queue_bytes{0};
+		std::atomic<size_t> g_congested_socket_count{0};
+		std::atomic<uint64_t> g_send_queue_congestion_count{0};
+		std::atomic<uint64_t> g_send_queue_overflow_count{0};
+		std::atomic<uint64_t> g_send_queue_dropped_packet_count{0};
+	}  // namespace
+
 	// Used to wait for connection
 	class ConnectHelper : public SocketAsyncInterface
 	{
@@ -120,6 +132,9 @@ namespace ov
 		// Verify that the socket is closed normally
 		OV_ASSERT(_socket.IsValid() == false, "Socket is not closed. Current state: %s", StringFromSocketState(GetState()));
 		CHECK_STATE2(== SocketState::Closed, >= SocketState::Disconnected, );
+
+		LockGuard lock_guard(_dispatch_queue_lock);
+		ClearDispatchQueue();
 	}
 
 	bool Socket::Create(const SocketType type, const SocketFamily family)
@@ -266,6 +281,15 @@ namespace ov
 	}
 
 	bool Socket::AppendCommand(DispatchCommand command, bool dispatch_immediately)
+	{
+		auto result = QueueCommand(std::move(command), dispatch_immediately);
+
+		CallSendQueueObserverIfNeeded();
+
+		return result;
+	}
+
+	bool Socket::QueueCommand(DispatchCommand command, bool dispatch_immediately)
 	{
 		SOCKET_PROFILER_INIT();
 		LockGuard lock_guard(_dispatch_queue_lock);
@@ -278,11 +302,38 @@ namespace ov
 			}
 		});
 
+		if (IsOverSendQueueBudget(command))
+		{
+			if (GetType() == SocketType::Udp)
+			{
+				// Datagrams may be lost anyway, and closing the socket would cut off every peer sharing it
+				_send_queue_stats.dropped_packets++;
+				g_send_queue_dropped_packet_count++;
+
+				return false;
+			}
+
+			if (_send_queue_overflowed.exchange(true) == false)
+			{
+				g_send_queue_overflow_count++;
+
+				logaw("Send queue is full (%zu bytes, %zu packets) - The peer is too slow, so this socket is going to be closed (%s)",
+					  _send_queue_stats.queued_bytes, _send_queue_stats.queued_packets, ToString().CStr());
+
+				// The stream to the peer is broken from here. The close command waits behind the
+				// queued data, so the worker garbage-collects the socket (see IsSendQueueOverflowed())
+				CloseWithState(SocketState::Disconnected);
+			}
+
+			return false;
+		}
+
+		OnCommandQueued(command);
 		_dispatch_queue.push_back(std::move(command));
 
 		if (dispatch_immediately)
 		{
-			switch (DispatchEvents())
+			switch (DispatchQueuedEvents())
 			{
 				case DispatchResult::Dispatched:
 					return true;
@@ -299,6 +350,188 @@ namespace ov
 		return true;
 	}
 
+	void Socket::OnCommandQueued(const DispatchCommand &command)
+	{
+		if (command.IsSendCommand() == false)
+		{
+			return;
+		}
+
+		auto bytes = command.GetQueuedBytes();
+
+		_send_queue_stats.queued_bytes += bytes;
+		_send_queue_stats.queued_packets++;
+		_send_queue_stats.peak_queued_bytes = std::max(_send_queue_stats.peak_queued_bytes, _send_queue_stats.queued_bytes);
+		g_total_send_queue_bytes += bytes;
+
+		UpdateSendQueueCongestion();
+	}
+
+	void Socket::OnCommandDequeued(const DispatchCommand &command)
+	{
+		if (command.IsSendCommand() == false)
+		{
+			return;
+		}
+
+		auto bytes = command.GetQueuedBytes();
+
+		_send_queue_stats.queued_bytes -= bytes;
+		_send_queue_stats.queued_packets--;
+		g_total_send_queue_bytes -= bytes;
+
+		UpdateSendQueueCongestion();
+	}
+
+	void Socket::ClearDispatchQueue()
+	{
+		_dispatch_queue.clear();
+
+		g_total_send_queue_bytes -= _send_queue_stats.queued_bytes;
+		_send_queue_stats.queued_bytes = 0;
+		_send_queue_stats.queued_packets = 0;
+
+		UpdateSendQueueCongestion();
+	}
+
+	bool Socket::IsOverSendQueueBudget(const DispatchCommand &command) const
+	{
+		if (command.IsSendCommand() == false)
+		{
+			// Close commands are always accepted
+			return false;
+		}
+
+		if (_send_queue_overflowed)
+		{
+			return true;
+		}
+
+		const auto &budget = _send_queue_budget;
+		const auto &stats = _send_queue_stats;
+
+		// An empty queue always takes the data, however large it is
+		if (stats.queued_packets == 0)
+		{
+			return false;
+		}
+
+		return ((budget.max_bytes > 0) && ((stats.queued_bytes + command.GetQueuedBytes()) > budget.max_bytes)) ||
+			   ((budget.max_packets > 0) && (stats.queued_packets >= budget.max_packets));
+	}
+
+	void Socket::UpdateSendQueueCongestion()
+	{
+		const auto &budget = _send_queue_budget;
+		auto &stats = _send_queue_stats;
+
+		if (stats.congested)
+		{
+			if (stats.queued_bytes <= budget.low_watermark_bytes)
+			{
+				stats.congested = false;
+				g_congested_socket_count--;
+			}
+		}
+		else if ((budget.high_watermark_bytes > 0) && (stats.queued_bytes >= budget.high_watermark_bytes))
+		{
+			stats.congested = true;
+			stats.congestion_count++;
+			g_congested_socket_count++;
+			g_send_queue_congestion_count++;
+		}
+
+		_send_queue_congested = stats.congested;
+	}
+
+	void Socket::CallSendQueueObserverIfNeeded()
+	{
+		bool congested = _send_queue_congested;
+
+		if (_send_queue_congestion_notified.exchange(congested) == congested)
+		{
+			return;
+		}
+
+		std::shared_ptr<SocketSendQueueObserver> observer;
+		{
+			LockGuard lock_guard(_send_queue_observer_mutex);
+			observer = _send_queue_observer.lock();
+		}
+
+		if (observer == nullptr)
+		{
+			return;
+		}
+
+		size_t queued_bytes = 0;
+		{
+			LockGuard lock_guard(_dispatch_queue_lock);
+			queued_bytes = _send_queue_stats.queued_bytes;
+		}
+
+		if (congested)
+		{
+			logad("Send queue is congested (%zu bytes)", queued_bytes);
+			observer->OnSendQueueCongested(queued_bytes);
+		}
+		else
+		{
+			logad("Send queue has been drained (%zu bytes)", queued_bytes);
+			observer->OnSendQueueDrained(queued_bytes);
+		}
+	}
+
+	void Socket::SetSendQueueBudget(const SendQueueBudget &budget)
+	{
+		{
+			LockGuard lock_guard(_dispatch_queue_lock);
+
+			_send_queue_budget = budget;
+			// A low watermark above the high one would never let the queue drain
+			_send_queue_budget.low_watermark_bytes = std::min(budget.low_watermark_bytes, budget.high_watermark_bytes);
+
+			UpdateSendQueueCongestion();
+		}
+
+		CallSendQueueObserverIfNeeded();
+	}
+
+	Socket::SendQueueBudget Socket::GetSendQueueBudget() const
+	{
+		LockGuard lock_guard(_dispatch_queue_lock);
+		return _send_queue_budget;
+	}
+
+	void Socket::SetSendQueueObserver(const std::shared_ptr<SocketSendQueueObserver> &observer)
+	{
+		LockGuard lock_guard(_send_queue_observer_mutex);
+		_send_queue_observer = observer;
+	}
+
+	Socket::SendQueueStats Socket::GetSendQueueStats() const
+	{
+		LockGuard lock_guard(_dispatch_queue_lock);
+
+		auto stats = _send_queue_stats;
+		stats.overflowed = _send_queue_overflowed;
+
+		return stats;
+	}
+
+	Socket::TotalSendQueueStats Socket::GetTotalSendQueueStats()
+	{
+		TotalSendQueueStats stats;
+
+		stats.queued_bytes = g_total_send_queue_bytes;
+		stats.congested_socket_count = g_congested_socket_count;
+		stats.congestion_count = g_send_queue_congestion_count;
+		stats.overflow_count = g_send_queue_overflow_count;
+		stats.dropped_packet_count = g_send_queue_dropped_packet_count;
+
+		return stats;
+	}
+
 	bool Socket::AddToWorker(bool need_to_wait_first_epoll_event)
 	{
 		{
@@ -1043,6 +1276,90 @@ namespace ov
 		return DispatchResult::PartialDispatched;
 	}
 
+	bool Socket::IsGatherableSendCommand(const DispatchCommand &command) const
+	{
+		// File-backed data is sent with sendfile()
+		return (GetType() == SocketType::Tcp) &&
+			   (command.type == DispatchCommand::Type::Send) &&
+			   (command.data != nullptr) &&
+			   (command.data->IsEmpty() == false) &&
+			   (command.data->GetMappedFile() == nullptr);
+	}
+
+	Socket::DispatchResult Socket::DispatchGatheredSends(DispatchCommand &command)
+	{
+		size_t gathered_count = 1;
+		for (const auto &next_command : _dispatch_queue)
+		{
+			if ((gathered_count >= MAX_GATHERED_SEND_COUNT) || (IsGatherableSendCommand(next_command) == false))
+			{
+				break;
+			}
+
+			gathered_count++;
+		}
+
+		if (gathered_count == 1)
+		{
+			return DispatchEventInternal(command);
+		}
+
+		std::vector<iovec> iovs;
+		iovs.reserve(gathered_count);
+
+		auto append_iov = [&iovs](const std::shared_ptr<const Data> &data) {
+			iovs.push_back({const_cast<void *>(data->GetData()), data->GetLength()});
+		};
+
+		append_iov(command.data);
+		for (size_t index = 1; index < gathered_count; index++)
+		{
+			append_iov(_dispatch_queue[index - 1].data);
+		}
+
+		logap("Dispatching %zu gathered send commands", gathered_count);
+
+		auto sent_bytes = SendDataVector(iovs);
+
+		if (sent_bytes == -1)
+		{
+			return DispatchResult::Error;
+		}
+
+		size_t remaining_bytes = sent_bytes;
+
+		for (size_t index = 0; index < gathered_count; index++)
+		{
+			if (index > 0)
+			{
+				// <command> has been sent completely, so the next one takes its place
+				command = _dispatch_queue.front();
+				_dispatch_queue.pop_front();
+				OnCommandDequeued(command);
+			}
+
+			auto length = command.data->GetLength();
+
+			if (remaining_bytes < length)
+			{
+				if (remaining_bytes > 0)
+				{
+					// Since some data has been sent, the time needs to be updated.
+					command.UpdateTime();
+					command.data = command.data->Subdata(remaining_bytes);
+
+					logat("Part of the data has been sent: %zu bytes, left: %zu bytes (%s)", remaining_bytes, command.data->GetLength(), command.ToString().CStr());
+				}
+
+				return DispatchResult::PartialDispatched;
+			}
+
+			remaining_bytes -= length;
+		}
+
+		return DispatchResult::Dispatched;
+	}
+
 	Socket::DispatchResult Socket::DispatchEventsInternal()
 	{
 		SOCKET_PROFILER_INIT();
@@ -1071,6 +1388,7 @@ namespace ov
 				{
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
+					OnCommandDequeued(front);
 
 					bool is_close_command = front.IsCloseCommand();
 
@@ -1085,13 +1403,15 @@ namespace ov
 						}
 #endif	// DEBUG
 
-						_dispatch_queue.clear();
+						ClearDispatchQueue();
 
 						result = DispatchResult::Dispatched;
 						break;
 					}
 
-					result = DispatchEventInternal(front);
+					result = IsGatherableSendCommand(front)
+								 ? DispatchGatheredSends(front)
+								 : DispatchEventInternal(front);
 
 					if (result == DispatchResult::Dispatched)
 					{
@@ -1102,6 +1422,7 @@ namespace ov
 					{
 						// The data is not fully processed and will not be removed from queue
 
+						OnCommandQueued(front);
 						_dispatch_queue.emplace_front(front);
 
 						// Close-related commands will be processed when we receive the event from epoll later
@@ -1126,6 +1447,15 @@ namespace ov
 	}
 
 	Socket::DispatchResult Socket::DispatchEvents()
+	{
+		auto result = DispatchQueuedEvents();
+
+		CallSendQueueObserverIfNeeded();
+
+		return result;
+	}
+
+	Socket::DispatchResult Socket::DispatchQueuedEvents()
 	{
 		switch (_blocking_mode)
 		{
@@ -1267,6 +1597,91 @@ namespace ov
 		return total_sent_bytes;
 	}
 
+	ssize_t Socket::SendDataVector(std::vector<iovec> &iovs)
+	{
+		size_t iov_index		= 0;
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send %zu buffers...", iovs.size());
+
+		while ((iov_index < iovs.size()) && (_force_stop == false))
+		{
+			struct msghdr message = {};
+			message.msg_iov		  = &iovs[iov_index];
+			message.msg_iovlen	  = std::min(iovs.size() - iov_index, static_cast<size_t>(IOV_MAX));
+
+			const auto sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			total_sent_bytes += sent;
+			UpdateLastSentTime();
+
+			// Skips the buffers that have been sent, and the sent part of the last one
+			size_t remaining_sent = sent;
+			while ((iov_index < iovs.size()) && (remaining_sent >= iovs[iov_index].iov_len))
+			{
+				remaining_sent -= iovs[iov_index].iov_len;
+				iov_index++;
+			}
+
+			if (remaining_sent > 0)
+			{
+				auto &iov	 = iovs[iov_index];
+				iov.iov_base = static_cast<uint8_t *>(iov.iov_base) + remaining_sent;
+				iov.iov_len -= remaining_sent;
+			}
+		}
+
+		logap("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	ssize_t Socket::SendFileData(const std::shared_ptr<const Data> &data)
+	{
+		const auto &mapped_file = data->GetMappedFile();
+		off_t file_offset		= data->GetMappedFileOffset();
+		size_t remaining_bytes	= data->GetLength();
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send file %s (offset: %jd) %zu bytes...", mapped_file->GetPath().CStr(), static_cast<intmax_t>(file_offset), remaining_bytes);
+
+		while ((remaining_bytes > 0L) && (_force_stop == false))
+		{
+			// sendfile() advances file_offset by the number of bytes sent
+			const auto sent = ::sendfile(GetNativeHandle(), mapped_file->GetFd(), &file_offset, remaining_bytes);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			if (sent == 0L)
+			{
+				// The file was truncated after it was mapped
+				logaw("Could not send file: %s is shorter than expected", mapped_file->GetPath().CStr());
+				return -1L;
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			remaining_bytes -= sent;
+			total_sent_bytes += sent;
+
+			UpdateLastSentTime();
+		}
+
+		logap("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
 	ssize_t Socket::SendSrtData(
 		const std::shared_ptr<const Data> &data)
 	{
@@ -1318,8 +1733,15 @@ namespace ov
 	{
 		switch (GetType())
 		{
-			case SocketType::Udp:
 			case SocketType::Tcp:
+				if (data->GetMappedFile() != nullptr)
+				{
+					// Zero-copy path for file-backed data (e.g. HttpResponse::AppendFile() over plaintext HTTP/1.1)
+					return SendFileData(data);
+				}
+				return SendData(data);
+
+			case SocketType::Udp:
 				return SendData(data);
 
 			case SocketType::Srt:
@@ -1358,6 +1780,66 @@ namespace ov
 		return false;
 	}
 
+	bool Socket::Send(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		if (data_list.empty())
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				for (const auto &data : data_list)
+				{
+					if (Send(data) == false)
+					{
+						return false;
+					}
+				}
+
+				return true;
+
+			case BlockingMode::NonBlocking: {
+				if (IsSendable() == false)
+				{
+					break;
+				}
+
+				bool result = true;
+
+				{
+					// Keeps other senders from interleaving their data between the pieces
+					LockGuard lock_guard(_dispatch_queue_lock);
+
+					// Only the last piece dispatches the queue, so the pieces are written together
+					for (size_t index = 0; index < data_list.size(); index++)
+					{
+						const auto &data = data_list[index];
+						if (data == nullptr)
+						{
+							OV_ASSERT2(data != nullptr);
+							result = false;
+							break;
+						}
+
+						if (QueueCommand({data->Clone()}, index == (data_list.size() - 1)) == false)
+						{
+							result = false;
+							break;
+						}
+					}
+				}
+
+				CallSendQueueObserverIfNeeded();
+
+				return result;
+			}
+		}
+
+		return false;
+	}
+
 	bool Socket::Send(const void *data, size_t length)
 	{
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
@@ -1616,7 +2098,7 @@ namespace ov
 		size_t capacity = data->GetCapacity();
 
 		// Set the length of the data to the capacity to avoid memory reallocation
-		data->SetLength(capacity);
+		data->SetLengthUninitialized(capacity);
 
 		auto result = Recv(data->GetWritableData(), capacity, non_block);
 
@@ -1985,7 +2467,7 @@ namespace ov
 				socklen_t remote_length = sizeof(remote);
 
 				logat("Trying to read from the socket...");
-				data->SetLength(data->GetCapacity());
+				data->SetLengthUninitialized(data->GetCapacity());
 
 				iovec iov{};
 				iov.iov_base			   = data->GetWritableData();
@@ -2376,7 +2858,7 @@ namespace ov
 				}
 			}
 
-			_dispatch_queue.clear();
+			ClearDispatchQueue();
 
 			logat("Socket is closed successfully");
 
@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #ifdef OME_LATENCY_PROBE
 #include <atomic>
@@ -59,6 +60,18 @@ namespace ov
 		virtual void OnClosed() = 0;
 	};
 
+	// Lets the owner of a socket react when the peer falls behind, e.g. by dropping the frames
+	// nothing depends on, or by skipping to the next keyframe. See Socket::SetSendQueueBudget().
+	class SocketSendQueueObserver
+	{
+	public:
+		virtual ~SocketSendQueueObserver() = default;
+		// The queued bytes have reached the high watermark
+		virtual void OnSendQueueCongested(size_t queued_bytes) = 0;
+		// The queued bytes have fallen to the low watermark
+		virtual void OnSendQueueDrained(size_t queued_bytes) = 0;
+	};
+
 	class Socket : public EnableSharedFromThis<Socket>, public SocketPoolEventInterface
 	{
 	public:
@@ -81,6 +94,46 @@ namespace ov
 		};
 
 	public:
+		// Bounds of the send queue in non-blocking mode (0 = unbounded). The bytes of
+		// memory-mapped files are not counted, since sendfile() does not hold them in memory.
+		//
+		// A socket is unbounded unless its owner sets a budget, as the OVT publisher does for the
+		// connections to its edges. Other sockets still rely on OV_SOCKET_EXPIRE_TIMEOUT alone.
+		struct SendQueueBudget
+		{
+			// A Send() that would exceed these is rejected, and the socket is closed by the worker.
+			// A UDP socket may be shared by many peers (e.g. ICE), so it only drops the datagram.
+			size_t max_bytes = 0;
+			size_t max_packets = 0;
+			// The observer is told when the queued bytes reach high_watermark_bytes,
+			// and again when they fall to low_watermark_bytes
+			size_t high_watermark_bytes = 0;
+			size_t low_watermark_bytes = 0;
+		};
+
+		struct SendQueueStats
+		{
+			size_t queued_bytes = 0;
+			size_t queued_packets = 0;
+			size_t peak_queued_bytes = 0;
+			// Number of times the high watermark was reached
+			uint64_t congestion_count = 0;
+			// Number of datagrams dropped by a UDP socket over the budget
+			uint64_t dropped_packets = 0;
+			bool congested = false;
+			bool overflowed = false;
+		};
+
+		// Sum of all sockets in the process
+		struct TotalSendQueueStats
+		{
+			size_t queued_bytes = 0;
+			size_t congested_socket_count = 0;
+			uint64_t congestion_count = 0;
+			uint64_t overflow_count = 0;
+			uint64_t dropped_packet_count = 0;
+		};
+
 		// SocketPoolWorker can only be created within SocketPool
 		Socket(PrivateToken token, const std::shared_ptr<SocketPoolWorker> &worker);
 		Socket(PrivateToken token, const std::shared_ptr<SocketPoolWorker> &worker,
@@ -190,6 +243,9 @@ namespace ov
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Sends the pieces in order. They are queued together, so a TCP socket writes them with
+		// a single sendmsg() instead of a send() for each piece.
+		bool Send(const std::vector<std::shared_ptr<const Data>> &data_list);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
@@ -197,6 +253,19 @@ namespace ov
 		bool SendFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 		bool SendFromTo(const SocketAddressPair &address_pair, const void *data, size_t length);
 
+		void SetSendQueueBudget(const SendQueueBudget &budget);
+		SendQueueBudget GetSendQueueBudget() const;
+		// The observer is held weakly
+		void SetSendQueueObserver(const std::shared_ptr<SocketSendQueueObserver> &observer);
+		SendQueueStats GetSendQueueStats() const;
+		// A Send() has been rejected by the budget, so the stream to the peer is broken
+		bool IsSendQueueOverflowed() const
+		{
+			return _send_queue_overflowed;
+		}
+
+		static TotalSendQueueStats GetTotalSendQueueStats();
+
 		// On success, `data->GetLength()` equals the received byte count and this returns `nullptr`.
 		// A length of `0` means either "retry later" (`EAGAIN`/non-blocking with no data)
 		// or, for UDP, a valid 0-length datagram - both are reported as success, not a disconnect.
@@ -404,11 +473,24 @@ namespace ov
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
+			DispatchCommand &operator=(const DispatchCommand &another_command) = default;
+
 			bool IsCloseCommand() const
 			{
 				return OV_CHECK_FLAG(static_cast<uint8_t>(type), CLOSE_TYPE_MASK);
 			}
 
+			bool IsSendCommand() const
+			{
+				return (type == Type::Send) || (type == Type::SendTo) || (type == Type::SendFromTo);
+			}
+
+			// Bytes held in memory by this command
+			size_t GetQueuedBytes() const
+			{
+				return ((data != nullptr) && (data->GetMappedFile() == nullptr)) ? data->GetLength() : 0;
+			}
+
 			void UpdateTime()
 			{
 				enqueued_time = std::chrono::steady_clock::now();
@@ -466,7 +548,22 @@ namespace ov
 
 		bool SetBlockingInternal(BlockingMode mode);
 
+		// Queues the command, and calls the send queue observer once the lock is released
 		bool AppendCommand(DispatchCommand command, bool dispatch_immediately);
+		// Same as AppendCommand() without calling the observer, for a caller that holds the lock
+		bool QueueCommand(DispatchCommand command, bool dispatch_immediately);
+		// Same as DispatchEvents() without calling the observer
+		DispatchResult DispatchQueuedEvents();
+
+		// Keep the send queue accounting in step with _dispatch_queue
+		void OnCommandQueued(const DispatchCommand &command) OV_REQUIRES(_dispatch_queue_lock);
+		void OnCommandDequeued(const DispatchCommand &command) OV_REQUIRES(_dispatch_queue_lock);
+		void ClearDispatchQueue() OV_REQUIRES(_dispatch_queue_lock);
+		bool IsOverSendQueueBudget(const DispatchCommand &command) const OV_REQUIRES(_dispatch_queue_lock);
+		void UpdateSendQueueCongestion() OV_REQUIRES(_dispatch_queue_lock);
+		// Calls the observer if the congestion state has changed since the last call. Must be
+		// called without _dispatch_queue_lock, since the observer may send or close the socket.
+		void CallSendQueueObserverIfNeeded();
 
 		//--------------------------------------------------------------------
 		// Implementation of SocketPoolEventInterface
@@ -477,6 +574,13 @@ namespace ov
 		//--------------------------------------------------------------------
 
 		DispatchResult DispatchEventInternal(DispatchCommand &command) OV_REQUIRES(_dispatch_queue_lock);
+		// Whether <command> can be written together with adjacent commands by DispatchGatheredSends()
+		bool IsGatherableSendCommand(const DispatchCommand &command) const;
+		// Sends <command> (already dequeued) together with the gatherable Send commands queued after it.
+		// The commands that have been sent completely are removed from the queue. If PartialDispatched is
+		// returned, <command> holds the first command that has not been sent completely (dequeued as well),
+		// so the caller puts it back in front of the queue.
+		DispatchResult DispatchGatheredSends(DispatchCommand &command) OV_REQUIRES(_dispatch_queue_lock);
 
 		bool IsSendable() const;
 		ssize_t HandleSendError(const ssize_t result, const size_t total_sent);
@@ -484,6 +588,10 @@ namespace ov
 		bool DispatchEventsAfterAppendCommand();
 
 		ssize_t SendData(const std::shared_ptr<const Data> &data);
+		// Sends the buffers using sendmsg() (TCP only), <iovs> is modified while sending
+		ssize_t SendDataVector(std::vector<iovec> &iovs);
+		// Sends a region of a memory-mapped file using sendfile() (TCP only)
+		ssize_t SendFileData(const std::shared_ptr<const Data> &data);
 		ssize_t SendSrtData(const std::shared_ptr<const Data> &data);
 
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
@@ -577,6 +685,14 @@ namespace ov
 		std::deque<DispatchCommand> _dispatch_queue OV_GUARDED_BY(_dispatch_queue_lock);
 		std::atomic<bool> _has_close_command = false;
 
+		SendQueueBudget _send_queue_budget OV_GUARDED_BY(_dispatch_queue_lock);
+		SendQueueStats _send_queue_stats OV_GUARDED_BY(_dispatch_queue_lock);
+		std::atomic<bool> _send_queue_overflowed{false};
+		std::atomic<bool> _send_queue_congested{false};
+		std::atomic<bool> _send_queue_congestion_notified{false};
+		Mutex _send_queue_observer_mutex;
+		std::weak_ptr<SocketSendQueueObserver> _send_queue_observer OV_GUARDED_BY(_send_queue_observer_mutex);
+
 		std::atomic<bool> _connection_event_fired{false};
 		std::shared_ptr<SocketAsyncInterface> _callback;
 
@@ -85,6 +85,20 @@ namespace ov
 			return false;
 		}
 
+		// SocketAddress::Hash() keeps the raw address bits, so the pair is mixed to spread them over every bit
+		std::size_t Hash() const
+		{
+			uint64_t hash = (static_cast<uint64_t>(_local_address.Hash()) * 0x9E3779B97F4A7C15ULL) ^ static_cast<uint64_t>(_remote_address.Hash());
+
+			hash ^= hash >> 30;
+			hash *= 0xBF58476D1CE4E5B9ULL;
+			hash ^= hash >> 27;
+			hash *= 0x94D049BB133111EBULL;
+			hash ^= hash >> 31;
+
+			return static_cast<std::size_t>(hash);
+		}
+
 		String ToString() const
 		{
 			return String::FormatString(
@@ -99,3 +113,15 @@ namespace ov
 		SocketAddress _remote_address;
 	};
 }  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::SocketAddressPair>
+	{
+		std::size_t operator()(ov::SocketAddressPair const &pair) const
+		{
+			return pair.Hash();
+		}
+	};
+}  // namespace std
@@ -253,6 +253,15 @@ namespace ov
 
 				candidate = _gc_candidates.erase(candidate);
 			}
+			else if (socket->IsSendQueueOverflowed())
+			{
+				// Part of the data has been dropped, so there is no point in sending the rest
+				logaw("Send queue of the socket has overflowed - This socket is going to be garbage collected (%s)", socket->ToString().CStr());
+
+				socket->CloseImmediatelyWithState(SocketState::Disconnected);
+
+				candidate = _gc_candidates.erase(candidate);
+			}
 			else if (socket->HasCommand() == false)
 			{
 				// There have been unprocessed commands in the past, but now all of them have been processed
@@ -292,6 +301,9 @@ namespace ov
 	{
 		logger::ThreadHelper thread_helper;
 
+		// A worker serves the sockets of every stream, so the workers are spread over the nodes
+		ThreadPlacement::GetInstance()->PlaceCurrentThread(ThreadRole::Network);
+
 		if (_is_first_connection_callback_queue_start == false)
 		{
 			std::lock_guard lock(_connection_callback_queue_mutex);
@@ -12,6 +12,9 @@
 
 #define MAX_BUFFER_SIZE 4096
 
+// The maximum number of queued Send commands written by a single sendmsg() call
+#define MAX_GATHERED_SEND_COUNT 64
+
 // If state is not <condition>, returns <return_value>
 #define CHECK_STATE(condition, return_value)                                 \
 	do                                                                       \
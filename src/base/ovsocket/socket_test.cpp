@@ -170,6 +170,26 @@ namespace
 			return static_cast<ssize_t>(sent);
 		}
 
+		// Receives exactly <length> bytes, or fails after LOOPBACK_TIMEOUT_MSEC without data.
+		bool Recv(void *out, size_t length)
+		{
+			timeval tv = {LOOPBACK_TIMEOUT_MSEC / 1000, (LOOPBACK_TIMEOUT_MSEC % 1000) * 1000};
+			::setsockopt(_conn_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+			auto *cursor	= static_cast<uint8_t *>(out);
+			size_t received = 0;
+			while (received < length)
+			{
+				ssize_t read = ::recv(_conn_fd, cursor + received, length - received, 0);
+				if (read <= 0)
+				{
+					return false;
+				}
+				received += static_cast<size_t>(read);
+			}
+			return true;
+		}
+
 		void CloseConnection()
 		{
 			if (_accept_thread.joinable())
@@ -655,6 +675,212 @@ TEST_F(SocketRecvTcpTest, NonBlockParamOnBlockingSocketWithoutDataReportsRetry)
 	EXPECT_EQ(client->GetState(), ov::SocketState::Connected);
 }
 
+namespace
+{
+	class ConnectWaiter : public ov::SocketAsyncInterface
+	{
+	public:
+		void OnConnected(const std::shared_ptr<const ov::SocketError> &error) override
+		{
+			_connected = (error == nullptr);
+			_done	   = true;
+		}
+		void OnReadable() override {}
+		void OnClosed() override {}
+
+		bool WaitConnected()
+		{
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LOOPBACK_TIMEOUT_MSEC);
+			while ((_done == false) && (std::chrono::steady_clock::now() < deadline))
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return _connected;
+		}
+
+	private:
+		std::atomic<bool> _done{false};
+		std::atomic<bool> _connected{false};
+	};
+
+	class SendQueueObserver : public ov::SocketSendQueueObserver
+	{
+	public:
+		void OnSendQueueCongested(size_t queued_bytes) override
+		{
+			congested_count++;
+		}
+		void OnSendQueueDrained(size_t queued_bytes) override
+		{
+			drained_count++;
+		}
+
+		std::atomic<int> congested_count{0};
+		std::atomic<int> drained_count{0};
+	};
+}  // namespace
+
+// A peer that never reads lets the queue reach the high watermark first (so the owner can
+// start dropping), and then the hard budget: the queue never grows past it, and the socket
+// is given up instead.
+TEST_F(SocketRecvTcpTest, SendQueueIsBoundedForSlowPeer)
+{
+	constexpr size_t CHUNK_SIZE		 = 16 * 1024;
+	constexpr size_t MAX_QUEUE_BYTES = 1024 * 1024;
+
+	PosixTcpPeer peer;
+	ASSERT_TRUE(peer.Listen());
+
+	auto client = _pool->AllocSocket(ov::SocketFamily::Inet);
+	ASSERT_NE(client, nullptr);
+	_client = client;
+
+	auto waiter = std::make_shared<ConnectWaiter>();
+	ASSERT_TRUE(client->MakeNonBlocking(waiter));
+
+	peer.AcceptAsync();
+	client->Connect(LoopbackAddress(peer.Port()), LOOPBACK_TIMEOUT_MSEC);
+	peer.WaitAccepted();
+	ASSERT_TRUE(waiter->WaitConnected());
+
+	auto observer = std::make_shared<SendQueueObserver>();
+	client->SetSendQueueObserver(observer);
+
+	ov::Socket::SendQueueBudget budget;
+	budget.max_bytes			= MAX_QUEUE_BYTES;
+	budget.high_watermark_bytes = MAX_QUEUE_BYTES / 4;
+	budget.low_watermark_bytes	= 0;
+	client->SetSendQueueBudget(budget);
+
+	auto overflow_count = ov::Socket::GetTotalSendQueueStats().overflow_count;
+
+	auto chunk = std::make_shared<ov::Data>(CHUNK_SIZE);
+	chunk->SetLength(CHUNK_SIZE);
+
+	bool rejected = false;
+	// Far more than the kernel buffers of a loopback connection can hold
+	for (int index = 0; index < 8192; index++)
+	{
+		if (client->Send(chunk) == false)
+		{
+			rejected = true;
+			break;
+		}
+
+		EXPECT_LE(client->GetSendQueueStats().queued_bytes, MAX_QUEUE_BYTES);
+	}
+
+	ASSERT_TRUE(rejected);
+	EXPECT_EQ(observer->congested_count, 1);
+	EXPECT_TRUE(client->IsSendQueueOverflowed());
+	EXPECT_EQ(ov::Socket::GetTotalSendQueueStats().overflow_count, overflow_count + 1);
+
+	// Once overflowed, the socket stays closed to new data
+	EXPECT_FALSE(client->Send(chunk));
+}
+
+// Without a budget set by its owner, a socket never gives up on a slow peer because of its
+// send queue
+TEST_F(SocketRecvTcpTest, SendQueueIsUnboundedByDefault)
+{
+	constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+	PosixTcpPeer peer;
+	ASSERT_TRUE(peer.Listen());
+
+	auto client = _pool->AllocSocket(ov::SocketFamily::Inet);
+	ASSERT_NE(client, nullptr);
+	_client = client;
+
+	auto waiter = std::make_shared<ConnectWaiter>();
+	ASSERT_TRUE(client->MakeNonBlocking(waiter));
+
+	peer.AcceptAsync();
+	client->Connect(LoopbackAddress(peer.Port()), LOOPBACK_TIMEOUT_MSEC);
+	peer.WaitAccepted();
+	ASSERT_TRUE(waiter->WaitConnected());
+
+	EXPECT_EQ(client->GetSendQueueBudget().max_bytes, 0u);
+
+	auto chunk = std::make_shared<ov::Data>(CHUNK_SIZE);
+	chunk->SetLength(CHUNK_SIZE);
+
+	// 64 MB, far more than the kernel buffers of a loopback connection can hold
+	for (int index = 0; index < 4096; index++)
+	{
+		ASSERT_TRUE(client->Send(chunk));
+	}
+
+	EXPECT_GT(client->GetSendQueueStats().queued_bytes, 0u);
+	EXPECT_FALSE(client->IsSendQueueOverflowed());
+}
+
+// A list of pieces is written together (sendmsg()). The pieces are far more than the loopback
+// connection can take at once, so some are left partially sent and are written later by the
+// worker, but the peer still receives every byte in order.
+TEST_F(SocketRecvTcpTest, SendsDataListInOrder)
+{
+	constexpr size_t PIECE_COUNT = 2000;
+
+	PosixTcpPeer peer;
+	ASSERT_TRUE(peer.Listen());
+
+	auto client = _pool->AllocSocket(ov::SocketFamily::Inet);
+	ASSERT_NE(client, nullptr);
+	_client = client;
+
+	auto waiter = std::make_shared<ConnectWaiter>();
+	ASSERT_TRUE(client->MakeNonBlocking(waiter));
+
+	peer.AcceptAsync();
+	client->Connect(LoopbackAddress(peer.Port()), LOOPBACK_TIMEOUT_MSEC);
+	peer.WaitAccepted();
+	ASSERT_TRUE(waiter->WaitConnected());
+
+	auto byte_at = [](size_t offset) {
+		return static_cast<uint8_t>((offset * 31) ^ (offset >> 11));
+	};
+
+	std::vector<std::shared_ptr<const ov::Data>> data_list;
+	size_t total_bytes = 0;
+	for (size_t index = 0; index < PIECE_COUNT; index++)
+	{
+		// Mostly small pieces (like the headers and samples of an fMP4 chunk) with a few large ones
+		size_t piece_size = ((index % 100) == 99) ? (256 * 1024) : (1 + (index * 37) % 3000);
+
+		auto piece = std::make_shared<ov::Data>(piece_size);
+		piece->SetLength(piece_size);
+
+		auto buffer = piece->GetWritableDataAs<uint8_t>();
+		for (size_t offset = 0; offset < piece_size; offset++)
+		{
+			buffer[offset] = byte_at(total_bytes + offset);
+		}
+
+		total_bytes += piece_size;
+		data_list.push_back(piece);
+	}
+
+	ASSERT_TRUE(client->Send(data_list));
+
+	std::vector<uint8_t> received(total_bytes);
+	ASSERT_TRUE(peer.Recv(received.data(), received.size()));
+
+	size_t mismatched_offset = total_bytes;
+	for (size_t offset = 0; offset < total_bytes; offset++)
+	{
+		if (received[offset] != byte_at(offset))
+		{
+			mismatched_offset = offset;
+			break;
+		}
+	}
+	EXPECT_EQ(mismatched_offset, total_bytes);
+
+	EXPECT_EQ(client->GetSendQueueStats().queued_bytes, 0u);
+	EXPECT_EQ(client->GetSendQueueStats().queued_packets, 0u);
+}
+
 // ===========================================================================
 // UDP
 // ===========================================================================
@@ -8,169 +8,67 @@
 
 namespace pub
 {
-	ApplicationWorker::ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name)
-		: _stream_data_queue(nullptr, 500)
+	ApplicationWorkerPool::ApplicationWorkerPool()
+		: ov::LanePool<StreamData>("AppWorker", ov::ThreadRole::FanOut, MAX_APPLICATION_WORKER_COUNT, 500, &ApplicationWorkerPool::SendFrame)
 	{
-		_worker_id = worker_id;
-		_vhost_app_name = vhost_app_name;
-		_worker_name = worker_name;
-		_stop_thread_flag = false;
 	}
 
-	bool ApplicationWorker::Start()
+	ApplicationWorkerPool::Slot ApplicationWorkerPool::AttachStream(const info::VHostAppName &vhost_app_name, PublisherType publisher_type, uint32_t worker_count)
 	{
-		_stop_thread_flag = false;
-		_worker_thread = std::thread(&ApplicationWorker::WorkerThread, this);
-
-		auto name = ov::String::FormatString("AW-%s%d", _worker_name.CStr(), _worker_id);
-		pthread_setname_np(_worker_thread.native_handle(), name.CStr());
-
-		auto urn = std::make_shared<info::ManagedQueue::URN>(
-			_vhost_app_name,
-			nullptr,
-			"pub",
-			name.LowerCaseString());
-
-		_stream_data_queue.SetUrn(urn);
-
-		logtt("%s ApplicationWorker has been created", _worker_name.CStr());
-
-		return true;
+		// Keeps the AW-XXX thread names of the workers each application used to start
+		return Attach(vhost_app_name, ov::String::FormatString("AW-%s", StringFromPublisherType(publisher_type).CStr()), worker_count);
 	}
 
-	bool ApplicationWorker::Stop()
+	void ApplicationWorkerPool::SendFrame(StreamData &stream_data)
 	{
-		if (_stop_thread_flag == true)
+		auto stream = stream_data._stream;
+		auto media_packet = stream_data._media_packet;
+		if (stream == nullptr || media_packet == nullptr)
 		{
-			return true;
+			return;
 		}
 
-		_stream_data_queue.Clear();
-
-		_stop_thread_flag = true;
-
-		_queue_event.Stop();
-
-		if (_worker_thread.joinable())
+		// State::CREATED could be needed for some cases
+		if (stream->GetState() == Stream::State::ERROR || stream->GetState() == Stream::State::STOPPED)
 		{
-			_worker_thread.join();
+			return;
 		}
 
-		return true;
-	}
-
-	uint32_t ApplicationWorker::GetWorkerId() const
-	{
-		return _worker_id;
-	}
-
-	void ApplicationWorker::OnStreamCreated(const std::shared_ptr<info::Stream> &info)
-	{
-		logti("Stream(%s/%u) created on AppWorker (%s / %d)", info->GetName().CStr(), info->GetId(), _worker_name.CStr(), _worker_id);
-		_stream_count++;
-	}
-
-	void ApplicationWorker::OnStreamDeleted(const std::shared_ptr<info::Stream> &info)
-	{
-		logti("Stream(%s/%u) deleted on AppWorker (%s / %d)", info->GetName().CStr(), info->GetId(), _worker_name.CStr(), _worker_id);
-		_stream_count--;
-	}
-
-	uint32_t ApplicationWorker::GetStreamCount() const
-	{
-		return _stream_count.load();
-	}
-
-	bool ApplicationWorker::PushMediaPacket(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet)
-	{
-		auto data = std::make_shared<ApplicationWorker::StreamData>(stream, media_packet);
-		_stream_data_queue.Enqueue(std::move(data));
-
-		_queue_event.Notify();
+		// Track the packet's version at this stream's consumption position
+		stream->UpdateTrackFromPacket(media_packet);
 
-		return true;
-	}
-
-	std::shared_ptr<ApplicationWorker::StreamData> ApplicationWorker::PopStreamData()
-	{
-		if (_stream_data_queue.IsEmpty())
+		if (media_packet->GetMediaType() == cmn::MediaType::Video)
 		{
-			return nullptr;
+			stream->SendVideoFrame(media_packet);
 		}
-
-		auto data = _stream_data_queue.Dequeue(0);
-		if (data.has_value())
+		else if (media_packet->GetMediaType() == cmn::MediaType::Audio)
 		{
-			return data.value();
+			stream->SendAudioFrame(media_packet);
 		}
-
-		return nullptr;
-	}
-
-	void ApplicationWorker::WorkerThread()
-	{
-		ov::logger::ThreadHelper thread_helper;
-
-		while (!_stop_thread_flag)
+		else if (media_packet->GetMediaType() == cmn::MediaType::Data || 
+					media_packet->GetMediaType() == cmn::MediaType::Subtitle)
 		{
-			_queue_event.Wait();
-
-			// Check media data is available
-			auto stream_data = PopStreamData();
-			if (stream_data == nullptr)
-			{
-				continue;
-			}
-			
-			auto stream = stream_data->_stream;
-			auto media_packet = stream_data->_media_packet;
-			if (stream == nullptr || media_packet == nullptr)
-			{
-				continue;
-			}
-
-			// State::CREATED could be needed for some cases
-			if (stream->GetState() == Stream::State::ERROR || stream->GetState() == Stream::State::STOPPED)
-			{
-				continue;
-			}
-
-			// Track the packet's version at this stream's consumption position
-			stream->UpdateTrackFromPacket(media_packet);
-
-			if (media_packet->GetMediaType() == cmn::MediaType::Video)
-			{
-				stream->SendVideoFrame(stream_data->_media_packet);
-			}
-			else if (media_packet->GetMediaType() == cmn::MediaType::Audio)
+			if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::OVEN_EVENT)
 			{
-				stream->SendAudioFrame(stream_data->_media_packet);
-			}
-			else if (media_packet->GetMediaType() == cmn::MediaType::Data || 
-						media_packet->GetMediaType() == cmn::MediaType::Subtitle)
-			{
-				if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::OVEN_EVENT)
-				{
-					auto event = std::dynamic_pointer_cast<MediaEvent>(media_packet);
-					if (event == nullptr)
-					{
-						logtw("MediaPacket is not MediaEvent. Cannot process event. %s/%s(%u)", stream->GetApplicationName(), stream->GetName().CStr(), stream->GetId());
-						continue;
-					}
-
-					stream->ProcessEvent(event);
-					stream->OnEvent(event);
-				}
-				else
+				auto event = std::dynamic_pointer_cast<MediaEvent>(media_packet);
+				if (event == nullptr)
 				{
-					stream->SendDataFrame(stream_data->_media_packet);
+					logtw("MediaPacket is not MediaEvent. Cannot process event. %s/%s(%u)", stream->GetApplicationName(), stream->GetName().CStr(), stream->GetId());
+					return;
 				}
+
+				stream->ProcessEvent(event);
+				stream->OnEvent(event);
 			}
 			else
 			{
-				// Nothing can do
+				stream->SendDataFrame(media_packet);
 			}
 		}
+		else
+		{
+			// Nothing can do
+		}
 	}
 
 	Application::Application(const std::shared_ptr<Publisher> &publisher, const info::Application &application_info)
@@ -221,22 +119,7 @@ namespace pub
 			_application_worker_count = MAX_APPLICATION_WORKER_COUNT;
 		}
 
-		std::lock_guard<std::shared_mutex> worker_lock(_application_worker_lock);
-
-		for (uint32_t i = 0; i < _application_worker_count; i++)
-		{
-			auto app_worker = std::make_shared<ApplicationWorker>(i, GetVHostAppName().CStr(), StringFromPublisherType(_publisher->GetPublisherType()));
-			if (app_worker->Start() == false)
-			{
-				logte("Cannot create ApplicationWorker (%s/%s/%d)", GetApplicationTypeName(), GetVHostAppName().CStr(), i);
-				Stop();
-
-				return false;
-			}
-
-			_application_workers.push_back(app_worker);
-		}
-
+		// The workers are taken from ApplicationWorkerPool when a stream is created
 		logti("%s has created [%s] application", GetApplicationTypeName(), GetVHostAppName().CStr());
 
 		return true;
@@ -244,14 +127,7 @@ namespace pub
 
 	bool Application::Stop()
 	{
-		std::unique_lock<std::shared_mutex> worker_lock(_application_worker_lock);
-		for (const auto &worker : _application_workers)
-		{
-			worker->Stop();
-		}
-
-		_application_workers.clear();
-		worker_lock.unlock();
+		UnmapAllStreamsToWorker();
 
 		// release remaining streams
 		DeleteAllStreams();
@@ -359,102 +235,76 @@ namespace pub
 		return true;
 	}
 
-	std::shared_ptr<ApplicationWorker> Application::GetLowestLoadWorker()
-	{
-		std::shared_lock lock(_application_worker_lock);
-		uint32_t min_load = UINT32_MAX;
-		uint32_t min_load_worker_id = 0;
-
-		for (const auto &worker : _application_workers)
-		{
-			auto stream_count = worker->GetStreamCount();
-			if (stream_count < min_load)
-			{
-				min_load = stream_count;
-				min_load_worker_id = worker->GetWorkerId();
-
-				if (min_load == 0)
-				{
-					break;
-				}
-			}
-		}
-
-		return _application_workers[min_load_worker_id];
-	}
-
 	void Application::MapStreamToWorker(const std::shared_ptr<info::Stream> &info)
 	{
-		auto app_worker = GetLowestLoadWorker();
-		if (app_worker == nullptr)
+		auto worker_slot = ApplicationWorkerPool::GetInstance()->AttachStream(GetVHostAppName(), _publisher->GetPublisherType(), _application_worker_count);
+		if (worker_slot.IsValid() == false)
 		{
 			logte("Cannot find ApplicationWorker for stream mapping. %s / %u", info->GetName().CStr(), info->GetId());
 			return;
 		}
 
-		app_worker->OnStreamCreated(info);
+		logti("Stream(%s/%u) created on AppWorker (%s / %zu)", info->GetName().CStr(), info->GetId(), GetPublisherTypeName(), worker_slot.GetLaneIndex());
 
 		std::unique_lock<std::shared_mutex> lock(_stream_app_worker_map_lock);
-		_stream_app_worker_map[info->GetId()] = app_worker->GetWorkerId();
+		_stream_app_worker_map[info->GetId()] = worker_slot;
 	}
 	
 	void Application::UnmapStreamToWorker(const std::shared_ptr<info::Stream> &info)
 	{
-		auto app_worker = GetWorkerByStreamID(info->GetId());
-		if (app_worker != nullptr)
-		{
-			app_worker->OnStreamDeleted(info);
-		}
-		else
+		std::unique_lock<std::shared_mutex> lock(_stream_app_worker_map_lock);
+
+		auto it = _stream_app_worker_map.find(info->GetId());
+		if (it == _stream_app_worker_map.end())
 		{
 			logte("Cannot find ApplicationWorker for stream unmapping. %s / %u", info->GetName().CStr(), info->GetId());
+			return;
 		}
 
-		std::unique_lock<std::shared_mutex> lock(_stream_app_worker_map_lock);
-		_stream_app_worker_map.erase(info->GetId());
+		logti("Stream(%s/%u) deleted on AppWorker (%s / %zu)", info->GetName().CStr(), info->GetId(), GetPublisherTypeName(), it->second.GetLaneIndex());
+
+		it->second.Detach();
+		_stream_app_worker_map.erase(it);
 	}
 
-	std::shared_ptr<ApplicationWorker> Application::GetWorkerByStreamID(info::stream_id_t stream_id)
+	void Application::UnmapAllStreamsToWorker()
 	{
-		if (_application_worker_count == 0)
+		std::unique_lock<std::shared_mutex> lock(_stream_app_worker_map_lock);
+
+		for (auto &[stream_id, worker_slot] : _stream_app_worker_map)
 		{
-			return nullptr;
+			worker_slot.Detach();
 		}
-		
-		uint32_t worker_id = 0;
+
+		_stream_app_worker_map.clear();
+	}
+
+	bool Application::OnSendFrame(const std::shared_ptr<info::Stream> &stream,
+								  const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		ApplicationWorkerPool::Slot worker_slot;
 
 		{
 			std::shared_lock<std::shared_mutex> lock(_stream_app_worker_map_lock);
-			auto it = _stream_app_worker_map.find(stream_id);
+			auto it = _stream_app_worker_map.find(stream->GetId());
 			if (it == _stream_app_worker_map.end())
 			{
-				logte("(%s/%s) cannot find ApplicationWorker for stream mapping. %u", GetApplicationTypeName(), GetVHostAppName().CStr(), stream_id);
-				return nullptr;
+				logte("(%s/%s) cannot find ApplicationWorker for stream mapping. %u", GetApplicationTypeName(), GetVHostAppName().CStr(), stream->GetId());
+				return false;
 			}
 
-			worker_id = it->second;
-		}
-
-		std::shared_lock<std::shared_mutex> lock(_application_worker_lock);
-		if (worker_id >= _application_workers.size())
-		{
-			logte("Cannot find ApplicationWorker for stream mapping. %u", stream_id);
-			return nullptr;
+			worker_slot = it->second;
 		}
 
-		return _application_workers[worker_id];
-	}
-
-	bool Application::OnSendFrame(const std::shared_ptr<info::Stream> &stream,
-								  const std::shared_ptr<MediaPacket> &media_packet)
-	{
-		auto application_worker = GetWorkerByStreamID(stream->GetId());
-		if (application_worker == nullptr)
+		if (worker_slot.Enqueue(StreamData{GetStream(stream->GetId()), media_packet}) == false)
 		{
+			// The workers are stopped, which only happens while the server shuts down
+			logtd("(%s/%s) ApplicationWorker of stream %s/%u has stopped, a frame has been dropped (track: %u, pts: %" PRId64 ")",
+				  GetApplicationTypeName(), GetVHostAppName().CStr(), stream->GetName().CStr(), stream->GetId(), media_packet->GetTrackId(), media_packet->GetPts());
 			return false;
 		}
 
-		return application_worker->PushMediaPacket(GetStream(stream->GetId()), media_packet);
+		return true;
 	}
 
 	uint32_t Application::GetStreamCount()
@@ -11,7 +11,7 @@
 #include "base/ovlibrary/string.h"
 #include "config/config.h"
 #include "stream.h"
-#include "modules/managed_queue/managed_queue.h"
+#include "modules/task_pool/lane_pool.h"
 
 #define MIN_APPLICATION_WORKER_COUNT		1
 #define MAX_APPLICATION_WORKER_COUNT		72
@@ -28,52 +28,28 @@ namespace pub
 
 	class Publisher;
 
-	// Distribute Stream to applicationWorker.
-	class ApplicationWorker
+	// A frame to be sent by a stream
+	struct StreamData
 	{
-	public:
-		ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name);
-		bool Start();
-		bool Stop();
-		bool PushMediaPacket(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet);
-
-		uint32_t GetWorkerId() const;
-		void OnStreamCreated(const std::shared_ptr<info::Stream> &info);
-		void OnStreamDeleted(const std::shared_ptr<info::Stream> &info);
-		uint32_t GetStreamCount() const;
-
-	private:
-		void WorkerThread();
-
-		uint32_t	_worker_id = 0;
-		ov::String  _vhost_app_name;
-		ov::String	_worker_name;
-
-		class StreamData
-		{
-		public:
-			StreamData(const std::shared_ptr<Stream> &stream,
-							const std::shared_ptr<MediaPacket> &media_packet)
-			{
-				_stream = stream;
-				_media_packet = media_packet;
-			}
-
-			std::shared_ptr<Stream> _stream;
-			std::shared_ptr<MediaPacket> _media_packet;
-		};
-		std::shared_ptr<ApplicationWorker::StreamData> PopStreamData();
+		std::shared_ptr<Stream> _stream;
+		std::shared_ptr<MediaPacket> _media_packet;
+	};
 
-		std::atomic<bool> _stop_thread_flag;
-		std::thread _worker_thread;
-		ov::Semaphore _queue_event;
+	// Distributes the frames of the streams to the application workers. The workers are
+	// shared by the applications of every publisher: each publisher type has its own group,
+	// which starts with the first stream and stops after the idle timeout of <AppWorkerPool>.
+	// The applications on a worker take turns (see ov::LanePool).
+	class ApplicationWorkerPool : public ov::Singleton<ApplicationWorkerPool>, public ov::LanePool<StreamData>
+	{
+	public:
+		using Slot = ov::LanePool<StreamData>::Slot;
 
-		ov::ManagedQueue<std::shared_ptr<StreamData>> _stream_data_queue;
+		ApplicationWorkerPool();
 
-		[[maybe_unused]] int64_t _last_video_ts_ms = 0;
-		[[maybe_unused]] int64_t _last_audio_ts_ms = 0;
+		Slot AttachStream(const info::VHostAppName &vhost_app_name, PublisherType publisher_type, uint32_t worker_count);
 
-		std::atomic<uint32_t> _stream_count = 0;
+	protected:
+		static void SendFrame(StreamData &stream_data);
 	};
 
 	class Application : public info::Application, public MediaRouterApplicationObserver
@@ -87,7 +63,7 @@ namespace pub
 		bool OnStreamDeleted(const std::shared_ptr<info::Stream> &info) override;
 		bool OnStreamPrepared(const std::shared_ptr<info::Stream> &info) override;
 
-		// Put data in ApplicationWorker's queue.
+		// Put data in the queue of the stream's application worker.
 		bool OnSendFrame(const std::shared_ptr<info::Stream> &stream,
 							  const std::shared_ptr<MediaPacket> &media_packet) override;
 
@@ -123,17 +99,13 @@ namespace pub
 		virtual std::shared_ptr<Stream> CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t thread_count) = 0;
 		virtual bool DeleteStream(const std::shared_ptr<info::Stream> &info) = 0;
 		
-		std::shared_ptr<ApplicationWorker> GetWorkerByStreamID(info::stream_id_t stream_id);
-		std::shared_ptr<ApplicationWorker> GetLowestLoadWorker();
-
 		void MapStreamToWorker(const std::shared_ptr<info::Stream> &info);
 		void UnmapStreamToWorker(const std::shared_ptr<info::Stream> &info);
+		void UnmapAllStreamsToWorker();
 
 		uint32_t		_application_worker_count;
-		std::shared_mutex _application_worker_lock;
-		std::vector<std::shared_ptr<ApplicationWorker>>	_application_workers;
-		// stream_id : worker_id
-		std::map<info::stream_id_t, uint32_t> _stream_app_worker_map;
+		// stream_id : worker
+		std::map<info::stream_id_t, ApplicationWorkerPool::Slot> _stream_app_worker_map;
 		std::shared_mutex _stream_app_worker_map_lock;
 
 		std::shared_ptr<Publisher>		_publisher;
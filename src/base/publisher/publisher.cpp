@@ -348,6 +348,17 @@ namespace pub
 		return _access_controller->VerifyByWebhooks(request_info);
 	}
 
+	void Publisher::VerifyByAdmissionWebhooksAsync(const std::shared_ptr<const ac::RequestInfo> &request_info, AccessController::VerificationHandler handler)
+	{
+		if(_access_controller == nullptr)
+		{
+			handler(AccessController::VerificationResult::Error, nullptr);
+			return;
+		}
+
+		_access_controller->VerifyByWebhooksAsync(request_info, std::move(handler));
+	}
+
 	std::shared_ptr<Session> Publisher::GetSession(const info::Session::Path &session_path)
 	{
 		auto application = GetApplicationById(session_path._application_id);
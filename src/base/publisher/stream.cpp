@@ -170,6 +170,9 @@ namespace pub
 	{
 		ov::logger::ThreadHelper thread_helper;
 
+		// Stays on the node of the thread that created the stream
+		ov::ThreadPlacement::GetInstance()->PlaceCurrentThreadOnNode(ov::ThreadRole::FanOut, -1);
+
 		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
 
 		while (!_stop_thread_flag)
@@ -24,11 +24,15 @@ namespace cfg
 				Egress _egress;
 
 				bool _internal_queue_congestion = false;
+				int64_t _stream_memory_budget = 0;
+				ov::String _stream_memory_budget_string;
 
 			public:
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetIngress, _ingress)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEgress, _egress)
 				CFG_DECLARE_CONST_REF_GETTER_OF(IsInternalQueueCongestion, _internal_queue_congestion)
+				// In bytes, 0 if not set
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamMemoryBudget, _stream_memory_budget)
 
 			protected:
 				void MakeList() override
@@ -39,6 +43,26 @@ namespace cfg
 						_internal_queue_congestion = true;
 						return nullptr;
 					});
+					Register<Optional>("StreamMemoryBudget", &_stream_memory_budget_string, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+						auto budget_string = _stream_memory_budget_string.UpperCaseString();
+						int64_t multiplier = 1;
+						if (budget_string.HasSuffix("K"))
+						{
+							multiplier = 1024;
+						}
+						else if (budget_string.HasSuffix("M"))
+						{
+							multiplier = 1024 * 1024;
+						}
+						else if (budget_string.HasSuffix("G"))
+						{
+							multiplier = 1024 * 1024 * 1024;
+						}
+
+						_stream_memory_budget = static_cast<int64_t>(ov::Converter::ToDouble(budget_string) * multiplier);
+
+						return (_stream_memory_budget > 0) ? nullptr : CreateConfigErrorPtr("StreamMemoryBudget must be greater than 0");
+					});
 				}
 			};
 		}  // namespace rule
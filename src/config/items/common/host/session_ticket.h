@@ -0,0 +1,40 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace cmn
+	{
+		struct SessionTicket : public Item
+		{
+		protected:
+			bool _enable = true;
+			// The ticket keys of the host are replaced at this interval (in seconds)
+			int _rotation_interval = 3600;
+			// TLS 1.3 early data (0-RTT) can be replayed by an attacker
+			bool _early_data = false;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enable)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetRotationInterval, _rotation_interval)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsEarlyDataEnabled, _early_data)
+
+		protected:
+			void MakeList() override
+			{
+				Register<Optional>("Enable", &_enable);
+				Register<Optional>("RotationInterval", &_rotation_interval, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					return (_rotation_interval > 0) ? nullptr : CreateConfigErrorPtr("RotationInterval must be greater than 0");
+				});
+				Register<Optional>("EarlyData", &_early_data);
+			}
+		};
+	}  // namespace cmn
+}  // namespace cfg
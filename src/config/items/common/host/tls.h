@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include "session_ticket.h"
+
 namespace cfg
 {
 	namespace cmn
@@ -18,11 +20,13 @@ namespace cfg
 			ov::String _cert_path;
 			ov::String _key_path;
 			ov::String _chain_cert_path;
+			SessionTicket _session_ticket;
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetCertPath, _cert_path)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetKeyPath, _key_path)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetChainCertPath, _chain_cert_path)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSessionTicket, _session_ticket)
 
 		protected:
 			void MakeList() override
@@ -30,6 +34,7 @@ namespace cfg
 				Register<ResolvePath>("CertPath", &_cert_path);
 				Register<ResolvePath>("KeyPath", &_key_path);
 				Register<Optional, ResolvePath>("ChainCertPath", &_chain_cert_path);
+				Register<Optional>("SessionTicket", &_session_ticket);
 			}
 		};
 	}  // namespace cmn
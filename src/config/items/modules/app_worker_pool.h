@@ -0,0 +1,42 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct AppWorkerPool : public Item
+		{
+		protected:
+			int _idle_timeout_ms = 30 * 1000;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetIdleTimeoutMs, _idle_timeout_ms)
+
+		protected:
+			void MakeList() override
+			{
+				/**
+					Worker threads of the MediaRouter and the publishers, shared by all
+					applications. They start with the first stream of an application.
+
+					server.xml:
+						<Modules>
+							<AppWorkerPool>
+								<!-- Workers without a stream stop after this time. -1 keeps them. -->
+								<IdleTimeoutMs>30000</IdleTimeoutMs>
+							</AppWorkerPool>
+						</Modules>
+				*/
+				Register<Optional>("IdleTimeoutMs", &_idle_timeout_ms);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
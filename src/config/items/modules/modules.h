@@ -8,11 +8,13 @@
 //==============================================================================
 #pragma once
 
+#include "app_worker_pool.h"
 #include "jemalloc.h"
 #include "module_template.h"
 #include "p2p.h"
 #include "recovery.h"
 #include "task_pool.h"
+#include "thread_placement.h"
 #include "whisper.h"
 
 namespace cfg
@@ -36,6 +38,8 @@ namespace cfg
 			Whisper _whisper;
 			Jemalloc _jemalloc;
 			TaskPool _task_pool;
+			AppWorkerPool _app_worker_pool;
+			ThreadPlacement _thread_placement;
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
@@ -48,6 +52,8 @@ namespace cfg
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetWhisper, _whisper)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetJemalloc, _jemalloc)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetTaskPool, _task_pool)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetAppWorkerPool, _app_worker_pool)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetThreadPlacement, _thread_placement)
 
 		protected:
 			void MakeList() override
@@ -62,6 +68,8 @@ namespace cfg
 				Register<Optional>("Whisper", &_whisper);
 				Register<Optional>("Jemalloc", &_jemalloc);
 				Register<Optional>("TaskPool", &_task_pool);
+				Register<Optional>("AppWorkerPool", &_app_worker_pool);
+				Register<Optional>("ThreadPlacement", &_thread_placement);
 			}
 		};
 	}  // namespace modules
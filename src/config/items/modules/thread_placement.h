@@ -0,0 +1,63 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct ThreadPlacement : public Item
+		{
+		protected:
+			bool _enable = false;
+			bool _numa_local_arena = true;
+			ov::String _network_cpus;
+			ov::String _routing_cpus;
+			ov::String _fan_out_cpus;
+			ov::String _codec_cpus;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enable)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsNumaLocalArenaEnabled, _numa_local_arena)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetNetworkCpus, _network_cpus)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetRoutingCpus, _routing_cpus)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetFanOutCpus, _fan_out_cpus)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCodecCpus, _codec_cpus)
+
+		protected:
+			void MakeList() override
+			{
+				/**
+					Pins the socket pool, MediaRouter, publisher and transcoder threads to the
+					CPUs of a NUMA node, so a stream is handled on the node it is received on.
+
+					server.xml:
+						<Modules>
+							<ThreadPlacement>
+								<Enable>true</Enable>
+								<!-- Threads of a node allocate from an arena of the node (jemalloc builds only) -->
+								<NumaLocalArena>true</NumaLocalArena>
+								<!-- CPU lists such as "0-3,8". A role without a list runs on every online CPU. -->
+								<NetworkCpus>0-3</NetworkCpus>
+								<RoutingCpus>4-7</RoutingCpus>
+								<FanOutCpus>4-15</FanOutCpus>
+								<CodecCpus>16-31</CodecCpus>
+							</ThreadPlacement>
+						</Modules>
+				*/
+				Register<Optional>("Enable", &_enable);
+				Register<Optional>("NumaLocalArena", &_numa_local_arena);
+				Register<Optional>("NetworkCpus", &_network_cpus);
+				Register<Optional>("RoutingCpus", &_routing_cpus);
+				Register<Optional>("FanOutCpus", &_fan_out_cpus);
+				Register<Optional>("CodecCpus", &_codec_cpus);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
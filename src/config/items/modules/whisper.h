@@ -39,14 +39,22 @@ namespace cfg
 		{
 		protected:
 			std::vector<WhisperPreloadModel> _preload_model_list;
+			// The maximum number of threads used for inference by all streams (0 = number of CPU cores)
+			int32_t _threads = 0;
+			// The maximum number of windows run together in one batch (0 = half of <Threads>)
+			int32_t _max_batch_size = 0;
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetPreloadModels, _preload_model_list)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetThreads, _threads)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBatchSize, _max_batch_size)
 
 		protected:
 			void MakeList() override
 			{
 				Register<Optional>("PreloadModel", &_preload_model_list);
+				Register<Optional>("Threads", &_threads);
+				Register<Optional>("MaxBatchSize", &_max_batch_size);
 			}
 		};
 	}  // namespace modules
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "base/common_types.h"
+#include "circuit_breaker.h"
+#include "decision_cache.h"
 #include "enables.h"
 
 namespace cfg
@@ -24,6 +26,8 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeoutMsec, _timeout_msec)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledProviders, _enables.GetProviders().GetValue())
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetEnabledPublishers, _enables.GetPublishers().GetValue())
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetDecisionCache, _decision_cache)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetCircuitBreaker, _circuit_breaker)
 
 				bool IsEnabledProvider(ProviderType type) const
 				{
@@ -44,6 +48,8 @@ namespace cfg
 					Register("SecretKey", &_secret_key);
 					Register("Timeout", &_timeout_msec);
 					Register("Enables", &_enables);
+					Register<Optional>("DecisionCache", &_decision_cache);
+					Register<Optional>("CircuitBreaker", &_circuit_breaker);
 				}
 
 				ov::String _control_server_url;
@@ -51,6 +57,8 @@ namespace cfg
 				int _timeout_msec = 3000;
 
 				Enables _enables;
+				DecisionCache _decision_cache;
+				CircuitBreaker _circuit_breaker;
 			};
 		}  // namespace sig
 	}  // namespace vhost
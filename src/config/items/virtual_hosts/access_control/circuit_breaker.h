@@ -0,0 +1,40 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "base/common_types.h"
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace sig
+		{
+			// After <FailureThreshold> consecutive failures (timeout, connection error, non-200 response),
+			// queries to the control server fail immediately for <OpenDuration> milliseconds.
+			// Then a single query is let through to probe the server. 0 disables the breaker.
+			// Without <CircuitBreaker>, the breaker is disabled.
+			struct CircuitBreaker : public Item
+			{
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetFailureThreshold, _failure_threshold)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetOpenDurationMsec, _open_duration_msec)
+
+			protected:
+				void MakeList() override
+				{
+					Register<Optional>("FailureThreshold", &_failure_threshold);
+					Register<Optional>("OpenDuration", &_open_duration_msec);
+				}
+
+				int _failure_threshold = 5;
+				int _open_duration_msec = 5000;
+			};
+		}  // namespace sig
+	}  // namespace vhost
+}  // namespace cfg
@@ -0,0 +1,48 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "base/common_types.h"
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace sig
+		{
+			// <DecisionCache>
+			//     <Key>${Host}/${App}/${Stream}?token=${Query:token}</Key>
+			//     <AllowedTTL>60000</AllowedTTL>
+			//     <DeniedTTL>5000</DeniedTTL>
+			// </DecisionCache>
+			//
+			// Requests that expand <Key> to the same value share one query to the control server,
+			// and its decision is reused until the TTL (or the returned lifetime) expires.
+			// Macros: ${Host}, ${App}, ${Stream}, ${File}, ${ClientIP}, ${Query:<name>}
+			struct DecisionCache : public Item
+			{
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetKey, _key)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetAllowedTtlMsec, _allowed_ttl_msec)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetDeniedTtlMsec, _denied_ttl_msec)
+
+			protected:
+				void MakeList() override
+				{
+					Register("Key", &_key);
+					Register<Optional>("AllowedTTL", &_allowed_ttl_msec);
+					Register<Optional>("DeniedTTL", &_denied_ttl_msec);
+				}
+
+				ov::String _key;
+				int _allowed_ttl_msec = 60000;
+				int _denied_ttl_msec = 5000;
+			};
+		}  // namespace sig
+	}  // namespace vhost
+}  // namespace cfg
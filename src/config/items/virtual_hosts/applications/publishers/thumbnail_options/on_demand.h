@@ -0,0 +1,45 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				// The image encoders of the application run only while their thumbnail is requested
+				struct ThumbnailOnDemand : public Item
+				{
+				protected:
+					bool _enabled = false;
+					// The encoder goes idle when no request has arrived for this long
+					int _idle_timeout = 10000;
+					// How long a request waits for the first image after the encoder has been woken up
+					int _wait_timeout = 1000;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enabled)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetIdleTimeout, _idle_timeout)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetWaitTimeout, _wait_timeout)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Enable", &_enabled);
+						Register<Optional>("IdleTimeout", &_idle_timeout);
+						Register<Optional>("WaitTimeout", &_wait_timeout);
+					}
+				};
+			}  // namespace pub
+		}  // namespace app
+	}  // namespace vhost
+}  // namespace cfg
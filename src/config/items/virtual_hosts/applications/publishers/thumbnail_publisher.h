@@ -10,6 +10,7 @@
 
 #include "../../../common/cross_domain_support.h"
 #include "publisher.h"
+#include "thumbnail_options/on_demand.h"
 
 namespace cfg
 {
@@ -21,18 +22,24 @@ namespace cfg
 			{
 				struct ThumbnailPublisher : public Publisher, public cmn::CrossDomainSupport
 				{
+				protected:
+					ThumbnailOnDemand _on_demand;
+
 				public:
 					PublisherType GetType() const override
 					{
 						return PublisherType::Thumbnail;
 					}
 
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetOnDemand, _on_demand)
+
 				protected:
 					void MakeList() override
 					{
 						Publisher::MakeList();
 
 						Register<Optional>("CrossDomains", &_cross_domains);
+						Register<Optional>("OnDemand", &_on_demand);
 					}
 				};
 			}  // namespace pub
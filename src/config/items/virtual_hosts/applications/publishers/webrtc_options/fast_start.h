@@ -0,0 +1,50 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				// How a new WebRTC session gets its first decodable frame
+				struct WebrtcFastStart : public Item
+				{
+				protected:
+					// The stream keeps the RTP packets of the current GOP, and a new session starts with them
+					bool _gop_cache = false;
+					// Maximum bytes of the RTP packets kept for the GOP of a video track. A longer GOP is not cached.
+					int _gop_cache_max_size = 4 * 1024 * 1024;
+					// PLI/FIR from a session that is already playing asks the encoder of the transcoder for a keyframe
+					bool _keyframe_request = false;
+					// Minimum interval between the keyframes requested from an encoder
+					int _keyframe_request_interval = 1000;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsGopCacheEnabled, _gop_cache)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetGopCacheMaxSize, _gop_cache_max_size)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsKeyframeRequestEnabled, _keyframe_request)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetKeyframeRequestInterval, _keyframe_request_interval)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("GopCache", &_gop_cache);
+						Register<Optional>("GopCacheMaxSize", &_gop_cache_max_size);
+						Register<Optional>("KeyframeRequest", &_keyframe_request);
+						Register<Optional>("KeyframeRequestInterval", &_keyframe_request_interval);
+					}
+				};
+			}  // namespace pub
+		}  // namespace app
+	}  // namespace vhost
+}  // namespace cfg
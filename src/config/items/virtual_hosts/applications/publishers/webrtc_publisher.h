@@ -9,6 +9,7 @@
 #pragma once
 
 #include "publisher.h"
+#include "webrtc_options/fast_start.h"
 
 namespace cfg
 {
@@ -50,6 +51,8 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPlayoutDelay, _playout_delay)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBandwidthEstimationType, _bandwidth_estimation_type)
 					CFG_DECLARE_CONST_REF_GETTER_OF(ShouldCreateDefaultPlaylist, _create_default_playlist)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetFastStart, _fast_start)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsTemporalThinningEnabled, _temporal_thinning)
 
 				protected:
 					void MakeList() override
@@ -62,6 +65,8 @@ namespace cfg
 						Register<Optional>("PlayoutDelay", &_playout_delay);
 						Register<Optional>("JitterBuffer", &_jitter_buffer);
 						Register<Optional>("CreateDefaultPlaylist", &_create_default_playlist);
+						Register<Optional>("FastStart", &_fast_start);
+						Register<Optional>("TemporalThinning", &_temporal_thinning);
 						Register<Optional>("BandwidthEstimation", &_bwe, [=]() -> std::shared_ptr<ConfigError> { return nullptr; }, [=]() -> std::shared_ptr<ConfigError> {
 								if (_bwe.UpperCaseString() == "REMB")
 								{
@@ -92,6 +97,9 @@ namespace cfg
 					PlayoutDelay _playout_delay;
 					bool _jitter_buffer			  = false;
 					bool _create_default_playlist = true;
+					WebrtcFastStart _fast_start;
+					// Drops non-reference frames for congested sessions that have no lower rendition
+					bool _temporal_thinning = false;
 				};
 			}  // namespace pub
 		}  // namespace app
@@ -20,16 +20,20 @@ namespace cfg
 			{
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetRedisServer, _redis_server)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetOriginHostName, _origin_host_name)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetRelayTier, _relay_tier)
 
 			protected:
 				void MakeList() override
 				{
 					Register("RedisServer", &_redis_server);
 					Register<Optional>("OriginHostName", &_origin_host_name);
+					Register<Optional>("RelayTier", &_relay_tier);
 				}
 				
 				RedisServer _redis_server;
 				ov::String _origin_host_name;
+				// 0: pulls streams from the origin, N: relays streams to tier N + 1, and pulls them from the nearest lower tier
+				int _relay_tier = 0;
 			};
 		}  // namespace orgn
 	}	   // namespace vhost
@@ -10,11 +10,13 @@
 
 #include <api_server/api_server.h>
 #include <base/info/ome_version.h>
+#include <base/publisher/application.h>
 #include <base/ovlibrary/daemon.h>
 #include <base/ovlibrary/log_write.h>
 #include <base/ovsocket/ovsocket.h>
 #include <config/config_manager.h>
 #include <mediarouter/mediarouter.h>
+#include <mediarouter/mediarouter_worker_pool.h>
 #include <modules/address/address_utilities.h>
 #include <modules/sdp/sdp_regex_pattern.h>
 #include <modules/task_pool/task_pool.h>
@@ -35,6 +37,7 @@
 
 static ov::Daemon::State Initialize(int argc, char *argv[], ParseOption *parse_option);
 static void CheckKernelVersion();
+static void ConfigureThreadPlacement(const cfg::Server &server_config);
 static bool Uninitialize();
 
 int main(int argc, char *argv[])
@@ -73,6 +76,9 @@ int main(int argc, char *argv[])
 
 	logti("Server ID : %s", server_config->GetID().CStr());
 
+	// Before any worker thread starts, because a thread is pinned when it starts
+	ConfigureThreadPlacement(*server_config);
+
 	// Before any module posts a task, because the workers already running are not resized to
 	// a new thread count
 	if (ov::TaskPool::GetInstance()->Initialize() == false)
@@ -80,6 +86,13 @@ int main(int argc, char *argv[])
 		logtw("Could not read the server configuration, so the task pool uses its default values");
 	}
 
+	// Before any application is created, since the workers of the applications are taken from these pools
+	if ((MediaRouterWorkerPool::GetInstance()->Initialize() == false) ||
+		(pub::ApplicationWorkerPool::GetInstance()->Initialize() == false))
+	{
+		logtw("Could not read the server configuration, so the application worker pools use their default values");
+	}
+
 	// Get public IP
 	bool stun_server_parsed;
 	auto stun_server_address = server_config->GetStunServer(&stun_server_parsed);
@@ -387,12 +400,51 @@ static void CheckKernelVersion()
 	}
 }
 
+static void ConfigureThreadPlacement(const cfg::Server &server_config)
+{
+	const auto &placement_config = server_config.GetModules().GetThreadPlacement();
+
+	ov::ThreadPlacement::Config config;
+	config.enabled = placement_config.IsEnabled();
+	config.numa_local_arena = placement_config.IsNumaLocalArenaEnabled();
+
+	const std::pair<ov::ThreadRole, ov::String> cpu_lists[] = {
+		{ov::ThreadRole::Network, placement_config.GetNetworkCpus()},
+		{ov::ThreadRole::Routing, placement_config.GetRoutingCpus()},
+		{ov::ThreadRole::FanOut, placement_config.GetFanOutCpus()},
+		{ov::ThreadRole::Codec, placement_config.GetCodecCpus()},
+	};
+
+	for (const auto &[role, cpu_list] : cpu_lists)
+	{
+		std::vector<int> cpus;
+
+		if (ov::CpuTopology::ParseCpuList(cpu_list, &cpus) == false)
+		{
+			logtw("Invalid CPU list of %s threads: %s, so they run on every online CPU", ov::StringFromThreadRole(role), cpu_list.CStr());
+			continue;
+		}
+
+		if (cpus.empty() == false)
+		{
+			config.cpus[role] = std::move(cpus);
+		}
+	}
+
+	ov::ThreadPlacement::GetInstance()->Configure(config);
+}
+
 static bool Uninitialize()
 {
 	// Before the socket pools, because a task may still be using a socket
 	logti("Stopping the task pool...");
 	ov::TaskPool::GetInstance()->Stop();
 
+	// The applications have been released, so no stream is left on these workers
+	logti("Stopping the application worker pools...");
+	pub::ApplicationWorkerPool::GetInstance()->Stop();
+	MediaRouterWorkerPool::GetInstance()->Stop();
+
 	logti("Uninitializing TCP socket pool...");
 	ov::SocketPool::GetTcpPool()->Uninitialize();
 	logti("Uninitializing UDP socket pool...");
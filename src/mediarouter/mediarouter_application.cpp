@@ -50,22 +50,6 @@ MediaRouteApplication::MediaRouteApplication(const info::Application &applicatio
 	int delay_buffer_time_ms = _application_info.GetConfig().GetPublishers().GetDelayBufferTimeMs();
 
 	logti("[%s(%u)] Created Mediarouter application. Worker(%d) DelayBufferTime(%d)", _application_info.GetVHostAppName().CStr(), _application_info.GetId(), _max_worker_thread_count, delay_buffer_time_ms);
-
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
-	{
-		{
-			auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetVHostAppName(), nullptr, "imr", ov::String::FormatString("aw_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::weak_ptr<MediaRouteStream>>>(urn, 1000);
-			_inbound_stream_indicator.push_back(stream_data);
-		}
-
-		{
-			auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetVHostAppName(), nullptr, "omr", ov::String::FormatString("aw_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::weak_ptr<MediaRouteStream>>>(urn, 1000);
-			stream_data->SetBufferingDelay(delay_buffer_time_ms);	
-			_outbound_stream_indicator.push_back(stream_data);
-		}
-	}
 }
 
 MediaRouteApplication::~MediaRouteApplication()
@@ -77,41 +61,12 @@ bool MediaRouteApplication::Start()
 {
 	_kill_flag = false;
 
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
-	{
-		try
-		{
-			auto inbound_thread = std::thread(&MediaRouteApplication::InboundWorkerThread, this, worker_id);
-			pthread_setname_np(inbound_thread.native_handle(), "InboundWorker");
-			_inbound_threads.push_back(std::move(inbound_thread));
-		}
-		catch (const std::system_error &e)
-		{
-			_kill_flag = true;
-			logte("Failed to start Mediarouter application thread.");
-			return false;
-		}
-	}
-
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
-	{
-		try
-		{
-			auto outbound_thread = std::thread(&MediaRouteApplication::OutboundWorkerThread, this, worker_id);
-			pthread_setname_np(outbound_thread.native_handle(), "OutboundWorker");
-			_outbound_threads.push_back(std::move(outbound_thread));
-		}
-		catch (const std::system_error &e)
-		{
-			_kill_flag = true;
-			logte("Failed to start Mediarouter application thread.");
-			return false;
-		}
-	}
+	// The workers are taken from MediaRouterWorkerPool when a stream is created,
+	// and they find this application through a weak pointer
+	_weak_this = GetSharedPtrAs<MediaRouteApplication>();
 
 	logtt("[%s(%u)] Started Mediarouter application.", _application_info.GetVHostAppName().CStr(), _application_info.GetId());
 
-
 	return true;
 }
 
@@ -119,39 +74,26 @@ bool MediaRouteApplication::Stop()
 {
 	_kill_flag = true;
 
-	for (auto &indicator : _inbound_stream_indicator)
+	// Waits for the workers that are in the middle of a stream of this application
 	{
-		indicator->Stop();
-		indicator->Clear();
+		std::unique_lock<std::shared_mutex> lock(_worker_lock);
 	}
 
-	for (auto &indicator : _outbound_stream_indicator)
+	// The streams that are left give their workers back
 	{
-		indicator->Stop();
-		indicator->Clear();
-	}
+		std::shared_lock<std::shared_mutex> lock(_streams_lock);
 
-	for (auto &worker : _inbound_threads)
-	{
-		if (worker.joinable())
+		for (auto &[stream_id, stream] : _inbound_streams)
 		{
-			worker.join();
+			stream->DetachWorker();
 		}
-	}
 
-	for (auto &worker : _outbound_threads)
-	{
-		if (worker.joinable())
+		for (auto &[stream_id, stream] : _outbound_streams)
 		{
-			worker.join();
+			stream->DetachWorker();
 		}
 	}
 
-	_inbound_stream_indicator.clear();
-	_outbound_stream_indicator.clear();
-	_inbound_threads.clear();
-	_outbound_threads.clear();
-
 	_connectors.clear();
 	_observers.clear();
 
@@ -414,9 +356,17 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateInboundStream(con
 	// receive new versions attached to the packets (or at prepared time)
 	auto in_stream_info = std::make_shared<info::Stream>(*stream_info);
 
-	auto new_stream = std::make_shared<MediaRouteStream>(in_stream_info, cmn::MediaRouterStreamType::INBOUND, (_inbound_worker_rr++) % _max_worker_thread_count);
+	auto worker_slot = MediaRouterWorkerPool::GetInstance()->AttachInbound(_application_info.GetVHostAppName(), _max_worker_thread_count);
+	if (worker_slot.IsValid() == false)
+	{
+		logte("[%s/%s(%u)] Could not get a worker for the inbound stream", _application_info.GetVHostAppName().CStr(), stream_info->GetName().CStr(), stream_info->GetId());
+		return nullptr;
+	}
+
+	auto new_stream = std::make_shared<MediaRouteStream>(in_stream_info, cmn::MediaRouterStreamType::INBOUND, worker_slot);
 	if (!new_stream)
 	{
+		worker_slot.Detach();
 		return nullptr;
 	}
 
@@ -440,14 +390,23 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateOutboundStream(co
 		out_stream_info->LinkInputStream(stream_info);
 	}
 
-	auto new_stream = std::make_shared<MediaRouteStream>(out_stream_info, cmn::MediaRouterStreamType::OUTBOUND, (_outbound_worker_rr++) % _max_worker_thread_count);
+	int delay_buffer_time_ms = _application_info.GetConfig().GetPublishers().GetDelayBufferTimeMs();
+
+	auto worker_slot = MediaRouterWorkerPool::GetInstance()->AttachOutbound(_application_info.GetVHostAppName(), _max_worker_thread_count, delay_buffer_time_ms);
+	if (worker_slot.IsValid() == false)
+	{
+		logte("[%s/%s(%u)] Could not get a worker for the outbound stream", _application_info.GetVHostAppName().CStr(), stream_info->GetName().CStr(), stream_info->GetId());
+		return nullptr;
+	}
+
+	auto new_stream = std::make_shared<MediaRouteStream>(out_stream_info, cmn::MediaRouterStreamType::OUTBOUND, worker_slot);
 	if (!new_stream)
 	{
+		worker_slot.Detach();
 		return nullptr;
 	}
 
 	// Set buffer retention duration for outbound stream
-	int delay_buffer_time_ms = _application_info.GetConfig().GetPublishers().GetDelayBufferTimeMs();
 	if (delay_buffer_time_ms > 0)
 	{
 		new_stream->SetBufferRetentionDuration(delay_buffer_time_ms);
@@ -642,14 +601,26 @@ bool MediaRouteApplication::DeleteInboundStream(const std::shared_ptr<info::Stre
 		}
 	}
 	std::lock_guard<std::shared_mutex> lock_guard(_streams_lock);
-	_inbound_streams.erase(stream_info->GetId());
+
+	auto bucket = _inbound_streams.find(stream_info->GetId());
+	if (bucket != _inbound_streams.end())
+	{
+		bucket->second->DetachWorker();
+		_inbound_streams.erase(bucket);
+	}
 
 	return true;
 }
 bool MediaRouteApplication::DeleteOutboundStream(const std::shared_ptr<info::Stream> &stream_info)
 {
 	std::lock_guard<std::shared_mutex> lock_guard(_streams_lock);
-	_outbound_streams.erase(stream_info->GetId());
+
+	auto bucket = _outbound_streams.find(stream_info->GetId());
+	if (bucket != _outbound_streams.end())
+	{
+		bucket->second->DetachWorker();
+		_outbound_streams.erase(bucket);
+	}
 
 	return true;
 }
@@ -728,9 +699,12 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouterAp
 
 		stream->Push(packet);
 
-		auto inbound_worker_id = stream->GetWorkerID();
-		OV_ASSERT2(inbound_worker_id < _inbound_stream_indicator.size());
-		_inbound_stream_indicator[inbound_worker_id]->Enqueue(std::weak_ptr<MediaRouteStream>(stream), packet->IsHighPriority());
+		if (stream->GetWorkerSlot().Enqueue(MediaRouterWorkerItem{_weak_this, stream}, packet->IsHighPriority()) == false)
+		{
+			// The workers are stopped, which only happens while the server shuts down
+			logtd("[%s/%s(%u)] The worker of the stream has stopped, so the packet will not be delivered", _application_info.GetVHostAppName().CStr(), stream_info->GetName().CStr(), stream_info->GetId());
+			return false;
+		}
 	}
 	// Provider(relay), Transcoder => Outbound Stream
 	else if ((IS_CONNECTOR_PROVIDER(connector_type) && IS_REPRENT_RELAY(representation_type)) ||
@@ -744,9 +718,12 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouterAp
 
 		stream->Push(packet);
 
-		auto outbound_worker_id = stream->GetWorkerID();
-		OV_ASSERT2(outbound_worker_id < _outbound_stream_indicator.size());
-		_outbound_stream_indicator[outbound_worker_id]->Enqueue(std::weak_ptr<MediaRouteStream>(stream), packet->IsHighPriority());
+		if (stream->GetWorkerSlot().Enqueue(MediaRouterWorkerItem{_weak_this, stream}, packet->IsHighPriority()) == false)
+		{
+			// The workers are stopped, which only happens while the server shuts down
+			logtd("[%s/%s(%u)] The worker of the stream has stopped, so the packet will not be delivered", _application_info.GetVHostAppName().CStr(), stream_info->GetName().CStr(), stream_info->GetId());
+			return false;
+		}
 	}
 	else
 	{
@@ -831,178 +808,154 @@ bool MediaRouteApplication::IsExistingInboundStream(ov::String stream_name)
 	return false;
 }
 
-void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
+// Called by a worker of MediaRouterWorkerPool
+void MediaRouteApplication::ProcessStream(const std::shared_ptr<MediaRouteStream> &stream)
 {
-	ov::logger::ThreadHelper thread_helper;
+	// Stop() waits for this lock, so no observer is called after the application is stopped
+	std::shared_lock<std::shared_mutex> worker_lock(_worker_lock);
 
-	logtt("Created Inbound worker thread #%d", worker_id);
+	if (_kill_flag)
+	{
+		return;
+	}
 
-	while (!_kill_flag)
+	if (stream->IsInbound())
 	{
-		auto msg = _inbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
-		if (msg.has_value() == false)
-		{
-			// It may be called due to a normal stop signal.
-			continue;
-		}
+		ProcessInboundStream(stream);
+	}
+	else
+	{
+		ProcessOutboundStream(stream);
+	}
+}
 
-		auto stream = msg.value().lock();
-		if (stream == nullptr)
-		{
-			// Stream was already destroyed.
-			continue;
-		}
+void MediaRouteApplication::ProcessInboundStream(std::shared_ptr<MediaRouteStream> stream)
+{
+	// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+	auto media_packet = stream->PopAndNormalize();
+	if (media_packet == nullptr)
+	{
+		return;
+	}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->PopAndNormalize();
-		if (media_packet == nullptr)
+	// When the inbound stream is finished parsing track information,
+	// Notify the Observer that the stream is parsed
+	if (stream->IsStreamPrepared() == false)
+	{
+		if (stream->IsStreamReady() == true)
 		{
-			continue;
+			NotifyStreamPrepared(stream);
 		}
-
-		// When the inbound stream is finished parsing track information,
-		// Notify the Observer that the stream is parsed
-		if (stream->IsStreamPrepared() == false)
+		else
 		{
-			if (stream->IsStreamReady() == true)
-			{
-				NotifyStreamPrepared(stream);
-			}
-			else
-			{
-				// Warn if a track has not become valid in time, blocking the stream from being prepared
-				stream->CheckUnpreparedTrackTimeout();
-			}
+			// Warn if a track has not become valid in time, blocking the stream from being prepared
+			stream->CheckUnpreparedTrackTimeout();
 		}
+	}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		auto observers = _observers; // Avoid deadlock
-		lock.unlock();
-		for (const auto &observer : observers)
-		{
-			auto observer_type = observer->GetObserverType();
+	std::shared_lock<std::shared_mutex> lock(_observers_lock);
+	auto observers = _observers; // Avoid deadlock
+	lock.unlock();
+	for (const auto &observer : observers)
+	{
+		auto observer_type = observer->GetObserverType();
 
-			if (observer_type == MediaRouterApplicationObserver::ObserverType::Transcoder)
-			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+		if (observer_type == MediaRouterApplicationObserver::ObserverType::Transcoder)
+		{
+			// Get Stream Info
+			auto stream_info = stream->GetStream();
 
-				// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-				observer->OnSendFrame(stream_info, media_packet);
-			}
+			// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
+			observer->OnSendFrame(stream_info, media_packet);
 		}
+	}
 
-		// Mirror stream
+	// Mirror stream
+	{
+		std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
+		auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
+		for (auto iter = it.first; iter != it.second; ++iter)
 		{
-			std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
-			auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
-			for (auto iter = it.first; iter != it.second; ++iter)
-			{
-				auto stream_tap = iter->second;
+			auto stream_tap = iter->second;
 
-				if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
+			if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
+			{
+				if (stream_tap->DoesNeedPastData())
 				{
-					if (stream_tap->DoesNeedPastData())
-					{
-						stream_tap->SetNeedPastData(false);
+					stream_tap->SetNeedPastData(false);
 
-						for (const auto &item : MediaRouteStream::BuildPastData(stream->GetMirrorBuffers()))
-						{
-							stream_tap->PushBackfill(item->packet);
-						}
-					}
-					else
+					for (const auto &item : MediaRouteStream::BuildPastData(stream->GetMirrorBuffers()))
 					{
-						stream_tap->Push(media_packet);
+						stream_tap->PushBackfill(item->packet);
 					}
 				}
+				else
+				{
+					stream_tap->Push(media_packet);
+				}
 			}
 		}
 	}
-
-	logtt("Inbound worker thread #%d has been stopped", worker_id);
 }
 
-void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
+void MediaRouteApplication::ProcessOutboundStream(std::shared_ptr<MediaRouteStream> stream)
 {
-	ov::logger::ThreadHelper thread_helper;
-
-	logtt("Created outbound worker thread #%d", worker_id);
-
-	while (!_kill_flag)
+	// check stream is exist, there can be removed streams packet because of delay buffer
+	if (GetOutboundStream(stream->GetStream()->GetId()) == nullptr)
 	{
-		auto msg = _outbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
-		if (msg.has_value() == false)
-		{
-			// It may be called due to a normal stop signal.
-			continue;
-		}
-		auto stream = msg.value().lock();
-		if (stream == nullptr)
-		{
-			// Stream was already destroyed (e.g. deleted while packets were buffered in delay queue).
-			continue;
-		}
+		return;
+	}
 
-		// check stream is exist, there can be removed streams packet because of delay buffer
-		if (GetOutboundStream(stream->GetStream()->GetId()) == nullptr)
-		{
-			continue;
-		}
+	// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+	auto media_packet = stream->PopAndNormalize();
+	if (media_packet == nullptr)
+	{
+		return;
+	}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->PopAndNormalize();
-		if (media_packet == nullptr)
-		{
-			continue;
-		}
+	if (stream->IsStreamPrepared() == false && stream->IsStreamReady() == true)
+	{
+		NotifyStreamPrepared(stream);
+	}
 
-		if (stream->IsStreamPrepared() == false && stream->IsStreamReady() == true)
-		{
-			NotifyStreamPrepared(stream);
-		}
+	std::shared_lock<std::shared_mutex> lock(_observers_lock);
+	auto observers = _observers; // Avoid deadlock
+	lock.unlock();
+	for (const auto &observer : observers)
+	{
+		auto observer_type = observer->GetObserverType();
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		auto observers = _observers; // Avoid deadlock
-		lock.unlock();
-		for (const auto &observer : observers)
+		if (observer_type == MediaRouterApplicationObserver::ObserverType::Publisher)
 		{
-			auto observer_type = observer->GetObserverType();
-
-			if (observer_type == MediaRouterApplicationObserver::ObserverType::Publisher)
-			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
-				observer->OnSendFrame(stream_info, media_packet);
-			}
+			// Get Stream Info
+			auto stream_info = stream->GetStream();
+			observer->OnSendFrame(stream_info, media_packet);
 		}
+	}
 
-		// mirror stream
+	// mirror stream
+	{
+		std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
+		auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
+		for (auto iter = it.first; iter != it.second; ++iter)
 		{
-			std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
-			auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
-			for (auto iter = it.first; iter != it.second; ++iter)
+			auto stream_tap = iter->second;
+			if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
 			{
-				auto stream_tap = iter->second;
-				if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
+				if (stream_tap->DoesNeedPastData())
 				{
-					if (stream_tap->DoesNeedPastData())
-					{
-						stream_tap->SetNeedPastData(false);
+					stream_tap->SetNeedPastData(false);
 
-						for (const auto &item : MediaRouteStream::BuildPastData(stream->GetMirrorBuffers()))
-						{
-							stream_tap->PushBackfill(item->packet);
-						}
-					}
-					else
+					for (const auto &item : MediaRouteStream::BuildPastData(stream->GetMirrorBuffers()))
 					{
-						stream_tap->Push(media_packet);
+						stream_tap->PushBackfill(item->packet);
 					}
 				}
+				else
+				{
+					stream_tap->Push(media_packet);
+				}
 			}
 		}
 	}
-
-	logtt("Outbound worker thread #%d has been stopped", worker_id);
 }
@@ -19,10 +19,9 @@
 #include "base/mediarouter/mediarouter_application_interface.h"
 #include "base/mediarouter/mediarouter_application_observer.h"
 #include "base/mediarouter/mediarouter_interface.h"
-#include "modules/managed_queue/managed_queue.h"
-
 #include "mediarouter_stream.h"
 #include "mediarouter_stream_tap.h"
+#include "mediarouter_worker_pool.h"
 
 class ApplicationInfo;
 class Stream;
@@ -153,22 +152,18 @@ private:
 	std::shared_mutex _streams_lock;
 
 private:
-	void InboundWorkerThread(uint32_t worker_id);
-	void OutboundWorkerThread(uint32_t worker_id);
+	friend class MediaRouterWorkerPool;
+
+	// Delivers a packet of the stream, called by a worker of MediaRouterWorkerPool
+	void ProcessStream(const std::shared_ptr<MediaRouteStream> &stream);
+	void ProcessInboundStream(std::shared_ptr<MediaRouteStream> stream);
+	void ProcessOutboundStream(std::shared_ptr<MediaRouteStream> stream);
 
 	std::atomic<bool> _kill_flag{false};
-	std::vector<std::thread> _inbound_threads;
-	std::vector<std::thread> _outbound_threads;
+	// Held shared while a worker delivers a packet of this application
+	std::shared_mutex _worker_lock;
+	std::weak_ptr<MediaRouteApplication> _weak_this;
 
+	// Workers a stream of this application may be spread across
 	uint32_t _max_worker_thread_count;
-
-	// Round-robin worker assignment so streams spread evenly across all workers, instead
-	// of stream_id % N clustering onto a subset (the global stream-id counter is strided
-	// across apps). Only touched at stream creation, under _streams_lock.
-	uint32_t _inbound_worker_rr = 0;
-	uint32_t _outbound_worker_rr = 0;
-
-private:
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::weak_ptr<MediaRouteStream>>>> _inbound_stream_indicator;
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::weak_ptr<MediaRouteStream>>>> _outbound_stream_indicator;
 };
@@ -41,14 +41,17 @@
 
 using namespace cmn;
 
-MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream, cmn::MediaRouterStreamType type, uint32_t worker_id)
-	: _worker_id(worker_id),
+MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream, cmn::MediaRouterStreamType type, const MediaRouterWorkerPool::Slot &worker_slot)
+	: _worker_slot(worker_slot),
 	  _stream(stream),
 	  _stats(stream->GetStats()),
 	  _packets_queue(nullptr, 600)
 {
 	SetType(type);
 
+	_queue_memory_account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::QueueBacklog, stream->GetUri());
+	_mirror_memory_account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::MirrorBuffer, stream->GetUri());
+
 	MediaRouterStats::Init(stream);
 	MediaRouterAlert::Init(stream);
 }
@@ -292,6 +295,12 @@ void MediaRouteStream::Push(const std::shared_ptr<MediaPacket> &media_packet)
 {
 	_stats->SetFirstMediaTime();
 
+	// Counted as the backlog of the stream unless something else keeps the packet
+	if (media_packet->GetData() != nullptr)
+	{
+		media_packet->GetData()->ClaimMemoryFor(_queue_memory_account);
+	}
+
 	_packets_queue.Enqueue(media_packet, media_packet->IsHighPriority());
 }
 
@@ -311,6 +320,11 @@ std::shared_ptr<MediaPacket> MediaRouteStream::PopAndNormalize()
 
 	auto &media_packet = media_packet_ref.value();
 
+	if (media_packet->GetData() != nullptr)
+	{
+		media_packet->GetData()->UnclaimMemoryFor(_queue_memory_account);
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// [ Calculating Packet Timestamp, Duration]
 
@@ -437,6 +451,10 @@ std::shared_ptr<MediaPacket> MediaRouteStream::PopAndNormalize()
 
 	// Mirror Buffer
 	int64_t dts_us = (int64_t)((double)pop_media_packet->GetDts() * 1000000.0 * media_track->GetTimeBase().GetExpr());
+	if (pop_media_packet->GetData() != nullptr)
+	{
+		pop_media_packet->GetData()->ChargeMemoryTo(_mirror_memory_account);
+	}
 	RetainMirrorBuffer(_mirror_buffers, pop_media_packet, dts_us);
 
 	return pop_media_packet;
@@ -23,6 +23,7 @@
 #include "mediarouter_stats.h"
 #include "mediarouter_event_generator.h"
 #include "mediarouter_alert.h"
+#include "mediarouter_worker_pool.h"
 #include "modules/managed_queue/managed_queue.h"
 
 // Mirror buffer retention window, measured in media time (DTS). A video track
@@ -39,7 +40,7 @@ static constexpr int64_t MEDIA_ROUTE_STREAM_TRACK_PREPARE_TIMEOUT_MS = 3000;
 class MediaRouteStream : public MediaRouterNormalize, public MediaRouterStats, public MediaRouterEventGenerator, public MediaRouterAlert
 {
 public:
-	MediaRouteStream(const std::shared_ptr<info::Stream> &stream, cmn::MediaRouterStreamType type, uint32_t worker_id);
+	MediaRouteStream(const std::shared_ptr<info::Stream> &stream, cmn::MediaRouterStreamType type, const MediaRouterWorkerPool::Slot &worker_slot);
 	~MediaRouteStream();
 
 	// Inout Stream Type
@@ -97,8 +98,10 @@ public:
 	// Query original stream information
 	std::shared_ptr<info::Stream> GetStream();
 
-	// MediaRouter worker assigned round-robin at construction, immutable for the stream's life.
-	uint32_t GetWorkerID() const { return _worker_id; }
+	// MediaRouter worker attached at construction, immutable for the stream's life.
+	const MediaRouterWorkerPool::Slot &GetWorkerSlot() const { return _worker_slot; }
+	// Gives the worker back to the pool when the stream is deleted
+	void DetachWorker() { _worker_slot.Detach(); }
 
 	void OnStreamPrepared(bool completed);
 	bool IsStreamPrepared();
@@ -157,7 +160,7 @@ private:
 	// Incoming/Outgoing Stream
 	cmn::MediaRouterStreamType _type;
 
-	const uint32_t _worker_id;
+	MediaRouterWorkerPool::Slot _worker_slot;
 
 	// Stream Information
 	std::shared_ptr<info::Stream> _stream = nullptr;
@@ -175,4 +178,8 @@ private:
 
 	// Mirror buffers, one per track
 	MirrorBufferMap _mirror_buffers;
+
+	// Packets waiting in _packets_queue, and packets kept in _mirror_buffers
+	std::shared_ptr<ov::MemoryAccount> _queue_memory_account;
+	std::shared_ptr<ov::MemoryAccount> _mirror_memory_account;
 };
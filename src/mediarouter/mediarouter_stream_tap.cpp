@@ -92,6 +92,21 @@ std::shared_ptr<MediaPacket> MediaRouterStreamTap::Pop(int timeout_in_msec)
     return nullptr;
 }
 
+void MediaRouterStreamTap::SetPacketNotifier(PacketNotifier notifier)
+{
+    ov::LockGuard lock(_packet_notifier_mutex);
+    _packet_notifier = std::move(notifier);
+}
+
+void MediaRouterStreamTap::NotifyPacket()
+{
+    ov::LockGuard lock(_packet_notifier_mutex);
+    if (_packet_notifier != nullptr)
+    {
+        _packet_notifier();
+    }
+}
+
 std::shared_ptr<info::Stream> MediaRouterStreamTap::GetStreamInfo() const
 {
     return _tapped_stream_info;
@@ -137,10 +152,14 @@ bool MediaRouterStreamTap::PushTo(ov::Queue<std::shared_ptr<MediaPacket>> &buffe
 
     buffer.Enqueue(media_packet->ClonePacket());
 
+    NotifyPacket();
+
     return true;
 }
 
 void MediaRouterStreamTap::SetState(State state)
 {
     _state = state;
+
+    NotifyPacket();
 }
@@ -10,8 +10,11 @@
 
 #include <base/common_types.h>
 #include <base/ovlibrary/queue.h>
+#include <base/ovlibrary/tsa/mutex.h>
 #include <base/info/stream.h>
 
+#include <functional>
+
 #include <base/mediarouter/media_buffer.h>
 #include "mediarouter_application.h"
 
@@ -48,6 +51,12 @@ public:
     // The backfill buffer is drained before the live buffer; backfill is always older than any live packet.
     std::shared_ptr<MediaPacket> Pop(int timeout_in_msec = 0);
 
+    // The notifier is called whenever a packet is buffered or the state changes, so a consumer
+    // can wait for it (e.g. on one event shared by several taps) instead of polling the tap.
+    // It is called from the thread that pushes the packet, and must not block.
+    using PacketNotifier = std::function<void()>;
+    void SetPacketNotifier(PacketNotifier notifier);
+
     // return stream info reference
     std::shared_ptr<info::Stream> GetStreamInfo() const;
 
@@ -61,6 +70,7 @@ private:
     bool PushBackfill(const std::shared_ptr<MediaPacket> &media_packet);
 
     bool PushTo(ov::Queue<std::shared_ptr<MediaPacket>> &buffer, const std::shared_ptr<MediaPacket> &media_packet);
+    void NotifyPacket();
 
     void SetStreamInfo(const std::shared_ptr<info::Stream> &stream_info);
     void SetState(State state);
@@ -78,5 +88,8 @@ private:
 
 	std::atomic<bool> _need_past_data = false;
 
+    mutable ov::Mutex _packet_notifier_mutex;
+    PacketNotifier _packet_notifier OV_GUARDED_BY(_packet_notifier_mutex);
+
     uint32_t _id = 0;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+//==============================================================================
+//
+//  MediaRouterWorkerPool
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "mediarouter_worker_pool.h"
+
+#include "mediarouter_application.h"
+#include "mediarouter_private.h"
+
+#define MEDIAROUTER_WORKER_MAX_COUNT 64
+#define MEDIAROUTER_WORKER_QUEUE_THRESHOLD 1000
+
+MediaRouterWorkerPool::MediaRouterWorkerPool()
+	: ov::LanePool<MediaRouterWorkerItem>("MRWorker", ov::ThreadRole::Routing, MEDIAROUTER_WORKER_MAX_COUNT, MEDIAROUTER_WORKER_QUEUE_THRESHOLD, &MediaRouterWorkerPool::HandleItem)
+{
+}
+
+MediaRouterWorkerPool::Slot MediaRouterWorkerPool::AttachInbound(const info::VHostAppName &vhost_app_name, size_t worker_count)
+{
+	return Attach(vhost_app_name, "MRIn", worker_count);
+}
+
+MediaRouterWorkerPool::Slot MediaRouterWorkerPool::AttachOutbound(const info::VHostAppName &vhost_app_name, size_t worker_count, int buffering_delay_ms)
+{
+	if (buffering_delay_ms > 0)
+	{
+		return Attach(vhost_app_name, ov::String::FormatString("MROut-d%d", buffering_delay_ms), worker_count, buffering_delay_ms);
+	}
+
+	return Attach(vhost_app_name, "MROut", worker_count);
+}
+
+void MediaRouterWorkerPool::HandleItem(MediaRouterWorkerItem &item)
+{
+	auto application = item.application.lock();
+	if (application == nullptr)
+	{
+		// Application was already destroyed.
+		return;
+	}
+
+	auto stream = item.stream.lock();
+	if (stream == nullptr)
+	{
+		// Stream was already destroyed (e.g. deleted while packets were buffered in delay queue).
+		return;
+	}
+
+	application->ProcessStream(stream);
+}
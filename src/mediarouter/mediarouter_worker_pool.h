@@ -0,0 +1,40 @@
+//==============================================================================
+//
+//  MediaRouterWorkerPool
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <modules/task_pool/lane_pool.h>
+
+class MediaRouteApplication;
+class MediaRouteStream;
+
+// A stream that has packets to be delivered
+struct MediaRouterWorkerItem
+{
+	std::weak_ptr<MediaRouteApplication> application;
+	std::weak_ptr<MediaRouteStream> stream;
+};
+
+// Inbound and outbound workers shared by every MediaRouteApplication. The workers of an
+// application's streams start with its first stream, so an application without a stream
+// costs no thread, and the applications on a worker take turns (see ov::LanePool).
+class MediaRouterWorkerPool : public ov::Singleton<MediaRouterWorkerPool>, public ov::LanePool<MediaRouterWorkerItem>
+{
+public:
+	using Slot = ov::LanePool<MediaRouterWorkerItem>::Slot;
+
+	MediaRouterWorkerPool();
+
+	Slot AttachInbound(const info::VHostAppName &vhost_app_name, size_t worker_count);
+	// The buffering delay is applied by the queue of a worker, so the outbound streams are
+	// grouped by their delay
+	Slot AttachOutbound(const info::VHostAppName &vhost_app_name, size_t worker_count, int buffering_delay_ms);
+
+protected:
+	static void HandleItem(MediaRouterWorkerItem &item);
+};
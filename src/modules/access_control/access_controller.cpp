@@ -100,12 +100,82 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const SignedPol
 	return {AccessController::VerificationResult::Error, nullptr};
 }
 
-std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::InvokeAdmissionWebhook(
+ov::String AccessController::ExpandDecisionCacheKey(const ov::String &key_template, const std::shared_ptr<const ac::RequestInfo> &request_info)
+{
+	auto requested_url = request_info->GetRequestedUrl();
+	ov::String key;
+	off_t offset = 0;
+
+	while (true)
+	{
+		auto macro_start = key_template.IndexOf("${", offset);
+		auto macro_end = (macro_start >= 0) ? key_template.IndexOf('}', macro_start) : -1;
+
+		if (macro_end < 0)
+		{
+			key.Append(key_template.Substring(offset));
+			break;
+		}
+
+		key.Append(key_template.Substring(offset, macro_start - offset));
+
+		auto macro = key_template.Substring(macro_start + 2, macro_end - macro_start - 2);
+
+		if (macro == "Host")
+		{
+			key.Append(requested_url->Host());
+		}
+		else if (macro == "App")
+		{
+			key.Append(requested_url->App());
+		}
+		else if (macro == "Stream")
+		{
+			key.Append(requested_url->Stream());
+		}
+		else if (macro == "File")
+		{
+			key.Append(requested_url->File());
+		}
+		else if (macro == "ClientIP")
+		{
+			auto real_ip = request_info->FindRealIP();
+			if (real_ip.has_value())
+			{
+				key.Append(real_ip.value());
+			}
+			else if (request_info->GetClientAddress() != nullptr)
+			{
+				key.Append(request_info->GetClientAddress()->GetIpAddress());
+			}
+		}
+		else if (macro.HasPrefix("Query:"))
+		{
+			key.Append(requested_url->GetQueryValue(macro.Substring(6)));
+		}
+		else
+		{
+			// Unknown macros are kept as they are
+			key.Append(key_template.Substring(macro_start, macro_end - macro_start + 1));
+		}
+
+		offset = macro_end + 1;
+	}
+
+	return key;
+}
+
+AccessController::VerificationResult AccessController::ToVerificationResult(const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks)
+{
+	return (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED) ? AccessController::VerificationResult::Pass : AccessController::VerificationResult::Fail;
+}
+
+std::tuple<AccessController::VerificationResult, std::shared_ptr<AdmissionWebhooks>> AccessController::PrepareAdmissionWebhook(
 	const info::Host &host_info,
 	const std::shared_ptr<const ac::RequestInfo> &request_info,
 	std::optional<int> timeout_in_msec,
 	AdmissionWebhooks::Status::Code status,
-	AccessController::AdmissionWebhookInvokeResult result_callback)
+	AdmissionWebhooksDispatcher::Policy *policy)
 {
 	auto &webhooks_config = host_info.GetAdmissionWebhooks();
 	if (!webhooks_config.IsParsed())
@@ -148,42 +218,162 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 	}
 
 	std::shared_ptr<AdmissionWebhooks> admission_webhooks;
+	ov::String protocol;
 	if (_provider_type != ProviderType::Unknown)
 	{
-		admission_webhooks = AdmissionWebhooks::Query(_provider_type, control_server_url, timeout_msec, secret_key, request_info, status);
+		admission_webhooks = AdmissionWebhooks::Create(_provider_type, control_server_url, timeout_msec, secret_key, request_info, status);
+		protocol		   = ov::String::FormatString("incoming/%s", StringFromProviderType(_provider_type).CStr());
 	}
-	else if (_publisher_type != PublisherType::Unknown)
+	else
 	{
-		admission_webhooks = AdmissionWebhooks::Query(_publisher_type, control_server_url, timeout_msec, secret_key, request_info, status);
+		admission_webhooks = AdmissionWebhooks::Create(_publisher_type, control_server_url, timeout_msec, secret_key, request_info, status);
+		protocol		   = ov::String::FormatString("outgoing/%s", StringFromPublisherType(_publisher_type).CStr());
 	}
-	else
+
+	*policy = AdmissionWebhooksDispatcher::Policy();
+
+	auto &decision_cache_config = webhooks_config.GetDecisionCache();
+	// Closing notifications are neither coalesced nor cached
+	if (decision_cache_config.IsParsed() && (status == AdmissionWebhooks::Status::Code::OPENING))
 	{
-		logte("Provider type or publisher type must be set");
-		return {AccessController::VerificationResult::Error, nullptr};
+		policy->cache_key		 = ov::String::FormatString("%s %s %s",
+															control_server_url_address.CStr(),
+															protocol.CStr(),
+															ExpandDecisionCacheKey(decision_cache_config.GetKey(), request_info).CStr());
+		policy->allowed_ttl_msec = decision_cache_config.GetAllowedTtlMsec();
+		policy->denied_ttl_msec	 = decision_cache_config.GetDeniedTtlMsec();
 	}
 
-	if (admission_webhooks == nullptr)
+	// The breaker fails requests without asking the Control Server, so it applies only when configured
+	auto &circuit_breaker_config = webhooks_config.GetCircuitBreaker();
+	if (circuit_breaker_config.IsParsed())
 	{
-		// Probably this doesn't happen
-		logte("Could not load admission webhooks");
-		return {AccessController::VerificationResult::Error, nullptr};
+		policy->failure_threshold  = circuit_breaker_config.GetFailureThreshold();
+		policy->open_duration_msec = circuit_breaker_config.GetOpenDurationMsec();
+	}
+
+	return {AccessController::VerificationResult::Pass, admission_webhooks};
+}
+
+std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::InvokeAdmissionWebhook(
+	const info::Host &host_info,
+	const std::shared_ptr<const ac::RequestInfo> &request_info,
+	std::optional<int> timeout_in_msec,
+	AdmissionWebhooks::Status::Code status,
+	AccessController::AdmissionWebhookInvokeResult result_callback)
+{
+	AdmissionWebhooksDispatcher::Policy policy;
+	auto [prepare_result, admission_webhooks] = PrepareAdmissionWebhook(host_info, request_info, timeout_in_msec, status, &policy);
+
+	if (prepare_result != AccessController::VerificationResult::Pass)
+	{
+		return {prepare_result, nullptr};
 	}
 
+	auto result = AdmissionWebhooksDispatcher::GetInstance()->QueryAndWait(admission_webhooks, policy);
+
 	if (result_callback != nullptr)
 	{
-		auto client_address = request_info->GetClientAddress();
 		result_callback(
-			control_server_url_address,
-			client_address,
-			admission_webhooks);
+			host_info.GetAdmissionWebhooks().GetControlServerUrl(),
+			request_info->GetClientAddress(),
+			result);
 	}
 
-	if (admission_webhooks->GetErrCode() != AdmissionWebhooks::ErrCode::ALLOWED)
+	return {ToVerificationResult(result), result};
+}
+
+AccessController::VerificationResult AccessController::InvokeAdmissionWebhookAsync(
+	const info::Host &host_info,
+	const std::shared_ptr<const ac::RequestInfo> &request_info,
+	AdmissionWebhooks::Status::Code status,
+	AccessController::AdmissionWebhookInvokeResult result_callback,
+	AccessController::VerificationHandler handler)
+{
+	AdmissionWebhooksDispatcher::Policy policy;
+	auto [prepare_result, admission_webhooks] = PrepareAdmissionWebhook(host_info, request_info, std::nullopt, status, &policy);
+
+	if (prepare_result != AccessController::VerificationResult::Pass)
 	{
-		return {AccessController::VerificationResult::Fail, admission_webhooks};
+		if (handler != nullptr)
+		{
+			handler(prepare_result, nullptr);
+		}
+
+		return prepare_result;
 	}
 
-	return {AccessController::VerificationResult::Pass, admission_webhooks};
+	auto control_server_url_address = host_info.GetAdmissionWebhooks().GetControlServerUrl();
+
+	AdmissionWebhooksDispatcher::GetInstance()->Query(
+		admission_webhooks, policy,
+		[control_server_url_address, request_info, result_callback, handler](const std::shared_ptr<AdmissionWebhooks> &result) {
+			if (result_callback != nullptr)
+			{
+				result_callback(control_server_url_address, request_info->GetClientAddress(), result);
+			}
+
+			if (handler != nullptr)
+			{
+				handler(ToVerificationResult(result), result);
+			}
+		});
+
+	return AccessController::VerificationResult::Pass;
+}
+
+AccessController::AdmissionWebhookInvokeResult AccessController::MakeOpeningLogger(const std::shared_ptr<const ac::RequestInfo> &request_info)
+{
+	return [request_info](const ov::String &control_server_url_address,
+						  const std::shared_ptr<const ov::SocketAddress> &client_address,
+						  const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
+		if (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED ||
+			admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::DENIED)
+		{
+			logti("AdmissionWebhook queried %s for client %s accessing %s (Result: %s, Elapsed: %" PRIu64 " ms)",
+				  control_server_url_address.CStr(),
+				  client_address->ToString(false).CStr(),
+				  request_info->GetRequestedUrl()->ToUrlString().CStr(),
+				  admission_webhooks->GetErrCodeString().CStr(),
+				  admission_webhooks->GetElapsedTime());
+		}
+		else 
+		{
+			logtw("Failed to query AdmissionWebhook %s for client %s accessing %s (Result: %s, Elapsed: %" PRIu64" ms)",
+				  control_server_url_address.CStr(),
+				  client_address->ToString(false).CStr(),
+				  request_info->GetRequestedUrl()->ToUrlString().CStr(),
+				  admission_webhooks->GetErrCodeString().CStr(),
+				  admission_webhooks->GetElapsedTime());
+		}
+	};
+}
+
+AccessController::AdmissionWebhookInvokeResult AccessController::MakeClosingLogger(const std::shared_ptr<const ac::RequestInfo> &request_info)
+{
+	return [request_info](const ov::String &control_server_url_address,
+						  const std::shared_ptr<const ov::SocketAddress> &client_address,
+						  const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
+		if (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED ||
+			admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::DENIED)
+		{
+			logti("AdmissionWebhook notified %s that client %s closed the connection to %s (Result: %s, Elapsed: %" PRIu64 " ms)",
+				  control_server_url_address.CStr(),
+				  client_address->ToString(false).CStr(),
+				  request_info->GetRequestedUrl()->ToUrlString().CStr(),
+				  admission_webhooks->GetErrCodeString().CStr(),
+				  admission_webhooks->GetElapsedTime());
+		}
+		else 
+		{
+			logtw("Failed to notify AdmissionWebhook %s that client %s closed the connection to %s (Result: %s, Elapsed: %" PRIu64 " ms)",
+				  control_server_url_address.CStr(),
+				  client_address->ToString(false).CStr(),
+				  request_info->GetRequestedUrl()->ToUrlString().CStr(),
+				  admission_webhooks->GetErrCodeString().CStr(),
+				  admission_webhooks->GetElapsedTime());
+		}
+	};
 }
 
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::VerifyByWebhooks(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info)
@@ -193,29 +383,7 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		request_info,
 		std::nullopt,
 		AdmissionWebhooks::Status::Code::OPENING,
-		[&request_info](const ov::String &control_server_url_address,
-						const std::shared_ptr<const ov::SocketAddress> &client_address,
-						const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
-			if (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED ||
-				admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::DENIED)
-			{
-				logti("AdmissionWebhook queried %s for client %s accessing %s (Result: %s, Elapsed: %" PRIu64 " ms)",
-					  control_server_url_address.CStr(),
-					  client_address->ToString(false).CStr(),
-					  request_info->GetRequestedUrl()->ToUrlString().CStr(),
-					  admission_webhooks->GetErrCodeString().CStr(),
-					  admission_webhooks->GetElapsedTime());
-			}
-			else 
-			{
-				logtw("Failed to query AdmissionWebhook %s for client %s accessing %s (Result: %s, Elapsed: %" PRIu64" ms)",
-					  control_server_url_address.CStr(),
-					  client_address->ToString(false).CStr(),
-					  request_info->GetRequestedUrl()->ToUrlString().CStr(),
-					  admission_webhooks->GetErrCodeString().CStr(),
-					  admission_webhooks->GetElapsedTime());
-			}
-		});
+		MakeOpeningLogger(request_info));
 }
 
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::VerifyByWebhooks(const std::shared_ptr<const ac::RequestInfo> &request_info)
@@ -232,36 +400,40 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 	return {AccessController::VerificationResult::Error, nullptr};
 }
 
+void AccessController::VerifyByWebhooksAsync(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info, VerificationHandler handler)
+{
+	InvokeAdmissionWebhookAsync(
+		host_info,
+		request_info,
+		AdmissionWebhooks::Status::Code::OPENING,
+		MakeOpeningLogger(request_info),
+		std::move(handler));
+}
+
+void AccessController::VerifyByWebhooksAsync(const std::shared_ptr<const ac::RequestInfo> &request_info, VerificationHandler handler)
+{
+	auto host_info_item = GetHostInfo(request_info);
+
+	if (host_info_item.has_value())
+	{
+		VerifyByWebhooksAsync(host_info_item.value(), request_info, std::move(handler));
+		return;
+	}
+
+	handler(AccessController::VerificationResult::Error, nullptr);
+}
+
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::SendCloseWebhooks(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info)
 {
-	return InvokeAdmissionWebhook(
+	// Nobody waits for the response of a closing notification
+	auto result = InvokeAdmissionWebhookAsync(
 		host_info,
 		request_info,
-		std::nullopt,
 		AdmissionWebhooks::Status::Code::CLOSING,
-		[&request_info](const ov::String &control_server_url_address,
-						const std::shared_ptr<const ov::SocketAddress> &client_address,
-						const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
-			if (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED ||
-				admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::DENIED)
-			{
-				logti("AdmissionWebhook notified %s that client %s closed the connection to %s (Result: %s, Elapsed: %" PRIu64 " ms)",
-					  control_server_url_address.CStr(),
-					  client_address->ToString(false).CStr(),
-					  request_info->GetRequestedUrl()->ToUrlString().CStr(),
-					  admission_webhooks->GetErrCodeString().CStr(),
-					  admission_webhooks->GetElapsedTime());
-			}
-			else 
-			{
-				logtw("Failed to notify AdmissionWebhook %s that client %s closed the connection to %s (Result: %s, Elapsed: %" PRIu64 " ms)",
-					  control_server_url_address.CStr(),
-					  client_address->ToString(false).CStr(),
-					  request_info->GetRequestedUrl()->ToUrlString().CStr(),
-					  admission_webhooks->GetErrCodeString().CStr(),
-					  admission_webhooks->GetElapsedTime());
-			}
-		});
+		MakeClosingLogger(request_info),
+		nullptr);
+
+	return {result, nullptr};
 }
 
 std::tuple<AccessController::VerificationResult, std::shared_ptr<const AdmissionWebhooks>> AccessController::SendCloseWebhooks(const std::shared_ptr<const ac::RequestInfo> &request_info)
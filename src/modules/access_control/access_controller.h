@@ -12,6 +12,7 @@
 #include <base/info/host.h>
 
 #include "admission_webhooks/admission_webhooks.h"
+#include "admission_webhooks/admission_webhooks_dispatcher.h"
 #include "request_info.h"
 #include "signed_policy/signed_policy.h"
 
@@ -33,6 +34,8 @@ public:
 		const std::shared_ptr<const ov::SocketAddress> &client_address,
 		const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks)>;
 
+	using VerificationHandler = std::function<void(VerificationResult result, const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks)>;
+
 public:
 	AccessController(ProviderType provider_type, const cfg::Server &server_config);
 	AccessController(PublisherType publisher_type, const cfg::Server &server_config);
@@ -47,6 +50,13 @@ public:
 	// Verify the AdmissionWebhooks based on the `request_info`'s host part, treating it as a domain.
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> VerifyByWebhooks(const std::shared_ptr<const ac::RequestInfo> &request_info);
 
+	// Same as VerifyByWebhooks(), but does not block the calling thread while the control server is queried.
+	// <handler> is called from the thread that received the response, or before this returns (configuration is off,
+	// the decision is cached, or the control server is considered down).
+	void VerifyByWebhooksAsync(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info, VerificationHandler handler);
+	void VerifyByWebhooksAsync(const std::shared_ptr<const ac::RequestInfo> &request_info, VerificationHandler handler);
+
+	// Close webhooks are sent in the background, so the returned AdmissionWebhooks is always nullptr.
 	// Send close webhooks to the control server based on the `host_info` provided from outside, such as vhost or host.
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> SendCloseWebhooks(const info::Host &host_info, const std::shared_ptr<const ac::RequestInfo> &request_info);
 	// Send close webhooks to the control server based on the `request_info`'s host part, treating it as a domain.
@@ -55,6 +65,18 @@ public:
 protected:
 	std::optional<info::Host> GetHostInfo(const std::shared_ptr<const ac::RequestInfo> &request_info);
 
+	static VerificationResult ToVerificationResult(const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks);
+	static AdmissionWebhookInvokeResult MakeOpeningLogger(const std::shared_ptr<const ac::RequestInfo> &request_info);
+	static AdmissionWebhookInvokeResult MakeClosingLogger(const std::shared_ptr<const ac::RequestInfo> &request_info);
+
+	// Returns Pass with an AdmissionWebhooks that is ready to be dispatched, or Off/Error with nullptr
+	std::tuple<VerificationResult, std::shared_ptr<AdmissionWebhooks>> PrepareAdmissionWebhook(
+		const info::Host &host_info,
+		const std::shared_ptr<const ac::RequestInfo> &request_info,
+		std::optional<int> timeout_msec,
+		AdmissionWebhooks::Status::Code status,
+		AdmissionWebhooksDispatcher::Policy *policy);
+
 	std::tuple<VerificationResult, std::shared_ptr<const AdmissionWebhooks>> InvokeAdmissionWebhook(
 		const info::Host &host_info,
 		const std::shared_ptr<const ac::RequestInfo> &request_info,
@@ -62,6 +84,17 @@ protected:
 		AdmissionWebhooks::Status::Code status,
 		AdmissionWebhookInvokeResult result_callback);
 
+	// Returns Pass if the query has been dispatched, otherwise <handler> has already been called with Off/Error
+	VerificationResult InvokeAdmissionWebhookAsync(
+		const info::Host &host_info,
+		const std::shared_ptr<const ac::RequestInfo> &request_info,
+		AdmissionWebhooks::Status::Code status,
+		AdmissionWebhookInvokeResult result_callback,
+		VerificationHandler handler);
+
+	// Expands the macros of <DecisionCache><Key> with <request_info>
+	static ov::String ExpandDecisionCacheKey(const ov::String &key_template, const std::shared_ptr<const ac::RequestInfo> &request_info);
+
 private:
 	const ProviderType _provider_type;
 	const PublisherType _publisher_type;
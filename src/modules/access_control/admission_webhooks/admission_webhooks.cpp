@@ -2,11 +2,11 @@
 
 #include <modules/http/client/http_client.h>
 
-std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
-															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
-															const ov::String secret_key,
-															const std::shared_ptr<const ac::RequestInfo> &request_info,
-															const Status::Code status)
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Create(ProviderType provider,
+															 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															 const ov::String secret_key,
+															 const std::shared_ptr<const ac::RequestInfo> &request_info,
+															 const Status::Code status)
 {
 	auto hooks = std::make_shared<AdmissionWebhooks>();
 
@@ -17,16 +17,14 @@ std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provide
 	hooks->_request_info = request_info;
 	hooks->_status = status;
 
-	hooks->Run();
-
 	return hooks;
 }
 
-std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(PublisherType publisher,
-															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
-															const ov::String secret_key,
-															const std::shared_ptr<const ac::RequestInfo> &request_info,
-															const Status::Code status)
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Create(PublisherType publisher,
+															 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															 const ov::String secret_key,
+															 const std::shared_ptr<const ac::RequestInfo> &request_info,
+															 const Status::Code status)
 {
 	auto hooks = std::make_shared<AdmissionWebhooks>();
 
@@ -37,11 +35,73 @@ std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(PublisherType publis
 	hooks->_request_info = request_info;
 	hooks->_status = status;
 
+	return hooks;
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
+															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															const ov::String secret_key,
+															const std::shared_ptr<const ac::RequestInfo> &request_info,
+															const Status::Code status)
+{
+	auto hooks = Create(provider, control_server_url, timeout_msec, secret_key, request_info, status);
+
 	hooks->Run();
 
 	return hooks;
 }
 
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(PublisherType publisher,
+															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															const ov::String secret_key,
+															const std::shared_ptr<const ac::RequestInfo> &request_info,
+															const Status::Code status)
+{
+	auto hooks = Create(publisher, control_server_url, timeout_msec, secret_key, request_info, status);
+
+	hooks->Run();
+
+	return hooks;
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::CloneResult(uint64_t lifetime) const
+{
+	auto hooks = std::make_shared<AdmissionWebhooks>();
+
+	hooks->_elapsed_ms = _elapsed_ms;
+	hooks->_request_info = _request_info;
+	hooks->_control_server_url = _control_server_url;
+	hooks->_timeout_msec = _timeout_msec;
+	hooks->_secret_key = _secret_key;
+	hooks->_provider_type = _provider_type;
+	hooks->_publisher_type = _publisher_type;
+	hooks->_status = _status;
+
+	hooks->_allowed = _allowed;
+	hooks->_err_code = _err_code;
+	hooks->_err_reason = _err_reason;
+	// Callers may modify the URL (e.g. port), so each request gets its own
+	hooks->_new_url = (_new_url != nullptr) ? _new_url->Clone() : nullptr;
+	hooks->_lifetime = lifetime;
+
+	return hooks;
+}
+
+const std::shared_ptr<ov::Url> &AdmissionWebhooks::GetControlServerUrl() const
+{
+	return _control_server_url;
+}
+
+uint64_t AdmissionWebhooks::GetTimeoutMsec() const
+{
+	return _timeout_msec;
+}
+
+AdmissionWebhooks::Status::Code AdmissionWebhooks::GetStatusCode() const
+{
+	return _status;
+}
+
 AdmissionWebhooks::ErrCode AdmissionWebhooks::GetErrCode() const
 {
 	return _err_code;
@@ -263,13 +323,13 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 	SetError(_allowed ? ErrCode::ALLOWED : ErrCode::DENIED, _err_reason);
 }
 
-void AdmissionWebhooks::Run()
+std::shared_ptr<http::clnt::HttpClient> AdmissionWebhooks::PrepareHttpClient()
 {
 	auto body = MakeMessageBody();
 	if (body.IsEmpty())
 	{
 		// Error
-		return;
+		return nullptr;
 	}
 
 	// Set X-OME-Signature
@@ -278,14 +338,13 @@ void AdmissionWebhooks::Run()
 	{
 		// Error
 		SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("Signature creation failed.(Method : HMAC(SHA1), Key : %s, Body length : %zu", _secret_key.CStr(), body.GetLength()));
-		return;
+		return nullptr;
 	}
 
 	auto signature_sha1_base64 = ov::Base64::Encode(md_sha1, true);
 
 	auto client = std::make_shared<http::clnt::HttpClient>();
 	client->SetMethod(http::Method::Post);
-	client->SetBlockingMode(ov::BlockingMode::Blocking);
 	client->SetConnectionTimeout(_timeout_msec);
 	client->SetRecvTimeout(_timeout_msec);
 	client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
@@ -293,32 +352,123 @@ void AdmissionWebhooks::Run()
 	client->SetRequestHeader("Accept", "application/json");
 	client->SetRequestBody(body);
 
-	ov::StopWatch watch;
-	watch.Start();
+	return client;
+}
+
+void AdmissionWebhooks::HandleResponse(http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error)
+{
+	_elapsed_ms = _watch.Elapsed();
+
+	// A response was received from the server.
+	if (error == nullptr)
+	{
+		if (status_code == http::StatusCode::OK)
+		{
+			// Parsing response
+			ParseResponse(data);
+		}
+		else
+		{
+			SetError(ErrCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(status_code)));
+		}
+	}
+	else
+	{
+		// A connection error or an error that does not conform to the HTTP spec has occurred.
+		SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", error->GetCode(), error->GetMessage().CStr()));
+	}
+}
+
+void AdmissionWebhooks::Run()
+{
+	auto client = PrepareHttpClient();
+	if (client == nullptr)
+	{
+		return;
+	}
+
+	client->SetBlockingMode(ov::BlockingMode::Blocking);
+
+	_watch.Start();
 
 	client->Request(_control_server_url->ToUrlString(true), [=](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) {
-		_elapsed_ms = watch.Elapsed();
+		HandleResponse(status_code, data, error);
+	});
+}
+
+void AdmissionWebhooks::RunAsync(CompletionHandler handler)
+{
+	auto client = PrepareHttpClient();
+	if (client == nullptr)
+	{
+		handler(GetSharedPtr());
+		return;
+	}
+
+	client->SetBlockingMode(ov::BlockingMode::NonBlocking);
+
+	{
+		ov::LockGuard lock_guard(_async_mutex);
+
+		_completion_handler = std::move(handler);
+		_http_client = client;
+		_watch.Start();
+	}
+
+	auto self = GetSharedPtr();
+
+	// The handler may be called before Request() returns (e.g. connection refused)
+	client->Request(_control_server_url->ToUrlString(true), [self](http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error) {
+		CompletionHandler completion_handler;
 
-		// A response was received from the server.
-		if (error == nullptr)
 		{
-			if (status_code == http::StatusCode::OK)
-			{
-				// Parsing response
-				ParseResponse(data);
-				return;
-			}
-			else
+			ov::LockGuard lock_guard(self->_async_mutex);
+
+			if (self->_completed)
 			{
-				SetError(ErrCode::INVALID_STATUS_CODE, ov::String::FormatString("Control server responded with %d status code.", static_cast<uint16_t>(status_code)));
+				// Already canceled
 				return;
 			}
+
+			self->HandleResponse(status_code, data, error);
+
+			self->_completed = true;
+			completion_handler = std::move(self->_completion_handler);
+			self->_http_client = nullptr;
 		}
-		else
+
+		completion_handler(self);
+	});
+}
+
+void AdmissionWebhooks::Cancel(const ov::String &reason)
+{
+	CompletionHandler completion_handler;
+	std::shared_ptr<http::clnt::HttpClient> client;
+
+	{
+		ov::LockGuard lock_guard(_async_mutex);
+
+		if (_completed)
 		{
-			// A connection error or an error that does not conform to the HTTP spec has occurred.
-			SetError(ErrCode::INTERNAL_ERROR, ov::String::FormatString("The HTTP client's request failed. (error code(%d) error message(%s)", error->GetCode(), error->GetMessage().CStr()));
 			return;
 		}
-	});
+
+		_elapsed_ms = (_completion_handler != nullptr) ? _watch.Elapsed() : 0;
+		SetError(ErrCode::INTERNAL_ERROR, reason);
+
+		_completed = true;
+		completion_handler = std::move(_completion_handler);
+		client = std::move(_http_client);
+	}
+
+	if (client != nullptr)
+	{
+		client->Cancel();
+	}
+
+	if (completion_handler != nullptr)
+	{
+		completion_handler(GetSharedPtr());
+	}
 }
@@ -3,9 +3,16 @@
 #include <base/common_types.h>
 #include <base/ovlibrary/ovlibrary.h>
 #include <base/ovsocket/socket_address.h>
+#include <modules/http/http_datastructure.h>
+
 #include "../request_info.h"
 
-class AdmissionWebhooks
+namespace http::clnt
+{
+	class HttpClient;
+}
+
+class AdmissionWebhooks : public ov::EnableSharedFromThis<AdmissionWebhooks>
 {
 public:
 	enum class ErrCode : uint8_t
@@ -41,6 +48,22 @@ public:
 		};
 	};
 
+	// Called once when the query is completed, failed or canceled
+	using CompletionHandler = std::function<void(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks)>;
+
+	static std::shared_ptr<AdmissionWebhooks> Create(ProviderType provider,
+													 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+													 const ov::String secret_key,
+													 const std::shared_ptr<const ac::RequestInfo> &request_info,
+													 const Status::Code status);
+
+	static std::shared_ptr<AdmissionWebhooks> Create(PublisherType publisher,
+													 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+													 const ov::String secret_key,
+													 const std::shared_ptr<const ac::RequestInfo> &request_info,
+													 const Status::Code status);
+
+	// Create() + Run()
 	static std::shared_ptr<AdmissionWebhooks> Query(ProviderType provider,
 													const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
 													const ov::String secret_key,
@@ -53,6 +76,23 @@ public:
 													const std::shared_ptr<const ac::RequestInfo> &request_info,
 													const Status::Code status);
 
+	// Queries the control server, and blocks until the response is received or the timeout expires
+	void Run();
+	// Queries the control server with a non-blocking HTTP client; <handler> is called from the socket thread
+	// that received the response. The timeout is not applied here, see Cancel().
+	void RunAsync(CompletionHandler handler);
+	// Completes the query with INTERNAL_ERROR unless the response arrived first.
+	// If RunAsync() is in progress, its handler is called with this result.
+	void Cancel(const ov::String &reason);
+
+	// Returns a copy of the result of a completed query, to be handed to another request.
+	// <lifetime> replaces the lifetime returned by the control server.
+	std::shared_ptr<AdmissionWebhooks> CloneResult(uint64_t lifetime) const;
+
+	const std::shared_ptr<ov::Url> &GetControlServerUrl() const;
+	uint64_t GetTimeoutMsec() const;
+	Status::Code GetStatusCode() const;
+
 	ErrCode GetErrCode() const;
 	ov::String GetErrCodeString() const;
 	ov::String GetErrReason() const;
@@ -61,7 +101,9 @@ public:
 	uint64_t GetElapsedTime() const;
 	
 private:
-	void Run();
+	std::shared_ptr<http::clnt::HttpClient> PrepareHttpClient();
+	void HandleResponse(http::StatusCode status_code, const std::shared_ptr<ov::Data> &data, const std::shared_ptr<const ov::Error> &error);
+
 	ov::String MakeMessageBody();
 	void SetError(ErrCode code, ov::String reason);
 
@@ -77,9 +119,16 @@ private:
 	PublisherType _publisher_type = PublisherType::Unknown;
 	Status::Code _status;
 
+	// For RunAsync()
+	ov::Mutex _async_mutex;
+	bool _completed OV_GUARDED_BY(_async_mutex) = false;
+	CompletionHandler _completion_handler OV_GUARDED_BY(_async_mutex);
+	std::shared_ptr<http::clnt::HttpClient> _http_client OV_GUARDED_BY(_async_mutex);
+	ov::StopWatch _watch;
+
 	// Response
 	bool _allowed = false;
-	ErrCode _err_code;
+	ErrCode _err_code = ErrCode::INTERNAL_ERROR;
 	ov::String _err_reason;
 	std::shared_ptr<ov::Url> _new_url = nullptr;
 	uint64_t _lifetime = 0;
@@ -0,0 +1,310 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "admission_webhooks_dispatcher.h"
+
+#include <future>
+
+#define OV_LOG_TAG "AdmissionWebhooks"
+
+#define ADMISSION_WEBHOOKS_PURGE_INTERVAL_MSEC (10 * 1000)
+
+AdmissionWebhooksDispatcher::AdmissionWebhooksDispatcher()
+{
+	_timer.Push(
+		[this](void *parameter) -> ov::DelayQueueAction {
+			PurgeExpiredDecisions();
+			return ov::DelayQueueAction::Repeat;
+		},
+		ADMISSION_WEBHOOKS_PURGE_INTERVAL_MSEC);
+
+	_timer.Start();
+}
+
+AdmissionWebhooksDispatcher::~AdmissionWebhooksDispatcher()
+{
+	_timer.Stop();
+}
+
+bool AdmissionWebhooksDispatcher::IsFailure(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks)
+{
+	switch (admission_webhooks->GetErrCode())
+	{
+		case AdmissionWebhooks::ErrCode::ALLOWED:
+		case AdmissionWebhooks::ErrCode::DENIED:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+uint64_t AdmissionWebhooksDispatcher::GetRemainingLifetime(const CachedDecision &decision, Clock::time_point now)
+{
+	if (decision.lifetime_end_time.has_value() == false)
+	{
+		return 0;
+	}
+
+	// The decision expires no later than its lifetime, so this is at least 1
+	return std::max<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(decision.lifetime_end_time.value() - now).count(), 1);
+}
+
+std::shared_ptr<AdmissionWebhooksDispatcher::PendingQuery> AdmissionWebhooksDispatcher::Prepare(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks, const Policy &policy, AdmissionWebhooks::CompletionHandler handler)
+{
+	auto server_key = admission_webhooks->GetControlServerUrl()->ToUrlString(true);
+	std::shared_ptr<AdmissionWebhooks> cached_result;
+	ov::String reject_reason;
+
+	{
+		ov::LockGuard lock_guard(_mutex);
+
+		auto now = Clock::now();
+
+		if (policy.cache_key.IsEmpty() == false)
+		{
+			auto decision_item = _decision_map.find(policy.cache_key);
+			if (decision_item != _decision_map.end())
+			{
+				auto &decision = decision_item->second;
+
+				if (decision.expire_time > now)
+				{
+					cached_result = decision.admission_webhooks->CloneResult(GetRemainingLifetime(decision, now));
+				}
+				else
+				{
+					_decision_map.erase(decision_item);
+				}
+			}
+
+			if (cached_result == nullptr)
+			{
+				auto pending_item = _pending_query_map.find(policy.cache_key);
+				if (pending_item != _pending_query_map.end())
+				{
+					// The same query is in flight
+					pending_item->second->handlers.push_back(std::move(handler));
+					return nullptr;
+				}
+			}
+		}
+
+		if ((cached_result == nullptr) && (policy.failure_threshold > 0))
+		{
+			auto &circuit = _circuit_map[server_key];
+
+			if (circuit.failure_count >= policy.failure_threshold)
+			{
+				if ((now < circuit.open_until) || circuit.probing)
+				{
+					reject_reason.Format("The control server (%s) is not available (circuit open after %d failures)", server_key.CStr(), circuit.failure_count);
+				}
+				else
+				{
+					// Half-open: let this query probe the server
+					circuit.probing = true;
+				}
+			}
+		}
+
+		if ((cached_result == nullptr) && reject_reason.IsEmpty())
+		{
+			auto pending_query = std::make_shared<PendingQuery>();
+
+			pending_query->cache_key = policy.cache_key;
+			pending_query->server_key = server_key;
+			pending_query->policy = policy;
+			pending_query->handlers.push_back(std::move(handler));
+
+			if (policy.cache_key.IsEmpty() == false)
+			{
+				_pending_query_map[policy.cache_key] = pending_query;
+			}
+
+			return pending_query;
+		}
+	}
+
+	if (cached_result != nullptr)
+	{
+		handler(cached_result);
+	}
+	else
+	{
+		admission_webhooks->Cancel(reject_reason);
+		handler(admission_webhooks);
+	}
+
+	return nullptr;
+}
+
+void AdmissionWebhooksDispatcher::Complete(const std::shared_ptr<PendingQuery> &pending_query, const std::shared_ptr<AdmissionWebhooks> &admission_webhooks)
+{
+	std::vector<AdmissionWebhooks::CompletionHandler> handlers;
+	auto failed = IsFailure(admission_webhooks);
+	auto &policy = pending_query->policy;
+
+	{
+		ov::LockGuard lock_guard(_mutex);
+
+		auto now = Clock::now();
+
+		if (policy.failure_threshold > 0)
+		{
+			auto &circuit = _circuit_map[pending_query->server_key];
+
+			if (failed)
+			{
+				circuit.failure_count++;
+
+				if (circuit.failure_count >= policy.failure_threshold)
+				{
+					if ((circuit.probing == false) && (circuit.failure_count == policy.failure_threshold))
+					{
+						logtw("The control server (%s) failed %d times in a row, queries to it will fail for %" PRId64 " ms",
+							  pending_query->server_key.CStr(), circuit.failure_count, policy.open_duration_msec);
+					}
+
+					circuit.open_until = now + std::chrono::milliseconds(policy.open_duration_msec);
+				}
+			}
+			else
+			{
+				if (circuit.failure_count >= policy.failure_threshold)
+				{
+					logti("The control server (%s) is available again", pending_query->server_key.CStr());
+				}
+
+				circuit.failure_count = 0;
+			}
+
+			circuit.probing = false;
+		}
+
+		if (pending_query->cache_key.IsEmpty() == false)
+		{
+			_pending_query_map.erase(pending_query->cache_key);
+
+			auto ttl_msec = (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::ALLOWED) ? policy.allowed_ttl_msec
+						  : (admission_webhooks->GetErrCode() == AdmissionWebhooks::ErrCode::DENIED) ? policy.denied_ttl_msec
+																									   : 0;
+
+			if (ttl_msec > 0)
+			{
+				CachedDecision decision;
+
+				// Handlers may modify their result, so the cache keeps its own copy
+				decision.admission_webhooks = admission_webhooks->CloneResult(admission_webhooks->GetLifetime());
+				decision.expire_time = now + std::chrono::milliseconds(ttl_msec);
+
+				if (admission_webhooks->GetLifetime() > 0)
+				{
+					// The lifetime counts from now, so a cached decision must not outlive it
+					decision.lifetime_end_time = now + std::chrono::milliseconds(admission_webhooks->GetLifetime());
+					decision.expire_time = std::min(decision.expire_time, decision.lifetime_end_time.value());
+				}
+
+				_decision_map[pending_query->cache_key] = std::move(decision);
+			}
+		}
+
+		handlers = std::move(pending_query->handlers);
+	}
+
+	for (size_t index = 0; index < handlers.size(); index++)
+	{
+		handlers[index]((index == 0) ? admission_webhooks : admission_webhooks->CloneResult(admission_webhooks->GetLifetime()));
+	}
+}
+
+void AdmissionWebhooksDispatcher::Query(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks, const Policy &policy, AdmissionWebhooks::CompletionHandler handler)
+{
+	auto pending_query = Prepare(admission_webhooks, policy, std::move(handler));
+	if (pending_query == nullptr)
+	{
+		return;
+	}
+
+	// Non-blocking sockets have no receive timeout, so the query is canceled by the timer
+	std::weak_ptr<AdmissionWebhooks> weak_admission_webhooks = admission_webhooks;
+	_timer.Push(
+		[weak_admission_webhooks](void *parameter) -> ov::DelayQueueAction {
+			auto admission_webhooks = weak_admission_webhooks.lock();
+			if (admission_webhooks != nullptr)
+			{
+				admission_webhooks->Cancel(ov::String::FormatString("The control server did not respond within %" PRIu64 " ms", admission_webhooks->GetTimeoutMsec()));
+			}
+
+			return ov::DelayQueueAction::Stop;
+		},
+		static_cast<int>(admission_webhooks->GetTimeoutMsec()));
+
+	admission_webhooks->RunAsync([this, pending_query](const std::shared_ptr<AdmissionWebhooks> &result) {
+		Complete(pending_query, result);
+	});
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooksDispatcher::QueryAndWait(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks, const Policy &policy)
+{
+	// The handler may be called after this function gave up waiting, so the promise is shared with it
+	auto promise = std::make_shared<std::promise<std::shared_ptr<AdmissionWebhooks>>>();
+	auto future = promise->get_future();
+
+	auto pending_query = Prepare(admission_webhooks, policy, [promise](const std::shared_ptr<AdmissionWebhooks> &result) {
+		promise->set_value(result);
+	});
+
+	if (pending_query != nullptr)
+	{
+		admission_webhooks->Run();
+		Complete(pending_query, admission_webhooks);
+	}
+	else if (future.wait_for(std::chrono::milliseconds(admission_webhooks->GetTimeoutMsec() * 2)) != std::future_status::ready)
+	{
+		// The query we joined should have timed out by now
+		admission_webhooks->Cancel(ov::String::FormatString("The control server did not respond within %" PRIu64 " ms", admission_webhooks->GetTimeoutMsec()));
+		return admission_webhooks;
+	}
+
+	return future.get();
+}
+
+size_t AdmissionWebhooksDispatcher::GetCachedDecisionCount() const
+{
+	ov::LockGuard lock_guard(_mutex);
+
+	return _decision_map.size();
+}
+
+void AdmissionWebhooksDispatcher::ClearCache()
+{
+	ov::LockGuard lock_guard(_mutex);
+
+	_decision_map.clear();
+	_circuit_map.clear();
+}
+
+void AdmissionWebhooksDispatcher::PurgeExpiredDecisions()
+{
+	ov::LockGuard lock_guard(_mutex);
+
+	auto now = Clock::now();
+
+	for (auto item = _decision_map.begin(); item != _decision_map.end();)
+	{
+		if (item->second.expire_time <= now)
+		{
+			item = _decision_map.erase(item);
+		}
+		else
+		{
+			++item;
+		}
+	}
+}
@@ -0,0 +1,102 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <unordered_map>
+
+#include "admission_webhooks.h"
+
+// Runs AdmissionWebhooks queries on behalf of all publishers/providers.
+//
+// - Requests with the same cache key that arrive while a query is in flight wait for that
+//   query instead of sending their own (flash crowd coalescing)
+// - ALLOWED/DENIED decisions are cached by key, no longer than the lifetime returned by the
+//   control server
+// - After consecutive failures of a control server, queries to it fail immediately for a while
+//   (circuit breaker). When that time has passed, one query probes the server again.
+class AdmissionWebhooksDispatcher : public ov::Singleton<AdmissionWebhooksDispatcher>
+{
+public:
+	struct Policy
+	{
+		// Empty key: the query is neither coalesced nor cached
+		ov::String cache_key;
+		int64_t allowed_ttl_msec = 0;
+		int64_t denied_ttl_msec = 0;
+
+		// 0: circuit breaker is disabled
+		int failure_threshold = 0;
+		int64_t open_duration_msec = 0;
+	};
+
+	AdmissionWebhooksDispatcher();
+	~AdmissionWebhooksDispatcher() override;
+
+	// <admission_webhooks> must be created by AdmissionWebhooks::Create() and not run yet.
+	// <handler> may be called before Query() returns (cached decision, open circuit), or from the thread
+	// that received the response. Each handler gets its own AdmissionWebhooks.
+	void Query(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks, const Policy &policy, AdmissionWebhooks::CompletionHandler handler);
+
+	// Same as Query(), but returns the result. If no identical query is in flight, the query is sent by
+	// a blocking HTTP client in the calling thread.
+	std::shared_ptr<AdmissionWebhooks> QueryAndWait(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks, const Policy &policy);
+
+	size_t GetCachedDecisionCount() const;
+	void ClearCache();
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct PendingQuery
+	{
+		ov::String cache_key;
+		ov::String server_key;
+		Policy policy;
+
+		// The first handler is the one of the request that sent the query
+		std::vector<AdmissionWebhooks::CompletionHandler> handlers;
+	};
+
+	struct CachedDecision
+	{
+		std::shared_ptr<AdmissionWebhooks> admission_webhooks;
+		Clock::time_point expire_time;
+		// Valid if the control server returned a lifetime
+		std::optional<Clock::time_point> lifetime_end_time;
+	};
+
+	struct CircuitState
+	{
+		int failure_count = 0;
+		Clock::time_point open_until;
+		// While probing, the other queries keep failing immediately
+		bool probing = false;
+	};
+
+	// Returns the query to be sent by the caller, or nullptr if <handler> was served from the cache,
+	// joined to a query in flight, or rejected by the circuit breaker
+	std::shared_ptr<PendingQuery> Prepare(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks, const Policy &policy, AdmissionWebhooks::CompletionHandler handler);
+	void Complete(const std::shared_ptr<PendingQuery> &pending_query, const std::shared_ptr<AdmissionWebhooks> &admission_webhooks);
+
+	static bool IsFailure(const std::shared_ptr<AdmissionWebhooks> &admission_webhooks);
+	static uint64_t GetRemainingLifetime(const CachedDecision &decision, Clock::time_point now);
+
+	void PurgeExpiredDecisions();
+
+	mutable ov::Mutex _mutex;
+	std::unordered_map<ov::String, std::shared_ptr<PendingQuery>> _pending_query_map OV_GUARDED_BY(_mutex);
+	std::unordered_map<ov::String, CachedDecision> _decision_map OV_GUARDED_BY(_mutex);
+	// Key: Control server URL
+	std::unordered_map<ov::String, CircuitState> _circuit_map OV_GUARDED_BY(_mutex);
+
+	// Timeouts of asynchronous queries and purging the cache
+	ov::DelayQueue _timer{"AWDispatch"};
+};
@@ -0,0 +1,372 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "admission_webhooks_dispatcher.h"
+
+namespace
+{
+	// Minimal HTTP/1.1 server standing in for the control server
+	class StubControlServer
+	{
+	public:
+		StubControlServer()
+		{
+			_listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+			int reuse = 1;
+			::setsockopt(_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+			sockaddr_in address{};
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			address.sin_port = 0;
+
+			::bind(_listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+			::listen(_listen_fd, 128);
+
+			socklen_t length = sizeof(address);
+			::getsockname(_listen_fd, reinterpret_cast<sockaddr *>(&address), &length);
+			_port = ntohs(address.sin_port);
+
+			_thread = std::thread(&StubControlServer::AcceptLoop, this);
+		}
+
+		~StubControlServer()
+		{
+			_stop = true;
+			_thread.join();
+			::close(_listen_fd);
+		}
+
+		void SetResponse(int status_code, const ov::String &body, int delay_msec = 0)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+			_status_code = status_code;
+			_body = body;
+			_delay_msec = delay_msec;
+		}
+
+		int GetRequestCount() const
+		{
+			return _request_count;
+		}
+
+		std::shared_ptr<ov::Url> GetUrl() const
+		{
+			return ov::Url::Parse(ov::String::FormatString("http://127.0.0.1:%d/webhooks", _port));
+		}
+
+	private:
+		void AcceptLoop()
+		{
+			std::vector<std::thread> workers;
+
+			while (_stop == false)
+			{
+				pollfd poll_fd{_listen_fd, POLLIN, 0};
+				if (::poll(&poll_fd, 1, 50) <= 0)
+				{
+					continue;
+				}
+
+				int client_fd = ::accept(_listen_fd, nullptr, nullptr);
+				if (client_fd < 0)
+				{
+					continue;
+				}
+
+				workers.emplace_back(&StubControlServer::Serve, this, client_fd);
+			}
+
+			for (auto &worker : workers)
+			{
+				worker.join();
+			}
+		}
+
+		void Serve(int client_fd)
+		{
+			std::string request;
+			char buffer[4096];
+
+			// Read the headers and the body announced by Content-Length
+			while (true)
+			{
+				auto header_end = request.find("\r\n\r\n");
+				if (header_end != std::string::npos)
+				{
+					size_t content_length = 0;
+					auto position = request.find("Content-Length:");
+					if (position == std::string::npos)
+					{
+						position = request.find("content-length:");
+					}
+					if (position != std::string::npos)
+					{
+						content_length = std::strtoul(request.c_str() + position + 15, nullptr, 10);
+					}
+
+					if (request.size() >= header_end + 4 + content_length)
+					{
+						break;
+					}
+				}
+
+				auto read_bytes = ::recv(client_fd, buffer, sizeof(buffer), 0);
+				if (read_bytes <= 0)
+				{
+					::close(client_fd);
+					return;
+				}
+
+				request.append(buffer, read_bytes);
+			}
+
+			_request_count++;
+
+			int status_code;
+			ov::String body;
+			int delay_msec;
+			{
+				std::lock_guard<std::mutex> lock_guard(_mutex);
+				status_code = _status_code;
+				body = _body;
+				delay_msec = _delay_msec;
+			}
+
+			for (int waited = 0; (waited < delay_msec) && (_stop == false); waited += 10)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+
+			auto response = ov::String::FormatString(
+				"HTTP/1.1 %d Status\r\n"
+				"Content-Type: application/json\r\n"
+				"Content-Length: %zu\r\n"
+				"Connection: close\r\n"
+				"\r\n"
+				"%s",
+				status_code, body.GetLength(), body.CStr());
+
+			::send(client_fd, response.CStr(), response.GetLength(), MSG_NOSIGNAL);
+			::close(client_fd);
+		}
+
+		int _listen_fd = -1;
+		int _port = 0;
+		std::thread _thread;
+		std::atomic<bool> _stop{false};
+		std::atomic<int> _request_count{0};
+
+		std::mutex _mutex;
+		int _status_code = 200;
+		ov::String _body = R"({"allowed": true})";
+		int _delay_msec = 0;
+	};
+
+	class AdmissionWebhooksDispatcherTest : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			AdmissionWebhooksDispatcher::GetInstance()->ClearCache();
+		}
+
+		void TearDown() override
+		{
+			AdmissionWebhooksDispatcher::GetInstance()->ClearCache();
+		}
+
+		std::shared_ptr<AdmissionWebhooks> Create(uint32_t timeout_msec = 3000)
+		{
+			auto requested_url = ov::Url::Parse("ws://ome.example.com:3333/app/stream");
+			auto request_info = std::make_shared<ac::RequestInfo>(requested_url, nullptr, nullptr, nullptr);
+
+			return AdmissionWebhooks::Create(PublisherType::LLHls, _server.GetUrl(), timeout_msec, "secret", request_info, AdmissionWebhooks::Status::Code::OPENING);
+		}
+
+		static AdmissionWebhooksDispatcher::Policy MakePolicy(const ov::String &cache_key, int failure_threshold = 0)
+		{
+			AdmissionWebhooksDispatcher::Policy policy;
+
+			policy.cache_key = cache_key;
+			policy.allowed_ttl_msec = 60000;
+			policy.denied_ttl_msec = 5000;
+			policy.failure_threshold = failure_threshold;
+			policy.open_duration_msec = 300;
+
+			return policy;
+		}
+
+		// Collects the results of asynchronous queries
+		class Collector
+		{
+		public:
+			AdmissionWebhooks::CompletionHandler MakeHandler()
+			{
+				return [this](const std::shared_ptr<AdmissionWebhooks> &result) {
+					std::lock_guard<std::mutex> lock_guard(_mutex);
+					_results.push_back(result);
+					_condition.notify_all();
+				};
+			}
+
+			std::vector<std::shared_ptr<AdmissionWebhooks>> WaitFor(size_t count, int timeout_msec = 5000)
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_condition.wait_for(lock, std::chrono::milliseconds(timeout_msec), [&] {
+					return _results.size() >= count;
+				});
+
+				return _results;
+			}
+
+		private:
+			std::mutex _mutex;
+			std::condition_variable _condition;
+			std::vector<std::shared_ptr<AdmissionWebhooks>> _results;
+		};
+
+		StubControlServer _server;
+	};
+}  // namespace
+
+// Identical requests arriving while a query is in flight share that query
+TEST_F(AdmissionWebhooksDispatcherTest, CoalescesConcurrentQueries)
+{
+	constexpr size_t COUNT = 20;
+	auto dispatcher = AdmissionWebhooksDispatcher::GetInstance();
+	Collector collector;
+
+	_server.SetResponse(200, R"({"allowed": true, "lifetime": 60000})", 200);
+
+	for (size_t index = 0; index < COUNT; index++)
+	{
+		dispatcher->Query(Create(), MakePolicy("coalesce"), collector.MakeHandler());
+	}
+
+	auto results = collector.WaitFor(COUNT);
+	ASSERT_EQ(results.size(), COUNT);
+	EXPECT_EQ(_server.GetRequestCount(), 1);
+
+	for (size_t index = 0; index < COUNT; index++)
+	{
+		EXPECT_EQ(results[index]->GetErrCode(), AdmissionWebhooks::ErrCode::ALLOWED);
+
+		for (size_t other = index + 1; other < COUNT; other++)
+		{
+			EXPECT_NE(results[index], results[other]);
+		}
+	}
+}
+
+// Decisions are served from the cache, but not beyond the lifetime returned by the control server
+TEST_F(AdmissionWebhooksDispatcherTest, CachesDecisionWithinLifetime)
+{
+	auto dispatcher = AdmissionWebhooksDispatcher::GetInstance();
+
+	_server.SetResponse(200, R"({"allowed": true, "lifetime": 300})");
+
+	auto first = dispatcher->QueryAndWait(Create(), MakePolicy("cache"));
+	EXPECT_EQ(first->GetErrCode(), AdmissionWebhooks::ErrCode::ALLOWED);
+	EXPECT_EQ(_server.GetRequestCount(), 1);
+	EXPECT_EQ(dispatcher->GetCachedDecisionCount(), 1u);
+
+	auto second = dispatcher->QueryAndWait(Create(), MakePolicy("cache"));
+	EXPECT_EQ(second->GetErrCode(), AdmissionWebhooks::ErrCode::ALLOWED);
+	EXPECT_EQ(_server.GetRequestCount(), 1);
+	EXPECT_GT(second->GetLifetime(), 0u);
+	EXPECT_LE(second->GetLifetime(), 300u);
+
+	// Different key
+	dispatcher->QueryAndWait(Create(), MakePolicy("cache-other"));
+	EXPECT_EQ(_server.GetRequestCount(), 2);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(400));
+
+	auto third = dispatcher->QueryAndWait(Create(), MakePolicy("cache"));
+	EXPECT_EQ(third->GetErrCode(), AdmissionWebhooks::ErrCode::ALLOWED);
+	EXPECT_EQ(_server.GetRequestCount(), 3);
+}
+
+// Failures are neither cached nor coalesced beyond their own query
+TEST_F(AdmissionWebhooksDispatcherTest, DoesNotCacheFailures)
+{
+	auto dispatcher = AdmissionWebhooksDispatcher::GetInstance();
+
+	_server.SetResponse(500, "{}");
+
+	EXPECT_EQ(dispatcher->QueryAndWait(Create(), MakePolicy("failure"))->GetErrCode(), AdmissionWebhooks::ErrCode::INVALID_STATUS_CODE);
+	EXPECT_EQ(dispatcher->QueryAndWait(Create(), MakePolicy("failure"))->GetErrCode(), AdmissionWebhooks::ErrCode::INVALID_STATUS_CODE);
+	EXPECT_EQ(_server.GetRequestCount(), 2);
+	EXPECT_EQ(dispatcher->GetCachedDecisionCount(), 0u);
+}
+
+// After consecutive failures, queries fail without reaching the server until one probe succeeds
+TEST_F(AdmissionWebhooksDispatcherTest, CircuitBreakerOpensAndRecovers)
+{
+	auto dispatcher = AdmissionWebhooksDispatcher::GetInstance();
+
+	_server.SetResponse(500, "{}");
+
+	for (int index = 0; index < 3; index++)
+	{
+		dispatcher->QueryAndWait(Create(), MakePolicy("", 3));
+	}
+	EXPECT_EQ(_server.GetRequestCount(), 3);
+
+	auto rejected = dispatcher->QueryAndWait(Create(), MakePolicy("", 3));
+	EXPECT_EQ(rejected->GetErrCode(), AdmissionWebhooks::ErrCode::INTERNAL_ERROR);
+	EXPECT_EQ(_server.GetRequestCount(), 3);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(400));
+	_server.SetResponse(200, R"({"allowed": false, "reason": "no"})");
+
+	auto probe = dispatcher->QueryAndWait(Create(), MakePolicy("", 3));
+	EXPECT_EQ(probe->GetErrCode(), AdmissionWebhooks::ErrCode::DENIED);
+	EXPECT_EQ(_server.GetRequestCount(), 4);
+
+	auto closed = dispatcher->QueryAndWait(Create(), MakePolicy("", 3));
+	EXPECT_EQ(closed->GetErrCode(), AdmissionWebhooks::ErrCode::DENIED);
+	EXPECT_EQ(_server.GetRequestCount(), 5);
+}
+
+// An asynchronous query is completed by the timer when the control server does not respond
+TEST_F(AdmissionWebhooksDispatcherTest, AsyncQueryTimesOut)
+{
+	auto dispatcher = AdmissionWebhooksDispatcher::GetInstance();
+	Collector collector;
+
+	_server.SetResponse(200, R"({"allowed": true})", 2000);
+
+	dispatcher->Query(Create(200), MakePolicy("timeout"), collector.MakeHandler());
+	dispatcher->Query(Create(200), MakePolicy("timeout"), collector.MakeHandler());
+
+	auto results = collector.WaitFor(2, 1000);
+	ASSERT_EQ(results.size(), 2u);
+
+	for (auto &result : results)
+	{
+		EXPECT_EQ(result->GetErrCode(), AdmissionWebhooks::ErrCode::INTERNAL_ERROR);
+	}
+
+	EXPECT_EQ(dispatcher->GetCachedDecisionCount(), 0u);
+}
@@ -5,6 +5,11 @@
 #include <base/ovlibrary/converter.h>
 #include <openssl/evp.h>
 
+#include "signed_policy_cache.h"
+
+// Rejected URLs are cached only briefly: long enough to absorb a flood of the same URL
+#define SIGNED_POLICY_NEGATIVE_CACHE_TTL_MSEC (3 * 1000)
+
 // requested_url ==> scheme://domain:port/app/stream[/file]?[query1=value&query2=value&]policy=value&signature=value
 std::shared_ptr<const SignedPolicy> SignedPolicy::Load(const std::shared_ptr<const ac::RequestInfo> &request_info, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key)
 {
@@ -22,8 +27,6 @@ bool SignedPolicy::Process(const std::shared_ptr<const ac::RequestInfo> &request
 		return false;
 	}
 
-	auto client_address = request_info->GetClientAddress()->GetIpAddress();
-
 	auto request_url_str = url->ToUrlString();
 
 	if (url->HasQueryKey(signature_query_key) == false)
@@ -46,6 +49,54 @@ bool SignedPolicy::Process(const std::shared_ptr<const ac::RequestInfo> &request
 		return false;
 	}
 
+	if (url->GetQueryValue(policy_query_key).IsEmpty())
+	{
+		SetError(ErrCode::NO_POLICY_VALUE_IN_URL, ov::String::FormatString("Policy value is empty in url(%s).", request_url_str.CStr()));
+		return false;
+	}
+
+	// The secret key and the query key names may differ between virtual hosts
+	auto cache_key = ov::String::FormatString("%s\n%s\n%s\n%s", secret_key.CStr(), policy_query_key.CStr(), signature_query_key.CStr(), url->ToUrlString(true).CStr());
+	auto cache = SignedPolicyCache::GetInstance();
+
+	auto verified_policy = cache->Find(cache_key);
+	if (verified_policy == nullptr)
+	{
+		auto new_policy = std::make_shared<SignedPolicy>();
+
+		if (new_policy->Verify(url, policy_query_key, signature_query_key, secret_key, signature_query_value, request_url_str))
+		{
+			// The URL cannot be used after url_expire anyway
+			cache->Store(cache_key, new_policy, new_policy->_url_expire_epoch_msec);
+		}
+		else if ((new_policy->_error_code == ErrCode::INVALID_SIGNATURE) || (new_policy->_error_code == ErrCode::INVALID_POLICY))
+		{
+			// Floods of the same forged URL are rejected without computing the HMAC again
+			cache->Store(cache_key, new_policy, ov::Clock::NowMSec() + SIGNED_POLICY_NEGATIVE_CACHE_TTL_MSEC);
+		}
+
+		verified_policy = new_policy;
+	}
+
+	*this = *verified_policy;
+
+	if (_error_code != ErrCode::PASSED)
+	{
+		return false;
+	}
+
+	if (CheckPolicy(request_info) == false)
+	{
+		return false;
+	}
+
+	SetError(ErrCode::PASSED, "Authorized");
+
+	return true;
+}
+
+bool SignedPolicy::Verify(const std::shared_ptr<const ov::Url> &url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key, const ov::String &signature_value, const ov::String &request_url_str)
+{
 	// Separate the signature to make base url of signature
 	auto base_url_ptr = url->Clone();
 	base_url_ptr->RemoveQueryKey(signature_query_key);
@@ -59,34 +110,67 @@ bool SignedPolicy::Process(const std::shared_ptr<const ac::RequestInfo> &request
 		return false;
 	}
 
-	if (signature_base64 != signature_query_value)
+	if (signature_base64 != signature_value)
 	{
-		SetError(ErrCode::INVALID_SIGNATURE, ov::String::FormatString("Signature value is invalid(expected : %s | input : %s).", signature_base64.CStr(), signature_query_value.CStr()));
+		SetError(ErrCode::INVALID_SIGNATURE, ov::String::FormatString("Signature value is invalid(expected : %s | input : %s).", signature_base64.CStr(), signature_value.CStr()));
 		return false;
 	}
 
 	// Extract policy
-	auto policy_base64 = url->GetQueryValue(policy_query_key);
-	if (policy_base64.IsEmpty())
+	auto policy = ov::Base64::Decode(url->GetQueryValue(policy_query_key), true);
+	if (policy == nullptr)
 	{
-		SetError(ErrCode::NO_POLICY_VALUE_IN_URL, ov::String::FormatString("Policy value is empty in url(%s).", request_url_str.CStr()));
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The policy is not a valid base64 value."));
 		return false;
 	}
 
-	auto policy = ov::Base64::Decode(policy_base64, true);
-
 	if (ProcessPolicyJson(policy->ToString()) == false)
 	{
 		return false;
 	}
 
-	// Check connected IP
-	if (_allow_ip_cidr != nullptr && _allow_ip_cidr->CheckIP(client_address) == false)
+	SetError(ErrCode::PASSED, "Verified");
+
+	return true;
+}
+
+bool SignedPolicy::CheckPolicy(const std::shared_ptr<const ac::RequestInfo> &request_info)
+{
+	auto now = ov::Clock::NowMSec();
+
+	// Policy expired
+	if (_url_expire_epoch_msec < now)
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("URL has expired.(now:%" PRIu64 " policy_expire:%" PRIu64 ") ", now, _url_expire_epoch_msec));
+		return false;
+	}
+
+	// Policy is not activated yet
+	if (_url_activate_epoch_msec > now)
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The URL has not yet been activated.(now:%" PRIu64 " policy_activate:%" PRIu64 ") ", now, _url_activate_epoch_msec));
+		return false;
+	}
+
+	if ((_stream_expire_epoch_msec != 0) && (_stream_expire_epoch_msec < now))
 	{
-		SetError(ErrCode::UNAUTHORIZED_CLIENT, ov::String::FormatString("%s IP address is not allowed.(Allowed range : %s ~ %s)", client_address.CStr(), _allow_ip_cidr->Begin().CStr(), _allow_ip_cidr->End().CStr()));
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("Stream has expired.(now:%" PRIu64 " stream_expire:%" PRIu64 ") ", now, _stream_expire_epoch_msec));
 		return false;
 	}
 
+	// Check connected IP
+	if (_allow_ip_cidr != nullptr)
+	{
+		auto client_address = request_info->GetClientAddress();
+		auto client_ip = (client_address != nullptr) ? client_address->GetIpAddress() : "";
+
+		if (_allow_ip_cidr->CheckIP(client_ip) == false)
+		{
+			SetError(ErrCode::UNAUTHORIZED_CLIENT, ov::String::FormatString("%s IP address is not allowed.(Allowed range : %s ~ %s)", client_ip.CStr(), _allow_ip_cidr->Begin().CStr(), _allow_ip_cidr->End().CStr()));
+			return false;
+		}
+	}
+
 	// Check Real IP (Through the proxy)
 	if (_real_ip_cidr != nullptr)
 	{
@@ -104,8 +188,6 @@ bool SignedPolicy::Process(const std::shared_ptr<const ac::RequestInfo> &request
 		}
 	}
 
-	SetError(ErrCode::PASSED, "Authorized");
-
 	return true;
 }
 
@@ -153,35 +235,16 @@ bool SignedPolicy::ProcessPolicyJson(const ov::String &policy_json)
 	else
 	{
 		_url_expire_epoch_msec = jv_url_expire.asUInt64();
-
-		// Policy expired
-		if (_url_expire_epoch_msec < ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("URL has expired.(now:%" PRIu64 " policy_expire:%" PRIu64 ") ", ov::Clock::NowMSec(), _url_expire_epoch_msec));
-			return false;
-		}
 	}
 
 	if (!jv_url_activate.isNull() && jv_url_activate.isUInt64())
 	{
 		_url_activate_epoch_msec = jv_url_activate.asUInt64();
-
-		// Policy is not activated yet
-		if (_url_activate_epoch_msec > ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The URL has not yet been activated.(now:%" PRIu64 " policy_activate:%" PRIu64 ") ", ov::Clock::NowMSec(), _url_activate_epoch_msec));
-			return false;
-		}
 	}
 
 	if (!jv_stream_expire.isNull() && jv_stream_expire.isUInt64())
 	{
 		_stream_expire_epoch_msec = jv_stream_expire.asUInt64();
-		if (_stream_expire_epoch_msec < ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("Stream has expired.(now:%" PRIu64 " policy_expire:%" PRIu64 ") ", ov::Clock::NowMSec(), _url_expire_epoch_msec));
-			return false;
-		}
 	}
 
 	if (!jv_allow_ip.isNull() && jv_allow_ip.isString())
@@ -58,7 +58,11 @@ private:
 	}
 
     bool Process(const std::shared_ptr<const ac::RequestInfo> &request_info, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key);
+	// Verifies the signature and decodes the policy. The result depends only on the URL, so it is cached by SignedPolicyCache.
+	bool Verify(const std::shared_ptr<const ov::Url> &url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key, const ov::String &signature_value, const ov::String &request_url_str);
 	bool ProcessPolicyJson(const ov::String &policy_json);
+	// Checks the decoded policy against the current time and the client
+	bool CheckPolicy(const std::shared_ptr<const ac::RequestInfo> &request_info);
 	bool MakeSignature(const ov::String &base_url, const ov::String &secret_key, ov::String &signature_base64);
 
 private:
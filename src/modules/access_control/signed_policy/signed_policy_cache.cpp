@@ -0,0 +1,117 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "signed_policy_cache.h"
+
+#include "signed_policy.h"
+
+SignedPolicyCache::Shard &SignedPolicyCache::GetShard(const ov::String &key)
+{
+	return _shards[std::hash<ov::String>()(key) % SHARD_COUNT];
+}
+
+std::shared_ptr<const SignedPolicy> SignedPolicyCache::Find(const ov::String &key)
+{
+	auto &shard = GetShard(key);
+	auto now = ov::Clock::NowMSec();
+
+	ov::LockGuard lock_guard(shard.mutex);
+
+	auto item = shard.entry_map.find(key);
+	if (item == shard.entry_map.end())
+	{
+		_miss_count++;
+		return nullptr;
+	}
+
+	auto entry = item->second;
+
+	if (entry->expire_epoch_msec <= now)
+	{
+		shard.entry_map.erase(item);
+		shard.lru_list.erase(entry);
+
+		_miss_count++;
+		return nullptr;
+	}
+
+	shard.lru_list.splice(shard.lru_list.begin(), shard.lru_list, entry);
+
+	_hit_count++;
+	if (entry->verified_policy->GetErrCode() != SignedPolicy::ErrCode::PASSED)
+	{
+		_negative_hit_count++;
+	}
+
+	return entry->verified_policy;
+}
+
+void SignedPolicyCache::Store(const ov::String &key, const std::shared_ptr<const SignedPolicy> &verified_policy, uint64_t expire_epoch_msec)
+{
+	if (expire_epoch_msec <= ov::Clock::NowMSec())
+	{
+		return;
+	}
+
+	auto &shard = GetShard(key);
+
+	ov::LockGuard lock_guard(shard.mutex);
+
+	auto item = shard.entry_map.find(key);
+	if (item != shard.entry_map.end())
+	{
+		// Another thread verified the same URL at the same time
+		auto entry = item->second;
+
+		entry->verified_policy = verified_policy;
+		entry->expire_epoch_msec = expire_epoch_msec;
+		shard.lru_list.splice(shard.lru_list.begin(), shard.lru_list, entry);
+
+		return;
+	}
+
+	if (shard.lru_list.size() >= MAX_ENTRIES_PER_SHARD)
+	{
+		shard.entry_map.erase(shard.lru_list.back().key);
+		shard.lru_list.pop_back();
+
+		_eviction_count++;
+	}
+
+	shard.lru_list.push_front(Entry{key, verified_policy, expire_epoch_msec});
+	shard.entry_map.emplace(key, shard.lru_list.begin());
+}
+
+SignedPolicyCache::Stats SignedPolicyCache::GetStats() const
+{
+	Stats stats;
+
+	stats.hit_count = _hit_count;
+	stats.negative_hit_count = _negative_hit_count;
+	stats.miss_count = _miss_count;
+	stats.eviction_count = _eviction_count;
+
+	for (auto &shard : _shards)
+	{
+		ov::LockGuard lock_guard(shard.mutex);
+		stats.entry_count += shard.lru_list.size();
+	}
+
+	return stats;
+}
+
+void SignedPolicyCache::Clear()
+{
+	for (auto &shard : _shards)
+	{
+		ov::LockGuard lock_guard(shard.mutex);
+
+		shard.entry_map.clear();
+		shard.lru_list.clear();
+	}
+}
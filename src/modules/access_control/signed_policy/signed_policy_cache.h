@@ -0,0 +1,76 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <list>
+#include <unordered_map>
+
+class SignedPolicy;
+
+// Results of the signature verification (HMAC) and policy decoding, shared by all requests
+// that use the same signed URL.
+//
+// Only the part of SignedPolicy that depends on the URL is cached. The checks that depend on
+// the time (url_activate, url_expire, stream_expire) or the client (allow_ip, real_ip) are
+// done for every request with the cached policy.
+//
+// The cache is split into shards by the hash of the key, and each shard is a bounded LRU.
+class SignedPolicyCache : public ov::Singleton<SignedPolicyCache>
+{
+public:
+	static constexpr size_t SHARD_COUNT = 16;
+	static constexpr size_t MAX_ENTRIES_PER_SHARD = 1024;
+
+	struct Stats
+	{
+		uint64_t hit_count = 0;
+		// Included in hit_count
+		uint64_t negative_hit_count = 0;
+		uint64_t miss_count = 0;
+		uint64_t eviction_count = 0;
+		size_t entry_count = 0;
+	};
+
+	// Returns nullptr if <key> is not cached or has expired
+	std::shared_ptr<const SignedPolicy> Find(const ov::String &key);
+
+	// <verified_policy> is valid until <expire_epoch_msec>, and is not stored if that has already passed
+	void Store(const ov::String &key, const std::shared_ptr<const SignedPolicy> &verified_policy, uint64_t expire_epoch_msec);
+
+	Stats GetStats() const;
+	void Clear();
+
+private:
+	struct Entry
+	{
+		ov::String key;
+		std::shared_ptr<const SignedPolicy> verified_policy;
+		uint64_t expire_epoch_msec = 0;
+	};
+
+	struct Shard
+	{
+		ov::Mutex mutex;
+
+		// The most recently used entry is at the front
+		std::list<Entry> lru_list OV_GUARDED_BY(mutex);
+		std::unordered_map<ov::String, std::list<Entry>::iterator> entry_map OV_GUARDED_BY(mutex);
+	};
+
+	Shard &GetShard(const ov::String &key);
+
+	mutable Shard _shards[SHARD_COUNT];
+
+	std::atomic<uint64_t> _hit_count{0};
+	std::atomic<uint64_t> _negative_hit_count{0};
+	std::atomic<uint64_t> _miss_count{0};
+	std::atomic<uint64_t> _eviction_count{0};
+};
@@ -0,0 +1,162 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <base/ovcrypto/base_64.h>
+#include <base/ovcrypto/message_digest.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "signed_policy.h"
+#include "signed_policy_cache.h"
+
+namespace
+{
+	constexpr const char *SECRET_KEY = "aKq#1kj";
+
+	std::shared_ptr<const ac::RequestInfo> MakeSignedRequest(const ov::String &stream_name, const ov::String &policy_json, bool forge = false)
+	{
+		auto policy = ov::Base64::Encode(policy_json.ToData(false), true);
+		auto unsigned_url = ov::Url::Parse(ov::String::FormatString("ws://ome.example.com:3333/app/%s?policy=%s", stream_name.CStr(), policy.CStr()));
+
+		auto hmac = ov::MessageDigest::ComputeHmac(ov::CryptoAlgorithm::Sha1, ov::String(SECRET_KEY).ToData(false), unsigned_url->ToUrlString(true).ToData(false));
+		auto signature = forge ? ov::String("forged") : ov::Base64::Encode(hmac, true);
+
+		auto signed_url = ov::Url::Parse(ov::String::FormatString("%s&signature=%s", unsigned_url->ToUrlString(true).CStr(), signature.CStr()));
+
+		return std::make_shared<ac::RequestInfo>(signed_url, nullptr, nullptr, nullptr);
+	}
+
+	std::shared_ptr<const SignedPolicy> Load(const std::shared_ptr<const ac::RequestInfo> &request_info)
+	{
+		return SignedPolicy::Load(request_info, "policy", "signature", SECRET_KEY);
+	}
+
+	ov::String MakePolicy(int64_t activate_offset_msec, int64_t expire_offset_msec)
+	{
+		auto now = ov::Clock::NowMSec();
+
+		return ov::String::FormatString(R"({"url_activate": %)" PRIu64 R"(, "url_expire": %)" PRIu64 "}",
+										now + activate_offset_msec, now + expire_offset_msec);
+	}
+
+	class SignedPolicyCacheTest : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			SignedPolicyCache::GetInstance()->Clear();
+			_base_stats = SignedPolicyCache::GetInstance()->GetStats();
+		}
+
+		SignedPolicyCache::Stats GetStatsDelta() const
+		{
+			auto stats = SignedPolicyCache::GetInstance()->GetStats();
+
+			stats.hit_count -= _base_stats.hit_count;
+			stats.negative_hit_count -= _base_stats.negative_hit_count;
+			stats.miss_count -= _base_stats.miss_count;
+			stats.eviction_count -= _base_stats.eviction_count;
+
+			return stats;
+		}
+
+		SignedPolicyCache::Stats _base_stats;
+	};
+}  // namespace
+
+TEST_F(SignedPolicyCacheTest, VerifiedUrlIsCached)
+{
+	auto request_info = MakeSignedRequest("stream", MakePolicy(-1000, 60000));
+
+	for (int index = 0; index < 3; index++)
+	{
+		auto signed_policy = Load(request_info);
+		EXPECT_EQ(signed_policy->GetErrCode(), SignedPolicy::ErrCode::PASSED);
+	}
+
+	auto stats = GetStatsDelta();
+	EXPECT_EQ(stats.miss_count, 1u);
+	EXPECT_EQ(stats.hit_count, 2u);
+	EXPECT_EQ(stats.negative_hit_count, 0u);
+	EXPECT_EQ(stats.entry_count, 1u);
+}
+
+TEST_F(SignedPolicyCacheTest, ForgedUrlIsCachedAsRejected)
+{
+	auto request_info = MakeSignedRequest("stream", MakePolicy(-1000, 60000), true);
+
+	for (int index = 0; index < 3; index++)
+	{
+		auto signed_policy = Load(request_info);
+		EXPECT_EQ(signed_policy->GetErrCode(), SignedPolicy::ErrCode::INVALID_SIGNATURE);
+	}
+
+	auto stats = GetStatsDelta();
+	EXPECT_EQ(stats.miss_count, 1u);
+	EXPECT_EQ(stats.hit_count, 2u);
+	EXPECT_EQ(stats.negative_hit_count, 2u);
+}
+
+// The time is checked for every request, even if the signature was verified before
+TEST_F(SignedPolicyCacheTest, CachedPolicyIsCheckedPerRequest)
+{
+	auto request_info = MakeSignedRequest("stream", MakePolicy(200, 60000));
+
+	EXPECT_EQ(Load(request_info)->GetErrCode(), SignedPolicy::ErrCode::INVALID_POLICY);
+	EXPECT_EQ(Load(request_info)->GetErrCode(), SignedPolicy::ErrCode::INVALID_POLICY);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+	EXPECT_EQ(Load(request_info)->GetErrCode(), SignedPolicy::ErrCode::PASSED);
+
+	auto stats = GetStatsDelta();
+	EXPECT_EQ(stats.miss_count, 1u);
+	EXPECT_EQ(stats.hit_count, 2u);
+}
+
+TEST_F(SignedPolicyCacheTest, EntryExpiresWithUrl)
+{
+	auto request_info = MakeSignedRequest("stream", MakePolicy(-1000, 100));
+
+	EXPECT_EQ(Load(request_info)->GetErrCode(), SignedPolicy::ErrCode::PASSED);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+	EXPECT_EQ(Load(request_info)->GetErrCode(), SignedPolicy::ErrCode::INVALID_POLICY);
+
+	auto stats = GetStatsDelta();
+	EXPECT_EQ(stats.miss_count, 2u);
+	EXPECT_EQ(stats.hit_count, 0u);
+}
+
+TEST_F(SignedPolicyCacheTest, LeastRecentlyUsedEntryIsEvicted)
+{
+	auto cache = SignedPolicyCache::GetInstance();
+	auto verified_policy = std::make_shared<SignedPolicy>();
+	auto expire = ov::Clock::NowMSec() + 60000;
+	constexpr size_t CAPACITY = SignedPolicyCache::SHARD_COUNT * SignedPolicyCache::MAX_ENTRIES_PER_SHARD;
+
+	cache->Store("first", verified_policy, expire);
+
+	for (size_t index = 0; index < CAPACITY * 2; index++)
+	{
+		cache->Store(ov::String::FormatString("key-%zu", index), verified_policy, expire);
+
+		if ((index % 16) == 0)
+		{
+			// Keep "first" at the front of its shard
+			EXPECT_NE(cache->Find("first"), nullptr);
+		}
+	}
+
+	auto stats = GetStatsDelta();
+	EXPECT_LE(stats.entry_count, CAPACITY);
+	EXPECT_GE(stats.eviction_count, CAPACITY);
+	EXPECT_NE(cache->Find("first"), nullptr);
+}
@@ -325,6 +325,38 @@ bool Av1Parser::IsKeyFrame(const uint8_t *data, size_t size)
 	return false;
 }
 
+std::optional<uint8_t> Av1Parser::GetFrameTemporalId(const uint8_t *data, size_t size)
+{
+	if (data == nullptr)
+	{
+		return std::nullopt;
+	}
+
+	size_t offset = 0;
+	Av1ObuSpan obu;
+	while (offset < size)
+	{
+		if (ReadObu(data, size, offset, obu) == false)
+		{
+			return std::nullopt;
+		}
+
+		if (obu.header.type == Av1ObuType::Frame || obu.header.type == Av1ObuType::FrameHeader)
+		{
+			if (obu.header.extension_flag == false)
+			{
+				return std::nullopt;
+			}
+
+			return obu.header.temporal_id;
+		}
+
+		offset = obu.next_offset;
+	}
+
+	return std::nullopt;
+}
+
 bool Av1Parser::HasSequenceHeaderObu(const uint8_t *data, size_t size)
 {
 	if (data == nullptr)
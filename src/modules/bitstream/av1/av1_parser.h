@@ -94,6 +94,12 @@ public:
 		return (data != nullptr) && IsKeyFrame(data->GetDataAs<uint8_t>(), data->GetLength());
 	}
 
+	/// Return the `temporal_id` of the first Frame / FrameHeader OBU of the OBU bytestream.
+	///
+	/// @return `std::nullopt` if there is no such OBU, or if it has no `obu_extension_header()` (the
+	/// stream is not temporally scalable).
+	static std::optional<uint8_t> GetFrameTemporalId(const uint8_t *data, size_t size);
+
 	/// Return true if the OBU bytestream contains an `OBU_SEQUENCE_HEADER`.
 	static bool HasSequenceHeaderObu(const uint8_t *data, size_t size);
 	static bool HasSequenceHeaderObu(const std::shared_ptr<const ov::Data> &data)
@@ -918,6 +918,31 @@ TEST(Av1ParserIsKeyFrame, ReducedStillPictureIsAlwaysKey)
 	EXPECT_TRUE(Av1Parser::IsKeyFrame(data));
 }
 
+TEST(Av1ParserGetFrameTemporalId, ReadsExtensionOfFrameObu)
+{
+	// A TemporalDelimiter without extension, then a frame OBU of temporal layer 2
+	const uint8_t bytes[] = {
+		MakeObuHeaderByte(Av1ObuType::TemporalDelimiter, false, true),
+		0x00,
+		MakeObuHeaderByte(Av1ObuType::Frame, true, true),
+		MakeObuExtensionByte(2, 0),
+		0x01,
+		0x20,
+	};
+	auto temporal_id = Av1Parser::GetFrameTemporalId(bytes, sizeof(bytes));
+	ASSERT_TRUE(temporal_id.has_value());
+	EXPECT_EQ(temporal_id.value(), 2u);
+}
+
+TEST(Av1ParserGetFrameTemporalId, NulloptWithoutExtension)
+{
+	auto frame = MakeObu(Av1ObuType::Frame, {0x20});
+	EXPECT_FALSE(Av1Parser::GetFrameTemporalId(frame.data(), frame.size()).has_value());
+
+	auto seq = MakeObu(Av1ObuType::SequenceHeader, {0x00});
+	EXPECT_FALSE(Av1Parser::GetFrameTemporalId(seq.data(), seq.size()).has_value());
+}
+
 TEST(Av1ParserHasSequenceHeaderObu, PresentAndAbsent)
 {
 	auto seq   = MakeObu(Av1ObuType::SequenceHeader, {0x00});
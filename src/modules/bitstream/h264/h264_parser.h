@@ -17,6 +17,11 @@ public:
 		return _type;
 	}
 
+	uint8_t GetNalRefIdc() const
+	{
+		return _nal_ref_idc;
+	}
+
 	bool IsVideoSlice() const
 	{
 		return _type >= H264NalUnitType::NonIdrSlice && _type <= H264NalUnitType::IdrSlice;
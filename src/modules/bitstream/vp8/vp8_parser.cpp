@@ -161,6 +161,247 @@ bool VP8Parser::Parse(const uint8_t *data, size_t data_length, VP8Parser &parser
 	return true;
 }
 
+namespace
+{
+	// Boolean entropy decoder of RFC 6386 section 7.3
+	class Vp8BoolDecoder
+	{
+	public:
+		Vp8BoolDecoder(const uint8_t *data, size_t data_length)
+			: _data(data),
+			  _end(data + data_length)
+		{
+			_value = NextByte() << 8;
+			_value |= NextByte();
+		}
+
+		bool ReadBool(uint8_t probability)
+		{
+			uint32_t split	   = 1 + (((_range - 1) * probability) >> 8);
+			uint32_t big_split = split << 8;
+			bool bit		   = false;
+
+			if (_value >= big_split)
+			{
+				bit = true;
+				_range -= split;
+				_value -= big_split;
+			}
+			else
+			{
+				_range = split;
+			}
+
+			while (_range < 128)
+			{
+				_value <<= 1;
+				_range <<= 1;
+
+				if (++_bit_count == 8)
+				{
+					_bit_count = 0;
+					_value |= NextByte();
+				}
+			}
+
+			return bit;
+		}
+
+		bool ReadFlag()
+		{
+			return ReadBool(128);
+		}
+
+		// L(n) of RFC 6386 section 19, most significant bit first
+		uint32_t ReadLiteral(int bits)
+		{
+			uint32_t value = 0;
+
+			while (bits-- > 0)
+			{
+				value = (value << 1) | (ReadFlag() ? 1 : 0);
+			}
+
+			return value;
+		}
+
+		// An update flag followed by the value (and its sign) when the flag is set
+		void SkipOptionalLiteral(int bits, bool has_sign)
+		{
+			if (ReadFlag())
+			{
+				ReadLiteral(bits + (has_sign ? 1 : 0));
+			}
+		}
+
+		// The decoder reads two bytes ahead, so only reading past that means the partition was short
+		bool IsOverrun() const
+		{
+			return _overrun_bytes > 2;
+		}
+
+	private:
+		uint32_t NextByte()
+		{
+			if (_data < _end)
+			{
+				return *_data++;
+			}
+
+			_overrun_bytes++;
+			return 0;
+		}
+
+		const uint8_t *_data = nullptr;
+		const uint8_t *_end	 = nullptr;
+
+		uint32_t _value		 = 0;
+		uint32_t _range		 = 255;
+		int _bit_count		 = 0;
+		int _overrun_bytes	 = 0;
+	};
+}  // namespace
+
+/*
+Reference : RFC 6386 section 19.2 (Frame Header), for an inter frame
+
+   | segmentation_enabled                              | L(1)  |
+   | if (segmentation_enabled)                         |       |
+   |     update_segmentation()                         |       |
+   | filter_type                                       | L(1)  |
+   | loop_filter_level                                 | L(6)  |
+   | sharpness_level                                   | L(3)  |
+   | mb_lf_adjustments()                               |       |
+   | log2_nbr_of_dct_partitions                        | L(2)  |
+   | quant_indices()                                   |       |
+   |     refresh_golden_frame                          | L(1)  |
+   |     refresh_alternate_frame                       | L(1)  |
+   |     if (!refresh_golden_frame)                    |       |
+   |         copy_buffer_to_golden                     | L(2)  |
+   |     if (!refresh_alternate_frame)                 |       |
+   |         copy_buffer_to_alternate                  | L(2)  |
+   |     sign_bias_golden                              | L(1)  |
+   |     sign_bias_alternate                           | L(1)  |
+   |     refresh_entropy_probs                         | L(1)  |
+   |     refresh_last                                  | L(1)  |
+*/
+bool VP8Parser::ParseNonReference(const uint8_t *data, size_t data_length, bool &non_reference)
+{
+	bool is_key_frame = false;
+	if (ParseKeyFrame(data, data_length, is_key_frame) == false)
+	{
+		return false;
+	}
+
+	if (is_key_frame == true)
+	{
+		non_reference = false;
+		return true;
+	}
+
+	const uint32_t frame_tag = static_cast<uint32_t>(data[0]) |
+							   (static_cast<uint32_t>(data[1]) << 8) |
+							   (static_cast<uint32_t>(data[2]) << 16);
+	const uint32_t first_part_size = (frame_tag >> 5) & 0x7FFFF;
+
+	// The first partition follows the 3-byte frame tag of an inter frame
+	if (data_length < 3 + static_cast<size_t>(first_part_size))
+	{
+		logtw("Invalid VP8 bitstream");
+		return false;
+	}
+
+	Vp8BoolDecoder decoder(data + 3, first_part_size);
+
+	// segmentation_enabled
+	if (decoder.ReadFlag())
+	{
+		// update_segmentation()
+		bool update_mb_segmentation_map	 = decoder.ReadFlag();
+		bool update_segment_feature_data = decoder.ReadFlag();
+
+		if (update_segment_feature_data)
+		{
+			// segment_feature_mode
+			decoder.ReadFlag();
+
+			// quantizer_update_value, quantizer_update_sign
+			for (int i = 0; i < 4; i++)
+			{
+				decoder.SkipOptionalLiteral(7, true);
+			}
+
+			// lf_update_value, lf_update_sign
+			for (int i = 0; i < 4; i++)
+			{
+				decoder.SkipOptionalLiteral(6, true);
+			}
+		}
+
+		if (update_mb_segmentation_map)
+		{
+			// segment_prob
+			for (int i = 0; i < 3; i++)
+			{
+				decoder.SkipOptionalLiteral(8, false);
+			}
+		}
+	}
+
+	// filter_type, loop_filter_level, sharpness_level
+	decoder.ReadLiteral(1 + 6 + 3);
+
+	// mb_lf_adjustments(): loop_filter_adj_enable
+	if (decoder.ReadFlag())
+	{
+		// mode_ref_lf_delta_update
+		if (decoder.ReadFlag())
+		{
+			// 4 ref_frame deltas and 4 mb_mode deltas
+			for (int i = 0; i < 8; i++)
+			{
+				decoder.SkipOptionalLiteral(6, true);
+			}
+		}
+	}
+
+	// log2_nbr_of_dct_partitions
+	decoder.ReadLiteral(2);
+
+	// quant_indices(): y_ac_qi, then the y_dc, y2_dc, y2_ac, uv_dc and uv_ac deltas
+	decoder.ReadLiteral(7);
+	for (int i = 0; i < 5; i++)
+	{
+		decoder.SkipOptionalLiteral(4, true);
+	}
+
+	bool refresh_golden_frame	 = decoder.ReadFlag();
+	bool refresh_alternate_frame = decoder.ReadFlag();
+	uint32_t copy_buffer_to_golden	  = refresh_golden_frame ? 0 : decoder.ReadLiteral(2);
+	uint32_t copy_buffer_to_alternate = refresh_alternate_frame ? 0 : decoder.ReadLiteral(2);
+
+	// sign_bias_golden, sign_bias_alternate
+	decoder.ReadLiteral(2);
+
+	bool refresh_entropy_probs = decoder.ReadFlag();
+	bool refresh_last		   = decoder.ReadFlag();
+
+	if (decoder.IsOverrun())
+	{
+		logtw("Invalid VP8 bitstream");
+		return false;
+	}
+
+	non_reference = (refresh_golden_frame == false) &&
+					(refresh_alternate_frame == false) &&
+					(copy_buffer_to_golden == 0) &&
+					(copy_buffer_to_alternate == 0) &&
+					(refresh_entropy_probs == false) &&
+					(refresh_last == false);
+
+	return true;
+}
+
 bool VP8Parser::IsKeyFrame()
 {
 	return _key_frame;
@@ -10,6 +10,10 @@ public:
 	static bool IsValid(const uint8_t *data, size_t data_length);
 	static bool ParseKeyFrame(const uint8_t *data, size_t data_length, bool &is_key_frame);
 	static bool Parse(const uint8_t *data, size_t data_length, VP8Parser &parser);
+	// Reads the frame header of the first partition. A non-reference frame is an inter frame that
+	// updates none of the reference buffers (last, golden, altref) nor the entropy context, so it
+	// can be dropped without affecting the decoding of the following frames.
+	static bool ParseNonReference(const uint8_t *data, size_t data_length, bool &non_reference);
 
 	bool IsKeyFrame();
 	uint16_t GetWidth();
@@ -0,0 +1,286 @@
+//==============================================================================
+//
+//  OvenMediaEngine - Unit Tests
+//
+//  Covers VP8Parser::ParseNonReference (reference buffer and entropy context
+//  updates of the inter frame header).
+//
+//  Frame headers are hand-built with the boolean entropy encoder of
+//  RFC 6386 section 7.3, following the frame header layout of section 19.2.
+//
+//==============================================================================
+
+// Unit tests
+// ----------
+// cmake build/debug && ninja -C build/debug ome_test_modules
+// ./build/debug/bin/ome_test_modules --gtest_filter='VP8Parser.*'
+
+#include <gtest/gtest.h>
+
+#include <modules/bitstream/vp8/vp8_parser.h>
+
+#include <vector>
+
+namespace
+{
+	// Boolean entropy encoder of RFC 6386 section 7.3
+	class BoolEncoder
+	{
+	public:
+		void WriteBool(uint8_t probability, bool value)
+		{
+			uint32_t split = 1 + (((_range - 1) * probability) >> 8);
+
+			if (value)
+			{
+				_bottom += split;
+				_range -= split;
+			}
+			else
+			{
+				_range = split;
+			}
+
+			while (_range < 128)
+			{
+				_range <<= 1;
+
+				if (_bottom & (1u << 31))
+				{
+					AddOneToOutput();
+				}
+
+				_bottom <<= 1;
+
+				if (--_bit_count == 0)
+				{
+					_output.push_back(static_cast<uint8_t>(_bottom >> 24));
+					_bottom &= (1 << 24) - 1;
+					_bit_count = 8;
+				}
+			}
+		}
+
+		void WriteLiteral(uint32_t value, int bits)
+		{
+			while (bits-- > 0)
+			{
+				WriteBool(128, (value >> bits) & 0x01);
+			}
+		}
+
+		std::vector<uint8_t> Finish()
+		{
+			// Pushes the pending bits out
+			WriteLiteral(0, 32);
+			return _output;
+		}
+
+	private:
+		void AddOneToOutput()
+		{
+			for (auto it = _output.rbegin(); it != _output.rend(); ++it)
+			{
+				if (*it != 0xFF)
+				{
+					(*it)++;
+					return;
+				}
+
+				*it = 0;
+			}
+		}
+
+		std::vector<uint8_t> _output;
+		uint32_t _range		= 255;
+		uint32_t _bottom	= 0;
+		int _bit_count		= 24;
+	};
+
+	struct InterFrameHeader
+	{
+		bool segmentation_enabled  = false;
+		bool loop_filter_adj	   = false;
+		bool refresh_golden_frame  = false;
+		uint8_t copy_buffer_to_alt = 0;
+		bool refresh_entropy_probs = false;
+		bool refresh_last		   = false;
+	};
+
+	std::vector<uint8_t> BuildInterFrame(const InterFrameHeader &header)
+	{
+		BoolEncoder encoder;
+
+		encoder.WriteLiteral(header.segmentation_enabled, 1);
+		if (header.segmentation_enabled)
+		{
+			// update_mb_segmentation_map, update_segment_feature_data
+			encoder.WriteLiteral(1, 1);
+			encoder.WriteLiteral(1, 1);
+
+			// segment_feature_mode
+			encoder.WriteLiteral(1, 1);
+			for (int i = 0; i < 4; i++)
+			{
+				// quantizer_update with a value and sign
+				encoder.WriteLiteral(1, 1);
+				encoder.WriteLiteral(i * 10, 7);
+				encoder.WriteLiteral(i & 1, 1);
+			}
+			for (int i = 0; i < 4; i++)
+			{
+				// No loop_filter_update
+				encoder.WriteLiteral(0, 1);
+			}
+			for (int i = 0; i < 3; i++)
+			{
+				// segment_prob_update with a probability
+				encoder.WriteLiteral(1, 1);
+				encoder.WriteLiteral(200, 8);
+			}
+		}
+
+		// filter_type, loop_filter_level, sharpness_level
+		encoder.WriteLiteral(0, 1);
+		encoder.WriteLiteral(32, 6);
+		encoder.WriteLiteral(3, 3);
+
+		encoder.WriteLiteral(header.loop_filter_adj, 1);
+		if (header.loop_filter_adj)
+		{
+			// mode_ref_lf_delta_update
+			encoder.WriteLiteral(1, 1);
+			for (int i = 0; i < 8; i++)
+			{
+				encoder.WriteLiteral(i % 2, 1);
+				if (i % 2)
+				{
+					encoder.WriteLiteral(63, 6);
+					encoder.WriteLiteral(1, 1);
+				}
+			}
+		}
+
+		// log2_nbr_of_dct_partitions
+		encoder.WriteLiteral(0, 2);
+
+		// y_ac_qi, then only the y2_dc delta
+		encoder.WriteLiteral(40, 7);
+		encoder.WriteLiteral(0, 1);
+		encoder.WriteLiteral(1, 1);
+		encoder.WriteLiteral(15, 4);
+		encoder.WriteLiteral(1, 1);
+		encoder.WriteLiteral(0, 1);
+		encoder.WriteLiteral(0, 1);
+		encoder.WriteLiteral(0, 1);
+
+		encoder.WriteLiteral(header.refresh_golden_frame, 1);
+		// refresh_alternate_frame
+		encoder.WriteLiteral(0, 1);
+		if (header.refresh_golden_frame == false)
+		{
+			// copy_buffer_to_golden
+			encoder.WriteLiteral(0, 2);
+		}
+		encoder.WriteLiteral(header.copy_buffer_to_alt, 2);
+
+		// sign_bias_golden, sign_bias_alternate
+		encoder.WriteLiteral(1, 1);
+		encoder.WriteLiteral(1, 1);
+
+		encoder.WriteLiteral(header.refresh_entropy_probs, 1);
+		encoder.WriteLiteral(header.refresh_last, 1);
+
+		// The rest of the first partition is never read by the parser
+		encoder.WriteLiteral(0x5A5A, 16);
+
+		auto partition = encoder.Finish();
+
+		// Frame tag: inter frame, version 0, show_frame, first_part_size
+		uint32_t frame_tag = 0x01 | (1 << 4) | (static_cast<uint32_t>(partition.size()) << 5);
+
+		std::vector<uint8_t> frame = {
+			static_cast<uint8_t>(frame_tag & 0xFF),
+			static_cast<uint8_t>((frame_tag >> 8) & 0xFF),
+			static_cast<uint8_t>((frame_tag >> 16) & 0xFF),
+		};
+		frame.insert(frame.end(), partition.begin(), partition.end());
+
+		// Token partition
+		frame.insert(frame.end(), {0x00, 0x00, 0x00, 0x00});
+
+		return frame;
+	}
+
+	bool ParseNonReference(const std::vector<uint8_t> &frame, bool &non_reference)
+	{
+		return VP8Parser::ParseNonReference(frame.data(), frame.size(), non_reference);
+	}
+}  // namespace
+
+TEST(VP8Parser, InterFrameWithoutUpdatesIsNonReference)
+{
+	bool non_reference = false;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame({}), non_reference));
+	EXPECT_TRUE(non_reference);
+}
+
+TEST(VP8Parser, NonReferenceAfterSegmentationAndLoopFilterDeltas)
+{
+	InterFrameHeader header;
+	header.segmentation_enabled = true;
+	header.loop_filter_adj		= true;
+
+	bool non_reference = false;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame(header), non_reference));
+	EXPECT_TRUE(non_reference);
+
+	header.refresh_last = true;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame(header), non_reference));
+	EXPECT_FALSE(non_reference);
+}
+
+TEST(VP8Parser, ReferenceUpdatesAreDetected)
+{
+	bool non_reference = true;
+
+	InterFrameHeader refresh_last;
+	refresh_last.refresh_last = true;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame(refresh_last), non_reference));
+	EXPECT_FALSE(non_reference);
+
+	InterFrameHeader refresh_golden;
+	refresh_golden.refresh_golden_frame = true;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame(refresh_golden), non_reference));
+	EXPECT_FALSE(non_reference);
+
+	InterFrameHeader copy_to_alt;
+	copy_to_alt.copy_buffer_to_alt = 2;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame(copy_to_alt), non_reference));
+	EXPECT_FALSE(non_reference);
+
+	// The following frames are decoded with the updated probabilities
+	InterFrameHeader refresh_entropy;
+	refresh_entropy.refresh_entropy_probs = true;
+	ASSERT_TRUE(ParseNonReference(BuildInterFrame(refresh_entropy), non_reference));
+	EXPECT_FALSE(non_reference);
+}
+
+TEST(VP8Parser, KeyFrameIsReference)
+{
+	// Key frame tag, start code, 320x240
+	const std::vector<uint8_t> frame = {0x10, 0x02, 0x00, 0x9D, 0x01, 0x2A, 0x40, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+	bool non_reference = true;
+	ASSERT_TRUE(ParseNonReference(frame, non_reference));
+	EXPECT_FALSE(non_reference);
+}
+
+TEST(VP8Parser, RejectsTruncatedFirstPartition)
+{
+	auto frame = BuildInterFrame({});
+	frame.resize(8);
+
+	bool non_reference = false;
+	EXPECT_FALSE(ParseNonReference(frame, non_reference));
+}
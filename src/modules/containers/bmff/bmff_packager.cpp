@@ -1601,7 +1601,10 @@ namespace bmff
 
 		static uint32_t seq = 0;
 
-		for (const auto &sample : samples->GetList())
+		const auto &pts_list = samples->GetPtsList();
+		const auto &payload_list = samples->GetPayloadList();
+
+		for (size_t index = 0; index < pts_list.size(); index++)
 		{
 			ov::ByteStream stream(512);
 			
@@ -1611,7 +1614,7 @@ namespace bmff
 			stream.WriteBE32(GetDataTrack()->GetTimeBase().GetTimescale());
 
 			// presentation_time
-			stream.WriteBE64(sample._media_packet->GetPts());
+			stream.WriteBE64(pts_list[index]);
 
 			// event_duration
 			stream.WriteBE32(0xFFFFFFFF);
@@ -1627,7 +1630,7 @@ namespace bmff
 			stream.WriteText("OvenMediaEngine", true);
 
 			// message_data
-			stream.Write(sample._media_packet->GetData());
+			stream.Write(payload_list[index]);
 
 			// One or more Event Message boxes (‘emsg’) [CMAF] can be included per segment. Version 1 of the Event Message box [DASH] must be used.
 			if (WriteFullBox(container_stream, "emsg", *stream.GetData(), 1, 0) == false)
@@ -1841,7 +1844,7 @@ namespace bmff
 			return false;
 		}
 
-		auto base_media_decode_time = samples->GetAt(0)._media_packet->GetDts();
+		auto base_media_decode_time = samples->GetDtsList().front();
 		stream.WriteBE64(base_media_decode_time);
 
 		return WriteFullBox(container_stream, "tfdt", *stream.GetData(), 1, 0);
@@ -1911,27 +1914,31 @@ namespace bmff
 		_offset_field_offset_in_trun = stream.GetLength() + BMFF_FULL_BOX_HEADER_SIZE;
 		stream.WriteBE32(0); 
 		
-		for (const auto &sample : samples->GetList())
+		// The rows are read from the arrays of the samples
+		const auto &duration_list = samples->GetDurationList();
+		const auto &size_list = samples->GetSizeList();
+		const auto &flag_list = samples->GetFlagList();
+		const auto &dts_list = samples->GetDtsList();
+		const auto &pts_list = samples->GetPtsList();
+		bool is_video = (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video);
+
+		for (size_t index = 0; index < duration_list.size(); index++)
 		{
 			// unsigned int(32) sample_duration;
-			stream.WriteBE32(sample._media_packet->GetDuration());
+			stream.WriteBE32(duration_list[index]);
 
-			if (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video)
-			{
-				// unsigned int(32) sample_size;
-				stream.WriteBE32(sample._media_packet->GetDataLength());
+			// unsigned int(32) sample_size;
+			stream.WriteBE32(size_list[index]);
 
+			if (is_video)
+			{
 				// unsigned int(32) sample_flags;
 				uint32_t sample_flags = 0;
-				GetSampleFlags(sample._media_packet, sample_flags);
+				GetSampleFlags(flag_list[index], sample_flags);
 				stream.WriteBE32(sample_flags);
 
 				// unsigned int(32) sample_composition_time_offset;
-				stream.WriteBE32(int32_t(sample._media_packet->GetPts() - sample._media_packet->GetDts()));
-			}
-			else
-			{
-				stream.WriteBE32(sample._media_packet->GetDataLength());
+				stream.WriteBE32(int32_t(pts_list[index] - dts_list[index]));
 			}
 		}
 
@@ -1940,7 +1947,7 @@ namespace bmff
 		return WriteFullBox(container_stream, "trun", *stream.GetData(), version, tr_flags);
 	}
 
-	bool Packager::GetSampleFlags(const std::shared_ptr<const MediaPacket> &sample, uint32_t &flags)
+	bool Packager::GetSampleFlags(MediaPacketFlag sample_flag, uint32_t &flags)
 	{
 		// ISO/IEC 14496-12 8.8.3
 		// 
@@ -1987,7 +1994,7 @@ namespace bmff
 
 		flags = 0;
 
-		if (sample->GetMediaType() == cmn::MediaType::Video && sample->GetFlag() == MediaPacketFlag::Key)
+		if (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video && sample_flag == MediaPacketFlag::Key)
 		{
 			flags = 0x02000000; // sample_depends_on = 2
 		}
@@ -2202,9 +2209,9 @@ namespace bmff
 		stream.WriteBE32(samples->GetTotalCount());
 
 		// unsigned int(8) sample_info_size[ sample_count ];
-		for (const auto &sample : samples->GetList())
+		for (uint32_t index = 0; index < samples->GetTotalCount(); index++)
 		{
-			stream.Write8(sample._sai.GetSencAuxInfoSize());
+			stream.Write8(samples->GetSampleAuxInfoAt(index).GetSencAuxInfoSize());
 		}
 
 		return WriteFullBox(container_stream, "saiz", *stream.GetData(), 0, 0);
@@ -2304,28 +2311,30 @@ namespace bmff
 
 		uint32_t flag = 0x000000;
 
-		if (samples->GetList().size() > 0 &&  samples->GetList().front()._sai._sub_samples.size() > 0)
+		if (samples->GetTotalCount() > 0 && samples->GetSampleAuxInfoAt(0)._sub_samples.size() > 0)
 		{
 			flag = 0x000002;
 		}
 
-		for (const auto &sample : samples->GetList())
+		for (uint32_t index = 0; index < samples->GetTotalCount(); index++)
 		{
+			const auto &sai = samples->GetSampleAuxInfoAt(index);
+
 			// InitializationVector
-			if (sample._sai.per_sample_iv != nullptr)
+			if (sai.per_sample_iv != nullptr)
 			{
-				stream.Write(sample._sai.per_sample_iv->GetData(), sample._sai.per_sample_iv->GetLength());
+				stream.Write(sai.per_sample_iv->GetData(), sai.per_sample_iv->GetLength());
 			}
 
-			if (sample._sai._sub_samples.size() == 0)
+			if (sai._sub_samples.size() == 0)
 			{
 				continue;
 			}
 
 			// unsigned int(16) subsample_count;
-			stream.WriteBE16(sample._sai._sub_samples.size());
+			stream.WriteBE16(sai._sub_samples.size());
 
-			for (const auto &sub_sample : sample._sai._sub_samples)
+			for (const auto &sub_sample : sai._sub_samples)
 			{
 				// unsigned int(16) BytesOfClearData;
 				stream.WriteBE16(sub_sample.clear_bytes);
@@ -2339,19 +2348,48 @@ namespace bmff
 	}
 
 	bool Packager::WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples)
+	{
+		std::vector<std::shared_ptr<const ov::Data>> payloads;
+
+		if (WriteMdatBoxHeader(container_stream, samples, payloads) == false)
+		{
+			return false;
+		}
+
+		for (const auto &payload : payloads)
+		{
+			if (container_stream.Write(payload->GetData(), payload->GetLength()) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool Packager::WriteMdatBoxHeader(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples, std::vector<std::shared_ptr<const ov::Data>> &payloads)
 	{
 		// ISO/IEC 14496-12 8.1.1
 		// aligned(8) class MediaDataBox extends Box(‘mdat’)
 		// {
 		// 	bit(8) data[];
 		// }
-		auto data = std::make_shared<ov::Data>(samples->GetTotalSize());
-		for (const auto &sample : samples->GetList())
+		size_t data_size = 0;
+		payloads.reserve(payloads.size() + samples->GetTotalCount());
+
+		for (const auto &payload : samples->GetPayloadList())
 		{
-			data->Append(sample._media_packet->GetData());
+			if ((payload == nullptr) || (payload->GetLength() == 0))
+			{
+				continue;
+			}
+
+			data_size += payload->GetLength();
+			payloads.push_back(payload);
 		}
 
-		return WriteBox(container_stream, "mdat", *data);
+		container_stream.WriteBE32(data_size + BMFF_BOX_HEADER_SIZE);
+		return container_stream.WriteText("mdat");
 	}
 	
 	bool Packager::WriteBaseDescriptor(ov::ByteStream &stream, uint8_t tag, const ov::Data &data)
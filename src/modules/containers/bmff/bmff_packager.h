@@ -110,9 +110,12 @@ namespace bmff
 		virtual bool WriteTfhdBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
 		virtual bool WriteTfdtBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
 		virtual bool WriteTrunBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
-		virtual bool GetSampleFlags(const std::shared_ptr<const MediaPacket> &sample, uint32_t &flags);
+		virtual bool GetSampleFlags(MediaPacketFlag sample_flag, uint32_t &flags);
 
 		virtual bool WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
+		// Writes only the header of the mdat box and appends the payloads of the samples to <payloads>
+		// instead of copying them, the caller sends them right after the header
+		bool WriteMdatBoxHeader(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples, std::vector<std::shared_ptr<const ov::Data>> &payloads);
 
 		// Write BaseDescriptor
 		bool WriteBaseDescriptor(ov::ByteStream &stream, uint8_t tag, const ov::Data &data);
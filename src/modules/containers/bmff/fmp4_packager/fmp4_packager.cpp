@@ -523,13 +523,17 @@ namespace bmff
 					return false;
 				}
 
-				if (WriteMdatBox(chunk_stream, samples) == false)
+				// The samples are not copied into the chunk, it refers to their payloads after the headers
+				FMP4DataList chunk;
+				chunk.emplace_back(nullptr);
+
+				if (WriteMdatBoxHeader(chunk_stream, samples, chunk) == false)
 				{
 					logte("FMP4Packager::AppendSample() - Failed to write mdat box");
 					return false;
 				}
 
-				auto chunk = chunk_stream.GetDataPointer();
+				chunk.front() = chunk_stream.GetDataPointer();
 
 				// The marker boundary cut ends the segment exactly at this frame's
 				// position, so a marker sitting on it belongs to the closing segment
@@ -682,13 +686,17 @@ namespace bmff
 				return false;
 			}
 
-			if (WriteMdatBox(chunk_stream, samples) == false)
+			// The samples are not copied into the chunk, it refers to their payloads after the headers
+			FMP4DataList chunk;
+			chunk.emplace_back(nullptr);
+
+			if (WriteMdatBoxHeader(chunk_stream, samples, chunk) == false)
 			{
 				logte("FMP4Packager::Flush() - Failed to write mdat box");
 				return false;
 			}
 
-			auto chunk = chunk_stream.GetDataPointer();
+			chunk.front() = chunk_stream.GetDataPointer();
 
 			// Storage expects milliseconds, samples hold durations in timescale units
 			double total_sample_duration_ms = (static_cast<double>(samples->GetTotalDuration()) / GetMediaTrack()->GetTimeBase().GetTimescale()) * 1000.0;
@@ -120,6 +120,31 @@ namespace bmff
 		return nullptr;
 	}
 
+	ov::String FMP4Storage::GetDvrSegmentFilePath(int64_t segment_number) const
+	{
+		if ((_config.dvr_enabled == false) || (segment_number < 0))
+		{
+			return "";
+		}
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+
+			// The segments in memory are served from there
+			if (_segments.empty() || (segment_number >= _segments.begin()->first))
+			{
+				return "";
+			}
+		}
+
+		if (_dvr_info.GetSegmentInfo(static_cast<uint32_t>(segment_number)).IsAvailable() == false)
+		{
+			return "";
+		}
+
+		return GetSegmentFilePath(static_cast<uint32_t>(segment_number));
+	}
+
 	std::shared_ptr<base::modules::Segment> FMP4Storage::GetLastSegment() const
 	{
 		return GetLastSegmentInternal();	
@@ -232,6 +257,11 @@ namespace bmff
 			_initialization_sections[content_version] = section;
 		}
 
+		if (_config.memory_account != nullptr)
+		{
+			section->ChargeMemoryTo(_config.memory_account);
+		}
+
 		if (_observer != nullptr)
 		{
 			_observer->OnFMp4StorageInitialized(track->GetId());
@@ -412,10 +442,20 @@ namespace bmff
 			}
 		}
 
-		// Save to file
-		if (ov::DumpToFile(file_path, segment->GetData()) == nullptr)
+		// Segments are served from memory-mapped files (LoadMediaSegmentFromFile()), so a file
+		// that may still be mapped is never truncated in place: write a temporary file and rename it
+		auto temp_file_path = file_path + ".tmp";
+		if (ov::DumpToFile(temp_file_path, segment->GetDataList()) == nullptr)
+		{
+			logte("Could not save segment to file: %s", temp_file_path.CStr());
+			std::remove(temp_file_path);
+			return false;
+		}
+
+		if (std::rename(temp_file_path, file_path) != 0)
 		{
-			logte("Could not save segment to file: %s", file_path.CStr());
+			logte("Could not rename segment file: %s => %s", temp_file_path.CStr(), file_path.CStr());
+			std::remove(temp_file_path);
 			return false;
 		}
 
@@ -431,6 +471,7 @@ namespace bmff
 			}
 
 			auto file_path = GetSegmentFilePath(segment_to_delete.segment_number);
+			ov::MappedFileCache::GetInstance()->Remove(file_path);
 			if (std::remove(file_path) != 0)
 			{
 				logte("Could not delete DVR segment file: %s", file_path.CStr());
@@ -461,7 +502,10 @@ namespace bmff
 
 		auto file_path = GetSegmentFilePath(segment_number);
 
-		auto data = ov::LoadFromFile(file_path);
+		// Refer to the mapped file instead of reading the whole segment into the heap.
+		// Plaintext HTTP/1.1 responses send it with sendfile().
+		auto mapped_file = ov::MappedFileCache::GetInstance()->Get(file_path);
+		auto data = (mapped_file != nullptr) ? mapped_file->GetData() : nullptr;
 		if (data == nullptr)
 		{
 			logte("Could not load segment from file: %s", file_path.CStr());
@@ -557,7 +601,7 @@ namespace bmff
 		}
 	}
 
-	bool FMP4Storage::AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool &last_chunk, const std::vector<std::shared_ptr<Marker>> &markers)
+	bool FMP4Storage::AppendMediaChunk(const FMP4DataList &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool &last_chunk, const std::vector<std::shared_ptr<Marker>> &markers)
 	{
 		auto segment = GetLastSegmentInternal();
 		if (segment == nullptr || segment->IsCompleted() == true)
@@ -570,6 +614,16 @@ namespace bmff
 			return false;
 		}
 
+		if (_config.memory_account != nullptr)
+		{
+			// The sample payloads are shared with the media packets, and are kept for as long as
+			// the segment is
+			for (const auto &piece : chunk)
+			{
+				piece->ChargeMemoryTo(_config.memory_account);
+			}
+		}
+
 		segment->AddMarkers(markers);
 
 		if (segment->GetDurationMs() > _config.segment_duration_ms * 2)
@@ -38,6 +38,8 @@ namespace bmff
 			ov::String dvr_storage_path;
 			uint64_t dvr_duration_sec = 0;
 			bool server_time_based_segment_numbering = false;
+			// The segments in memory are charged to it, if set
+			std::shared_ptr<ov::MemoryAccount> memory_account;
 		};
 
 		FMP4Storage(const std::shared_ptr<FMp4StorageObserver> &observer, const std::shared_ptr<const MediaTrack> &track, const Config &config, const ov::String &stream_tag);
@@ -50,15 +52,18 @@ namespace bmff
 		std::map<uint32_t, std::shared_ptr<ov::Data>> GetInitializationSections() const;
 		std::shared_ptr<base::modules::Segment> GetSegment(int64_t segment_number) const override;
 		std::shared_ptr<base::modules::Segment> GetLastSegment() const override;
+		// Path of the DVR file of a segment that is no longer kept in memory, or an empty string
+		ov::String GetDvrSegmentFilePath(int64_t segment_number) const;
 		std::shared_ptr<base::modules::PartialSegment> GetPartialSegment(int64_t segment_number, int64_t partial_number) const override;
 		uint64_t GetSegmentCount() const override;
 		int64_t GetLastSegmentNumber() const override;
 		std::tuple<int64_t, int64_t> GetLastPartialSegmentNumber() const override;
 		
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &section);
+		// <chunk> is the moof/mdat headers followed by the sample payloads (see FMP4DataList).
 		// last_chunk is in/out: the storage force-completes an overlong segment on
 		// its own and reports it back through this flag
-		bool AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool &last_chunk, const std::vector<std::shared_ptr<Marker>> &markers = {});
+		bool AppendMediaChunk(const FMP4DataList &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool &last_chunk, const std::vector<std::shared_ptr<Marker>> &markers = {});
 
 		// Switch to a new version of the track at a runtime configuration change.
 		// Completes the in-progress segment and creates subsequent segments with the
@@ -14,12 +14,43 @@
 
 namespace bmff
 {
+	// An fMP4 chunk is kept as a list of pieces: the moof box and the mdat box header written by the
+	// packager, followed by the payloads of the samples, which are shared with the media packets.
+	// A segment lists the pieces of its partial segments, so both refer to the same sample memory.
+	using FMP4DataList = std::vector<std::shared_ptr<const ov::Data>>;
+
+	inline size_t GetFMP4DataListLength(const FMP4DataList &data_list)
+	{
+		size_t length = 0;
+
+		for (const auto &data : data_list)
+		{
+			length += data->GetLength();
+		}
+
+		return length;
+	}
+
+	// Concatenates the pieces into a new contiguous buffer
+	inline std::shared_ptr<ov::Data> ConcatFMP4DataList(const FMP4DataList &data_list, size_t length)
+	{
+		auto data = std::make_shared<ov::Data>(length);
+
+		for (const auto &piece : data_list)
+		{
+			data->Append(piece);
+		}
+
+		return data;
+	}
+
 	class FMP4Partial : public base::modules::PartialSegment
 	{
 	public:
-		FMP4Partial(const std::shared_ptr<ov::Data> &data, int64_t number, int64_t start_timestamp, double duration_ms, bool independent, double timebase_seconds)
+		FMP4Partial(FMP4DataList data_list, int64_t number, int64_t start_timestamp, double duration_ms, bool independent, double timebase_seconds)
 		{
-			_data = data;
+			_data_list = std::move(data_list);
+			_data_length = GetFMP4DataListLength(_data_list);
 			_number = number;
 			_duration_ms = duration_ms;
 			_start_timestamp = start_timestamp;
@@ -45,7 +76,7 @@ namespace bmff
 		// Get Size
 		uint64_t GetDataLength() const override
 		{
-			return _data == nullptr ? 0 : _data->GetLength();
+			return _data_length;
 		}
 
 		bool IsIndependent() const override
@@ -53,9 +84,15 @@ namespace bmff
 			return _independent;
 		}
 
+		// Copies the pieces into a contiguous buffer, use GetDataList() to send them
 		const std::shared_ptr<ov::Data> GetData() const override
 		{
-			return _data;
+			return ConcatFMP4DataList(_data_list, _data_length);
+		}
+
+		FMP4DataList GetDataList() const override
+		{
+			return _data_list;
 		}
 
 		double GetTimebaseSeconds() const override
@@ -68,7 +105,8 @@ namespace bmff
 		int64_t _start_timestamp = 0;
 		double _duration_ms = 0;
 		bool _independent = false;
-		std::shared_ptr<ov::Data> _data;
+		FMP4DataList _data_list;
+		size_t _data_length = 0;
 		double _timebase_seconds = 0.0;
 	};
 
@@ -79,16 +117,18 @@ namespace bmff
 		{
 			_number = number;
 			_timebase_seconds = timebase_seconds;
-
-			// For performance, reserve memory for 4Mbps * target_duration (sec)
-			_data = std::make_shared<ov::Data>(((1000.0 * 1000.0 * 4.0)/8.0) * (static_cast<double>(target_duration) / 1000.0));
 		}
 
 		FMP4Segment(uint64_t number, double duration_ms, const std::shared_ptr<ov::Data> &data)
 		{
 			_number = number;
 			_duration_ms = duration_ms;
-			_data = data;
+
+			if (data != nullptr)
+			{
+				_data_list.push_back(data);
+				_data_length = data->GetLength();
+			}
 
 			SetCompleted();
 		}
@@ -133,7 +173,7 @@ namespace bmff
 			return _codecs_parameter;
 		}
 
-		bool AppendPartialData(const std::shared_ptr<ov::Data> &partial_data, int64_t start_timestamp, double duration_ms, bool independent)
+		bool AppendPartialData(const FMP4DataList &partial_data_list, int64_t start_timestamp, double duration_ms, bool independent)
 		{
 			if (_is_completed)
 			{
@@ -148,27 +188,38 @@ namespace bmff
 				_start_timestamp = start_timestamp;
 			}
 
-			_partials.emplace_back(std::make_shared<FMP4Partial>(partial_data, partial_count, start_timestamp, duration_ms, independent, _timebase_seconds));
+			auto partial = std::make_shared<FMP4Partial>(partial_data_list, partial_count, start_timestamp, duration_ms, independent, _timebase_seconds);
+			_partials.emplace_back(partial);
 			_last_partial_number = partial_count;
 
+			// The segment refers to the same pieces as the partial segment
+			_data_list.insert(_data_list.end(), partial_data_list.begin(), partial_data_list.end());
+			_data_length += partial->GetDataLength();
+
 			lock.unlock();
-			
-			// Append data
+
 			_duration_ms += duration_ms;
-			_data->Append(partial_data);
 
 			return true;
 		}
 
-		// Get Data
+		// Copies the pieces into a contiguous buffer, use GetDataList() to send them
 		const std::shared_ptr<ov::Data> GetData() const override
 		{
-			return _data;
+			std::shared_lock<std::shared_mutex> lock(_partials_lock);
+			return ConcatFMP4DataList(_data_list, _data_length);
+		}
+
+		FMP4DataList GetDataList() const override
+		{
+			std::shared_lock<std::shared_mutex> lock(_partials_lock);
+			return _data_list;
 		}
 
 		size_t GetDataLength() const override
 		{
-			return _data == nullptr ? 0 : _data->GetLength();
+			std::shared_lock<std::shared_mutex> lock(_partials_lock);
+			return _data_length;
 		}
 
 		// Get Number
@@ -257,8 +308,9 @@ namespace bmff
 
 		int64_t _last_partial_number = -1;
 
-		// Segment Data
-		std::shared_ptr<ov::Data> _data;
+		// Pieces of all partial segments
+		FMP4DataList _data_list;
+		size_t _data_length = 0;
 
 		std::vector<std::shared_ptr<Marker>> _markers;
 
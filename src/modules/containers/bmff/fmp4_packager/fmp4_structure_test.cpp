@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include "fmp4_structure.h"
+
+namespace
+{
+	std::shared_ptr<const ov::Data> MakeData(const char *text)
+	{
+		return std::make_shared<ov::Data>(text, ::strlen(text));
+	}
+}  // namespace
+
+// A segment refers to the pieces of its partial segments, so both share the sample memory
+TEST(FMP4Structure, SegmentSharesPartialPieces)
+{
+	bmff::FMP4Segment segment(0, 6000, 1.0 / 90000.0);
+
+	bmff::FMP4DataList first_chunk = {MakeData("moof0mdat0"), MakeData("sample0"), MakeData("sample1")};
+	bmff::FMP4DataList second_chunk = {MakeData("moof1mdat1"), MakeData("sample2")};
+
+	ASSERT_TRUE(segment.AppendPartialData(first_chunk, 0, 500.0, true));
+	ASSERT_TRUE(segment.AppendPartialData(second_chunk, 45000, 500.0, false));
+
+	auto first_partial = segment.GetPartialSegment(0);
+	ASSERT_NE(first_partial, nullptr);
+	EXPECT_EQ(first_partial->GetDataList(), first_chunk);
+	EXPECT_EQ(first_partial->GetDataLength(), 24u);
+	EXPECT_EQ(first_partial->GetData()->ToString(), "moof0mdat0sample0sample1");
+
+	auto data_list = segment.GetDataList();
+	ASSERT_EQ(data_list.size(), first_chunk.size() + second_chunk.size());
+	for (size_t index = 0; index < first_chunk.size(); index++)
+	{
+		EXPECT_EQ(data_list[index], first_chunk[index]);
+	}
+	for (size_t index = 0; index < second_chunk.size(); index++)
+	{
+		EXPECT_EQ(data_list[first_chunk.size() + index], second_chunk[index]);
+	}
+
+	EXPECT_EQ(segment.GetDataLength(), 41u);
+	EXPECT_EQ(segment.GetData()->ToString(), "moof0mdat0sample0sample1moof1mdat1sample2");
+	EXPECT_DOUBLE_EQ(segment.GetDurationMs(), 1000.0);
+
+	segment.SetCompleted();
+	EXPECT_FALSE(segment.AppendPartialData(first_chunk, 90000, 500.0, true));
+	EXPECT_EQ(segment.GetDataLength(), 41u);
+}
+
+// A segment loaded from a DVR file is a single piece
+TEST(FMP4Structure, LoadedSegmentIsSinglePiece)
+{
+	auto data = std::make_shared<ov::Data>("moofmdatsamples", 15);
+	bmff::FMP4Segment segment(7, 2000.0, data);
+
+	EXPECT_TRUE(segment.IsCompleted());
+	ASSERT_EQ(segment.GetDataList().size(), 1u);
+	EXPECT_EQ(segment.GetDataList().front(), data);
+	EXPECT_EQ(segment.GetDataLength(), 15u);
+	EXPECT_EQ(segment.GetData()->ToString(), "moofmdatsamples");
+}
@@ -12,47 +12,74 @@
 
 namespace bmff
 {
-	bool Samples::AppendSample(const Sample &sample)
+	bool Samples::AppendSample(const std::shared_ptr<const MediaPacket> &media_packet)
 	{
-		if (sample._media_packet == nullptr)
+		if (media_packet == nullptr)
 		{
 			return false;
 		}
 
-		if (_samples.size() == 0)
+		if (_total_count == 0)
 		{
-			_start_timestamp = sample._media_packet->GetDts();
-			if (sample._media_packet->GetFlag() == MediaPacketFlag::Key)
-			{
-				_independent = true;
-			}
+			_start_timestamp = media_packet->GetDts();
+			_independent = (media_packet->GetFlag() == MediaPacketFlag::Key);
 		}
 
-		_end_timestamp = sample._media_packet->GetDts() + sample._media_packet->GetDuration();
-		_total_duration += sample._media_packet->GetDuration();
-		_total_size += sample._media_packet->GetDataLength();
+		_end_timestamp = media_packet->GetDts() + media_packet->GetDuration();
+		_total_duration += media_packet->GetDuration();
+		_total_size += media_packet->GetDataLength();
 		_total_count += 1;
 
-		_samples.push_back(sample);
+		_dts_list.push_back(media_packet->GetDts());
+		_pts_list.push_back(media_packet->GetPts());
+		_duration_list.push_back(static_cast<uint32_t>(media_packet->GetDuration()));
+		_size_list.push_back(static_cast<uint32_t>(media_packet->GetDataLength()));
+		_flag_list.push_back(media_packet->GetFlag());
+		_payload_list.push_back(media_packet->GetData());
 
 		return true;
 	}
 
-	// Get Data List
-	const std::vector<Sample> &Samples::GetList() const
+	bool Samples::AppendSample(const Sample &sample)
 	{
-		return _samples;
+		if (AppendSample(sample._media_packet) == false)
+		{
+			return false;
+		}
+
+		if ((sample._sai.per_sample_iv != nullptr) || (sample._sai._sub_samples.empty() == false) || (_sample_aux_info_list.empty() == false))
+		{
+			// The samples before the first one with auxiliary information have none
+			_sample_aux_info_list.resize(_total_count - 1);
+			_sample_aux_info_list.push_back(sample._sai);
+		}
+
+		return true;
 	}
 
-	// Get Data At
-	const Sample &Samples::GetAt(size_t index) const
+	void Samples::Clear()
 	{
-		return _samples.at(index);
+		_dts_list.clear();
+		_pts_list.clear();
+		_duration_list.clear();
+		_size_list.clear();
+		_flag_list.clear();
+		_payload_list.clear();
+		_sample_aux_info_list.clear();
+
+		_start_timestamp = 0;
+		_end_timestamp = 0;
+		_total_duration = 0.0;
+		_total_size = 0;
+		_total_count = 0;
+		_independent = false;
 	}
 
-	void Samples::PopFront()
+	const Sample::SampleAuxInfo &Samples::GetSampleAuxInfoAt(size_t index) const
 	{
-		_samples.erase(_samples.begin());
+		static const Sample::SampleAuxInfo empty_sample_aux_info;
+
+		return (index < _sample_aux_info_list.size()) ? _sample_aux_info_list[index] : empty_sample_aux_info;
 	}
 
 	// Get Start Timestamp
@@ -88,7 +115,7 @@ namespace bmff
 	// Is Empty
 	bool Samples::IsEmpty() const
 	{
-		return _samples.empty();
+		return (_total_count == 0);
 	}
 
 	// Is Independent
@@ -80,15 +80,52 @@ namespace bmff
         SampleAuxInfo _sai;
     };
 
+    // The samples of a fragment, kept as parallel arrays (one entry per sample) so that the trun and
+    // mdat boxes are written from them without going through each media packet.
+    //
+    // Clear() keeps the capacity of the arrays, so a Samples that is reused for every chunk stops
+    // allocating once it has grown to the size of a chunk.
     class Samples
     {
     public:
+        bool AppendSample(const std::shared_ptr<const MediaPacket> &media_packet);
+        // For a sample with auxiliary information (CENC)
         bool AppendSample(const Sample &sample);
-        // Get Data List
-        const std::vector<Sample> &GetList() const;
-        // Get Data At
-        const Sample &GetAt(size_t index) const;
-        void PopFront();
+        void Clear();
+
+        const std::vector<int64_t> &GetDtsList() const
+        {
+            return _dts_list;
+        }
+
+        const std::vector<int64_t> &GetPtsList() const
+        {
+            return _pts_list;
+        }
+
+        const std::vector<uint32_t> &GetDurationList() const
+        {
+            return _duration_list;
+        }
+
+        const std::vector<uint32_t> &GetSizeList() const
+        {
+            return _size_list;
+        }
+
+        const std::vector<MediaPacketFlag> &GetFlagList() const
+        {
+            return _flag_list;
+        }
+
+        const std::vector<std::shared_ptr<const ov::Data>> &GetPayloadList() const
+        {
+            return _payload_list;
+        }
+
+        // Returns an empty SampleAuxInfo for a sample without it
+        const Sample::SampleAuxInfo &GetSampleAuxInfoAt(size_t index) const;
+
         // Get Start Timestamp
         int64_t GetStartTimestamp() const;
         // Get End Timestamp
@@ -104,7 +141,14 @@ namespace bmff
         // Is Independent
         bool IsIndependent() const;
     private:
-        std::vector<Sample> _samples;
+        std::vector<int64_t> _dts_list;
+        std::vector<int64_t> _pts_list;
+        std::vector<uint32_t> _duration_list;
+        std::vector<uint32_t> _size_list;
+        std::vector<MediaPacketFlag> _flag_list;
+        std::vector<std::shared_ptr<const ov::Data>> _payload_list;
+        // Filled only once a sample with auxiliary information is appended
+        std::vector<Sample::SampleAuxInfo> _sample_aux_info_list;
 
         int64_t _start_timestamp = 0;
         int64_t _end_timestamp = 0;
@@ -4,7 +4,8 @@
 namespace bmff
 {
     SampleBuffer::SampleBuffer(const std::shared_ptr<const MediaTrack> &media_track, const CencProperty &cenc_property)
-        :_media_track(media_track)
+        :_samples(std::make_shared<Samples>()),
+         _media_track(media_track)
     {
 		if (cenc_property.scheme != CencProtectScheme::None)
 		{
@@ -14,35 +15,21 @@ namespace bmff
 
     bool SampleBuffer::AppendSample(const std::shared_ptr<const MediaPacket> &media_packet)
     {
-        if (_samples == nullptr)
-        {
-            _samples = std::make_shared<Samples>();
-        }
-
-		Sample sample(media_packet);
-
 		if (_encryptor == nullptr)
 		{
-			if (_samples->AppendSample(sample) == false)
-			{
-				return false;
-			}
+			// The packet is referred to as it is, nothing is allocated per sample
+			return _samples->AppendSample(media_packet);
 		}
-		else
-		{
-			Sample cipher_sample;
-			if (_encryptor->Encrypt(sample, cipher_sample) == false)
-			{
-				return false;
-			}
 
-			if (_samples->AppendSample(cipher_sample) == false)
-			{
-				return false;
-			}
+		Sample sample(media_packet);
+		Sample cipher_sample;
+
+		if (_encryptor->Encrypt(sample, cipher_sample) == false)
+		{
+			return false;
 		}
 
-        return true;
+		return _samples->AppendSample(cipher_sample);
     }
 
     std::shared_ptr<Samples> SampleBuffer::GetSamples() const
@@ -52,6 +39,6 @@ namespace bmff
 
     void SampleBuffer::Reset()
     {
-        _samples.reset();
+        _samples->Clear();
     }
 }
\ No newline at end of file
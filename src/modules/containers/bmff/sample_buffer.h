@@ -17,12 +17,15 @@
 
 namespace bmff
 {
+    // Samples of the chunk being made. The same Samples is used for every chunk of the track, so
+    // appending a sample of an unencrypted track allocates nothing once the arrays have grown.
     class SampleBuffer
     {
     public:
         SampleBuffer(const std::shared_ptr<const MediaTrack> &media_track, const CencProperty &cenc_property);
 
         bool AppendSample(const std::shared_ptr<const MediaPacket> &media_packet);
+        // Never nullptr. It is cleared by Reset(), not replaced.
         std::shared_ptr<Samples> GetSamples() const;
         void Reset();
 
@@ -0,0 +1,161 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+
+#include "bmff_packager.h"
+#include "sample_buffer.h"
+
+// The samples of a chunk are kept as arrays that the trun and mdat boxes are written from, and
+// the same arrays are reused for every chunk of the track.
+
+namespace
+{
+	std::shared_ptr<MediaTrack> MakeTrack(cmn::MediaType media_type)
+	{
+		auto track = std::make_shared<MediaTrack>();
+		track->SetId(0);
+		track->SetMediaType(media_type);
+		track->SetCodecId((media_type == cmn::MediaType::Video) ? cmn::MediaCodecId::H264 : cmn::MediaCodecId::Aac);
+		track->SetTimeBase(1, 90000);
+		return track;
+	}
+
+	std::shared_ptr<MediaPacket> MakePacket(cmn::MediaType media_type, int64_t pts, int64_t dts, int64_t duration, size_t length, bool keyframe)
+	{
+		auto data = std::make_shared<ov::Data>(length);
+		data->SetLength(length);
+
+		return std::make_shared<MediaPacket>(media_type, 0, data, pts, dts, duration,
+											 keyframe ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag,
+											 cmn::BitstreamFormat::H264_AVCC, cmn::PacketType::NALU);
+	}
+
+	// Exposes the box writers to the tests
+	class TestPackager : public bmff::Packager
+	{
+	public:
+		using bmff::Packager::Packager;
+		using bmff::Packager::WriteMdatBoxHeader;
+		using bmff::Packager::WriteTrunBox;
+	};
+
+	uint32_t ReadBE32(const uint8_t *bytes)
+	{
+		return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) | (static_cast<uint32_t>(bytes[2]) << 8) | bytes[3];
+	}
+}  // namespace
+
+TEST(BmffSampleBuffer, KeepsSamplesAsArrays)
+{
+	bmff::SampleBuffer sample_buffer(MakeTrack(cmn::MediaType::Video), bmff::CencProperty());
+
+	auto key_frame = MakePacket(cmn::MediaType::Video, 6000, 3000, 3000, 100, true);
+	auto frame = MakePacket(cmn::MediaType::Video, 12000, 6000, 3000, 40, false);
+
+	ASSERT_TRUE(sample_buffer.AppendSample(key_frame));
+	ASSERT_TRUE(sample_buffer.AppendSample(frame));
+	EXPECT_FALSE(sample_buffer.AppendSample(nullptr));
+
+	auto samples = sample_buffer.GetSamples();
+
+	ASSERT_EQ(samples->GetTotalCount(), 2u);
+	EXPECT_EQ(samples->GetDtsList(), (std::vector<int64_t>{3000, 6000}));
+	EXPECT_EQ(samples->GetPtsList(), (std::vector<int64_t>{6000, 12000}));
+	EXPECT_EQ(samples->GetDurationList(), (std::vector<uint32_t>{3000, 3000}));
+	EXPECT_EQ(samples->GetSizeList(), (std::vector<uint32_t>{100, 40}));
+	EXPECT_EQ(samples->GetFlagList(), (std::vector<MediaPacketFlag>{MediaPacketFlag::Key, MediaPacketFlag::NoFlag}));
+
+	// The payloads are referred to, not copied
+	EXPECT_EQ(samples->GetPayloadList()[1], frame->GetData());
+
+	EXPECT_EQ(samples->GetStartTimestamp(), 3000);
+	EXPECT_EQ(samples->GetEndTimestamp(), 9000);
+	EXPECT_EQ(samples->GetTotalSize(), 140u);
+	EXPECT_TRUE(samples->IsIndependent());
+}
+
+TEST(BmffSampleBuffer, ReusesTheArraysAfterReset)
+{
+	bmff::SampleBuffer sample_buffer(MakeTrack(cmn::MediaType::Audio), bmff::CencProperty());
+	auto samples = sample_buffer.GetSamples();
+
+	for (int64_t index = 0; index < 50; index++)
+	{
+		ASSERT_TRUE(sample_buffer.AppendSample(MakePacket(cmn::MediaType::Audio, index * 1920, index * 1920, 1920, 8, true)));
+	}
+
+	auto capacity = samples->GetDtsList().capacity();
+
+	sample_buffer.Reset();
+
+	EXPECT_EQ(sample_buffer.GetSamples(), samples);
+	EXPECT_TRUE(samples->IsEmpty());
+	EXPECT_EQ(samples->GetTotalDuration(), 0.0);
+	EXPECT_FALSE(samples->IsIndependent());
+	EXPECT_EQ(samples->GetDtsList().capacity(), capacity);
+
+	ASSERT_TRUE(sample_buffer.AppendSample(MakePacket(cmn::MediaType::Audio, 96000, 96000, 1920, 8, true)));
+	EXPECT_EQ(samples->GetStartTimestamp(), 96000);
+	EXPECT_EQ(samples->GetTotalCount(), 1u);
+}
+
+TEST(BmffSampleBuffer, KeepsAuxInfoOnlyForSamplesThatHaveIt)
+{
+	bmff::Samples samples;
+
+	ASSERT_TRUE(samples.AppendSample(MakePacket(cmn::MediaType::Video, 0, 0, 3000, 10, true)));
+
+	bmff::Sample::SampleAuxInfo sai;
+	sai._sub_samples.emplace_back(5, 16);
+	ASSERT_TRUE(samples.AppendSample(bmff::Sample(MakePacket(cmn::MediaType::Video, 3000, 3000, 3000, 21, false), sai)));
+
+	EXPECT_TRUE(samples.GetSampleAuxInfoAt(0)._sub_samples.empty());
+	ASSERT_EQ(samples.GetSampleAuxInfoAt(1)._sub_samples.size(), 1u);
+	EXPECT_EQ(samples.GetSampleAuxInfoAt(1)._sub_samples[0].cipher_bytes, 16u);
+	EXPECT_TRUE(samples.GetSampleAuxInfoAt(2)._sub_samples.empty());
+}
+
+TEST(BmffSampleBuffer, WritesTrunAndMdatFromTheArrays)
+{
+	auto video_track = MakeTrack(cmn::MediaType::Video);
+	TestPackager packager(video_track, nullptr, bmff::CencProperty());
+
+	auto samples = std::make_shared<bmff::Samples>();
+	ASSERT_TRUE(samples->AppendSample(MakePacket(cmn::MediaType::Video, 6000, 3000, 3000, 100, true)));
+	ASSERT_TRUE(samples->AppendSample(MakePacket(cmn::MediaType::Video, 9000, 6000, 3000, 40, false)));
+
+	ov::ByteStream trun_stream(256);
+	ASSERT_TRUE(packager.WriteTrunBox(trun_stream, samples));
+
+	auto trun = trun_stream.GetDataPointer();
+	auto bytes = trun->GetDataAs<uint8_t>();
+
+	// header(8) + version/flags(4) + sample_count(4) + data_offset(4) + 2 * (duration, size, flags, cts)
+	ASSERT_EQ(trun->GetLength(), 20u + (2 * 16));
+	EXPECT_EQ(ReadBE32(bytes + 12), 2u);
+
+	const uint8_t *row = bytes + 20;
+	EXPECT_EQ(ReadBE32(row + 0), 3000u);
+	EXPECT_EQ(ReadBE32(row + 4), 100u);
+	EXPECT_EQ(ReadBE32(row + 8), 0x02000000u);
+	EXPECT_EQ(ReadBE32(row + 12), 3000u);
+
+	row += 16;
+	EXPECT_EQ(ReadBE32(row + 4), 40u);
+	EXPECT_EQ(ReadBE32(row + 8), 0x01010000u);
+
+	ov::ByteStream mdat_stream(16);
+	std::vector<std::shared_ptr<const ov::Data>> payloads;
+	ASSERT_TRUE(packager.WriteMdatBoxHeader(mdat_stream, samples, payloads));
+
+	EXPECT_EQ(payloads, samples->GetPayloadList());
+	EXPECT_EQ(ReadBE32(mdat_stream.GetDataPointer()->GetDataAs<uint8_t>()), 8u + 140u);
+}
@@ -696,6 +696,12 @@ namespace mpegts
 
 	void Packager::AddSegmentToBuffer(const std::shared_ptr<Segment> &segment)
 	{
+		// GetData() of a segment that is not in memory loads it from the file
+		if ((_config.memory_account != nullptr) && segment->IsDataInMemory() && (segment->GetData() != nullptr))
+		{
+			segment->GetData()->ChargeMemoryTo(_config.memory_account);
+		}
+
 		std::lock_guard<std::shared_mutex> lock(_segments_guard);
 		_segments.emplace(segment->GetId(), segment);
 		_total_segments_duration_ms += segment->GetDurationMs();
@@ -456,6 +456,9 @@ namespace mpegts
 			uint32_t segment_retention_count = 2; // This number of segments are retained event after the SegmentRemoved event occurs
 
 			ov::String stream_id_meta;
+
+			// The segments kept in memory are charged to it, if set
+			std::shared_ptr<ov::MemoryAccount> memory_account;
         };
 
         Packager(const ov::String &packager_id, const Config &config);
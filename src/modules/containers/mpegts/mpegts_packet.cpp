@@ -319,19 +319,70 @@ namespace mpegts
 		return 1 + n + (remaining % 184 == 183 ? 1 : 0);
 	}
 
+	size_t Packet::GetPacketCount(const std::shared_ptr<Pes> &pes, bool has_pcr)
+	{
+		auto header_data = pes->GetHeaderData();
+		if (header_data == nullptr)
+		{
+			auto pes_data = pes->GetData();
+			return (pes_data != nullptr) ? GetPacketCount(pes_data->GetLength(), has_pcr) : 0;
+		}
+
+		auto payload_data = pes->GetPayloadData();
+		return GetPacketCount(header_data->GetLength() + ((payload_data != nullptr) ? payload_data->GetLength() : 0), has_pcr);
+	}
+
 	// Serialises all TS packets for one PES frame directly into a pre-allocated flat
 	// buffer that must be at least GetPacketCount() * 188 bytes.
 	// Returns the number of packets written (same value as GetPacketCount()).
 	size_t Packet::BuildAllInto(const std::shared_ptr<Pes> &pes, bool has_pcr, bool is_keyframe, uint8_t continuity_counter, uint8_t *output)
 	{
-		const auto pes_raw = pes->GetData();
-		if (pes_raw == nullptr)
+		// The PES is read as slices (the header and the media packet data) so that the payload is
+		// copied once, straight into the TS packets. A parsed PES has no media packet, so it is
+		// read from its own buffer.
+		std::shared_ptr<const ov::Data> slices[2];
+		auto header_data = pes->GetHeaderData();
+		if (header_data != nullptr)
+		{
+			slices[0] = header_data;
+			slices[1] = pes->GetPayloadData();
+		}
+		else
+		{
+			slices[0] = pes->GetData();
+		}
+
+		if (slices[0] == nullptr)
 		{
 			return 0;
 		}
 
-		const uint8_t *pes_data  = pes_raw->GetDataAs<uint8_t>();
-		const size_t   pes_len   = pes_raw->GetLength();
+		size_t slice_index  = 0;
+		size_t slice_offset = 0;
+		// Copies the next <length> bytes of the PES to <destination>
+		auto copy_pes_data = [&](uint8_t *destination, size_t length) {
+			while (length > 0)
+			{
+				const auto &slice		  = slices[slice_index];
+				const size_t slice_length = (slice != nullptr) ? slice->GetLength() : 0;
+
+				if (slice_offset >= slice_length)
+				{
+					slice_index++;
+					slice_offset = 0;
+					continue;
+				}
+
+				const size_t to_copy = std::min(length, slice_length - slice_offset);
+				::memcpy(destination, slice->GetDataAs<uint8_t>() + slice_offset, to_copy);
+
+				destination += to_copy;
+				slice_offset += to_copy;
+				length -= to_copy;
+			}
+		};
+
+		const size_t   pes_len   = slices[0]->GetLength() + ((slices[1] != nullptr) ? slices[1]->GetLength() : 0);
 		const uint16_t pid       = pes->PID();
 
 		// Pre-compute PCR fields once (only used for first packet when has_pcr)
@@ -425,7 +476,7 @@ namespace mpegts
 			// ---- payload ----
 			if (payload_size > 0)
 			{
-				memcpy(pkt + pos, pes_data + pes_offset, payload_size);
+				copy_pes_data(pkt + pos, payload_size);
 				pes_offset += payload_size;
 			}
 
@@ -170,8 +170,11 @@ namespace mpegts
 
 		// Zero-copy optimized path: builds all TS packets for one PES directly into a
 		// caller-allocated flat buffer (pre-sized to GetPacketCount() * 188 bytes).
+		// The PES header and the media packet data are copied straight into the packets,
+		// without being joined into a PES buffer first.
 		// Returns the number of packets written.
 		static size_t GetPacketCount(size_t pes_data_length, bool has_pcr);
+		static size_t GetPacketCount(const std::shared_ptr<Pes> &pes, bool has_pcr);
 		static size_t BuildAllInto(const std::shared_ptr<Pes> &pes, bool has_pcr, bool is_keyframe, uint8_t continuity_counter, uint8_t *output);
 
 		// Getter
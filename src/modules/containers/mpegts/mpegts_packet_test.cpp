@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "mpegts_depacketizer.h"
+#include "mpegts_pes.h"
 #include "mpegts_section.h"
 
 namespace
@@ -112,8 +113,95 @@ namespace
 		b[5] = 0x80;											 // discontinuity_indicator
 		return std::make_shared<ov::Data>(b.data(), b.size());
 	}
+
+	std::shared_ptr<MediaTrack> MakeTrack(cmn::MediaType type)
+	{
+		auto track = std::make_shared<MediaTrack>();
+		track->SetId(1);
+		track->SetMediaType(type);
+		track->SetCodecId((type == cmn::MediaType::Video) ? cmn::MediaCodecId::H264 : cmn::MediaCodecId::Aac);
+		track->SetTimeBase(1, 90000);
+		return track;
+	}
+
+	std::shared_ptr<const MediaPacket> MakeFrame(cmn::MediaType type, size_t length, bool is_keyframe)
+	{
+		auto data = std::make_shared<ov::Data>(length);
+		data->SetLength(length);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		for (size_t index = 0; index < length; index++)
+		{
+			buffer[index] = static_cast<uint8_t>(index * 7);
+		}
+
+		return std::make_shared<MediaPacket>(type, 1, data, 183000, 180000, 3000,
+											 is_keyframe ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag,
+											 (type == cmn::MediaType::Video) ? cmn::BitstreamFormat::H264_ANNEXB : cmn::BitstreamFormat::AAC_ADTS,
+											 (type == cmn::MediaType::Video) ? cmn::PacketType::NALU : cmn::PacketType::RAW);
+	}
+
+	// Packet::Build(): a Packet object (and its own buffer) for every TS packet
+	std::vector<uint8_t> BuildPacketByPacket(const std::shared_ptr<mpegts::Pes> &pes, bool has_pcr, bool is_keyframe, uint8_t continuity_counter)
+	{
+		std::vector<uint8_t> bytes;
+
+		for (const auto &packet : mpegts::Packet::Build(pes, has_pcr, is_keyframe, continuity_counter))
+		{
+			auto data = packet->GetData();
+			bytes.insert(bytes.end(), data->GetDataAs<uint8_t>(), data->GetDataAs<uint8_t>() + data->GetLength());
+		}
+
+		return bytes;
+	}
+
+	// Packet::BuildAllInto(): all TS packets written straight into one buffer
+	std::vector<uint8_t> BuildIntoBuffer(const std::shared_ptr<mpegts::Pes> &pes, bool has_pcr, bool is_keyframe, uint8_t continuity_counter)
+	{
+		auto packet_count = mpegts::Packet::GetPacketCount(pes, has_pcr);
+		std::vector<uint8_t> bytes(packet_count * mpegts::MPEGTS_MIN_PACKET_SIZE, 0x00);
+
+		EXPECT_EQ(mpegts::Packet::BuildAllInto(pes, has_pcr, is_keyframe, continuity_counter, bytes.data()), packet_count);
+
+		return bytes;
+	}
 }  // namespace
 
+// Writing the TS packets of a frame straight into a buffer produces the same bytes as building
+// them packet by packet, including the packet boundaries around the adaptation field sizes
+TEST(MpegTsPacket, BuildAllIntoIsByteIdentical)
+{
+	const size_t frame_lengths[] = {1, 100, 150, 158, 163, 164, 165, 169, 170, 171, 176, 177, 178,
+									347, 348, 349, 353, 354, 355, 1000, 4096, 65536, 100003};
+
+	for (auto media_type : {cmn::MediaType::Video, cmn::MediaType::Audio})
+	{
+		auto track = MakeTrack(media_type);
+
+		for (auto frame_length : frame_lengths)
+		{
+			for (bool has_pcr : {false, true})
+			{
+				for (bool is_keyframe : {false, true})
+				{
+					SCOPED_TRACE(ov::String::FormatString("type: %d, length: %zu, pcr: %d, key: %d",
+														  static_cast<int>(media_type), frame_length, has_pcr, is_keyframe)
+									 .CStr());
+
+					auto frame = MakeFrame(media_type, frame_length, is_keyframe);
+
+					// Continuity counter 14 wraps around within multi-packet frames
+					auto expected = BuildPacketByPacket(mpegts::Pes::Build(0x100, track, frame), has_pcr, is_keyframe, 14);
+					auto actual	  = BuildIntoBuffer(mpegts::Pes::Build(0x100, track, frame), has_pcr, is_keyframe, 14);
+
+					ASSERT_FALSE(expected.empty());
+					EXPECT_EQ(actual, expected);
+				}
+			}
+		}
+	}
+}
+
 TEST(MpegTsPacket, ParseAcceptsValidSyncByte)
 {
 	auto bytes = MakePacketBytes(0x0100, 3);
@@ -250,19 +250,15 @@ namespace mpegts
 
         // Allocate a single flat buffer for all TS packets of this frame, avoiding
         // per-packet heap allocation and multiple memcpy rounds.
-        const auto pes_raw = pes->GetData();
-        if (pes_raw == nullptr)
-        {
-            return false;
-        }
-        const size_t n_packets = Packet::GetPacketCount(pes_raw->GetLength(), has_pcr);
+        const size_t n_packets = Packet::GetPacketCount(pes, has_pcr);
         if (n_packets == 0)
         {
             return false;
         }
 
         auto ts_data = std::make_shared<ov::Data>(n_packets * MPEGTS_MIN_PACKET_SIZE);
-        ts_data->SetLength(n_packets * MPEGTS_MIN_PACKET_SIZE);
+        // BuildAllInto() writes every byte of each packet
+        ts_data->SetLengthUninitialized(n_packets * MPEGTS_MIN_PACKET_SIZE);
         const size_t written = Packet::BuildAllInto(pes, has_pcr, media_packet->IsKeyFrame(), continuity_counter, ts_data->GetWritableDataAs<uint8_t>());
         if (written == 0)
         {
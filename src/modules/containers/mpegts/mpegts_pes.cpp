@@ -95,7 +95,7 @@ namespace mpegts
 		return pes;
 	}
 
-	bool Pes::UpdateData()
+	std::shared_ptr<ov::Data> Pes::BuildHeaderData()
 	{
 		// Build data
 		ov::BitWriter optional_data(16);
@@ -122,14 +122,13 @@ namespace mpegts
 		optional_header.WriteBits(1, _extension_flag);
 		optional_header.WriteBits(8, _header_data_length);
 
-		// PES Packet Data
-		ov::BitWriter pes_packet_data(_media_packet->GetDataLength() + 64);
-
 		// PES Header
-		pes_packet_data.WriteBytes<uint8_t>(_start_code_prefix_1);
-		pes_packet_data.WriteBytes<uint8_t>(_start_code_prefix_2);
-		pes_packet_data.WriteBytes<uint8_t>(_start_code_prefix_3);
-		pes_packet_data.WriteBytes<uint8_t>(_stream_id);
+		ov::BitWriter pes_header(MPEGTS_PES_HEADER_SIZE + optional_header.GetDataSize() + optional_data.GetDataSize());
+
+		pes_header.WriteBytes<uint8_t>(_start_code_prefix_1);
+		pes_header.WriteBytes<uint8_t>(_start_code_prefix_2);
+		pes_header.WriteBytes<uint8_t>(_start_code_prefix_3);
+		pes_header.WriteBytes<uint8_t>(_stream_id);
 
 		uint64_t pes_packet_length = optional_header.GetDataSize() + optional_data.GetDataSize() + _media_packet->GetDataLength();
 		if (pes_packet_length > 0xFF && _media_track->GetMediaType() == cmn::MediaType::Video)
@@ -141,20 +140,36 @@ namespace mpegts
 			_pes_packet_length = static_cast<uint16_t>(pes_packet_length);
 		}
 
-		pes_packet_data.WriteBytes<uint16_t>(_pes_packet_length);
+		pes_header.WriteBytes<uint16_t>(_pes_packet_length);
 
 		// Optional Header
-		pes_packet_data.WriteData(optional_header.GetData(), optional_header.GetDataSize());
+		pes_header.WriteData(optional_header.GetData(), optional_header.GetDataSize());
 
 		// Optional Data
-		pes_packet_data.WriteData(optional_data.GetData(), optional_data.GetDataSize());
+		pes_header.WriteData(optional_data.GetData(), optional_data.GetDataSize());
 
-		auto payload_offset = pes_packet_data.GetDataSize();
+		return pes_header.GetDataObject();
+	}
+
+	bool Pes::UpdateData()
+	{
+		auto header_data = GetHeaderData();
+		if (header_data == nullptr)
+		{
+			return false;
+		}
+
+		// PES Packet Data
+		_data = std::make_shared<ov::Data>(header_data->GetLength() + _media_packet->GetDataLength());
+
+		// PES Header
+		_data->Append(header_data);
+
+		auto payload_offset = _data->GetLength();
 
 		// Payload
-		pes_packet_data.WriteData(_media_packet->GetData()->GetDataAs<uint8_t>(), _media_packet->GetDataLength());
+		_data->Append(_media_packet->GetData());
 
-		_data = pes_packet_data.GetDataObject();
 		_payload = _data->GetWritableDataAs<uint8_t>() + payload_offset;
 		_payload_length = _data->GetLength() - payload_offset;
 
@@ -514,6 +529,21 @@ namespace mpegts
 	}
 
 	// Getter
+	std::shared_ptr<const ov::Data> Pes::GetHeaderData()
+	{
+		if ((_header_data == nullptr) && (_media_packet != nullptr))
+		{
+			_header_data = BuildHeaderData();
+		}
+
+		return _header_data;
+	}
+
+	std::shared_ptr<const ov::Data> Pes::GetPayloadData() const
+	{
+		return (_media_packet != nullptr) ? _media_packet->GetData() : nullptr;
+	}
+
 	std::shared_ptr<const ov::Data> Pes::GetData()
 	{
 		if (_need_to_update_data == true)
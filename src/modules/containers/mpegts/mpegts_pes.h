@@ -85,6 +85,10 @@ namespace mpegts
 		int64_t Pcr() const;
 
 		std::shared_ptr<const ov::Data> GetData();
+		// A PES built from a media packet (Build()) can also be read as the PES header followed by the
+		// media packet data, without copying them into one buffer (see Packet::BuildAllInto())
+		std::shared_ptr<const ov::Data> GetHeaderData();
+		std::shared_ptr<const ov::Data> GetPayloadData() const;
 		const uint8_t* Payload();
 		uint32_t PayloadLength();
 
@@ -119,6 +123,7 @@ namespace mpegts
 		bool ParseTimestamp(BitReader *parser, uint8_t start_bits, int64_t &timestamp);
 		bool WriteTimestamp(ov::BitWriter *writer, int64_t& pts, int64_t& dts);
 
+		std::shared_ptr<ov::Data> BuildHeaderData();
 		bool UpdateData();
 
 		bool _pes_header_parsed = false;
@@ -161,6 +166,7 @@ namespace mpegts
 		std::shared_ptr<const MediaTrack> _media_track = nullptr;
 		std::shared_ptr<const MediaPacket> _media_packet = nullptr;
 
+		std::shared_ptr<ov::Data> _header_data = nullptr;
 		std::shared_ptr<ov::Data> _data = nullptr;
 		uint8_t* _payload = nullptr;
 		uint32_t _payload_length = 0;
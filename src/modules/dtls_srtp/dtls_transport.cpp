@@ -57,6 +57,7 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<::Certificate> &ce
 		"DEFAULT:!NULL:!aNULL:!SHA256:!SHA384:!aECDH:!AESGCM+AES256:!aPSK",
 		false,
 		false,
+		nullptr,
 		&tls_context_callback,
 		&error);
 
@@ -105,7 +105,7 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 
 	auto buffer = data->GetWritableData();
 	int out_len = static_cast<int>(data->GetLength());
-	data->SetLength(need_len);
+	data->SetLengthUninitialized(need_len);
 
 	// FOR DEBUG
 	auto byte_buffer = data->GetDataAs<uint8_t>();
@@ -143,7 +143,7 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
 
     auto buffer = data->GetWritableData();
     int out_len = static_cast<int>(data->GetLength());
-    data->SetLength(need_len);
+    data->SetLengthUninitialized(need_len);
 
     int err = srtp_protect_rtcp(_session, buffer, &out_len);
     if(err != srtp_err_status_ok)
@@ -160,5 +160,7 @@ bool SrtpTransport::SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Da
 		return false;
 	}
 
+	_ready = true;
+
 	return true;
 }
\ No newline at end of file
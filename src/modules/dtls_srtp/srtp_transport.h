@@ -27,7 +27,14 @@ public:
 
 	bool SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key);
 
+	// Whether the key material has been set, so that RTP/RTCP packets can be sent
+	bool IsReady() const
+	{
+		return _ready;
+	}
+
 private:
+	std::atomic<bool>					_ready{false};
 	std::shared_ptr<SrtpAdapter>		_send_session = nullptr;
 	std::shared_ptr<SrtpAdapter>		_recv_session = nullptr;
 };
@@ -9,6 +9,8 @@
 
 #include "ffmpeg_codec.h"
 
+#include "ffmpeg_frame_pool.h"
+
 namespace ffmpeg
 {
 	FFmpegCodec::~FFmpegCodec()
@@ -65,6 +67,9 @@ namespace ffmpeg
 
 	bool FFmpegCodec::Open()
 	{
+		// Software video decoders output into the shared frame pool
+		FramePool::GetInstance()->Attach(_context);
+
 		AVDictionary **options = nullptr;
 		int result = ::avcodec_open2(_context, nullptr, options);
 		if (result < 0)
@@ -0,0 +1,193 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+
+#include "ffmpeg_frame_pool.h"
+
+extern "C"
+{
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+}
+
+namespace ffmpeg
+{
+	FramePool::Pool::~Pool()
+	{
+		// Buffers still referenced by frames are freed when they are returned
+		::av_buffer_pool_uninit(&pool);
+	}
+
+	AVBufferRef *FramePool::AllocBuffer(void *opaque, size_t size)
+	{
+		// Only called when the pool has no free buffer
+		auto pool = static_cast<Pool *>(opaque);
+		pool->allocated_count++;
+
+		return ::av_buffer_alloc(size);
+	}
+
+	bool FramePool::GetBuffer(AVFrame *frame, int align)
+	{
+		if (frame == nullptr)
+		{
+			return false;
+		}
+
+		return GetBuffer(frame, frame->width, frame->height, align);
+	}
+
+	bool FramePool::GetBuffer(AVFrame *frame, int width, int height, int align)
+	{
+		if (frame == nullptr || frame->buf[0] != nullptr || width <= 0 || height <= 0 || align <= 0)
+		{
+			return false;
+		}
+
+		auto format = static_cast<AVPixelFormat>(frame->format);
+		auto descriptor = ::av_pix_fmt_desc_get(format);
+		if (descriptor == nullptr || (descriptor->flags & AV_PIX_FMT_FLAG_HWACCEL))
+		{
+			return false;
+		}
+
+		auto pool = GetPool({frame->format, width, height, align});
+		if (pool == nullptr)
+		{
+			return false;
+		}
+
+		// Counted before AllocBuffer() can run, so a hit is never counted as a miss
+		pool->request_count++;
+
+		AVBufferRef *buffer = ::av_buffer_pool_get(pool->pool);
+		if (buffer == nullptr)
+		{
+			return false;
+		}
+
+		// Each linesize is aligned to <align>, and the planes are laid out back to back
+		if (::av_image_fill_arrays(frame->data, frame->linesize, buffer->data, format, width, height, align) < 0)
+		{
+			::av_buffer_unref(&buffer);
+			return false;
+		}
+
+		frame->buf[0] = buffer;
+		frame->extended_data = frame->data;
+
+		return true;
+	}
+
+	std::shared_ptr<FramePool::Pool> FramePool::GetPool(const Key &key)
+	{
+		ov::LockGuard lock(_mutex);
+
+		auto it = _pool_map.find(key);
+		if (it != _pool_map.end())
+		{
+			_pool_list.splice(_pool_list.begin(), _pool_list, it->second);
+			return *(it->second);
+		}
+
+		auto [format, width, height, align] = key;
+
+		int image_size = ::av_image_get_buffer_size(static_cast<AVPixelFormat>(format), width, height, align);
+		if (image_size < 0)
+		{
+			return nullptr;
+		}
+
+		auto pool = std::make_shared<Pool>();
+		pool->key = key;
+		// SIMD routines may read past the end of the last plane
+		pool->buffer_size = static_cast<size_t>(image_size) + AV_INPUT_BUFFER_PADDING_SIZE;
+		pool->pool = ::av_buffer_pool_init2(pool->buffer_size, pool.get(), AllocBuffer, nullptr);
+		if (pool->pool == nullptr)
+		{
+			return nullptr;
+		}
+
+		_pool_list.push_front(pool);
+		_pool_map[key] = _pool_list.begin();
+
+		while (_pool_list.size() > MAX_POOL_COUNT)
+		{
+			// A caller may still hold the evicted pool; it is released with the last reference
+			_pool_map.erase(_pool_list.back()->key);
+			_pool_list.pop_back();
+		}
+
+		return pool;
+	}
+
+	int FramePool::GetBuffer2(AVCodecContext *context, AVFrame *frame, int flags)
+	{
+		int width = frame->width;
+		int height = frame->height;
+		int linesize_align[AV_NUM_DATA_POINTERS] = {0};
+
+		// Decoders write past the visible area up to the coded size
+		::avcodec_align_dimensions2(context, &width, &height, linesize_align);
+
+		int align = DEFAULT_ALIGN;
+		for (int plane = 0; plane < 4; plane++)
+		{
+			align = std::max(align, linesize_align[plane]);
+		}
+
+		if (GetInstance()->GetBuffer(frame, width, height, align))
+		{
+			return 0;
+		}
+
+		return ::avcodec_default_get_buffer2(context, frame, flags);
+	}
+
+	void FramePool::Attach(AVCodecContext *context)
+	{
+		if (context == nullptr || context->codec == nullptr)
+		{
+			return;
+		}
+
+		if ((::av_codec_is_decoder(context->codec) == false) ||
+			(context->codec_type != AVMEDIA_TYPE_VIDEO) ||
+			// The decoder must accept buffers allocated by the user
+			((context->codec->capabilities & AV_CODEC_CAP_DR1) == 0) ||
+			// Hardware decoders allocate from their own frames context
+			(context->hw_device_ctx != nullptr) || (context->hw_frames_ctx != nullptr))
+		{
+			return;
+		}
+
+		context->get_buffer2 = GetBuffer2;
+	}
+
+	std::vector<FramePool::Stats> FramePool::GetStats() const
+	{
+		std::vector<Stats> stats_list;
+
+		ov::LockGuard lock(_mutex);
+
+		for (const auto &pool : _pool_list)
+		{
+			Stats stats;
+
+			std::tie(stats.format, stats.width, stats.height, stats.align) = pool->key;
+			stats.format_name = ::av_get_pix_fmt_name(static_cast<AVPixelFormat>(stats.format));
+			stats.buffer_size = pool->buffer_size;
+			stats.request_count = pool->request_count;
+			stats.allocated_count = pool->allocated_count;
+
+			stats_list.push_back(stats);
+		}
+
+		return stats_list;
+	}
+}  // namespace ffmpeg
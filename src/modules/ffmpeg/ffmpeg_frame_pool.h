@@ -0,0 +1,100 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <tuple>
+#include <vector>
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavutil/buffer.h>
+#include <libavutil/frame.h>
+}
+
+namespace ffmpeg
+{
+	// Transcoder-wide pool of software video frame buffers.
+	//
+	// Buffers are recycled through one AVBufferPool per (format, width, height, alignment),
+	// so decoders, the hardware download path and deep clones stop churning frame-sized
+	// allocations through the allocator. A buffer returns to its pool when the last AVFrame
+	// referencing it is released, wherever in the pipeline that happens.
+	class FramePool : public ov::Singleton<FramePool>
+	{
+	public:
+		static constexpr int DEFAULT_ALIGN = 64;
+		// Least recently used pools beyond this are released; buffers that are still in use
+		// stay valid and are freed when they are returned.
+		static constexpr size_t MAX_POOL_COUNT = 64;
+
+		struct Stats
+		{
+			int format = AV_PIX_FMT_NONE;
+			ov::String format_name;
+			int width = 0;
+			int height = 0;
+			int align = 0;
+
+			size_t buffer_size = 0;
+
+			uint64_t request_count = 0;
+			// Number of buffers the pool had to allocate, which is also the number it retains
+			uint64_t allocated_count = 0;
+
+			double GetHitRate() const
+			{
+				return (request_count > 0) ? (static_cast<double>(request_count - allocated_count) / static_cast<double>(request_count)) : 0.0;
+			}
+		};
+
+		// Allocates the planes of <frame> from the pool. format, width and height must be set.
+		// Returns false for hardware or unknown formats; the caller should fall back to av_frame_get_buffer().
+		bool GetBuffer(AVFrame *frame, int align = DEFAULT_ALIGN);
+
+		// Makes a software video decoder allocate its output frames from the pool.
+		// Must be called before avcodec_open2(). Other contexts are left untouched.
+		void Attach(AVCodecContext *context);
+
+		std::vector<Stats> GetStats() const;
+
+	private:
+		using Key = std::tuple<int, int, int, int>;
+
+		struct Pool
+		{
+			~Pool();
+
+			Key key;
+			size_t buffer_size = 0;
+			AVBufferPool *pool = nullptr;
+
+			std::atomic<uint64_t> request_count{0};
+			std::atomic<uint64_t> allocated_count{0};
+		};
+
+		static int GetBuffer2(AVCodecContext *context, AVFrame *frame, int flags);
+		static AVBufferRef *AllocBuffer(void *opaque, size_t size);
+
+		// Fills the planes of <frame> for a (width x height) image, which may be larger than the frame itself
+		bool GetBuffer(AVFrame *frame, int width, int height, int align);
+		std::shared_ptr<Pool> GetPool(const Key &key);
+
+		mutable ov::Mutex _mutex;
+		// Most recently used pool is at the front
+		std::list<std::shared_ptr<Pool>> _pool_list OV_GUARDED_BY(_mutex);
+		std::map<Key, std::list<std::shared_ptr<Pool>>::iterator> _pool_map OV_GUARDED_BY(_mutex);
+	};
+}  // namespace ffmpeg
@@ -0,0 +1,108 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+#include <modules/ffmpeg/ffmpeg_frame_pool.h>
+
+extern "C"
+{
+#include <libavutil/imgutils.h>
+}
+
+namespace
+{
+	AVFrame *AllocFrame(AVPixelFormat format, int width, int height)
+	{
+		AVFrame *frame = ::av_frame_alloc();
+		frame->format = format;
+		frame->width = width;
+		frame->height = height;
+
+		return frame;
+	}
+
+	bool FindStats(int format, int width, int height, ffmpeg::FramePool::Stats &found)
+	{
+		for (const auto &stats : ffmpeg::FramePool::GetInstance()->GetStats())
+		{
+			if (stats.format == format && stats.width == width && stats.height == height)
+			{
+				found = stats;
+				return true;
+			}
+		}
+
+		return false;
+	}
+}  // namespace
+
+TEST(FFmpegFramePool, ReusesReleasedBuffers)
+{
+	// A size no other test uses, so the pool is not shared
+	constexpr int WIDTH = 322;
+	constexpr int HEIGHT = 182;
+
+	auto pool = ffmpeg::FramePool::GetInstance();
+
+	AVFrame *first = AllocFrame(AV_PIX_FMT_YUV420P, WIDTH, HEIGHT);
+	ASSERT_TRUE(pool->GetBuffer(first));
+	ASSERT_NE(first->buf[0], nullptr);
+
+	for (int plane = 0; plane < 3; plane++)
+	{
+		ASSERT_NE(first->data[plane], nullptr);
+		EXPECT_EQ(first->linesize[plane] % ffmpeg::FramePool::DEFAULT_ALIGN, 0);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(first->data[plane]) % 16, 0u);
+	}
+
+	// Writable like a buffer from av_frame_get_buffer()
+	EXPECT_TRUE(::av_frame_is_writable(first));
+	::memset(first->data[2], 0x80, first->linesize[2] * ((HEIGHT + 1) / 2));
+
+	auto first_buffer = first->buf[0]->data;
+	::av_frame_free(&first);
+
+	AVFrame *second = AllocFrame(AV_PIX_FMT_YUV420P, WIDTH, HEIGHT);
+	ASSERT_TRUE(pool->GetBuffer(second));
+	EXPECT_EQ(second->buf[0]->data, first_buffer);
+
+	// A buffer in use is never handed out twice
+	AVFrame *third = AllocFrame(AV_PIX_FMT_YUV420P, WIDTH, HEIGHT);
+	ASSERT_TRUE(pool->GetBuffer(third));
+	EXPECT_NE(third->buf[0]->data, second->buf[0]->data);
+
+	ffmpeg::FramePool::Stats stats;
+	ASSERT_TRUE(FindStats(AV_PIX_FMT_YUV420P, WIDTH, HEIGHT, stats));
+	EXPECT_EQ(stats.request_count, 3u);
+	EXPECT_EQ(stats.allocated_count, 2u);
+	EXPECT_GE(stats.buffer_size, static_cast<size_t>(::av_image_get_buffer_size(AV_PIX_FMT_YUV420P, WIDTH, HEIGHT, ffmpeg::FramePool::DEFAULT_ALIGN)));
+	EXPECT_DOUBLE_EQ(stats.GetHitRate(), 1.0 / 3.0);
+
+	::av_frame_free(&second);
+	::av_frame_free(&third);
+}
+
+TEST(FFmpegFramePool, RejectsUnsupportedFrames)
+{
+	auto pool = ffmpeg::FramePool::GetInstance();
+
+	AVFrame *hardware = AllocFrame(AV_PIX_FMT_CUDA, 1920, 1080);
+	EXPECT_FALSE(pool->GetBuffer(hardware));
+	EXPECT_EQ(hardware->buf[0], nullptr);
+	::av_frame_free(&hardware);
+
+	AVFrame *empty = AllocFrame(AV_PIX_FMT_YUV420P, 0, 0);
+	EXPECT_FALSE(pool->GetBuffer(empty));
+	::av_frame_free(&empty);
+
+	// Frames that already own a buffer are left alone
+	AVFrame *allocated = AllocFrame(AV_PIX_FMT_YUV420P, 64, 64);
+	ASSERT_EQ(::av_frame_get_buffer(allocated, 0), 0);
+	EXPECT_FALSE(pool->GetBuffer(allocated));
+	::av_frame_free(&allocated);
+}
@@ -9,6 +9,7 @@
 
 #include "ffmpeg_media_frame.h"
 #include "compat.h"
+#include "ffmpeg_frame_pool.h"
 
 namespace ffmpeg
 {
@@ -43,6 +44,30 @@ namespace ffmpeg
 			return nullptr;
 		}
 
+		if (deep == true && IsHardwareFrame() == false && _frame->width > 0 && _frame->height > 0)
+		{
+			// Copy the video planes into a pooled buffer rather than a freshly allocated one
+			AVFrame *copied = ::av_frame_alloc();
+			if (copied == nullptr)
+			{
+				return nullptr;
+			}
+
+			copied->format = _frame->format;
+			copied->width = _frame->width;
+			copied->height = _frame->height;
+
+			if (FramePool::GetInstance()->GetBuffer(copied) &&
+				(::av_frame_copy(copied, _frame) >= 0) &&
+				(::av_frame_copy_props(copied, _frame) >= 0))
+			{
+				return std::make_shared<FFmpegMediaFrameData>(copied);
+			}
+
+			// Fall back to av_frame_make_writable() below
+			::av_frame_free(&copied);
+		}
+
 		// Create a new frame that references the same buffer as the source.
 		AVFrame *cloned = ::av_frame_clone(_frame);
 		if (cloned == nullptr)
@@ -81,6 +106,18 @@ namespace ffmpeg
 			return nullptr;
 		}
 
+		// Download into a pooled buffer. If the pool cannot serve the format,
+		// av_hwframe_transfer_data() allocates the buffer itself.
+		auto frames_context = reinterpret_cast<const AVHWFramesContext *>(_frame->hw_frames_ctx->data);
+		host->format = frames_context->sw_format;
+		host->width = _frame->width;
+		host->height = _frame->height;
+
+		if (FramePool::GetInstance()->GetBuffer(host) == false)
+		{
+			host->format = AV_PIX_FMT_NONE;
+		}
+
 		// GPU memory -> host memory
 		if (::av_hwframe_transfer_data(host, _frame, 0) < 0)
 		{
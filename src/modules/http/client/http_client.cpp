@@ -398,6 +398,18 @@ namespace http
 			HandleError(error);
 		}
 
+		void HttpClient::Cancel()
+		{
+			_canceled = true;
+
+			auto socket = _socket;
+
+			if (socket != nullptr)
+			{
+				socket->Close();
+			}
+		}
+
 		ov::String HttpClient::GetResponseHeader(const ov::String &key)
 		{
 			return _parser.GetHeader(key).value_or("");
@@ -501,7 +513,7 @@ namespace http
 
 			auto response_handler = _response_handler;
 
-			if (response_handler != nullptr)
+			if ((response_handler != nullptr) && (_canceled == false))
 			{
 				response_handler(_parser.GetStatusCode(), _response_body, error);
 			}
@@ -774,7 +786,7 @@ namespace http
 			// An error occurred - reset all variables
 			CleanupVariables();
 
-			if (response_handler != nullptr)
+			if ((response_handler != nullptr) && (_canceled == false))
 			{
 				auto http_error = std::dynamic_pointer_cast<const HttpError>(error);
 
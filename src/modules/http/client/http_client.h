@@ -65,6 +65,10 @@ namespace http
 
 			void Request(const ov::String &url, ResponseHandler response_handler);
 
+			// Closes the connection of an ongoing request (used in non-blocking mode).
+			// The response handler is not called after this.
+			void Cancel();
+
 			// Response headers (Headers received from HTTP server)
 			ov::String GetResponseHeader(const ov::String &key);
 			const std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaders() const;
@@ -144,6 +148,7 @@ namespace http
 
 			ov::Mutex _request_mutex;
 			std::atomic<bool> _requested = false;
+			std::atomic<bool> _canceled = false;
 
 			ov::String _url;
 			std::shared_ptr<ov::Url> _parsed_url;
@@ -30,12 +30,12 @@ namespace http
 				_value = value;
 			}
 
-			ov::String GetName() const
+			const ov::String &GetName() const
 			{
 				return _name;
 			}
 
-			ov::String GetValue() const
+			const ov::String &GetValue() const
 			{
 				return _value;
 			}
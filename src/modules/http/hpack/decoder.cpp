@@ -311,12 +311,17 @@ namespace http
 				length += extra;
 			}
 
+			if (reader->BytesRemained() < length)
+			{
+				return false;
+			}
+
 			if (h == 1)
 			{
-				auto encoded_data = std::make_shared<ov::Data>(reader->CurrentPosition(), length);
+				// Decode Huffman Encoded String in place
+				auto encoded_data = reader->CurrentPosition();
 				reader->SkipBytes(length);
-				// Decode Huffman Encoded String
-				if (HuffmanCodec::GetInstance()->Decode(encoded_data, value) == false)
+				if (HuffmanCodec::GetInstance()->Decode(encoded_data, length, value) == false)
 				{
 					return false;
 				}
@@ -7,289 +7,422 @@
 //
 //==============================================================================
 
-#include <base/ovlibrary/bit_reader.h>
 #include "huffman_codec.h"
 
 namespace http
 {
 	namespace hpack
 	{
-		HuffmanCodec::HuffmanCodec()
+		const std::array<HuffmanCodec::Code, HuffmanCodec::NUMBER_OF_SYMBOLS> &HuffmanCodec::GetCodeTable()
 		{
 			// https://www.rfc-editor.org/rfc/rfc7541.html#appendix-B
-			Build(0x1ff8, 13, 0);
-			Build(0x7fffd8, 23, 1);
-			Build(0xfffffe2, 28, 2);
-			Build(0xfffffe3, 28, 3);
-			Build(0xfffffe4, 28, 4);
-			Build(0xfffffe5, 28, 5);
-			Build(0xfffffe6, 28, 6);
-			Build(0xfffffe7, 28, 7);
-			Build(0xfffffe8, 28, 8);
-			Build(0xffffea, 24, 9);
-			Build(0x3ffffffc, 30, 10);
-			Build(0xfffffe9, 28, 11);
-			Build(0xfffffea, 28, 12);
-			Build(0x3ffffffd, 30, 13);
-			Build(0xfffffeb, 28, 14);
-			Build(0xfffffec, 28, 15);
-			Build(0xfffffed, 28, 16);
-			Build(0xfffffee, 28, 17);
-			Build(0xfffffef, 28, 18);
-			Build(0xffffff0, 28, 19);
-			Build(0xffffff1, 28, 20);
-			Build(0xffffff2, 28, 21);
-			Build(0x3ffffffe, 30, 22);
-			Build(0xffffff3, 28, 23);
-			Build(0xffffff4, 28, 24);
-			Build(0xffffff5, 28, 25);
-			Build(0xffffff6, 28, 26);
-			Build(0xffffff7, 28, 27);
-			Build(0xffffff8, 28, 28);
-			Build(0xffffff9, 28, 29);
-			Build(0xffffffa, 28, 30);
-			Build(0xffffffb, 28, 31);
-			Build(0x14, 6, 32);
-			Build(0x3f8, 10, 33);
-			Build(0x3f9, 10, 34);
-			Build(0xffa, 12, 35);
-			Build(0x1ff9, 13, 36);
-			Build(0x15, 6, 37);
-			Build(0xf8, 8, 38);
-			Build(0x7fa, 11, 39);
-			Build(0x3fa, 10, 40);
-			Build(0x3fb, 10, 41);
-			Build(0xf9, 8, 42);
-			Build(0x7fb, 11, 43);
-			Build(0xfa, 8, 44);
-			Build(0x16, 6, 45);
-			Build(0x17, 6, 46);
-			Build(0x18, 6, 47);
-			Build(0x0, 5, 48);
-			Build(0x1, 5, 49);
-			Build(0x2, 5, 50);
-			Build(0x19, 6, 51);
-			Build(0x1a, 6, 52);
-			Build(0x1b, 6, 53);
-			Build(0x1c, 6, 54);
-			Build(0x1d, 6, 55);
-			Build(0x1e, 6, 56);
-			Build(0x1f, 6, 57);
-			Build(0x5c, 7, 58);
-			Build(0xfb, 8, 59);
-			Build(0x7ffc, 15, 60);
-			Build(0x20, 6, 61);
-			Build(0xffb, 12, 62);
-			Build(0x3fc, 10, 63);
-			Build(0x1ffa, 13, 64);
-			Build(0x21, 6, 65);
-			Build(0x5d, 7, 66);
-			Build(0x5e, 7, 67);
-			Build(0x5f, 7, 68);
-			Build(0x60, 7, 69);
-			Build(0x61, 7, 70);
-			Build(0x62, 7, 71);
-			Build(0x63, 7, 72);
-			Build(0x64, 7, 73);
-			Build(0x65, 7, 74);
-			Build(0x66, 7, 75);
-			Build(0x67, 7, 76);
-			Build(0x68, 7, 77);
-			Build(0x69, 7, 78);
-			Build(0x6a, 7, 79);
-			Build(0x6b, 7, 80);
-			Build(0x6c, 7, 81);
-			Build(0x6d, 7, 82);
-			Build(0x6e, 7, 83);
-			Build(0x6f, 7, 84);
-			Build(0x70, 7, 85);
-			Build(0x71, 7, 86);
-			Build(0x72, 7, 87);
-			Build(0xfc, 8, 88);
-			Build(0x73, 7, 89);
-			Build(0xfd, 8, 90);
-			Build(0x1ffb, 13, 91);
-			Build(0x7fff0, 19, 92);
-			Build(0x1ffc, 13, 93);
-			Build(0x3ffc, 14, 94);
-			Build(0x22, 6, 95);
-			Build(0x7ffd, 15, 96);
-			Build(0x3, 5, 97);
-			Build(0x23, 6, 98);
-			Build(0x4, 5, 99);
-			Build(0x24, 6, 100);
-			Build(0x5, 5, 101);
-			Build(0x25, 6, 102);
-			Build(0x26, 6, 103);
-			Build(0x27, 6, 104);
-			Build(0x6, 5, 105);
-			Build(0x74, 7, 106);
-			Build(0x75, 7, 107);
-			Build(0x28, 6, 108);
-			Build(0x29, 6, 109);
-			Build(0x2a, 6, 110);
-			Build(0x7, 5, 111);
-			Build(0x2b, 6, 112);
-			Build(0x76, 7, 113);
-			Build(0x2c, 6, 114);
-			Build(0x8, 5, 115);
-			Build(0x9, 5, 116);
-			Build(0x2d, 6, 117);
-			Build(0x77, 7, 118);
-			Build(0x78, 7, 119);
-			Build(0x79, 7, 120);
-			Build(0x7a, 7, 121);
-			Build(0x7b, 7, 122);
-			Build(0x7ffe, 15, 123);
-			Build(0x7fc, 11, 124);
-			Build(0x3ffd, 14, 125);
-			Build(0x1ffd, 13, 126);
-			Build(0xffffffc, 28, 127);
-			Build(0xfffe6, 20, 128);
-			Build(0x3fffd2, 22, 129);
-			Build(0xfffe7, 20, 130);
-			Build(0xfffe8, 20, 131);
-			Build(0x3fffd3, 22, 132);
-			Build(0x3fffd4, 22, 133);
-			Build(0x3fffd5, 22, 134);
-			Build(0x7fffd9, 23, 135);
-			Build(0x3fffd6, 22, 136);
-			Build(0x7fffda, 23, 137);
-			Build(0x7fffdb, 23, 138);
-			Build(0x7fffdc, 23, 139);
-			Build(0x7fffdd, 23, 140);
-			Build(0x7fffde, 23, 141);
-			Build(0xffffeb, 24, 142);
-			Build(0x7fffdf, 23, 143);
-			Build(0xffffec, 24, 144);
-			Build(0xffffed, 24, 145);
-			Build(0x3fffd7, 22, 146);
-			Build(0x7fffe0, 23, 147);
-			Build(0xffffee, 24, 148);
-			Build(0x7fffe1, 23, 149);
-			Build(0x7fffe2, 23, 150);
-			Build(0x7fffe3, 23, 151);
-			Build(0x7fffe4, 23, 152);
-			Build(0x1fffdc, 21, 153);
-			Build(0x3fffd8, 22, 154);
-			Build(0x7fffe5, 23, 155);
-			Build(0x3fffd9, 22, 156);
-			Build(0x7fffe6, 23, 157);
-			Build(0x7fffe7, 23, 158);
-			Build(0xffffef, 24, 159);
-			Build(0x3fffda, 22, 160);
-			Build(0x1fffdd, 21, 161);
-			Build(0xfffe9, 20, 162);
-			Build(0x3fffdb, 22, 163);
-			Build(0x3fffdc, 22, 164);
-			Build(0x7fffe8, 23, 165);
-			Build(0x7fffe9, 23, 166);
-			Build(0x1fffde, 21, 167);
-			Build(0x7fffea, 23, 168);
-			Build(0x3fffdd, 22, 169);
-			Build(0x3fffde, 22, 170);
-			Build(0xfffff0, 24, 171);
-			Build(0x1fffdf, 21, 172);
-			Build(0x3fffdf, 22, 173);
-			Build(0x7fffeb, 23, 174);
-			Build(0x7fffec, 23, 175);
-			Build(0x1fffe0, 21, 176);
-			Build(0x1fffe1, 21, 177);
-			Build(0x3fffe0, 22, 178);
-			Build(0x1fffe2, 21, 179);
-			Build(0x7fffed, 23, 180);
-			Build(0x3fffe1, 22, 181);
-			Build(0x7fffee, 23, 182);
-			Build(0x7fffef, 23, 183);
-			Build(0xfffea, 20, 184);
-			Build(0x3fffe2, 22, 185);
-			Build(0x3fffe3, 22, 186);
-			Build(0x3fffe4, 22, 187);
-			Build(0x7ffff0, 23, 188);
-			Build(0x3fffe5, 22, 189);
-			Build(0x3fffe6, 22, 190);
-			Build(0x7ffff1, 23, 191);
-			Build(0x3ffffe0, 26, 192);
-			Build(0x3ffffe1, 26, 193);
-			Build(0xfffeb, 20, 194);
-			Build(0x7fff1, 19, 195);
-			Build(0x3fffe7, 22, 196);
-			Build(0x7ffff2, 23, 197);
-			Build(0x3fffe8, 22, 198);
-			Build(0x1ffffec, 25, 199);
-			Build(0x3ffffe2, 26, 200);
-			Build(0x3ffffe3, 26, 201);
-			Build(0x3ffffe4, 26, 202);
-			Build(0x7ffffde, 27, 203);
-			Build(0x7ffffdf, 27, 204);
-			Build(0x3ffffe5, 26, 205);
-			Build(0xfffff1, 24, 206);
-			Build(0x1ffffed, 25, 207);
-			Build(0x7fff2, 19, 208);
-			Build(0x1fffe3, 21, 209);
-			Build(0x3ffffe6, 26, 210);
-			Build(0x7ffffe0, 27, 211);
-			Build(0x7ffffe1, 27, 212);
-			Build(0x3ffffe7, 26, 213);
-			Build(0x7ffffe2, 27, 214);
-			Build(0xfffff2, 24, 215);
-			Build(0x1fffe4, 21, 216);
-			Build(0x1fffe5, 21, 217);
-			Build(0x3ffffe8, 26, 218);
-			Build(0x3ffffe9, 26, 219);
-			Build(0xffffffd, 28, 220);
-			Build(0x7ffffe3, 27, 221);
-			Build(0x7ffffe4, 27, 222);
-			Build(0x7ffffe5, 27, 223);
-			Build(0xfffec, 20, 224);
-			Build(0xfffff3, 24, 225);
-			Build(0xfffed, 20, 226);
-			Build(0x1fffe6, 21, 227);
-			Build(0x3fffe9, 22, 228);
-			Build(0x1fffe7, 21, 229);
-			Build(0x1fffe8, 21, 230);
-			Build(0x7ffff3, 23, 231);
-			Build(0x3fffea, 22, 232);
-			Build(0x3fffeb, 22, 233);
-			Build(0x1ffffee, 25, 234);
-			Build(0x1ffffef, 25, 235);
-			Build(0xfffff4, 24, 236);
-			Build(0xfffff5, 24, 237);
-			Build(0x3ffffea, 26, 238);
-			Build(0x7ffff4, 23, 239);
-			Build(0x3ffffeb, 26, 240);
-			Build(0x7ffffe6, 27, 241);
-			Build(0x3ffffec, 26, 242);
-			Build(0x3ffffed, 26, 243);
-			Build(0x7ffffe7, 27, 244);
-			Build(0x7ffffe8, 27, 245);
-			Build(0x7ffffe9, 27, 246);
-			Build(0x7ffffea, 27, 247);
-			Build(0x7ffffeb, 27, 248);
-			Build(0xffffffe, 28, 249);
-			Build(0x7ffffec, 27, 250);
-			Build(0x7ffffed, 27, 251);
-			Build(0x7ffffee, 27, 252);
-			Build(0x7ffffef, 27, 253);
-			Build(0x7fffff0, 27, 254);
-			Build(0x3ffffee, 26, 255);
-			Build(0x3fffffff, 30, 256); //EOS
+			static const std::array<Code, NUMBER_OF_SYMBOLS> code_table{{
+			{0x1ff8, 13},	// 0
+			{0x7fffd8, 23},	// 1
+			{0xfffffe2, 28},	// 2
+			{0xfffffe3, 28},	// 3
+			{0xfffffe4, 28},	// 4
+			{0xfffffe5, 28},	// 5
+			{0xfffffe6, 28},	// 6
+			{0xfffffe7, 28},	// 7
+			{0xfffffe8, 28},	// 8
+			{0xffffea, 24},	// 9
+			{0x3ffffffc, 30},	// 10
+			{0xfffffe9, 28},	// 11
+			{0xfffffea, 28},	// 12
+			{0x3ffffffd, 30},	// 13
+			{0xfffffeb, 28},	// 14
+			{0xfffffec, 28},	// 15
+			{0xfffffed, 28},	// 16
+			{0xfffffee, 28},	// 17
+			{0xfffffef, 28},	// 18
+			{0xffffff0, 28},	// 19
+			{0xffffff1, 28},	// 20
+			{0xffffff2, 28},	// 21
+			{0x3ffffffe, 30},	// 22
+			{0xffffff3, 28},	// 23
+			{0xffffff4, 28},	// 24
+			{0xffffff5, 28},	// 25
+			{0xffffff6, 28},	// 26
+			{0xffffff7, 28},	// 27
+			{0xffffff8, 28},	// 28
+			{0xffffff9, 28},	// 29
+			{0xffffffa, 28},	// 30
+			{0xffffffb, 28},	// 31
+			{0x14, 6},	// 32
+			{0x3f8, 10},	// 33
+			{0x3f9, 10},	// 34
+			{0xffa, 12},	// 35
+			{0x1ff9, 13},	// 36
+			{0x15, 6},	// 37
+			{0xf8, 8},	// 38
+			{0x7fa, 11},	// 39
+			{0x3fa, 10},	// 40
+			{0x3fb, 10},	// 41
+			{0xf9, 8},	// 42
+			{0x7fb, 11},	// 43
+			{0xfa, 8},	// 44
+			{0x16, 6},	// 45
+			{0x17, 6},	// 46
+			{0x18, 6},	// 47
+			{0x0, 5},	// 48
+			{0x1, 5},	// 49
+			{0x2, 5},	// 50
+			{0x19, 6},	// 51
+			{0x1a, 6},	// 52
+			{0x1b, 6},	// 53
+			{0x1c, 6},	// 54
+			{0x1d, 6},	// 55
+			{0x1e, 6},	// 56
+			{0x1f, 6},	// 57
+			{0x5c, 7},	// 58
+			{0xfb, 8},	// 59
+			{0x7ffc, 15},	// 60
+			{0x20, 6},	// 61
+			{0xffb, 12},	// 62
+			{0x3fc, 10},	// 63
+			{0x1ffa, 13},	// 64
+			{0x21, 6},	// 65
+			{0x5d, 7},	// 66
+			{0x5e, 7},	// 67
+			{0x5f, 7},	// 68
+			{0x60, 7},	// 69
+			{0x61, 7},	// 70
+			{0x62, 7},	// 71
+			{0x63, 7},	// 72
+			{0x64, 7},	// 73
+			{0x65, 7},	// 74
+			{0x66, 7},	// 75
+			{0x67, 7},	// 76
+			{0x68, 7},	// 77
+			{0x69, 7},	// 78
+			{0x6a, 7},	// 79
+			{0x6b, 7},	// 80
+			{0x6c, 7},	// 81
+			{0x6d, 7},	// 82
+			{0x6e, 7},	// 83
+			{0x6f, 7},	// 84
+			{0x70, 7},	// 85
+			{0x71, 7},	// 86
+			{0x72, 7},	// 87
+			{0xfc, 8},	// 88
+			{0x73, 7},	// 89
+			{0xfd, 8},	// 90
+			{0x1ffb, 13},	// 91
+			{0x7fff0, 19},	// 92
+			{0x1ffc, 13},	// 93
+			{0x3ffc, 14},	// 94
+			{0x22, 6},	// 95
+			{0x7ffd, 15},	// 96
+			{0x3, 5},	// 97
+			{0x23, 6},	// 98
+			{0x4, 5},	// 99
+			{0x24, 6},	// 100
+			{0x5, 5},	// 101
+			{0x25, 6},	// 102
+			{0x26, 6},	// 103
+			{0x27, 6},	// 104
+			{0x6, 5},	// 105
+			{0x74, 7},	// 106
+			{0x75, 7},	// 107
+			{0x28, 6},	// 108
+			{0x29, 6},	// 109
+			{0x2a, 6},	// 110
+			{0x7, 5},	// 111
+			{0x2b, 6},	// 112
+			{0x76, 7},	// 113
+			{0x2c, 6},	// 114
+			{0x8, 5},	// 115
+			{0x9, 5},	// 116
+			{0x2d, 6},	// 117
+			{0x77, 7},	// 118
+			{0x78, 7},	// 119
+			{0x79, 7},	// 120
+			{0x7a, 7},	// 121
+			{0x7b, 7},	// 122
+			{0x7ffe, 15},	// 123
+			{0x7fc, 11},	// 124
+			{0x3ffd, 14},	// 125
+			{0x1ffd, 13},	// 126
+			{0xffffffc, 28},	// 127
+			{0xfffe6, 20},	// 128
+			{0x3fffd2, 22},	// 129
+			{0xfffe7, 20},	// 130
+			{0xfffe8, 20},	// 131
+			{0x3fffd3, 22},	// 132
+			{0x3fffd4, 22},	// 133
+			{0x3fffd5, 22},	// 134
+			{0x7fffd9, 23},	// 135
+			{0x3fffd6, 22},	// 136
+			{0x7fffda, 23},	// 137
+			{0x7fffdb, 23},	// 138
+			{0x7fffdc, 23},	// 139
+			{0x7fffdd, 23},	// 140
+			{0x7fffde, 23},	// 141
+			{0xffffeb, 24},	// 142
+			{0x7fffdf, 23},	// 143
+			{0xffffec, 24},	// 144
+			{0xffffed, 24},	// 145
+			{0x3fffd7, 22},	// 146
+			{0x7fffe0, 23},	// 147
+			{0xffffee, 24},	// 148
+			{0x7fffe1, 23},	// 149
+			{0x7fffe2, 23},	// 150
+			{0x7fffe3, 23},	// 151
+			{0x7fffe4, 23},	// 152
+			{0x1fffdc, 21},	// 153
+			{0x3fffd8, 22},	// 154
+			{0x7fffe5, 23},	// 155
+			{0x3fffd9, 22},	// 156
+			{0x7fffe6, 23},	// 157
+			{0x7fffe7, 23},	// 158
+			{0xffffef, 24},	// 159
+			{0x3fffda, 22},	// 160
+			{0x1fffdd, 21},	// 161
+			{0xfffe9, 20},	// 162
+			{0x3fffdb, 22},	// 163
+			{0x3fffdc, 22},	// 164
+			{0x7fffe8, 23},	// 165
+			{0x7fffe9, 23},	// 166
+			{0x1fffde, 21},	// 167
+			{0x7fffea, 23},	// 168
+			{0x3fffdd, 22},	// 169
+			{0x3fffde, 22},	// 170
+			{0xfffff0, 24},	// 171
+			{0x1fffdf, 21},	// 172
+			{0x3fffdf, 22},	// 173
+			{0x7fffeb, 23},	// 174
+			{0x7fffec, 23},	// 175
+			{0x1fffe0, 21},	// 176
+			{0x1fffe1, 21},	// 177
+			{0x3fffe0, 22},	// 178
+			{0x1fffe2, 21},	// 179
+			{0x7fffed, 23},	// 180
+			{0x3fffe1, 22},	// 181
+			{0x7fffee, 23},	// 182
+			{0x7fffef, 23},	// 183
+			{0xfffea, 20},	// 184
+			{0x3fffe2, 22},	// 185
+			{0x3fffe3, 22},	// 186
+			{0x3fffe4, 22},	// 187
+			{0x7ffff0, 23},	// 188
+			{0x3fffe5, 22},	// 189
+			{0x3fffe6, 22},	// 190
+			{0x7ffff1, 23},	// 191
+			{0x3ffffe0, 26},	// 192
+			{0x3ffffe1, 26},	// 193
+			{0xfffeb, 20},	// 194
+			{0x7fff1, 19},	// 195
+			{0x3fffe7, 22},	// 196
+			{0x7ffff2, 23},	// 197
+			{0x3fffe8, 22},	// 198
+			{0x1ffffec, 25},	// 199
+			{0x3ffffe2, 26},	// 200
+			{0x3ffffe3, 26},	// 201
+			{0x3ffffe4, 26},	// 202
+			{0x7ffffde, 27},	// 203
+			{0x7ffffdf, 27},	// 204
+			{0x3ffffe5, 26},	// 205
+			{0xfffff1, 24},	// 206
+			{0x1ffffed, 25},	// 207
+			{0x7fff2, 19},	// 208
+			{0x1fffe3, 21},	// 209
+			{0x3ffffe6, 26},	// 210
+			{0x7ffffe0, 27},	// 211
+			{0x7ffffe1, 27},	// 212
+			{0x3ffffe7, 26},	// 213
+			{0x7ffffe2, 27},	// 214
+			{0xfffff2, 24},	// 215
+			{0x1fffe4, 21},	// 216
+			{0x1fffe5, 21},	// 217
+			{0x3ffffe8, 26},	// 218
+			{0x3ffffe9, 26},	// 219
+			{0xffffffd, 28},	// 220
+			{0x7ffffe3, 27},	// 221
+			{0x7ffffe4, 27},	// 222
+			{0x7ffffe5, 27},	// 223
+			{0xfffec, 20},	// 224
+			{0xfffff3, 24},	// 225
+			{0xfffed, 20},	// 226
+			{0x1fffe6, 21},	// 227
+			{0x3fffe9, 22},	// 228
+			{0x1fffe7, 21},	// 229
+			{0x1fffe8, 21},	// 230
+			{0x7ffff3, 23},	// 231
+			{0x3fffea, 22},	// 232
+			{0x3fffeb, 22},	// 233
+			{0x1ffffee, 25},	// 234
+			{0x1ffffef, 25},	// 235
+			{0xfffff4, 24},	// 236
+			{0xfffff5, 24},	// 237
+			{0x3ffffea, 26},	// 238
+			{0x7ffff4, 23},	// 239
+			{0x3ffffeb, 26},	// 240
+			{0x7ffffe6, 27},	// 241
+			{0x3ffffec, 26},	// 242
+			{0x3ffffed, 26},	// 243
+			{0x7ffffe7, 27},	// 244
+			{0x7ffffe8, 27},	// 245
+			{0x7ffffe9, 27},	// 246
+			{0x7ffffea, 27},	// 247
+			{0x7ffffeb, 27},	// 248
+			{0xffffffe, 28},	// 249
+			{0x7ffffec, 27},	// 250
+			{0x7ffffed, 27},	// 251
+			{0x7ffffee, 27},	// 252
+			{0x7ffffef, 27},	// 253
+			{0x7fffff0, 27},	// 254
+			{0x3ffffee, 26},	// 255
+			{0x3fffffff, 30},	// 256 (EOS)
+			}};
+
+			return code_table;
+		}
+
+		HuffmanCodec::HuffmanCodec()
+		{
+			BuildDecodeTable();
+		}
+
+		void HuffmanCodec::BuildDecodeTable()
+		{
+			// The tree is only needed to generate the state machine
+			struct TreeNode
+			{
+				int32_t children[2] = {-1, -1};
+				int32_t symbol = -1;
+				uint8_t depth = 0;
+				// Whether the path from the root consists of 1 only (prefix of EOS)
+				bool all_ones = true;
+			};
+
+			std::vector<TreeNode> nodes(1);
+			const auto &code_table = GetCodeTable();
+
+			for (uint16_t symbol = 0; symbol < NUMBER_OF_SYMBOLS; symbol++)
+			{
+				auto [code, length] = code_table[symbol];
+				size_t node_index = 0;
+
+				for (uint8_t i = 0; i < length; i++)
+				{
+					auto bit = (code >> (length - i - 1)) & 0x1;
+
+					if (nodes[node_index].children[bit] < 0)
+					{
+						TreeNode child;
+						child.depth = nodes[node_index].depth + 1;
+						child.all_ones = nodes[node_index].all_ones && (bit == 1);
+
+						nodes[node_index].children[bit] = static_cast<int32_t>(nodes.size());
+						nodes.push_back(child);
+					}
+
+					node_index = nodes[node_index].children[bit];
+				}
+
+				nodes[node_index].symbol = symbol;
+			}
+
+			// Internal nodes become states, the root is always state 0
+			std::vector<int32_t> states(nodes.size(), -1);
+			size_t number_of_states = 0;
+			for (size_t i = 0; i < nodes.size(); i++)
+			{
+				if (nodes[i].symbol < 0)
+				{
+					states[i] = static_cast<int32_t>(number_of_states++);
+				}
+			}
+			OV_ASSERT(number_of_states == NUMBER_OF_STATES, "Invalid huffman tree: %zu states", number_of_states);
+
+			for (size_t i = 0; i < nodes.size(); i++)
+			{
+				if (states[i] < 0)
+				{
+					continue;
+				}
+
+				for (uint8_t nibble = 0; nibble < 16; nibble++)
+				{
+					DecodeEntry entry;
+					size_t node_index = i;
+
+					for (int bit_index = 3; bit_index >= 0; bit_index--)
+					{
+						// RFC 7541 code is complete, so every internal node has two children
+						node_index = nodes[node_index].children[(nibble >> bit_index) & 0x1];
+
+						auto symbol = nodes[node_index].symbol;
+						if (symbol < 0)
+						{
+							continue;
+						}
+
+						if (symbol == EOS_SYMBOL)
+						{
+							// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+							// A Huffman-encoded string literal containing the EOS symbol
+							// MUST be treated as a decoding error.
+							entry.flags = DecodeFlag::Failure;
+							break;
+						}
+
+						entry.flags |= DecodeFlag::Symbol;
+						entry.symbol = static_cast<uint8_t>(symbol);
+						node_index = 0;
+					}
+
+					if ((entry.flags & DecodeFlag::Failure) == 0)
+					{
+						entry.next_state = static_cast<uint8_t>(states[node_index]);
+
+						// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+						// A padding strictly longer than 7 bits MUST be treated as a decoding error.
+						// A padding not corresponding to the most significant bits of the code
+						// for the EOS symbol MUST be treated as a decoding error.
+						if (nodes[node_index].all_ones && (nodes[node_index].depth <= 7))
+						{
+							entry.flags |= DecodeFlag::Accepted;
+						}
+					}
+
+					_decode_table[states[i]][nibble] = entry;
+				}
+			}
 		}
 
 		std::shared_ptr<ov::Data> HuffmanCodec::Encode(const ov::String &str)
 		{
-			std::vector<uint8_t> out_data_buf(str.GetLength() * 2);
-			uint8_t *out_data = out_data_buf.data();
-			size_t out_data_size = 0;
+			const auto &code_table = GetCodeTable();
+			auto input = reinterpret_cast<const uint8_t *>(str.CStr());
+			size_t length = str.GetLength();
 
+			// Calculate the exact output size first, so the output can be written in place
+			size_t total_bit_length = 0;
+			for (size_t i = 0; i < length; i++)
+			{
+				total_bit_length += code_table[input[i]].length;
+			}
+
+			size_t out_data_size = (total_bit_length + 7) / 8;
+			auto encoded_data = std::make_shared<ov::Data>(out_data_size);
+			if (out_data_size == 0)
+			{
+				return encoded_data;
+			}
+
+			encoded_data->SetLength(out_data_size);
+			uint8_t *out_data = encoded_data->GetWritableDataAs<uint8_t>();
+			size_t out_offset = 0;
+
+			// Up to 7 bits are left after flushing, so a 30-bit code always fits
 			uint64_t bit_buffer = 0;
 			size_t bit_buffer_length = 0;
-			size_t length = str.GetLength();
 			for (size_t i = 0; i < length; i++)
 			{
-				uint8_t c = str[i];
-				auto [code, code_bit_length] = _map[c];
-				
+				auto [code, code_bit_length] = code_table[input[i]];
+
 				// Append the code to the bit buffer
 				bit_buffer <<= code_bit_length;
 				bit_buffer |= code;
@@ -298,13 +431,11 @@ namespace http
 				// If the bit buffer is over 8 bits, flush it to the output buffer
 				while (bit_buffer_length >= 8)
 				{
-					uint8_t byte = static_cast<uint8_t>(bit_buffer >> (bit_buffer_length - 8));
 					bit_buffer_length -= 8;
-					out_data[out_data_size] = byte;
-					out_data_size ++;
+					out_data[out_offset++] = static_cast<uint8_t>(bit_buffer >> bit_buffer_length);
 				}
 			}
-			
+
 			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
 			// As the Huffman-encoded data doesn't always end at an octet boundary,
 			// some padding is inserted after it, up to the next octet boundary.  To
@@ -315,102 +446,82 @@ namespace http
 			// Append EOS
 			if (bit_buffer_length > 0)
 			{
-				auto byte = bit_buffer << (8 - bit_buffer_length);
+				auto byte = static_cast<uint8_t>(bit_buffer << (8 - bit_buffer_length));
 				// Append EOS(0xFF) to the end of the bit buffer
 				// bit_buffer is always less than 8 bits
 				byte |= 0xFF >> bit_buffer_length;
 
-				out_data[out_data_size] = byte;
-				out_data_size ++;
+				out_data[out_offset++] = byte;
 			}
-			
-			return std::make_shared<ov::Data>(&out_data[0], out_data_size);
+
+			return encoded_data;
 		}
 
 		bool HuffmanCodec::Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str)
 		{
-			auto reader = std::make_shared<BitReader>(data->GetDataAs<uint8_t>(), data->GetLength());
-			auto node = _tree;
+			return Decode(data->GetDataAs<uint8_t>(), data->GetLength(), str);
+		}
 
-			while (reader->BytesRemained() > 0)
+		bool HuffmanCodec::Decode(const uint8_t *data, size_t length, ov::String &str)
+		{
+			if (length == 0)
 			{
-				auto b = reader->ReadBit();
-				if (b == 1)
-				{
-					node = node->GetRight();
-					if (node == nullptr)
-					{
-						return false;
-					}
-				}
-				else
-				{
-					node = node->GetLeft();
-					if (node == nullptr)
-					{
-						return false;
-					}
-				}
+				return true;
+			}
 
-				if (node->IsLeaf())
-				{
-					if (node->GetValue() == 256)
-					{
-						// EOS
-						return false;
-					}
+			// Decoded symbols are appended to str. Since the shortest code is 5 bits long,
+			// the output never exceeds (length * 8 / 5) bytes.
+			auto offset = str.GetLength();
+			if (str.SetLength(offset + ((length * 8) / 5)) == false)
+			{
+				return false;
+			}
+
+			auto out = reinterpret_cast<uint8_t *>(str.GetBuffer()) + offset;
+			size_t out_length = 0;
 
-					str.Append(static_cast<uint8_t>(node->GetValue()));
-					node = _tree;
+			uint8_t state = 0;
+			uint8_t flags = DecodeFlag::Accepted;
 
-					// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
-					// As the Huffman-encoded data doesn't always end at an octet boundary,
-					// some padding is inserted after it, up to the next octet boundary.  To
-					// prevent this padding from being misinterpreted as part of the string
-					// literal, the most significant bits of the code corresponding to the
-					// EOS (end-of-string) symbol are used.
+			auto decode_nibble = [&](uint8_t nibble) -> bool {
+				const auto &entry = _decode_table[state][nibble];
 
-					// So, the symbol (1111111) corresponding to EOS may be included in the 
-					// last 7 bits or less. In this case, no processing is done because it will 
-					// terminate without reaching the leaf naturally.
+				if (entry.flags & DecodeFlag::Failure)
+				{
+					return false;
 				}
-			}
 
-			return true;
-		}
+				if (entry.flags & DecodeFlag::Symbol)
+				{
+					out[out_length++] = entry.symbol;
+				}
 
-		void HuffmanCodec::BuildTree(uint32_t code, uint8_t length, uint16_t symbol)
-		{
-			//TODO(Getroot): If needed, apply faster algorithm
-			auto node = _tree;
+				state = entry.next_state;
+				flags = entry.flags;
 
-			for (uint16_t i = 0; i < length; i++)
-			{
-				auto bit = (code >> (length - i - 1)) & 0x1;
+				return true;
+			};
 
-				if (bit == 0)
-				{
-					node = node->GetLeft(true);
-				}
-				else
+			for (size_t i = 0; i < length; i++)
+			{
+				if ((decode_nibble(data[i] >> 4) == false) ||
+					(decode_nibble(data[i] & 0x0F) == false))
 				{
-					node = node->GetRight(true);
+					str.SetLength(offset);
+					return false;
 				}
 			}
 
-			node->SetValue(symbol);
-		}
+			// The input must end with a symbol boundary or a valid padding
+			if ((flags & DecodeFlag::Accepted) == 0)
+			{
+				str.SetLength(offset);
+				return false;
+			}
 
-		void HuffmanCodec::BuildMap(uint32_t code, uint8_t length, uint16_t symbol)
-		{
-			_map[symbol] = std::make_pair(code, length);
-		}
+			str.SetLength(offset + out_length);
 
-		// Build Tree and Map
-		void HuffmanCodec::Build(uint32_t code, uint8_t length, uint16_t symbol)
-		{
-			BuildMap(code, length, symbol);
-			BuildTree(code, length, symbol);
+			return true;
 		}
-	} // namespace hpack
-} // namespace http
\ No newline at end of file
+	}  // namespace hpack
+}  // namespace http
@@ -10,6 +10,8 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+#include <array>
+
 namespace http
 {
 	// https://www.rfc-editor.org/rfc/rfc7541.html
@@ -18,67 +20,52 @@ namespace http
 		class HuffmanCodec : public ov::Singleton<HuffmanCodec>
 		{
 		public:
+			// Symbol 256 is EOS
+			static constexpr uint16_t EOS_SYMBOL = 256;
+			static constexpr size_t NUMBER_OF_SYMBOLS = 257;
+
+			struct Code
+			{
+				uint32_t code;
+				uint8_t length;
+			};
+
 			HuffmanCodec();
 			std::shared_ptr<ov::Data> Encode(const ov::String &str);
 			bool Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str);
-			
-		private:
-			// Build Tree and Map
-			void Build(uint32_t code, uint8_t length, uint16_t symbol);
-			// Build Map for encoding from symbol to code
-			void BuildMap(uint32_t code, uint8_t length, uint16_t symbol);
-			// Build Tree for decoding from code to symbol
-			void BuildTree(uint32_t code, uint8_t length, uint16_t symbol);
-
-			class Node
-			{
-			public:
-				Node* GetLeft(bool create = false)
-				{
-					if (_left == nullptr && create == true)
-					{
-						_left = new Node();
-					}
+			bool Decode(const uint8_t *data, size_t length, ov::String &str);
 
-					return _left;
-				}
+			// https://www.rfc-editor.org/rfc/rfc7541.html#appendix-B (indexed by symbol)
+			static const std::array<Code, NUMBER_OF_SYMBOLS> &GetCodeTable();
 
-				Node* GetRight(bool create = false)
-				{
-					if (_right == nullptr && create == true)
-					{
-						_right = new Node();
-					}
+		private:
+			// The decoder is a finite state machine that consumes 4 bits at a time,
+			// like nghttp2 does. Each state is an internal node of the Huffman tree,
+			// and since the shortest code is 5 bits long, a nibble emits at most one symbol.
+			enum DecodeFlag : uint8_t
+			{
+				// A symbol is emitted while consuming the nibble
+				Symbol = 0x01,
+				// The bits consumed since the last symbol are a valid padding (EOS prefix, 7 bits or less),
+				// so the input may end in this state
+				Accepted = 0x02,
+				// EOS is decoded
+				Failure = 0x04,
+			};
 
-					return _right;
-				}
+			struct DecodeEntry
+			{
+				uint8_t next_state = 0;
+				uint8_t flags = 0;
+				uint8_t symbol = 0;
+			};
 
-				void SetValue(uint16_t value)
-				{
-					_value = value;
-					_is_leaf = true;
-				}
-				
-				uint16_t GetValue()
-				{
-					return _value;
-				}
+			// Number of internal nodes of the tree (NUMBER_OF_SYMBOLS - 1)
+			static constexpr size_t NUMBER_OF_STATES = 256;
 
-				bool IsLeaf()
-				{
-					return _is_leaf;
-				}
-				
-			private:
-				Node* _left = nullptr;
-				Node* _right = nullptr;
-				uint16_t _value = 0;
-				bool _is_leaf = false;
-			};
+			void BuildDecodeTable();
 
-			// 
-			Node* _tree = new Node();
-			std::unordered_map<uint8_t, std::pair<uint32_t, uint8_t>> _map;
+			std::array<std::array<DecodeEntry, 16>, NUMBER_OF_STATES> _decode_table;
 		};
 	}
-}
\ No newline at end of file
+}
@@ -80,6 +80,98 @@ namespace http
 			Index(HeaderField("vary", ""));
 			Index(HeaderField("via", ""));
 			Index(HeaderField("www-authenticate", ""));
+
+			BuildPerfectHash();
+		}
+
+		size_t StaticTable::HashName(const ov::String &name) const
+		{
+			uint32_t hash = 2166136261U;
+			auto data = name.CStr();
+			auto length = name.GetLength();
+
+			for (size_t i = 0; i < length; i++)
+			{
+				hash ^= static_cast<uint8_t>(::tolower(data[i]));
+				hash *= 16777619U;
+			}
+
+			// The low bits of FNV-1a do not depend on the high bits of the state,
+			// so mix in the seed and take the top 8 bits as the slot
+			return ((hash ^ _hash_seed) * 2654435761U) >> 24;
+		}
+
+		void StaticTable::BuildPerfectHash()
+		{
+			// Group consecutive entries that have the same name
+			std::vector<Slot> names;
+			for (size_t i = 0; i < _header_fields_table.size(); i++)
+			{
+				if ((names.empty() == false) && (_header_fields_table[i].GetName() == _header_fields_table[names.back().index - 1].GetName()))
+				{
+					names.back().count++;
+					continue;
+				}
+
+				names.push_back({static_cast<uint8_t>(i + 1), 1});
+			}
+
+			// Find a seed that maps every name to a distinct slot. The static table never changes,
+			// so this takes a few hundred tries at most, once per process.
+			for (_hash_seed = 0; _hash_seed < UINT32_MAX; _hash_seed++)
+			{
+				_slots.fill(Slot());
+
+				bool collided = false;
+				for (const auto &name : names)
+				{
+					auto &slot = _slots[HashName(_header_fields_table[name.index - 1].GetName())];
+					if (slot.count > 0)
+					{
+						collided = true;
+						break;
+					}
+
+					slot = name;
+				}
+
+				if (collided == false)
+				{
+					return;
+				}
+			}
+
+			OV_ASSERT(false, "Could not build a perfect hash of the static table");
+		}
+
+		std::tuple<bool, bool, uint32_t> StaticTable::LookupIndex(const HeaderField &header_field)
+		{
+			const auto &name = header_field.GetName();
+			const auto &slot = _slots[HashName(name)];
+
+			if (slot.count == 0)
+			{
+				return {false, false, 0};
+			}
+
+			// Names that are not in the table may land on an occupied slot
+			const auto &first_entry = _header_fields_table[slot.index - 1];
+			if ((first_entry.GetName().GetLength() != name.GetLength()) ||
+				(::strncasecmp(first_entry.GetName().CStr(), name.CStr(), name.GetLength()) != 0))
+			{
+				return {false, false, 0};
+			}
+
+			const auto &value = header_field.GetValue();
+			for (uint8_t i = 0; i < slot.count; i++)
+			{
+				if (_header_fields_table[slot.index - 1 + i].GetValue() == value)
+				{
+					return {true, true, slot.index + i};
+				}
+			}
+
+			return {true, false, slot.index};
 		}
 
 		bool StaticTable::Insert(const HeaderField &header_field)
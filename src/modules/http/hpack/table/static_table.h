@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include <array>
+
 #include "table.h"
 
 namespace http
@@ -18,9 +20,31 @@ namespace http
 		{
 		public:
 			StaticTable();
+
+			// Looks up the static table through a perfect hash of the name
+			// instead of the (name, name + value) maps of Table
+			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field) override;
+
 		private:
 			bool Insert(const HeaderField &header_field) override;
 			uint32_t CalcIndexNumber(uint32_t sequence, uint32_t table_size, uint32_t removed_item_count) override;
+
+			// Case-insensitive FNV-1a of the name mixed with _hash_seed (0 ~ NUMBER_OF_SLOTS - 1)
+			size_t HashName(const ov::String &name) const;
+			void BuildPerfectHash();
+
+			// Entries with the same name are consecutive in the static table,
+			// so each slot holds the first index and the number of entries of a name
+			struct Slot
+			{
+				uint8_t index = 0;
+				uint8_t count = 0;
+			};
+
+			static constexpr size_t NUMBER_OF_SLOTS = 256;
+
+			uint32_t _hash_seed = 0;
+			std::array<Slot, NUMBER_OF_SLOTS> _slots;
 		};
 	} // namespace hpack
 } // namespace http
\ No newline at end of file
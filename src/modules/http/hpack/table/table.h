@@ -74,7 +74,7 @@ namespace http
 			};
 
 			// Return: <Name indexed, Value indexed, Index Number>
-			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field)
+			virtual std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field)
 			{
 				// If name/value pair is matched in the table, return the index number.
 				auto it = _header_field_sequence_map.find(header_field.GetKey().CStr());
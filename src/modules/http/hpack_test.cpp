@@ -0,0 +1,252 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "hpack/huffman_codec.h"
+#include "hpack/table/static_table.h"
+
+namespace
+{
+	using http::hpack::HuffmanCodec;
+
+	// The bit-by-bit tree walking decoder HuffmanCodec used before the state machine.
+	// Kept as the reference implementation that the table-driven decoder is compared against.
+	class ReferenceHuffmanDecoder
+	{
+	public:
+		ReferenceHuffmanDecoder()
+		{
+			_nodes.emplace_back();
+
+			const auto &code_table = HuffmanCodec::GetCodeTable();
+			for (uint16_t symbol = 0; symbol < HuffmanCodec::NUMBER_OF_SYMBOLS; symbol++)
+			{
+				auto [code, length] = code_table[symbol];
+				size_t node = 0;
+
+				for (uint8_t i = 0; i < length; i++)
+				{
+					auto bit = (code >> (length - i - 1)) & 0x1;
+					if (_nodes[node].children[bit] < 0)
+					{
+						_nodes[node].children[bit] = static_cast<int32_t>(_nodes.size());
+						_nodes.emplace_back();
+					}
+					node = _nodes[node].children[bit];
+				}
+
+				_nodes[node].symbol = symbol;
+			}
+		}
+
+		bool Decode(const std::vector<uint8_t> &data, ov::String &str) const
+		{
+			size_t node = 0;
+
+			for (size_t i = 0; i < data.size() * 8; i++)
+			{
+				auto bit = (data[i / 8] >> (7 - (i % 8))) & 0x1;
+				auto next = _nodes[node].children[bit];
+				if (next < 0)
+				{
+					return false;
+				}
+				node = next;
+
+				if (_nodes[node].symbol >= 0)
+				{
+					if (_nodes[node].symbol == HuffmanCodec::EOS_SYMBOL)
+					{
+						return false;
+					}
+
+					str.Append(static_cast<char>(_nodes[node].symbol));
+					node = 0;
+				}
+			}
+
+			return true;
+		}
+
+	private:
+		struct Node
+		{
+			int32_t children[2] = {-1, -1};
+			int32_t symbol = -1;
+		};
+
+		std::vector<Node> _nodes;
+	};
+
+	std::vector<uint8_t> ToVector(const std::shared_ptr<ov::Data> &data)
+	{
+		auto bytes = data->GetDataAs<uint8_t>();
+		return std::vector<uint8_t>(bytes, bytes + data->GetLength());
+	}
+
+	bool Decode(const std::vector<uint8_t> &data, ov::String &str)
+	{
+		return HuffmanCodec::GetInstance()->Decode(data.data(), data.size(), str);
+	}
+}  // namespace
+
+// https://www.rfc-editor.org/rfc/rfc7541.html#appendix-C.4
+TEST(HpackHuffmanCodec, Rfc7541Examples)
+{
+	const std::vector<std::pair<ov::String, std::vector<uint8_t>>> examples = {
+		{"www.example.com", {0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff}},
+		{"no-cache", {0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf}},
+		{"custom-key", {0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xa9, 0x7d, 0x7f}},
+		{"custom-value", {0x25, 0xa8, 0x49, 0xe9, 0x5b, 0xb8, 0xe8, 0xb4, 0xbf}},
+	};
+
+	for (const auto &[text, encoded] : examples)
+	{
+		EXPECT_EQ(ToVector(HuffmanCodec::GetInstance()->Encode(text)), encoded) << text.CStr();
+
+		ov::String decoded;
+		ASSERT_TRUE(Decode(encoded, decoded)) << text.CStr();
+		EXPECT_EQ(decoded, text);
+	}
+}
+
+TEST(HpackHuffmanCodec, RoundTripMatchesReference)
+{
+	ReferenceHuffmanDecoder reference;
+	std::mt19937 random(7541);
+
+	for (int iteration = 0; iteration < 2000; iteration++)
+	{
+		ov::String text;
+		auto length = random() % 64;
+		for (size_t i = 0; i < length; i++)
+		{
+			// Covers every symbol including the 30-bit ones
+			text.Append(static_cast<char>(random() % 256));
+		}
+
+		auto encoded = ToVector(HuffmanCodec::GetInstance()->Encode(text));
+
+		ov::String decoded;
+		ov::String reference_decoded;
+		ASSERT_TRUE(Decode(encoded, decoded));
+		ASSERT_TRUE(reference.Decode(encoded, reference_decoded));
+
+		EXPECT_EQ(decoded.GetLength(), text.GetLength());
+		EXPECT_EQ(::memcmp(decoded.CStr(), text.CStr(), text.GetLength()), 0);
+		EXPECT_EQ(decoded, reference_decoded);
+	}
+}
+
+TEST(HpackHuffmanCodec, RandomInputAgreesWithReference)
+{
+	ReferenceHuffmanDecoder reference;
+	std::mt19937 random(1);
+
+	for (int iteration = 0; iteration < 5000; iteration++)
+	{
+		std::vector<uint8_t> data(1 + (random() % 16));
+		for (auto &byte : data)
+		{
+			byte = static_cast<uint8_t>(random());
+		}
+
+		ov::String decoded;
+		ov::String reference_decoded;
+		auto result = Decode(data, decoded);
+		auto reference_result = reference.Decode(data, reference_decoded);
+
+		// The state machine additionally rejects invalid padding, which the reference ignores
+		if (result)
+		{
+			ASSERT_TRUE(reference_result);
+			EXPECT_EQ(decoded, reference_decoded);
+		}
+		else
+		{
+			EXPECT_TRUE(decoded.IsEmpty());
+		}
+	}
+}
+
+TEST(HpackHuffmanCodec, RejectsInvalidPadding)
+{
+	ov::String decoded;
+
+	// 'a' (00011) followed by 3 bits of EOS prefix: valid
+	EXPECT_TRUE(Decode({0x1f}, decoded));
+	EXPECT_EQ(decoded, "a");
+
+	// 'a' followed by a padding that is not a prefix of EOS
+	decoded.Clear();
+	EXPECT_FALSE(Decode({0x1e}, decoded));
+
+	// A padding longer than 7 bits
+	decoded.Clear();
+	EXPECT_FALSE(Decode({0x1f, 0xff}, decoded));
+
+	// EOS itself (30 bits of 1)
+	decoded.Clear();
+	EXPECT_FALSE(Decode({0xff, 0xff, 0xff, 0xff}, decoded));
+}
+
+TEST(HpackHuffmanCodec, AppendsToExistingString)
+{
+	ov::String decoded = "prefix-";
+	ASSERT_TRUE(Decode({0xa8, 0xeb, 0x10, 0x64, 0x9c, 0xbf}, decoded));
+	EXPECT_EQ(decoded, "prefix-no-cache");
+
+	// The existing content is kept on failure
+	EXPECT_FALSE(Decode({0x1e}, decoded));
+	EXPECT_EQ(decoded, "prefix-no-cache");
+}
+
+TEST(HpackStaticTable, PerfectHashFindsEveryEntry)
+{
+	auto table = http::hpack::StaticTable::GetInstance();
+	ASSERT_EQ(table->GetNumberOfTableEntries(), 61u);
+
+	for (uint32_t index = 1; index <= table->GetNumberOfTableEntries(); index++)
+	{
+		http::hpack::HeaderField header_field;
+		ASSERT_TRUE(table->GetHeaderField(index, header_field));
+
+		auto [name_indexed, value_indexed, found_index] = table->LookupIndex(header_field);
+		EXPECT_TRUE(name_indexed);
+		EXPECT_TRUE(value_indexed);
+		EXPECT_EQ(found_index, index) << header_field.ToString().CStr();
+	}
+}
+
+TEST(HpackStaticTable, NameOnlyAndMissingLookups)
+{
+	auto table = http::hpack::StaticTable::GetInstance();
+
+	auto [status_name, status_value, status_index] = table->LookupIndex({":status", "206"});
+	EXPECT_TRUE(status_name);
+	EXPECT_TRUE(status_value);
+	EXPECT_EQ(status_index, 10u);
+
+	auto [code_name, code_value, code_index] = table->LookupIndex({":status", "302"});
+	EXPECT_TRUE(code_name);
+	EXPECT_FALSE(code_value);
+	EXPECT_EQ(code_index, 8u);
+
+	auto [type_name, type_value, type_index] = table->LookupIndex({"Content-Type", "video/mp4"});
+	EXPECT_TRUE(type_name);
+	EXPECT_FALSE(type_value);
+	EXPECT_EQ(type_index, 31u);
+
+	auto [missing_name, missing_value, missing_index] = table->LookupIndex({"x-ome-custom", "1"});
+	EXPECT_FALSE(missing_name);
+	EXPECT_FALSE(missing_value);
+	EXPECT_EQ(missing_index, 0u);
+}
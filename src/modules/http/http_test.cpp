@@ -2,15 +2,89 @@
 //
 //  OvenMediaEngine - Unit Tests
 //
-//  tests/modules/http/test_http_placeholder.cpp
-//  Covers: HTTP request/response parser, header handling
-//
-//  NOTE: Skeleton - expand with actual HTTP parsing test cases.
+//  src/modules/http/http_test.cpp
+//  Covers: HttpResponse::ParseByteRange ("Range" request header)
 //
 //==============================================================================
 #include <gtest/gtest.h>
 
-TEST(HttpPlaceholder, TodoImplementTests)
+#include <modules/http/server/http_response.h>
+
+namespace
+{
+	using RangeResult = http::svr::HttpResponse::RangeResult;
+
+	struct ByteRangeCase
+	{
+		const char *range;
+		size_t file_size;
+		RangeResult expected_result;
+		size_t expected_offset;
+		size_t expected_length;
+	};
+
+	// Offset and length are only checked for satisfiable ranges
+	const ByteRangeCase kByteRangeCases[] = {
+		// int-range
+		{"bytes=0-99", 1000, RangeResult::Satisfiable, 0, 100},
+		{"bytes=100-199", 1000, RangeResult::Satisfiable, 100, 100},
+		{" bytes=10-10 ", 1000, RangeResult::Satisfiable, 10, 1},
+		// last-pos past EOF is clamped
+		{"bytes=900-5000", 1000, RangeResult::Satisfiable, 900, 100},
+
+		// Open-ended ranges
+		{"bytes=0-", 1000, RangeResult::Satisfiable, 0, 1000},
+		{"bytes=999-", 1000, RangeResult::Satisfiable, 999, 1},
+
+		// Suffix ranges
+		{"bytes=-100", 1000, RangeResult::Satisfiable, 900, 100},
+		{"bytes=-5000", 1000, RangeResult::Satisfiable, 0, 1000},
+		{"bytes=-0", 1000, RangeResult::Unsatisfiable, 0, 0},
+		{"bytes=-10", 0, RangeResult::Unsatisfiable, 0, 0},
+
+		// Start past EOF
+		{"bytes=1000-", 1000, RangeResult::Unsatisfiable, 0, 0},
+		{"bytes=1000-1999", 1000, RangeResult::Unsatisfiable, 0, 0},
+		{"bytes=0-", 0, RangeResult::Unsatisfiable, 0, 0},
+
+		// Multiple ranges are not handled, so the whole file is sent
+		{"bytes=0-9,20-29", 1000, RangeResult::Ignored, 0, 0},
+		{"bytes=-10, -20", 1000, RangeResult::Ignored, 0, 0},
+
+		// Malformed or unsupported ranges are ignored
+		{"", 1000, RangeResult::Ignored, 0, 0},
+		{"items=0-9", 1000, RangeResult::Ignored, 0, 0},
+		{"bytes=10", 1000, RangeResult::Ignored, 0, 0},
+		{"bytes=-", 1000, RangeResult::Ignored, 0, 0},
+		{"bytes=20-10", 1000, RangeResult::Ignored, 0, 0},
+		{"bytes=a-10", 1000, RangeResult::Ignored, 0, 0},
+		{"bytes=+1-10", 1000, RangeResult::Ignored, 0, 0},
+
+		// Positions that overflow size_t
+		{"bytes=99999999999999999999999-", 1000, RangeResult::Unsatisfiable, 0, 0},
+		{"bytes=0-99999999999999999999999", 1000, RangeResult::Satisfiable, 0, 1000},
+		{"bytes=-99999999999999999999999", 1000, RangeResult::Satisfiable, 0, 1000},
+		{"bytes=18446744073709551615-18446744073709551615", 1000, RangeResult::Unsatisfiable, 0, 0},
+	};
+}  // namespace
+
+TEST(HttpResponse, ParseByteRange)
 {
-	GTEST_SKIP() << "HTTP module tests not yet implemented - see tests/modules/http/";
+	for (const auto &test_case : kByteRangeCases)
+	{
+		SCOPED_TRACE(ov::String::FormatString("range: \"%s\", file_size: %zu", test_case.range, test_case.file_size).CStr());
+
+		size_t offset = 0;
+		size_t length = test_case.file_size;
+
+		auto result = http::svr::HttpResponse::ParseByteRange(test_case.range, test_case.file_size, offset, length);
+
+		ASSERT_EQ(result, test_case.expected_result);
+
+		if (result == RangeResult::Satisfiable)
+		{
+			EXPECT_EQ(offset, test_case.expected_offset);
+			EXPECT_EQ(length, test_case.expected_length);
+		}
+	}
 }
@@ -112,9 +112,11 @@ namespace http
 				logtt("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
-				for (const auto &data : GetResponseDataList())
+
+				if (_chunked_transfer)
 				{
-					if (_chunked_transfer)
+					// Every piece becomes a chunk of its own, so small pieces are merged first
+					for (const auto &data : GetCoalescedResponseDataList(HTTP1_COALESCED_DATA_SIZE))
 					{
 						sent &= SendChunkedData(data);
 						if (sent == true)
@@ -127,18 +129,30 @@ namespace http
 							return -1;
 						}
 					}
+				}
+				else
+				{
+					// Over TLS, every piece becomes a record of its own. Plaintext pieces are sent as they are,
+					// the socket writes them together.
+					auto response_data_list = (GetTlsData() != nullptr)
+												  ? GetCoalescedResponseDataList(HTTP1_COALESCED_DATA_SIZE)
+												  : GetResponseDataList();
+
+					size_t data_size = 0;
+					for (const auto &data : response_data_list)
+					{
+						data_size += data->GetLength();
+					}
+
+					sent &= Send(response_data_list);
+					if (sent == true)
+					{
+						sent_bytes += data_size;
+					}
 					else
 					{
-						sent &= Send(data);
-						if (sent == true)
-						{
-							sent_bytes += data->GetLength();
-						}
-						else
-						{
-							logte("Could not send data : %zu bytes", data->GetLength());
-							return -1;
-						}
+						logte("Could not send data : %zu bytes", data_size);
+						return -1;
 					}
 				}
 
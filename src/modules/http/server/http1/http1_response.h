@@ -11,6 +11,10 @@
 
 #include "../http_response.h"
 
+// Small pieces of the response are merged up to this size before they are encrypted or chunked
+// (the maximum plaintext length of a TLS record)
+#define HTTP1_COALESCED_DATA_SIZE (16 * 1024)
+
 namespace http
 {
 	namespace svr
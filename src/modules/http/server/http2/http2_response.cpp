@@ -127,7 +127,8 @@ namespace http
 
 				uint32_t sent_bytes = 0;
 
-				auto response_data_list = GetResponseDataList();
+				// Every piece is sent in DATA frames of its own, so small pieces are merged first
+				auto response_data_list = GetCoalescedResponseDataList(MAX_HTTP2_DATA_SIZE);
 				for (size_t i = 0; i < response_data_list.size(); ++i)
 				{
 					const auto &data = response_data_list[i];
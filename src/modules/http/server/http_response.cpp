@@ -253,10 +253,145 @@ namespace http
 			return AppendData(string.ToData(false));
 		}
 
-		bool HttpResponse::AppendFile(const ov::String &filename)
+		bool HttpResponse::AppendFile(const ov::String &filename, const ov::String &range)
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			auto mapped_file = ov::MappedFileCache::GetInstance()->Get(filename);
+			if (mapped_file == nullptr)
+			{
+				logte("Could not open file: %s", filename.CStr());
+				return false;
+			}
+
+			auto file_size = mapped_file->GetSize();
+			size_t offset = 0;
+			size_t length = file_size;
+
+			SetHeader("Accept-Ranges", "bytes");
+
+			switch (ParseByteRange(range, file_size, offset, length))
+			{
+				case RangeResult::Ignored:
+					break;
+
+				case RangeResult::Satisfiable:
+					SetStatusCode(StatusCode::PartialContent);
+					SetHeader("Content-Range", ov::String::FormatString("bytes %zu-%zu/%zu", offset, offset + length - 1, file_size));
+					break;
+
+				case RangeResult::Unsatisfiable:
+					// https://www.rfc-editor.org/rfc/rfc9110#section-15.5.17
+					SetStatusCode(StatusCode::RangeNotSatisfiable);
+					SetHeader("Content-Range", ov::String::FormatString("bytes */%zu", file_size));
+					return true;
+			}
+
+			return AppendData(mapped_file->GetData(offset, length));
+		}
+
+		HttpResponse::RangeResult HttpResponse::ParseByteRange(const ov::String &range, size_t file_size, size_t &offset, size_t &length)
+		{
+			// https://www.rfc-editor.org/rfc/rfc9110#section-14.1.2
+			//   ranges-specifier = range-unit "=" range-set
+			//   int-range        = first-pos "-" [ last-pos ]
+			//   suffix-range     = "-" suffix-length
+			auto trimmed = range.Trim();
+			if ((trimmed.HasPrefix("bytes=") == false) || (trimmed.IndexOf(',') >= 0))
+			{
+				return RangeResult::Ignored;
+			}
+
+			auto spec = trimmed.Substring(6).Trim();
+			auto dash = spec.IndexOf('-');
+			if (dash < 0)
+			{
+				return RangeResult::Ignored;
+			}
+
+			auto first_pos = spec.Substring(0, dash).Trim();
+			auto last_pos = spec.Substring(dash + 1).Trim();
+
+			auto is_number = [](const ov::String &value) -> bool {
+				if (value.IsEmpty())
+				{
+					return false;
+				}
+
+				for (size_t i = 0; i < value.GetLength(); i++)
+				{
+					if (::isdigit(static_cast<unsigned char>(value[i])) == 0)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			};
+
+			// Saturates at SIZE_MAX, which is past the end of any file
+			auto to_size = [](const ov::String &value) -> size_t {
+				size_t result = 0;
+
+				for (size_t i = 0; i < value.GetLength(); i++)
+				{
+					auto digit = static_cast<size_t>(value[i] - '0');
+
+					if (result > ((SIZE_MAX - digit) / 10))
+					{
+						return SIZE_MAX;
+					}
+
+					result = (result * 10) + digit;
+				}
+
+				return result;
+			};
+
+			if (first_pos.IsEmpty())
+			{
+				// suffix-range: the last <suffix-length> bytes
+				if (is_number(last_pos) == false)
+				{
+					return RangeResult::Ignored;
+				}
+
+				auto suffix_length = to_size(last_pos);
+				if ((suffix_length == 0) || (file_size == 0))
+				{
+					return RangeResult::Unsatisfiable;
+				}
+
+				length = std::min(suffix_length, file_size);
+				offset = file_size - length;
+
+				return RangeResult::Satisfiable;
+			}
+
+			if ((is_number(first_pos) == false) || ((last_pos.IsEmpty() == false) && (is_number(last_pos) == false)))
+			{
+				return RangeResult::Ignored;
+			}
+
+			auto first = to_size(first_pos);
+			// An open-ended range runs to the end of the file
+			auto last = last_pos.IsEmpty() ? SIZE_MAX : to_size(last_pos);
+
+			if (last < first)
+			{
+				// An invalid range-spec is ignored
+				return RangeResult::Ignored;
+			}
+
+			if (first >= file_size)
+			{
+				return RangeResult::Unsatisfiable;
+			}
+
+			last = std::min(last, file_size - 1);
+
+			offset = first;
+			length = last - first + 1;
+
+			return RangeResult::Satisfiable;
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -278,6 +413,62 @@ namespace http
 			return _response_data_list;
 		}
 
+		std::vector<std::shared_ptr<const ov::Data>> HttpResponse::GetCoalescedResponseDataList(size_t max_piece_size) const
+		{
+			auto response_data_list = GetResponseDataList();
+
+			std::vector<std::shared_ptr<const ov::Data>> coalesced_data_list;
+			coalesced_data_list.reserve(response_data_list.size());
+
+			// Pieces waiting to be merged
+			std::vector<std::shared_ptr<const ov::Data>> pending_list;
+			size_t pending_size = 0;
+
+			auto flush_pending = [&]() {
+				if (pending_list.size() == 1)
+				{
+					coalesced_data_list.push_back(pending_list.front());
+				}
+				else if (pending_list.size() > 1)
+				{
+					auto merged_data = std::make_shared<ov::Data>(pending_size);
+
+					for (const auto &pending_data : pending_list)
+					{
+						merged_data->Append(pending_data);
+					}
+
+					coalesced_data_list.push_back(merged_data);
+				}
+
+				pending_list.clear();
+				pending_size = 0;
+			};
+
+			for (const auto &data : response_data_list)
+			{
+				if (data->GetLength() >= max_piece_size)
+				{
+					// Large pieces are passed as they are
+					flush_pending();
+					coalesced_data_list.push_back(data);
+					continue;
+				}
+
+				if ((pending_size + data->GetLength()) > max_piece_size)
+				{
+					flush_pending();
+				}
+
+				pending_list.push_back(data);
+				pending_size += data->GetLength();
+			}
+
+			flush_pending();
+
+			return coalesced_data_list;
+		}
+
 		// Get Response Header
 		std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> HttpResponse::GetResponseHeaderList() const
 		{
@@ -436,6 +627,24 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+		{
+			if (GetTlsData() == nullptr)
+			{
+				return _client_socket->Send(data_list);
+			}
+
+			for (const auto &data : data_list)
+			{
+				if (Send(data) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
@@ -55,7 +55,24 @@ namespace http
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
 			bool AppendString(const ov::String &string);
-			bool AppendFile(const ov::String &filename);
+			// Appends a file without reading it into the heap. Plaintext HTTP/1.1 sends it with sendfile(),
+			// TLS and HTTP/2 read the memory-mapped pages. The file must be replaced, not truncated in place,
+			// while it is being served.
+			//
+			// <range> is the "Range" request header (a single byte range is honored). Sets 206 Partial Content
+			// with Content-Range, or 416 Range Not Satisfiable.
+			bool AppendFile(const ov::String &filename, const ov::String &range = "");
+
+			enum class RangeResult
+			{
+				// No range, or a range this server does not handle (multiple ranges, other units): send the whole file
+				Ignored,
+				Satisfiable,
+				Unsatisfiable
+			};
+			// Parses a "Range" header against a file of <file_size> bytes. Positions too large to be
+			// represented are treated as past the end of the file.
+			static RangeResult ParseByteRange(const ov::String &range, size_t file_size, size_t &offset, size_t &length);
 
 			int32_t Response();
 
@@ -77,6 +94,10 @@ namespace http
 			
 			// Get Response Data List
 			std::vector<std::shared_ptr<const ov::Data>> GetResponseDataList() const;
+			// Same as GetResponseDataList(), but consecutive pieces smaller than <max_piece_size> are merged into
+			// pieces of up to <max_piece_size> bytes. Used where each piece costs a TLS record, a chunk or a frame
+			// (e.g. an fMP4 segment is appended as one piece per sample).
+			std::vector<std::shared_ptr<const ov::Data>> GetCoalescedResponseDataList(size_t max_piece_size) const;
 			// Get Response Header
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> GetResponseHeaderList() const;
 			void ResetResponseData();
@@ -89,6 +110,8 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+			// Sends the pieces in order. Plaintext pieces are handed to the socket together, so it can write them at once.
+			virtual bool Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
 			
 		private:
 			virtual int32_t SendHeader();
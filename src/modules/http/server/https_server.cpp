@@ -37,12 +37,20 @@ namespace http
 				.verify_callback = nullptr,
 				.sni_callback = std::bind(&HttpsServer::HandleSniCallback, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)};
 
+			// Every context of the virtual host shares the ticket keys, so a session can be resumed on any port
+			auto &session_ticket_config = certificate->GetSessionTicketConfig();
+			ov::TlsSessionResumption session_resumption = {
+				.ticket_keys = ov::TlsTicketKeyManager::GetInstance()->GetKeys(certificate->GetName(), static_cast<int64_t>(session_ticket_config.GetRotationInterval()) * 1000),
+				.enable_session_ticket = session_ticket_config.IsEnabled(),
+				.enable_early_data = session_ticket_config.IsEarlyDataEnabled()};
+
 			std::shared_ptr<const ov::Error> error;
 			auto tls_context = ov::TlsContext::CreateServerContext(
 				ov::TlsMethod::Tls, certificate->GetCertificate(),
 				HTTP_FAST_NOT_VERY_SECURE,
 				IsHttp2Enabled(),
 				true,
+				&session_resumption,
 				&tls_context_callback,
 				&error);
 
@@ -145,9 +153,9 @@ namespace http
 				if (tls_data->Decrypt(data, &plain_data))
 				{
 					if (prev_tls_state == ov::TlsServerData::State::WaitingForAccept &&
-						tls_data->GetState() == ov::TlsServerData::State::Accepted)
+						tls_data->GetState() != ov::TlsServerData::State::WaitingForAccept)
 					{
-						// The client has accepted the connection
+						// The client has accepted the connection, or early data has been accepted
 						connection->OnTlsAccepted();
 					}
 
@@ -0,0 +1,185 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "ice_address_pair_table.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "ice_session.h"
+
+struct IceAddressPairTable::ReaderCache
+{
+	struct CachedShard
+	{
+		uint64_t version = 0;
+		std::shared_ptr<const Snapshot> snapshot;
+	};
+
+	uint64_t table_id = 0;
+	CachedShard shards[SHARD_COUNT];
+};
+
+namespace
+{
+	uint64_t IssueTableId()
+	{
+		static std::atomic<uint64_t> last_table_id{0};
+
+		return ++last_table_id;
+	}
+
+	template <typename Tentry>
+	auto LowerBound(const std::vector<Tentry> &snapshot, size_t hash)
+	{
+		return std::lower_bound(snapshot.begin(), snapshot.end(), hash, [](const Tentry &entry, size_t value) {
+			return entry.hash < value;
+		});
+	}
+}  // namespace
+
+IceAddressPairTable::IceAddressPairTable()
+	: _table_id(IssueTableId())
+{
+	auto empty_snapshot = std::make_shared<const Snapshot>();
+
+	for (auto &shard : _shards)
+	{
+		std::atomic_store(&shard.snapshot, empty_snapshot);
+		// Cached versions start at 0, so every thread loads the snapshot once
+		shard.version.store(1, std::memory_order_release);
+	}
+}
+
+bool IceAddressPairTable::Add(const ov::SocketAddressPair &pair, const std::shared_ptr<IceSession> &session)
+{
+	auto hash = pair.Hash();
+	auto &shard = _shards[GetShardIndex(hash)];
+
+	ov::LockGuard lock_guard(shard.mutex);
+
+	auto current = std::atomic_load(&shard.snapshot);
+	auto position = LowerBound(*current, hash);
+	auto replace = current->end();
+
+	for (auto item = position; (item != current->end()) && (item->hash == hash); ++item)
+	{
+		if (item->pair == pair)
+		{
+			if (item->session.expired() == false)
+			{
+				return false;
+			}
+
+			// The session went away without being removed
+			replace = item;
+			break;
+		}
+	}
+
+	auto next = std::make_shared<Snapshot>();
+	next->reserve(current->size() + 1);
+
+	if (replace != current->end())
+	{
+		next->assign(current->begin(), current->end());
+		(*next)[replace - current->begin()].session = session;
+	}
+	else
+	{
+		next->insert(next->end(), current->begin(), position);
+		next->push_back(Entry{hash, pair, session});
+		next->insert(next->end(), position, current->end());
+	}
+
+	std::atomic_store(&shard.snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+	shard.version.fetch_add(1, std::memory_order_release);
+
+	return true;
+}
+
+void IceAddressPairTable::Remove(const std::shared_ptr<IceSession> &session)
+{
+	auto matches = [&session](const Entry &entry) -> bool {
+		auto entry_session = entry.session.lock();
+		return (entry_session == nullptr) || (entry_session == session);
+	};
+
+	for (auto &shard : _shards)
+	{
+		ov::LockGuard lock_guard(shard.mutex);
+
+		auto current = std::atomic_load(&shard.snapshot);
+		if (std::none_of(current->begin(), current->end(), matches))
+		{
+			continue;
+		}
+
+		auto next = std::make_shared<Snapshot>();
+		next->reserve(current->size());
+		std::copy_if(current->begin(), current->end(), std::back_inserter(*next), [&matches](const Entry &entry) {
+			return matches(entry) == false;
+		});
+
+		std::atomic_store(&shard.snapshot, std::shared_ptr<const Snapshot>(std::move(next)));
+		shard.version.fetch_add(1, std::memory_order_release);
+	}
+}
+
+std::shared_ptr<IceSession> IceAddressPairTable::Find(const ov::SocketAddressPair &pair) const
+{
+	auto hash = pair.Hash();
+	const auto &snapshot = GetSnapshot(GetShardIndex(hash));
+
+	for (auto item = LowerBound(snapshot, hash); (item != snapshot.end()) && (item->hash == hash); ++item)
+	{
+		if (item->pair == pair)
+		{
+			return item->session.lock();
+		}
+	}
+
+	return nullptr;
+}
+
+size_t IceAddressPairTable::GetCount() const
+{
+	size_t count = 0;
+
+	for (auto &shard : _shards)
+	{
+		count += std::atomic_load(&shard.snapshot)->size();
+	}
+
+	return count;
+}
+
+const IceAddressPairTable::Snapshot &IceAddressPairTable::GetSnapshot(size_t shard_index) const
+{
+	thread_local ReaderCache cache;
+
+	if (cache.table_id != _table_id)
+	{
+		// Another table was used last on this thread
+		cache = ReaderCache();
+		cache.table_id = _table_id;
+	}
+
+	auto &shard = _shards[shard_index];
+	auto &cached_shard = cache.shards[shard_index];
+
+	auto version = shard.version.load(std::memory_order_acquire);
+	if (cached_shard.version != version)
+	{
+		// The snapshot is stored before the version is increased, so this one is at least as new
+		cached_shard.snapshot = std::atomic_load(&shard.snapshot);
+		cached_shard.version = version;
+	}
+
+	return *cached_shard.snapshot;
+}
@@ -0,0 +1,84 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket_address_pair.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class IceSession;
+
+// Address pair -> IceSession table looked up for every datagram on the receive path.
+//
+// The table is split into shards by the hash of the address pair. Each shard publishes an
+// immutable snapshot (sorted by hash) together with a version number, and writers replace
+// the snapshot of one shard under that shard's lock (copy-on-write).
+//
+// Readers keep the snapshots they used in a per-thread cache, so each socket worker thread
+// works on its own copy: a lookup loads the version of one shard, and only touches shared
+// state again after that shard has been modified (RCU-like: an old snapshot is freed when the
+// last worker that cached it moves on). Sessions are held weakly, so a cached snapshot does
+// not keep a removed session alive.
+class IceAddressPairTable
+{
+public:
+	static constexpr size_t SHARD_COUNT = 64;
+
+	IceAddressPairTable();
+
+	// Returns false if the pair is already registered
+	bool Add(const ov::SocketAddressPair &pair, const std::shared_ptr<IceSession> &session);
+
+	// Removes every pair registered for <session>
+	void Remove(const std::shared_ptr<IceSession> &session);
+
+	std::shared_ptr<IceSession> Find(const ov::SocketAddressPair &pair) const;
+
+	size_t GetCount() const;
+
+private:
+	struct Entry
+	{
+		size_t hash;
+		ov::SocketAddressPair pair;
+		std::weak_ptr<IceSession> session;
+	};
+
+	using Snapshot = std::vector<Entry>;
+
+	struct alignas(64) Shard
+	{
+		// Serializes writers of this shard
+		ov::Mutex mutex;
+
+		// Accessed with std::atomic_load()/std::atomic_store()
+		std::shared_ptr<const Snapshot> snapshot;
+		// Increased after a new snapshot is stored
+		std::atomic<uint64_t> version{0};
+	};
+
+	// Snapshots a thread has looked up, see GetSnapshot()
+	struct ReaderCache;
+
+	static size_t GetShardIndex(size_t hash)
+	{
+		return hash & (SHARD_COUNT - 1);
+	}
+
+	// Returns the snapshot of the shard cached by the calling thread, refreshed if the shard has changed
+	const Snapshot &GetSnapshot(size_t shard_index) const;
+
+	// Distinguishes tables in the per-thread cache
+	const uint64_t _table_id;
+
+	mutable Shard _shards[SHARD_COUNT];
+};
@@ -0,0 +1,144 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <base/ovsocket/ovsocket.h>
+#include <modules/sdp/session_description.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ice_address_pair_table.h"
+#include "ice_session.h"
+
+namespace
+{
+	ov::SocketAddressPair Pair(uint16_t local_port, uint16_t remote_port)
+	{
+		return ov::SocketAddressPair(
+			ov::SocketAddress::CreateAndGetFirst("127.0.0.1", local_port),
+			ov::SocketAddress::CreateAndGetFirst("127.0.0.1", remote_port));
+	}
+
+	std::shared_ptr<IceSession> MakeSession(session_id_t id)
+	{
+		auto sdp = std::make_shared<SessionDescription>(SessionDescription::SdpType::Offer);
+		sdp->SetIceUfrag(ov::String::FormatString("ufrag%u", id));
+		return std::make_shared<IceSession>(
+			id, IceSession::Role::CONTROLLED, sdp, sdp, 600000, 0, std::any{}, nullptr);
+	}
+}  // namespace
+
+TEST(IceAddressPairTable, AddFindRemove)
+{
+	IceAddressPairTable table;
+	auto s1 = MakeSession(1);
+	auto s2 = MakeSession(2);
+
+	EXPECT_TRUE(table.Add(Pair(10000, 20000), s1));
+	EXPECT_TRUE(table.Add(Pair(10000, 20001), s1));
+	EXPECT_TRUE(table.Add(Pair(10000, 30000), s2));
+	EXPECT_FALSE(table.Add(Pair(10000, 20000), s2));
+
+	EXPECT_EQ(table.Find(Pair(10000, 20000)), s1);
+	EXPECT_EQ(table.Find(Pair(10000, 20001)), s1);
+	EXPECT_EQ(table.Find(Pair(10000, 30000)), s2);
+	EXPECT_EQ(table.Find(Pair(10001, 20000)), nullptr);
+	EXPECT_EQ(table.GetCount(), 3u);
+
+	table.Remove(s1);
+
+	EXPECT_EQ(table.Find(Pair(10000, 20000)), nullptr);
+	EXPECT_EQ(table.Find(Pair(10000, 20001)), nullptr);
+	EXPECT_EQ(table.Find(Pair(10000, 30000)), s2);
+	EXPECT_EQ(table.GetCount(), 1u);
+}
+
+// The table holds sessions weakly: a session that went away is not found, and its pair can be reused
+TEST(IceAddressPairTable, ExpiredSessionIsReplaced)
+{
+	IceAddressPairTable table;
+	auto s1 = MakeSession(1);
+
+	ASSERT_TRUE(table.Add(Pair(10000, 20000), s1));
+	s1.reset();
+
+	EXPECT_EQ(table.Find(Pair(10000, 20000)), nullptr);
+
+	auto s2 = MakeSession(2);
+	EXPECT_TRUE(table.Add(Pair(10000, 20000), s2));
+	EXPECT_EQ(table.Find(Pair(10000, 20000)), s2);
+	EXPECT_EQ(table.GetCount(), 1u);
+}
+
+// A reader thread keeps its snapshots cached, and must pick up every change made by another thread
+TEST(IceAddressPairTable, ReadersSeeChangesOfWriters)
+{
+	IceAddressPairTable table;
+	constexpr int COUNT = 500;
+
+	std::vector<std::shared_ptr<IceSession>> sessions;
+	for (int index = 0; index < COUNT; index++)
+	{
+		sessions.push_back(MakeSession(index));
+	}
+
+	std::atomic<int> added_count{0};
+	std::atomic<bool> wrong_session{false};
+
+	std::thread reader([&] {
+		int found_count = 0;
+
+		while (found_count < COUNT)
+		{
+			auto available = added_count.load();
+
+			for (found_count = 0; found_count < available; found_count++)
+			{
+				auto session = table.Find(Pair(10000, 20000 + found_count));
+				if (session != sessions[found_count])
+				{
+					wrong_session = true;
+					return;
+				}
+			}
+		}
+	});
+
+	for (int index = 0; index < COUNT; index++)
+	{
+		ASSERT_TRUE(table.Add(Pair(10000, 20000 + index), sessions[index]));
+		added_count++;
+	}
+
+	reader.join();
+
+	EXPECT_FALSE(wrong_session.load());
+
+	for (int index = 0; index < COUNT; index += 2)
+	{
+		table.Remove(sessions[index]);
+	}
+
+	std::thread checker([&] {
+		for (int index = 0; index < COUNT; index++)
+		{
+			auto expected = ((index % 2) == 0) ? nullptr : sessions[index];
+			if (table.Find(Pair(10000, 20000 + index)) != expected)
+			{
+				wrong_session = true;
+			}
+		}
+	});
+	checker.join();
+
+	EXPECT_FALSE(wrong_session.load());
+	EXPECT_EQ(table.GetCount(), static_cast<size_t>(COUNT / 2));
+}
@@ -292,15 +292,7 @@ bool IcePort::AddIceSession(const ov::String &local_ufrag, const std::shared_ptr
 
 bool IcePort::AddIceSession(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(address_pair);
-	if (item == _ice_sessions_with_address_pair.end())
-	{
-		_ice_sessions_with_address_pair.emplace(address_pair, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_address_pair.Add(address_pair, ice_session);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(session_id_t session_id)
@@ -329,14 +321,7 @@ std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::String &local_ufra
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::SocketAddressPair &socket_address_pair)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(socket_address_pair);
-	if (item != _ice_sessions_with_address_pair.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_address_pair.Find(socket_address_pair);
 }
 
 session_id_t IcePort::IssueUniqueSessionId()
@@ -422,19 +407,8 @@ bool IcePort::RemoveSession(session_id_t session_id)
 
 	// Erase every pair registered for this session, not just the connected one
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-		for (auto it = _ice_sessions_with_address_pair.begin(); it != _ice_sessions_with_address_pair.end();)
-		{
-			if (it->second == ice_session)
-			{
-				it = _ice_sessions_with_address_pair.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.size();
+		_ice_sessions_with_address_pair.Remove(ice_session);
+		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.GetCount();
 	}
 
 	{
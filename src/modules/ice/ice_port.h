@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "ice_address_pair_table.h"
 #include "ice_session.h"
 #include "ice_port_observer.h"
 #include "ice_tcp_demultiplexer.h"
@@ -227,10 +228,10 @@ private:
 	std::shared_mutex _ice_sessions_with_ufrag_lock;
 	std::map<const ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
 	
-	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data
+	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data.
+	// Looked up for every datagram, so the socket workers read it without taking a lock
 	// key: SocketAddressPair
-	std::shared_mutex _ice_sessions_with_address_pair_lock;
-	std::map<ov::SocketAddressPair, std::shared_ptr<IceSession>> _ice_sessions_with_address_pair;
+	IceAddressPairTable _ice_sessions_with_address_pair;
 	
 	// Find IceSession with peer's session id, used for sending application data 
 	std::shared_mutex _ice_sessions_with_id_lock;
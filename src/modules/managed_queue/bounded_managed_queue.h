@@ -0,0 +1,679 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "managed_queue.h"
+
+#define BOUNDED_MANAGED_QUEUE_DEFAULT_CAPACITY 4096
+#define BOUNDED_MANAGED_QUEUE_URGENT_CAPACITY 256
+
+namespace ov
+{
+	enum class QueueProducerMode : uint8_t
+	{
+		// Only one thread enqueues at a time
+		Single,
+		// Any number of threads enqueue concurrently
+		Multi
+	};
+
+	// Lock-free counterpart of ManagedQueue for the hand-offs between pipeline stages.
+	//
+	// - Items live in a ring of preallocated cells, so Enqueue() and Dequeue() do not allocate.
+	//   Producers claim cells with a CAS (Multi) or a plain store (Single); the consumer never locks.
+	// - The consumer sleeps on a condition variable only when the queue is empty, and producers
+	//   take the lock to wake it only while it sleeps. The same holds for producers waiting for room.
+	// - One in MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL items is timestamped for the dwell statistics.
+	// - Urgent items go to a small ring of their own, which the consumer drains first.
+	//
+	// Differences from ManagedQueue:
+	// - Dequeue() must be called from one thread at a time (single consumer).
+	// - The ring has a fixed capacity. As ManagedQueue never loses an item, Enqueue() waits for
+	//   room by default when the ring is full. Dropping is opt-in: with an explicit timeout, the
+	//   item is dropped and counted once it expires (right away for 0), and Enqueue() returns false.
+	// - Front(), Back() and the buffering delay are not supported.
+	// - Clear() is carried out by the consumer on its next Dequeue() (or by the destructor).
+	//
+	// Shutdown order is the same as ManagedQueue: Stop() -> join threads -> delete queue.
+	template <typename T, QueueProducerMode producer_mode = QueueProducerMode::Multi>
+	class BoundedManagedQueue : public info::ManagedQueue
+	{
+		static_assert(std::is_default_constructible_v<T>, "Items are kept in preallocated cells");
+
+	private:
+		const char *LOG_TAG = "ManagedQueue";
+
+		static constexpr size_t CACHE_LINE_SIZE = 64;
+
+		class Ring
+		{
+		public:
+			explicit Ring(size_t capacity)
+			{
+				// A cell of a ring of one would look free again as soon as it is published
+				size_t ring_capacity = 2;
+				while (ring_capacity < capacity)
+				{
+					ring_capacity <<= 1;
+				}
+
+				_cells = std::make_unique<Cell[]>(ring_capacity);
+				_mask = ring_capacity - 1;
+
+				for (size_t index = 0; index < ring_capacity; index++)
+				{
+					_cells[index].sequence.store(index, std::memory_order_relaxed);
+				}
+			}
+
+			size_t GetCapacity() const
+			{
+				return _mask + 1;
+			}
+
+			// Called by producers. <item> is moved only if it is pushed.
+			bool Push(T &item)
+			{
+				size_t position = _tail.load(std::memory_order_relaxed);
+				Cell *cell = nullptr;
+
+				if constexpr (producer_mode == QueueProducerMode::Single)
+				{
+					cell = &_cells[position & _mask];
+
+					if (cell->sequence.load(std::memory_order_acquire) != position)
+					{
+						return false;
+					}
+
+					_tail.store(position + 1, std::memory_order_relaxed);
+				}
+				else
+				{
+					while (true)
+					{
+						cell = &_cells[position & _mask];
+
+						auto sequence = cell->sequence.load(std::memory_order_acquire);
+						auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+						if (diff == 0)
+						{
+							if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+							{
+								break;
+							}
+						}
+						else if (diff < 0)
+						{
+							// The consumer has not released this cell yet: full
+							return false;
+						}
+						else
+						{
+							position = _tail.load(std::memory_order_relaxed);
+						}
+					}
+				}
+
+				cell->data = std::move(item);
+
+				if ((position & (MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL - 1)) == 0)
+				{
+					cell->enqueued_at = std::chrono::steady_clock::now();
+				}
+
+				cell->sequence.store(position + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			// Called by the consumer. <enqueued_at> is left empty for items that are not sampled.
+			bool Pop(T &item, std::chrono::steady_clock::time_point &enqueued_at)
+			{
+				auto &cell = _cells[_head & _mask];
+
+				if (cell.sequence.load(std::memory_order_acquire) != (_head + 1))
+				{
+					return false;
+				}
+
+				item = std::move(cell.data);
+				// Release what the moved-from item may still hold
+				cell.data = T();
+				enqueued_at = std::exchange(cell.enqueued_at, std::chrono::steady_clock::time_point());
+
+				cell.sequence.store(_head + _mask + 1, std::memory_order_release);
+				_head++;
+
+				return true;
+			}
+
+			// Called by the consumer
+			bool HasItem() const
+			{
+				return _cells[_head & _mask].sequence.load(std::memory_order_acquire) == (_head + 1);
+			}
+
+		private:
+			struct Cell
+			{
+				// position + 1 once the item of <position> is published,
+				// position + capacity once the consumer has released the cell
+				std::atomic<size_t> sequence{0};
+				std::chrono::steady_clock::time_point enqueued_at;
+				T data{};
+			};
+
+			std::unique_ptr<Cell[]> _cells;
+			size_t _mask = 0;
+
+			// Written by producers and read by the consumer on separate cache lines
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail{0};
+			alignas(CACHE_LINE_SIZE) size_t _head = 0;
+		};
+
+	public:
+		BoundedManagedQueue()
+			: BoundedManagedQueue(nullptr) {}
+
+		BoundedManagedQueue(std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, size_t capacity = BOUNDED_MANAGED_QUEUE_DEFAULT_CAPACITY, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC)
+			: info::ManagedQueue(threshold),
+			  _ring(std::max(capacity, threshold)),
+			  _urgent_ring(BOUNDED_MANAGED_QUEUE_URGENT_CAPACITY),
+			  _stats_metric_interval(MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC),
+			  _log_interval(log_interval_in_msec)
+		{
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			SetId(IssueUniqueQueueId());
+
+			if (MonitorInstance->OnQueueCreated(*this) == false)
+			{
+				logw(LOG_TAG, "Failed to register queue to monitor. id:%u", GetId());
+			}
+		}
+
+		~BoundedManagedQueue()
+		{
+			Stop();
+
+			// No thread uses the queue anymore
+			DrainItems();
+
+			MonitorInstance->OnQueueDeleted(*this);
+		}
+
+		void SetUrn(std::shared_ptr<info::ManagedQueue::URN> urn)
+		{
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			MonitorInstance->OnQueueUpdated(*this, true);
+		}
+
+		void SetThreshold(size_t threshold)
+		{
+			info::ManagedQueue::SetThreshold(threshold);
+
+			MonitorInstance->OnQueueUpdated(*this);
+		}
+
+		void SetThresholdByTime(size_t time_ms)
+		{
+			info::ManagedQueue::SetThresholdByTime(time_ms);
+
+			MonitorInstance->OnQueueUpdated(*this);
+		}
+
+		// Urgent items are dequeued before the others.
+		// <timeout> is how long to wait while the ring is full (or over the threshold with exceed-wait enabled).
+		// By default the producer waits until there is room or the queue is stopped. A producer that
+		// would rather lose the item than wait passes a timeout, or 0 to drop it right away.
+		//
+		// Returns false if the item is dropped
+		bool Enqueue(T item, bool urgent = false, int timeout = Infinite)
+		{
+			if (_stop.load(std::memory_order_acquire))
+			{
+				return false;
+			}
+
+			auto &ring = urgent ? _urgent_ring : _ring;
+
+			// Counted before the push, so the consumer never sees an item that is not counted yet
+			auto size = _size.fetch_add(1, std::memory_order_relaxed) + 1;
+
+			bool pushed = false;
+			if (_exceed_threshold_and_wait_enabled.load(std::memory_order_relaxed) == false)
+			{
+				pushed = ring.Push(item);
+			}
+
+			if (pushed == false)
+			{
+				// A timeout of 0 drops the item without taking the slow path
+				bool can_wait = (timeout != 0) || _exceed_threshold_and_wait_enabled.load(std::memory_order_relaxed);
+
+				if ((can_wait == false) || (WaitAndPush(ring, item, timeout) == false))
+				{
+					_size.fetch_sub(1, std::memory_order_relaxed);
+					_drop_message_count.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+			}
+
+			auto peak = _peak.load(std::memory_order_relaxed);
+			while ((peak < size) && (_peak.compare_exchange_weak(peak, size, std::memory_order_relaxed) == false))
+			{
+			}
+
+			WakeConsumer();
+
+			return true;
+		}
+
+		std::optional<T> Dequeue(int timeout = Infinite)
+		{
+			std::chrono::steady_clock::time_point deadline;
+			bool deadline_set = false;
+
+			while (true)
+			{
+				if (_clear_requested.load(std::memory_order_acquire))
+				{
+					DrainItems();
+				}
+
+				if (_stop.load(std::memory_order_acquire))
+				{
+					return {};	// Stop is requested
+				}
+
+				// Same as ManagedQueue::InjectWakeup(): consumed before looking at the items
+				if (_pending_wakeup.load(std::memory_order_relaxed) && _pending_wakeup.exchange(false, std::memory_order_acq_rel))
+				{
+					return {};
+				}
+
+				T item;
+				if (TryPop(item))
+				{
+					return item;
+				}
+
+				if (timeout == 0)
+				{
+					return {};
+				}
+
+				if (deadline_set == false)
+				{
+					deadline = (timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+					deadline_set = true;
+				}
+
+				// The queue is idle, a good time to publish the statistics
+				UpdateMetrics();
+
+				if (WaitForItem(deadline) == false)
+				{
+					return {};	// timed out
+				}
+			}
+		}
+
+		bool IsEmpty() const
+		{
+			return (_size.load(std::memory_order_relaxed) == 0);
+		}
+
+		size_t Size() const
+		{
+			return _size.load(std::memory_order_relaxed);
+		}
+
+		size_t GetCapacity() const
+		{
+			return _ring.GetCapacity();
+		}
+
+		bool IsThresholdExceededFor(std::chrono::milliseconds duration) const
+		{
+			return _threshold_exceeded_time_ms.load(std::memory_order_acquire) >= static_cast<int64_t>(duration.count());
+		}
+
+		// Items are released by the consumer on its next Dequeue(), or by the destructor
+		void Clear()
+		{
+			_clear_requested.store(true, std::memory_order_release);
+
+			LockGuard lock_guard(_mutex);
+			_consumer_condition.NotifyAll();
+		}
+
+		void Stop()
+		{
+			_stop.store(true, std::memory_order_release);
+
+			ClearMetrics();
+
+			LockGuard lock_guard(_mutex);
+			_consumer_condition.NotifyAll();
+			_producer_condition.NotifyAll();
+		}
+
+		// Same as ManagedQueue::InjectWakeup()
+		void InjectWakeup()
+		{
+			_pending_wakeup.store(true, std::memory_order_release);
+
+			LockGuard lock_guard(_mutex);
+			_consumer_condition.NotifyAll();
+		}
+
+		bool IsStopped() const
+		{
+			return _stop.load(std::memory_order_acquire);
+		}
+
+		void SetExceedWaitEnable(bool enable)
+		{
+			_exceed_threshold_and_wait_enabled.store(enable, std::memory_order_release);
+		}
+
+		bool IsExceedWaitEnable()
+		{
+			return _exceed_threshold_and_wait_enabled.load(std::memory_order_acquire);
+		}
+
+		ov::String GetInfoString()
+		{
+			SharedLockGuard shared_lock(_name_mutex);
+
+			ov::String urn_str = (_urn != nullptr) ? _urn->ToString() : ov::String("NoUrn");
+
+			ov::String threshold_info = ov::String::FormatString("%zu (%s %zu%s)", _threshold, GetThresholdModeString(_threshold_mode), _threshold_value, (_threshold_mode == ThresholdMode::TimeBased) ? "ms" : "");
+
+			return ov::String::FormatString(
+				"BoundedManagedQueue [Id: %u, Size: %zu, Capacity: %zu, Threshold: %s, Peak: %zu, Imps: %zu, Omps: %zu, Drop: %llu, Wait: %s, Urn: %s]",
+				GetId(), _size.load(), _ring.GetCapacity(), threshold_info.CStr(),
+				_peak.load(), _input_message_per_second.load(), _output_message_per_second.load(), static_cast<unsigned long long>(_drop_message_count.load()),
+				_exceed_threshold_and_wait_enabled ? "On" : "Off",
+				urn_str.CStr());
+		}
+
+	private:
+		// <pending_count>: items already counted in _size but not pushed yet
+		bool IsThresholdExceeded(size_t pending_count = 0) const
+		{
+			SharedLockGuard shared_lock(_name_mutex);
+			if (_threshold == 0) return false;
+			return (_size - pending_count) >= _threshold;
+		}
+
+		// Slow path of Enqueue(): the ring is full, or the producer must wait for the threshold
+		bool WaitAndPush(Ring &ring, T &item, int timeout)
+		{
+			auto expire = (timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+			LockGuard lock(_mutex);
+
+			// Announced before retrying, so the consumer either sees the waiter or the producer sees the room
+			_waiting_producer_count.fetch_add(1, std::memory_order_seq_cst);
+
+			bool pushed = false;
+
+			while (true)
+			{
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (_stop.load(std::memory_order_acquire))
+				{
+					SharedLockGuard name_lock(_name_mutex);
+					logw(LOG_TAG, "[%s] Stop is requested. Failed to enqueue item.", (_urn != nullptr) ? _urn->ToString().CStr() : "NoUrn");
+					break;
+				}
+
+				if (((_exceed_threshold_and_wait_enabled == false) || (IsThresholdExceeded(1) == false)) && ring.Push(item))
+				{
+					pushed = true;
+					break;
+				}
+
+				if (std::chrono::steady_clock::now() >= expire)
+				{
+					SharedLockGuard name_lock(_name_mutex);
+					loge(LOG_TAG, "[%s] queue is full. q.size(%zu), q.capacity(%zu), q.threshold(%zu)", (_urn != nullptr) ? _urn->ToString().CStr() : "NoUrn", _size.load(), ring.GetCapacity(), _threshold);
+					break;
+				}
+
+				_producer_condition.WaitUntil(lock, expire);
+			}
+
+			_waiting_producer_count.fetch_sub(1, std::memory_order_relaxed);
+
+			return pushed;
+		}
+
+		void WakeConsumer()
+		{
+			// Pairs with the fence in WaitForItem(): either the consumer sees the item, or this sees the consumer waiting
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (_consumer_waiting.load(std::memory_order_relaxed))
+			{
+				LockGuard lock_guard(_mutex);
+				_consumer_condition.NotifyOne();
+			}
+		}
+
+		void WakeProducers()
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (_waiting_producer_count.load(std::memory_order_relaxed) > 0)
+			{
+				LockGuard lock_guard(_mutex);
+				_producer_condition.NotifyAll();
+			}
+		}
+
+		// Called by the consumer
+		bool WaitForItem(std::chrono::steady_clock::time_point deadline)
+		{
+			LockGuard lock(_mutex);
+
+			_consumer_waiting.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto result = _consumer_condition.WaitUntil(lock, deadline, [this]() OV_REQUIRES(_mutex) -> bool {
+				return _urgent_ring.HasItem() || _ring.HasItem() ||
+					   _stop.load(std::memory_order_acquire) || _pending_wakeup.load(std::memory_order_acquire) || _clear_requested.load(std::memory_order_acquire);
+			});
+
+			_consumer_waiting.store(false, std::memory_order_relaxed);
+
+			return result;
+		}
+
+		// Called by the consumer
+		bool TryPop(T &item)
+		{
+			std::chrono::steady_clock::time_point enqueued_at;
+
+			if ((_urgent_ring.Pop(item, enqueued_at) == false) && (_ring.Pop(item, enqueued_at) == false))
+			{
+				return false;
+			}
+
+			_size.fetch_sub(1, std::memory_order_relaxed);
+			_output_message_count.store(_output_message_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+			if (enqueued_at.time_since_epoch().count() != 0)
+			{
+				int64_t dwell_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - enqueued_at).count();
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + dwell_us * 0.1;
+				RecordDwellUs(dwell_us);
+			}
+
+			WakeProducers();
+
+			// The clock is read once per batch while items keep coming
+			if ((++_dequeue_count_since_metrics % MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL) == 0)
+			{
+				UpdateMetrics();
+			}
+
+			return true;
+		}
+
+		// Called by the consumer, or by the destructor
+		void DrainItems()
+		{
+			_clear_requested.store(false, std::memory_order_relaxed);
+
+			T item;
+			std::chrono::steady_clock::time_point enqueued_at;
+
+			while (_urgent_ring.Pop(item, enqueued_at) || _ring.Pop(item, enqueued_at))
+			{
+				_size.fetch_sub(1, std::memory_order_relaxed);
+				item = T();
+			}
+
+			ClearMetrics();
+
+			WakeProducers();
+		}
+
+		// Called by the consumer
+		void UpdateMetrics()
+		{
+			_dequeue_count_since_metrics = 0;
+
+			if (_timer.IsStart() == false)
+			{
+				_timer.Start();
+			}
+
+			if (_timer.IsElapsed(_stats_metric_interval) == false)
+			{
+				return;
+			}
+
+			int elapsed_time = _timer.Elapsed();
+			_timer.Update();
+
+			// Producers do not count their items, everything that went in is either out or still queued
+			_input_message_count = _output_message_count + static_cast<int64_t>(_size.load(std::memory_order_relaxed));
+
+			_input_message_per_second = (double)(_input_message_count - _last_input_message_count) * (1000.0 / (double)elapsed_time);
+			_output_message_per_second = (double)(_output_message_count - _last_output_message_count) * (1000.0 / (double)elapsed_time);
+			_last_input_message_count = _input_message_count.load();
+			_last_output_message_count = _output_message_count.load();
+
+			RollDwellLatest();
+
+			UpdateThreshold();
+
+			if (IsThresholdExceeded())
+			{
+				_threshold_exceeded_time_ms.fetch_add(elapsed_time);
+
+				_last_logging_time += elapsed_time;
+
+				if ((_exceed_threshold_and_wait_enabled == false) && ((_last_logged_peak < _peak) || (_last_logging_time >= _log_interval)))
+				{
+					_last_logging_time = 0;
+
+					logw(LOG_TAG, "Exceeded. %s dwell_us[n=%llu min=%lld avg=%lld p50=%lld p90=%lld p99=%lld max=%lld]", GetInfoString().CStr(),
+						 static_cast<unsigned long long>(GetDwellCount()), static_cast<long long>(GetDwellMinUs()), static_cast<long long>(GetDwellAvgUs()),
+						 static_cast<long long>(GetDwellPercentileUs(0.5)), static_cast<long long>(GetDwellPercentileUs(0.9)), static_cast<long long>(GetDwellPercentileUs(0.99)), static_cast<long long>(GetDwellMaxUs()));
+
+					_last_logged_peak = _peak;
+				}
+			}
+			else
+			{
+				_threshold_exceeded_time_ms.store(0);
+			}
+
+			MonitorInstance->OnQueueUpdated(*this);
+		}
+
+		void ClearMetrics()
+		{
+			_peak = 0;
+			_input_message_per_second = 0;
+			_output_message_per_second = 0;
+			_input_message_count = 0;
+			_output_message_count = 0;
+
+			_last_input_message_count = 0;
+			_last_output_message_count = 0;
+			_threshold_exceeded_time_ms.store(0);
+
+			MonitorInstance->OnQueueUpdated(*this);
+		}
+
+		// Same as ManagedQueue, without the buffering delay
+		void UpdateThreshold()
+		{
+			LockGuard name_lock(_name_mutex);
+
+			if (_threshold_mode == ThresholdMode::TimeBased)
+			{
+				size_t base_count = 0;
+				if (_threshold_value > 0 && _input_message_per_second > 0)
+				{
+					base_count = std::max(static_cast<size_t>(1), static_cast<size_t>(static_cast<double>(_input_message_per_second) * (static_cast<double>(_threshold_value) / 1000.0)));
+				}
+				_threshold = base_count;
+			}
+			else if (_threshold_mode == ThresholdMode::CountBased)
+			{
+				_threshold = _threshold_value;
+			}
+		}
+
+		Ring _ring;
+		Ring _urgent_ring;
+
+		// Used only to sleep and wake up; the rings do not need it
+		mutable Mutex _mutex;
+		ConditionVariable _consumer_condition;
+		ConditionVariable _producer_condition;
+
+		std::atomic<bool> _consumer_waiting{false};
+		std::atomic<int> _waiting_producer_count{0};
+
+		std::atomic<bool> _stop{false};
+		std::atomic<bool> _pending_wakeup{false};
+		std::atomic<bool> _clear_requested{false};
+		std::atomic<bool> _exceed_threshold_and_wait_enabled{false};
+
+		// Used by the consumer only
+		StopWatch _timer;
+		int _stats_metric_interval = 0;
+		int _log_interval = 0;
+		int64_t _last_logging_time = 0;
+		size_t _last_logged_peak = 0;
+		uint32_t _dequeue_count_since_metrics = 0;
+	};
+
+	template <typename T>
+	using SpscManagedQueue = BoundedManagedQueue<T, QueueProducerMode::Single>;
+
+	template <typename T>
+	using MpscManagedQueue = BoundedManagedQueue<T, QueueProducerMode::Multi>;
+}  // namespace ov
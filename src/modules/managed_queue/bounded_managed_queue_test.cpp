@@ -0,0 +1,263 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+#include <modules/managed_queue/bounded_managed_queue.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+TEST(BoundedManagedQueue, SingleProducerKeepsOrder)
+{
+	ov::SpscManagedQueue<int> queue(nullptr, 0, 64);
+	constexpr int COUNT = 100000;
+
+	std::thread producer([&] {
+		for (int value = 0; value < COUNT; value++)
+		{
+			queue.Enqueue(value, false, ov::Infinite);
+		}
+	});
+
+	bool in_order = true;
+	for (int expected = 0; expected < COUNT; expected++)
+	{
+		auto value = queue.Dequeue(5000);
+		if ((value.has_value() == false) || (value.value() != expected))
+		{
+			in_order = false;
+			break;
+		}
+	}
+
+	producer.join();
+
+	EXPECT_TRUE(in_order);
+	EXPECT_TRUE(queue.IsEmpty());
+	EXPECT_EQ(queue.GetDropCount(), 0u);
+}
+
+TEST(BoundedManagedQueue, MultiProducerDeliversEveryItem)
+{
+	// A small ring, so producers keep running into a full queue and waiting for room
+	ov::MpscManagedQueue<std::shared_ptr<int>> queue(nullptr, 0, 16);
+	constexpr int PRODUCER_COUNT = 4;
+	constexpr int COUNT_PER_PRODUCER = 20000;
+
+	std::vector<std::thread> producers;
+	for (int producer_index = 0; producer_index < PRODUCER_COUNT; producer_index++)
+	{
+		producers.emplace_back([&, producer_index] {
+			for (int value = 0; value < COUNT_PER_PRODUCER; value++)
+			{
+				queue.Enqueue(std::make_shared<int>(producer_index * COUNT_PER_PRODUCER + value), false, ov::Infinite);
+			}
+		});
+	}
+
+	// Items of each producer must come out in the order that producer pushed them
+	std::vector<int> last_values(PRODUCER_COUNT, -1);
+	bool in_order = true;
+	int64_t sum = 0;
+
+	for (int count = 0; count < PRODUCER_COUNT * COUNT_PER_PRODUCER; count++)
+	{
+		auto item = queue.Dequeue(5000);
+		ASSERT_TRUE(item.has_value());
+
+		auto value = *item.value();
+		auto producer_index = value / COUNT_PER_PRODUCER;
+		if (value <= last_values[producer_index])
+		{
+			in_order = false;
+		}
+		last_values[producer_index] = value;
+		sum += value;
+	}
+
+	for (auto &producer : producers)
+	{
+		producer.join();
+	}
+
+	constexpr int64_t TOTAL = PRODUCER_COUNT * COUNT_PER_PRODUCER;
+	EXPECT_TRUE(in_order);
+	EXPECT_EQ(sum, TOTAL * (TOTAL - 1) / 2);
+	EXPECT_EQ(queue.Size(), 0u);
+	EXPECT_LE(queue.GetPeak(), queue.GetCapacity() + PRODUCER_COUNT);
+}
+
+TEST(BoundedManagedQueue, UrgentItemsComeFirst)
+{
+	ov::MpscManagedQueue<int> queue;
+
+	queue.Enqueue(1);
+	queue.Enqueue(2);
+	queue.Enqueue(100, true);
+
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 100);
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 1);
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 2);
+	EXPECT_FALSE(queue.Dequeue(0).has_value());
+}
+
+TEST(BoundedManagedQueue, FullQueueDropsAfterTimeout)
+{
+	ov::SpscManagedQueue<int> queue(nullptr, 0, 2);
+
+	queue.Enqueue(1);
+	queue.Enqueue(2);
+	queue.Enqueue(3, false, 20);
+
+	EXPECT_EQ(queue.Size(), 2u);
+	EXPECT_EQ(queue.GetDropCount(), 1u);
+}
+
+TEST(BoundedManagedQueue, FullQueueWaitsForRoomByDefault)
+{
+	ov::MpscManagedQueue<int> queue(nullptr, 0, 2);
+
+	EXPECT_TRUE(queue.Enqueue(1));
+	EXPECT_TRUE(queue.Enqueue(2));
+
+	auto producer = std::async(std::launch::async, [&] {
+		return queue.Enqueue(3);
+	});
+
+	// Blocked while the ring is full
+	EXPECT_EQ(producer.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 1);
+
+	ASSERT_EQ(producer.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+	EXPECT_TRUE(producer.get());
+
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 2);
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 3);
+	EXPECT_EQ(queue.GetDropCount(), 0u);
+}
+
+TEST(BoundedManagedQueue, FullQueueDropsRightAwayWithZeroTimeout)
+{
+	ov::MpscManagedQueue<int> queue(nullptr, 0, 2);
+
+	EXPECT_TRUE(queue.Enqueue(1));
+	EXPECT_TRUE(queue.Enqueue(2));
+	EXPECT_FALSE(queue.Enqueue(3, false, 0));
+
+	EXPECT_EQ(queue.Size(), 2u);
+	EXPECT_EQ(queue.GetDropCount(), 1u);
+}
+
+TEST(BoundedManagedQueue, StopReleasesWaitingProducer)
+{
+	ov::SpscManagedQueue<int> queue(nullptr, 0, 2);
+
+	EXPECT_TRUE(queue.Enqueue(1));
+	EXPECT_TRUE(queue.Enqueue(2));
+
+	auto producer = std::async(std::launch::async, [&] {
+		return queue.Enqueue(3);
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	queue.Stop();
+
+	ASSERT_EQ(producer.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+	EXPECT_FALSE(producer.get());
+}
+
+TEST(BoundedManagedQueue, ExceedWaitHonorsThreshold)
+{
+	ov::MpscManagedQueue<int> queue(nullptr, 1, 16);
+	queue.SetExceedWaitEnable(true);
+
+	queue.Enqueue(1);
+	queue.Enqueue(2, false, 20);
+
+	EXPECT_EQ(queue.Size(), 1u);
+	EXPECT_EQ(queue.GetDropCount(), 1u);
+}
+
+TEST(BoundedManagedQueue, WakesBlockedConsumer)
+{
+	ov::MpscManagedQueue<int> queue;
+
+	auto consumer = std::async(std::launch::async, [&] {
+		return queue.Dequeue(5000);
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	queue.Enqueue(7);
+
+	ASSERT_EQ(consumer.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+	EXPECT_EQ(consumer.get().value_or(-1), 7);
+}
+
+TEST(BoundedManagedQueue, InjectWakeupAndStopReleaseConsumer)
+{
+	ov::MpscManagedQueue<int> queue;
+
+	queue.Enqueue(1);
+	queue.InjectWakeup();
+
+	// The wakeup is consumed once, ahead of the queued item
+	EXPECT_FALSE(queue.Dequeue(0).has_value());
+	EXPECT_EQ(queue.Dequeue(0).value_or(-1), 1);
+
+	auto consumer = std::async(std::launch::async, [&] {
+		return queue.Dequeue();
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	queue.Stop();
+
+	ASSERT_EQ(consumer.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+	EXPECT_FALSE(consumer.get().has_value());
+	EXPECT_TRUE(queue.IsStopped());
+}
+
+TEST(BoundedManagedQueue, ClearIsAppliedByConsumer)
+{
+	ov::MpscManagedQueue<std::shared_ptr<int>> queue;
+	auto item = std::make_shared<int>(1);
+
+	queue.Enqueue(item);
+	queue.Enqueue(item);
+	EXPECT_EQ(item.use_count(), 3);
+
+	queue.Clear();
+	EXPECT_FALSE(queue.Dequeue(0).has_value());
+
+	EXPECT_EQ(item.use_count(), 1);
+	EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(BoundedManagedQueue, DwellTimeIsSampled)
+{
+	ov::SpscManagedQueue<int> queue;
+
+	for (int round = 0; round < 4; round++)
+	{
+		for (int value = 0; value < MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL; value++)
+		{
+			queue.Enqueue(value);
+		}
+
+		for (int value = 0; value < MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL; value++)
+		{
+			ASSERT_TRUE(queue.Dequeue(0).has_value());
+		}
+	}
+
+	// One sample per MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL items
+	EXPECT_EQ(queue.GetDwellCount(), 4u);
+}
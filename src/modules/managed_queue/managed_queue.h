@@ -12,6 +12,7 @@
 #include <monitoring/monitoring.h>
 
 #include <atomic>
+#include <new>
 #include <optional>
 #include <queue>
 
@@ -20,6 +21,11 @@
 
 #define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC 1000
 #define MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC 5000
+// One in this many items is timestamped for the dwell-time statistics (must be a power of 2).
+// Every item is timestamped while a buffering delay is set, since the delay needs it.
+#define MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL 16
+// Node memory kept for reuse after items are dequeued
+#define MANAGED_QUEUE_NODE_POOL_LIMIT 256
 
 
 namespace ov
@@ -38,11 +44,17 @@ namespace ov
 
 			ManagedQueueNode* next;
 
+			// Left empty (epoch) for items that are not sampled
 			std::chrono::steady_clock::time_point _start;
 			bool _urgent = false;
 
-			ManagedQueueNode(T value, bool urgent, ManagedQueueNode *next_node = nullptr)
-				: data(std::move(value)), next(next_node), _start(std::chrono::steady_clock::now()), _urgent(urgent) {}
+			ManagedQueueNode(T value, bool urgent, std::chrono::steady_clock::time_point start)
+				: data(std::move(value)), next(nullptr), _start(start), _urgent(urgent) {}
+
+			bool IsTimestamped() const
+			{
+				return _start.time_since_epoch().count() != 0;
+			}
 		};
 
 	public:
@@ -73,6 +85,16 @@ namespace ov
 
 			Clear();
 
+			{
+				LockGuard lock_guard(_mutex);
+
+				while (_free_node_list.empty() == false)
+				{
+					::operator delete(_free_node_list.back());
+					_free_node_list.pop_back();
+				}
+			}
+
 			// Unregister to the server metrics
 			MonitorInstance->OnQueueDeleted(*this);
 		}
@@ -103,15 +125,9 @@ namespace ov
 		// Urgent item will be inserted at the front of the queue
 		void Enqueue(T item, bool urgent = false, int timeout = Infinite)
 		{
-			auto node = new(std::nothrow) ManagedQueueNode(std::move(item), urgent);
-			if (node == nullptr)
-			{
-				loge(LOG_TAG, "Failed to allocate memory for queue node.");
-				return;
-			}
 			EnqueuePos pos = urgent ? EnqueuePos::EnqueueFrontPos : EnqueuePos::EnqueueBackPos;
 
-			EnqueueInternal(node, timeout, pos);
+			EnqueueInternal(std::move(item), urgent, timeout, pos);
 		}
 
 		std::optional<T> Front(int timeout = Infinite)
@@ -127,9 +143,11 @@ namespace ov
 			{
 				std::chrono::steady_clock::time_point expire = (timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
 
+				_waiter_count++;
 				auto result = _condition.WaitUntil(lock, expire, [this]() OV_REQUIRES(_mutex) -> bool {
 					return (((_size == 0) == false) || _stop);
 				});
+				_waiter_count--;
 
 				if (!result || _stop)
 				{
@@ -161,9 +179,11 @@ namespace ov
 			{
 				std::chrono::steady_clock::time_point expire = (timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
 
+				_waiter_count++;
 				auto result = _condition.WaitUntil(lock, expire, [this]() OV_REQUIRES(_mutex) -> bool {
 					return (((_size == 0) == false) || _stop);
 				});
+				_waiter_count--;
 
 				if (!result || _stop)
 				{
@@ -213,7 +233,8 @@ namespace ov
 				}
 				else
 				{
-					if (_front_node != nullptr && _front_node->_urgent == true) 
+					// Urgent items, and items enqueued before the delay was set, are not held
+					if (_front_node != nullptr && (_front_node->_urgent == true || _front_node->IsTimestamped() == false))
 					{
 						break;
 					}
@@ -241,7 +262,9 @@ namespace ov
 					}
 				}
 
+				_waiter_count++;
 				_condition.WaitUntil(lock, expire);
+				_waiter_count--;
 
 				// Check the hard deadline after waking.
 				if (timeout != Infinite && std::chrono::steady_clock::now() >= deadline)
@@ -269,16 +292,20 @@ namespace ov
 			// Update statistics of output message count
 			_output_message_count++;
 
-			// Update statistics of waiting time (microseconds)
-			int64_t dwell_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - node->_start).count();
-			_waiting_time_in_us = _waiting_time_in_us * 0.9 + dwell_us * 0.1;
-			RecordDwellUs(dwell_us);
+			// Update statistics of waiting time (microseconds) from the sampled items
+			if (node->IsTimestamped())
+			{
+				int64_t dwell_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - node->_start).count();
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + dwell_us * 0.1;
+				RecordDwellUs(dwell_us);
+			}
 
-			delete node;
+			DeleteNode(node);
 
 			UpdateMetrics();
 
-			if(_exceed_threshold_and_wait_enabled == true)
+			// Wake producers waiting for the queue to fall below the threshold
+			if ((_exceed_threshold_and_wait_enabled == true) && (_waiter_count > 0))
 			{
 				_condition.NotifyAll();
 			}
@@ -311,7 +338,7 @@ namespace ov
 
 				_front_node = _front_node->next;
 
-				delete temp;
+				DeleteNode(temp);
 			}
 
 			_rear_node = nullptr;
@@ -419,6 +446,11 @@ namespace ov
 				return ov::Infinite;
 			}
 
+			if (_front_node->IsTimestamped() == false)
+			{
+				return 0;
+			}
+
 			auto current = std::chrono::steady_clock::now();
 			return std::chrono::duration_cast<std::chrono::milliseconds>(current - _front_node->_start).count();
 		}
@@ -433,7 +465,7 @@ namespace ov
 			EnqueueBackPos
 		};
 
-		void EnqueueInternal(ManagedQueueNode* node, int timeout, EnqueuePos push_method)
+		void EnqueueInternal(T item, bool urgent, int timeout, EnqueuePos push_method)
 		{
 			LockGuard lock(_mutex);
 
@@ -444,16 +476,17 @@ namespace ov
 			if(_exceed_threshold_and_wait_enabled == true)
 			{
 				std::chrono::steady_clock::time_point expire = (timeout == Infinite) ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+				_waiter_count++;
 				auto result = _condition.WaitUntil(lock, expire, [this]() OV_REQUIRES(_mutex) -> bool {
 					return (!IsThresholdExceeded() || _stop);
 				});
+				_waiter_count--;
 				if (_stop)
 				{
 					{
 						SharedLockGuard name_lock(_name_mutex);
 						logw(LOG_TAG, "[%s] Stop is requested. Failed to enqueue item.", (_urn != nullptr) ? _urn->ToString().CStr() : "NoUrn");
 					}
-					delete node;
 					return;
 				}
 
@@ -463,11 +496,17 @@ namespace ov
 						SharedLockGuard name_lock(_name_mutex);
 						loge(LOG_TAG, "[%s] queue is full. q.size(%zu), q.threshold(%zu)", (_urn != nullptr) ? _urn->ToString().CStr() : "NoUrn", _size.load(), _threshold);
 					}
-					delete node;
 					return;
 				}
 			}
 
+			auto node = NewNode(std::move(item), urgent);
+			if (node == nullptr)
+			{
+				loge(LOG_TAG, "Failed to allocate memory for queue node.");
+				return;
+			}
+
 			if (push_method == EnqueuePos::EnqueueBackPos)
 			{
 				PushBack(node);
@@ -479,10 +518,56 @@ namespace ov
 
 			UpdateMetrics();
 
-			// Always notify: when buffering_delay == 0 this is the normal signal;
+			// Notify whenever someone waits: when buffering_delay == 0 this is the normal signal;
 			// when buffering_delay != 0 this lets the Dequeue thread recalculate
 			// its timed wait based on the (possibly new) front node.
-			_condition.NotifyAll();
+			// Nobody waits while the consumer is busy draining the queue, so the notification is skipped.
+			if (_waiter_count > 0)
+			{
+				_condition.NotifyAll();
+			}
+		}
+
+		ManagedQueueNode *NewNode(T item, bool urgent) OV_REQUIRES(_mutex)
+		{
+			void *block = nullptr;
+
+			if (_free_node_list.empty() == false)
+			{
+				block = _free_node_list.back();
+				_free_node_list.pop_back();
+			}
+			else
+			{
+				block = ::operator new(sizeof(ManagedQueueNode), std::nothrow);
+				if (block == nullptr)
+				{
+					return nullptr;
+				}
+			}
+
+			// Only sampled items are timestamped, unless the buffering delay needs every timestamp
+			std::chrono::steady_clock::time_point start;
+			if ((_buffering_delay != 0) || ((_input_message_count & (MANAGED_QUEUE_DWELL_SAMPLE_INTERVAL - 1)) == 1))
+			{
+				start = std::chrono::steady_clock::now();
+			}
+
+			return new (block) ManagedQueueNode(std::move(item), urgent, start);
+		}
+
+		void DeleteNode(ManagedQueueNode *node) OV_REQUIRES(_mutex)
+		{
+			node->~ManagedQueueNode();
+
+			if (_free_node_list.size() < MANAGED_QUEUE_NODE_POOL_LIMIT)
+			{
+				_free_node_list.push_back(node);
+			}
+			else
+			{
+				::operator delete(node);
+			}
 		}
 
 		void PushBack(ManagedQueueNode* node) OV_REQUIRES(_mutex)
@@ -655,6 +740,12 @@ namespace ov
 		ManagedQueueNode* _front_node OV_GUARDED_BY(_mutex);
 		ManagedQueueNode* _rear_node OV_GUARDED_BY(_mutex);
 
+		// Memory of dequeued nodes, reused by the next Enqueue()
+		std::vector<void *> _free_node_list OV_GUARDED_BY(_mutex);
+
+		// Threads waiting on _condition; notifications are skipped while it is 0
+		int _waiter_count OV_GUARDED_BY(_mutex) = 0;
+
 	protected:
 		// `_mutex` is `protected` so derived classes can take the lock when calling
 		// protected helpers like `UpdateMetrics()`/`ClearMetrics()` which are annotated
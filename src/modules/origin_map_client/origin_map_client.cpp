@@ -24,26 +24,82 @@ OriginMapClient::OriginMapClient(const ov::String &redis_host, const ov::String
 	_redis_port = ov::Converter::ToUInt16(ip_port[1]);
 	_redis_password = redis_password;
 
+	_redis_client = std::make_shared<RedisAsyncClient>(_redis_ip, _redis_port, _redis_password, ORIGIN_MAP_STORE_COMMAND_TIMEOUT);
+	if (_redis_client->Start() == false)
+	{
+		_redis_client = nullptr;
+		return;
+	}
+
 	_update_timer.Push(
 		[this](void *paramter) -> ov::DelayQueueAction {
 			RetryRegister();
 			NofifyStreamsAlive();
 			ProcessPendingUnregisters();
+			PurgeExpiredLookups();
 			return ov::DelayQueueAction::Repeat;
 		},
 		500);
 	_update_timer.Start();
 }
 
+OriginMapClient::~OriginMapClient()
+{
+	_update_timer.Stop();
+
+	if (_redis_client != nullptr)
+	{
+		// Completes the commands in flight before the members they refer to are destroyed
+		_redis_client->Stop();
+	}
+}
+
 bool OriginMapClient::NofifyStreamsAlive()
 {
 	std::unique_lock<std::recursive_mutex> lock(_origin_map_mutex);
 	auto origin_map = _origin_map;
 	lock.unlock();
 
-	for (auto &[key, value] : origin_map)
+	if (origin_map.empty())
 	{
-		Update(key, value);
+		return true;
+	}
+
+	// Set origin host to redis
+	// XX option or EXPIRE cmd are not used because if redis server is restarted, keep-alive can restore the origin stream info.
+	std::vector<RedisAsyncClient::Command> commands;
+	commands.reserve(origin_map.size());
+
+	for (auto &[app_stream_name, origin_host] : origin_map)
+	{
+		commands.push_back({"SET", app_stream_name, origin_host, "EX", ov::Converter::ToString(ORIGIN_MAP_STORE_KEY_EXPIRE_TIME)});
+	}
+
+	ov::StopWatch watch;
+	watch.Start();
+
+	auto replies = _redis_client->SendCommandsAndWait(std::move(commands));
+
+	_keepalive_stream_count = origin_map.size();
+	_keepalive_latency_usec = watch.ElapsedUs();
+
+	size_t index = 0;
+	for (auto &[app_stream_name, origin_host] : origin_map)
+	{
+		auto &reply = replies[index++];
+
+		if (reply.type == REDIS_REPLY_STATUS && reply.str == "OK")
+		{
+			// Updated
+		}
+		else if (reply.type == REDIS_REPLY_NIL)
+		{
+			logte("Failed to update origin host to redis because the key does not exist : %s:%d/%s (err(%d):%s)", _redis_ip.CStr(), _redis_port, app_stream_name.CStr(), reply.type, reply.str.CStr());
+		}
+		else
+		{
+			logte("Failed to update origin host to redis : %s:%d/%s (err(%d):%s)", _redis_ip.CStr(), _redis_port, app_stream_name.CStr(), reply.type, reply.str.CStr());
+		}
 	}
 
 	return true;
@@ -65,14 +121,94 @@ bool OriginMapClient::RetryRegister()
 
 	decltype(_origin_map_candidates) failed;
 
-	for (auto &kv : candidates)
+	// Check if already registered
+	std::vector<RedisAsyncClient::Command> get_commands;
+	for (auto &[app_stream_name, origin_host] : candidates)
+	{
+		get_commands.push_back({"GET", app_stream_name});
+	}
+
+	auto get_replies = _redis_client->SendCommandsAndWait(std::move(get_commands));
+
+	std::vector<std::pair<ov::String, ov::String>> new_registrations;
+	size_t index = 0;
+
+	for (auto &[app_stream_name, origin_host] : candidates)
 	{
-		auto &key = kv.first;
-		auto &value = kv.second;
+		auto &reply = get_replies[index++];
 
-		if (!Register(key, value))
+		if (reply.type == REDIS_REPLY_NIL)
+		{
+			// Not exist, keep going
+			new_registrations.emplace_back(app_stream_name, origin_host);
+		}
+		else if (reply.type == REDIS_REPLY_STRING)
+		{
+			if (origin_host == reply.str)
+			{
+				// Already registered with same origin host, so no need to register again.
+				AddOriginMap(app_stream_name, origin_host);
+				logti("OriginMapStore: <%s> stream is registered with origin host : %s", app_stream_name.CStr(), origin_host.CStr());
+			}
+			else
+			{
+				if (IsRelayKey(app_stream_name))
+				{
+					// Another relay of the tier serves the stream, this one stands by
+					logtd("<%s> is held by another relay (%s)", app_stream_name.CStr(), reply.str.CStr());
+				}
+				else
+				{
+					logte("<%s> stream is already registered with different origin host (%s)", app_stream_name.CStr(), reply.str.CStr());
+				}
+				AddOriginMapCandidate(app_stream_name, origin_host);
+			}
+		}
+		else
 		{
-			failed.emplace(key, std::move(value));
+			logte("Failed to get origin host from redis : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply.type, reply.str.CStr());
+			failed.emplace(app_stream_name, origin_host);
+		}
+	}
+
+	// Set origin host to redis
+	// The EXPIRE option is to prevent locking the app/stream when OvenMediaEngine unexpectedly stops.
+	// So _update_timer updates the expire time periodically.
+	// If it is successful, it will return REDIS_REPLY_STATUS with "OK".
+	std::vector<RedisAsyncClient::Command> set_commands;
+	for (auto &[app_stream_name, origin_host] : new_registrations)
+	{
+		set_commands.push_back({"SET", app_stream_name, origin_host, "EX", ov::Converter::ToString(ORIGIN_MAP_STORE_KEY_EXPIRE_TIME), "NX"});
+	}
+
+	auto set_replies = _redis_client->SendCommandsAndWait(std::move(set_commands));
+
+	index = 0;
+	for (auto &[app_stream_name, origin_host] : new_registrations)
+	{
+		auto &reply = set_replies[index++];
+
+		if (reply.type == REDIS_ERR || reply.type == REDIS_REPLY_ERROR)
+		{
+			logte("Failed to register origin host to redis : %s:%d/%s/%s (err(%d):%s)", _redis_ip.CStr(), _redis_port, app_stream_name.CStr(), origin_host.CStr(), reply.type, reply.str.CStr());
+			failed.emplace(app_stream_name, origin_host);
+		}
+		else if (reply.type == REDIS_REPLY_NIL)
+		{
+			if (IsRelayKey(app_stream_name))
+			{
+				logtd("<%s> is held by another relay", app_stream_name.CStr());
+			}
+			else
+			{
+				logte("<%s> stream is already registered.", app_stream_name.CStr());
+			}
+			AddOriginMapCandidate(app_stream_name, origin_host);
+		}
+		else
+		{
+			AddOriginMap(app_stream_name, origin_host);
+			logti("OriginMapStore: <%s> stream is registered with origin host : %s", app_stream_name.CStr(), origin_host.CStr());
 		}
 	}
 
@@ -102,9 +238,33 @@ bool OriginMapClient::ProcessPendingUnregisters()
 		candidates.swap(_origin_map_remove_candidates);
 	}
 
+	std::vector<ov::String> registered_names;
+	std::vector<RedisAsyncClient::Command> commands;
+
+	for (auto &app_stream_name : candidates)
+	{
+		if (DeleteOriginMap(app_stream_name) == true)
+		{
+			registered_names.push_back(app_stream_name);
+			commands.push_back({"DEL", app_stream_name});
+		}
+	}
+
+	auto replies = _redis_client->SendCommandsAndWait(std::move(commands));
+
+	for (size_t index = 0; index < replies.size(); index++)
+	{
+		auto &reply = replies[index];
+
+		if (reply.type == REDIS_ERR || reply.type == REDIS_REPLY_ERROR)
+		{
+			logte("Failed to delete origin host from redis : %s:%d/%s (err(%d):%s)", _redis_ip.CStr(), _redis_port, registered_names[index].CStr(), reply.type, reply.str.CStr());
+		}
+	}
+
 	for (auto &app_stream_name : candidates)
 	{
-		Unregister(app_stream_name);
+		logti("OriginMapStore: <%s> stream is unregistered.", app_stream_name.CStr());
 	}
 
 	return true;
@@ -112,6 +272,8 @@ bool OriginMapClient::ProcessPendingUnregisters()
 
 bool OriginMapClient::AddOriginMap(const ov::String &app_stream_name, const ov::String &origin_host)
 {
+	InvalidateLookup(app_stream_name);
+
 	std::lock_guard<std::recursive_mutex> lock(_origin_map_mutex);
 	_origin_map[app_stream_name] = origin_host;
 	return true;
@@ -133,6 +295,8 @@ bool OriginMapClient::RequestUnregister(const ov::String &app_stream_name)
 
 bool OriginMapClient::DeleteOriginMap(const ov::String &app_stream_name)
 {
+	InvalidateLookup(app_stream_name);
+
 	std::lock_guard<std::recursive_mutex> lock(_origin_map_mutex);
 	auto origin_cand_it = _origin_map_candidates.find(app_stream_name);
 	if (origin_cand_it != _origin_map_candidates.end())
@@ -150,239 +314,204 @@ bool OriginMapClient::DeleteOriginMap(const ov::String &app_stream_name)
 	return false;
 }
 
-bool OriginMapClient::Register(const ov::String &app_stream_name, const ov::String &origin_host)
+bool OriginMapClient::RequestRegister(const ov::String &app_stream_name, const ov::String &origin_host)
+{
+	return AddOriginMapCandidate(app_stream_name, origin_host);
+}
+
+CommonErrorCode OriginMapClient::GetOrigin(const ov::String &app_stream_name, ov::String &origin_host)
 {
-	bool same_registered = false;
-	
+	if (_redis_client == nullptr)
 	{
-		// Check if already registered
-		auto [reply_type, reply_str] = CommandToRedis("GET %s", app_stream_name.CStr());
-		if (reply_type == REDIS_REPLY_NIL)
-		{
-			// Not exist, keep going
-		}
-		else if (reply_type == REDIS_REPLY_STRING)
+		logte("Redis server is not configured properly : %s:%d", _redis_ip.CStr(), _redis_port);
+		return CommonErrorCode::ERROR;
+	}
+
+	_lookup_count++;
+
+	std::shared_future<LookupResult> pending_lookup;
+	std::shared_ptr<std::promise<LookupResult>> promise;
+
+	{
+		ov::LockGuard lock_guard(_lookup_mutex);
+
+		auto cache_item = _lookup_cache.find(app_stream_name);
+		if (cache_item != _lookup_cache.end())
 		{
-			if (origin_host == reply_str)
+			if (cache_item->second.expire_time > Clock::now())
 			{
-				// Already registered with same origin host, so no need to register again.
-				same_registered = true;
-			}
-			else
-			{
-				logte("<%s> stream is already registered with different origin host (%s)", app_stream_name.CStr(), reply_str.CStr());
-				
-				AddOriginMapCandidate(app_stream_name, origin_host);
+				_lookup_cache_hit_count++;
 
-				return false;
+				auto &[result, cached_origin_host] = cache_item->second.result;
+				origin_host = cached_origin_host;
+				return result;
 			}
+
+			_lookup_cache.erase(cache_item);
+		}
+
+		auto pending_item = _pending_lookups.find(app_stream_name);
+		if (pending_item != _pending_lookups.end())
+		{
+			_lookup_coalesced_count++;
+			pending_lookup = pending_item->second;
 		}
 		else
 		{
-			logte("Failed to get origin host from redis : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply_type, reply_str.CStr());
-			return false;
+			promise = std::make_shared<std::promise<LookupResult>>();
+			pending_lookup = promise->get_future().share();
+			_pending_lookups.emplace(app_stream_name, pending_lookup);
 		}
 	}
 
-	if (same_registered == false)
+	if (promise != nullptr)
 	{
-		// Set origin host to redis
-		// The EXPIRE option is to prevent locking the app/stream when OvenMediaEngine unexpectedly stops.
-		// So _update_timer updates the expire time once every 2.5 seconds.
-		// If it is successful, it will return REDIS_REPLY_STATUS with "OK".
-		auto [reply_type, reply_str] = CommandToRedis("SET %s %s EX %d NX", app_stream_name.CStr(), origin_host.CStr(), ORIGIN_MAP_STORE_KEY_EXPIRE_TIME);
-		if (reply_type == REDIS_ERR || reply_type == REDIS_REPLY_ERROR)
-		{
-			logte("Failed to register origin host to redis : %s:%d/%s/%s (err(%d):%s)", _redis_ip.CStr(), _redis_port, app_stream_name.CStr(), origin_host.CStr(), reply_type, reply_str.CStr());
-			return false;
-		}
-		else if (reply_type == REDIS_REPLY_NIL)
+		auto result = LookupOrigin(app_stream_name);
+
 		{
-			logte("<%s> stream is already registered.", app_stream_name.CStr());
-			AddOriginMapCandidate(app_stream_name, origin_host);
-			return false;
+			ov::LockGuard lock_guard(_lookup_mutex);
+
+			_pending_lookups.erase(app_stream_name);
+
+			if (std::get<0>(result) != CommonErrorCode::ERROR)
+			{
+				_lookup_cache[app_stream_name] = CachedLookup{result, Clock::now() + std::chrono::milliseconds(ORIGIN_MAP_LOOKUP_CACHE_TTL)};
+			}
 		}
+
+		promise->set_value(result);
+	}
+	else if (pending_lookup.wait_for(std::chrono::milliseconds(ORIGIN_MAP_STORE_COMMAND_TIMEOUT * 2)) != std::future_status::ready)
+	{
+		logte("Timed out while waiting for origin host from redis : %s:%d/%s", _redis_ip.CStr(), _redis_port, app_stream_name.CStr());
+		return CommonErrorCode::ERROR;
 	}
 
-	AddOriginMap(app_stream_name, origin_host);
+	auto &[result, found_origin_host] = pending_lookup.get();
+	if (result == CommonErrorCode::SUCCESS)
+	{
+		origin_host = found_origin_host;
+	}
 
-	logti("OriginMapStore: <%s> stream is registered with origin host : %s", app_stream_name.CStr(), origin_host.CStr());
+	return result;
+}
 
-	return true;
+ov::String OriginMapClient::MakeRelayKey(const ov::String &app_stream_name, int relay_tier)
+{
+	return ov::String::FormatString(ORIGIN_MAP_RELAY_KEY_PREFIX "%d/%s", relay_tier, app_stream_name.CStr());
 }
 
-bool OriginMapClient::RequestRegister(const ov::String &app_stream_name, const ov::String &origin_host)
+bool OriginMapClient::IsRelayKey(const ov::String &key)
 {
-	return AddOriginMapCandidate(app_stream_name, origin_host);
+	return key.HasPrefix(ORIGIN_MAP_RELAY_KEY_PREFIX);
 }
 
-bool OriginMapClient::Update(const ov::String &app_stream_name, const ov::String &origin_host)
+bool OriginMapClient::RequestRegisterRelay(const ov::String &app_stream_name, int relay_tier, const ov::String &relay_host)
 {
-	// Set origin host to redis
-	// XX option or EXPIRE cmd are not used because if redis server is restarted, update() can restore the origin stream info.
-	auto [reply_type, reply_str] = CommandToRedis("SET %s %s EX %d", app_stream_name.CStr(), origin_host.CStr(), ORIGIN_MAP_STORE_KEY_EXPIRE_TIME);
-	if (reply_type == REDIS_REPLY_STATUS && reply_str == "OK")
+	if (relay_tier <= 0)
 	{
-		// Updated
-	}
-	else if (reply_type == REDIS_REPLY_NIL)
-	{
-		logte("Failed to update origin host to redis because the key does not exist : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply_type, reply_str.CStr());
 		return false;
 	}
-	else
+
+	return RequestRegister(MakeRelayKey(app_stream_name, relay_tier), relay_host);
+}
+
+bool OriginMapClient::RequestUnregisterRelay(const ov::String &app_stream_name, int relay_tier)
+{
+	if (relay_tier <= 0)
 	{
-		logte("Failed to update origin host to redis : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply_type, reply_str.CStr());
 		return false;
 	}
 
-	return true;
+	return RequestUnregister(MakeRelayKey(app_stream_name, relay_tier));
 }
 
-bool OriginMapClient::Unregister(const ov::String &app_stream_name)
+CommonErrorCode OriginMapClient::GetUpstream(const ov::String &app_stream_name, int relay_tier, ov::String &upstream_host)
 {
-	if (DeleteOriginMap(app_stream_name) == true)
+	for (int tier = relay_tier - 1; tier > 0; tier--)
 	{
-		auto [reply_type, reply_str] = CommandToRedis("DEL %s", app_stream_name.CStr());
-		if (reply_type == REDIS_ERR || reply_type == REDIS_REPLY_ERROR)
+		auto result = GetOrigin(MakeRelayKey(app_stream_name, tier), upstream_host);
+		if (result == CommonErrorCode::SUCCESS)
 		{
-			logte("Failed to delete origin host from redis : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply_type, reply_str.CStr());
-			return false;
+			return result;
 		}
-	}
 
-	logti("OriginMapStore: <%s> stream is unregistered.", app_stream_name.CStr());
+		// If a tier has no relay (or redis fails to answer), try the next one down to the origin
+	}
 
-	return true;
+	return GetOrigin(app_stream_name, upstream_host);
 }
 
-CommonErrorCode OriginMapClient::GetOrigin(const ov::String &app_stream_name, ov::String &origin_host)
+OriginMapClient::LookupResult OriginMapClient::LookupOrigin(const ov::String &app_stream_name)
 {
-	auto [reply_type, reply_str] = CommandToRedis("GET %s", app_stream_name.CStr());
-	if (reply_type == REDIS_ERR || reply_type == REDIS_REPLY_ERROR)
-	{
-		logte("Failed to get origin host from redis : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply_type, reply_str.CStr());
-		return CommonErrorCode::ERROR;
-	}
-	else if (reply_type == REDIS_REPLY_NIL)
-	{
-		return CommonErrorCode::NOT_FOUND;
-	}
-
-	origin_host = reply_str;
+	ov::StopWatch watch;
+	watch.Start();
 
-	return CommonErrorCode::SUCCESS;
-}
+	auto replies = _redis_client->SendCommandsAndWait({{"GET", app_stream_name}});
+	auto &reply = replies[0];
 
-bool OriginMapClient::ConnectRedis()
-{
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+	auto latency_usec = static_cast<uint64_t>(watch.ElapsedUs());
+	_lookup_total_latency_usec += latency_usec;
 
-	if (CheckConnection() == true)
+	auto max_latency_usec = _lookup_max_latency_usec.load();
+	while ((latency_usec > max_latency_usec) && (_lookup_max_latency_usec.compare_exchange_weak(max_latency_usec, latency_usec) == false))
 	{
-		return true;
 	}
 
-	// connect to redis server
-	_redis_context = redisConnect(_redis_ip.CStr(), _redis_port);
-	if (_redis_context == nullptr || _redis_context->err)
+	if (reply.type == REDIS_ERR || reply.type == REDIS_REPLY_ERROR)
 	{
-		if (_redis_context == nullptr)
-		{
-			redisFree(_redis_context);
-			_redis_context = nullptr;
-		}
-
-		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", _redis_ip.CStr(), _redis_port, _redis_context->errstr);
-		return false;
+		logte("Failed to get origin host from redis : %s:%d (err(%d):%s)", _redis_ip.CStr(), _redis_port, reply.type, reply.str.CStr());
+		return {CommonErrorCode::ERROR, ""};
 	}
-
-	// Auth
-	if (_redis_password.IsEmpty() == false)
+	else if (reply.type == REDIS_REPLY_NIL)
 	{
-		redisReply *reply = (redisReply *)redisCommand(_redis_context, "AUTH %s", _redis_password.CStr());
-		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
-		{
-			logte("Failed to auth to redis server. ip: %s, port: %d, err: %s", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
-
-			if (reply != nullptr)
-			{
-				freeReplyObject(reply);
-			}
-			
-			return false;
-		}
+		return {CommonErrorCode::NOT_FOUND, ""};
 	}
 
-	return true;
+	return {CommonErrorCode::SUCCESS, reply.str};
 }
 
-bool OriginMapClient::CheckConnection()
+void OriginMapClient::InvalidateLookup(const ov::String &app_stream_name)
 {
-	if (_redis_context == nullptr)
-	{
-		return false;
-	}
-
-	// Test with PING command
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "PING");
-	if (reply == nullptr)
-	{
-		return false;
-	}
-
-	return true;
+	ov::LockGuard lock_guard(_lookup_mutex);
+	_lookup_cache.erase(app_stream_name);
 }
 
-std::tuple<int, ov::String> OriginMapClient::CommandToRedis(const char *format, ...)
+void OriginMapClient::PurgeExpiredLookups()
 {
-	if (ConnectRedis() == false)
-	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
-		return { REDIS_ERR, "Failed to connect redis server" };
-	}
+	ov::LockGuard lock_guard(_lookup_mutex);
 
-	std::unique_lock<std::mutex> lock(_redis_context_mutex);
+	auto now = Clock::now();
 
-	va_list args;
-	va_start(args, format);
-	redisReply *reply = (redisReply *)redisvCommand(_redis_context, format, args);
-	va_end(args);
-
-	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+	for (auto item = _lookup_cache.begin(); item != _lookup_cache.end();)
 	{
-		logte("Failed to execute command to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
-		return { REDIS_ERR, reply!=nullptr?reply->str:"Failed to execute command to redis" };
+		if (item->second.expire_time <= now)
+		{
+			item = _lookup_cache.erase(item);
+		}
+		else
+		{
+			++item;
+		}
 	}
+}
 
-	int reply_type = reply->type;
-	ov::String reply_str;
-	if (reply->type == REDIS_REPLY_STRING)
-	{
-		reply_str = reply->str;
-	}
-	else if (reply->type == REDIS_REPLY_INTEGER)
-	{
-		reply_str = ov::Converter::ToString((int64_t)reply->integer);
-	}
-	else if (reply->type == REDIS_REPLY_NIL)
-	{
-		reply_str = "NIL";
-	}
-	else if (reply->type == REDIS_REPLY_STATUS)
-	{
-		reply_str = reply->str;
-	}
-	else if (reply->type == REDIS_REPLY_ARRAY)
-	{
-		reply_str = ov::Converter::ToString((int)reply->elements) + " elements";
-	}
-	else
+OriginMapClient::Stats OriginMapClient::GetStats() const
+{
+	Stats stats;
+
+	stats.lookup_count = _lookup_count;
+	stats.lookup_cache_hit_count = _lookup_cache_hit_count;
+	stats.lookup_coalesced_count = _lookup_coalesced_count;
+	stats.lookup_total_latency_usec = _lookup_total_latency_usec;
+	stats.lookup_max_latency_usec = _lookup_max_latency_usec;
+	stats.keepalive_stream_count = _keepalive_stream_count;
+	stats.keepalive_latency_usec = _keepalive_latency_usec;
+
+	if (_redis_client != nullptr)
 	{
-		reply_str = "Unknown type";
+		stats.redis = _redis_client->GetStats();
 	}
 
-	freeReplyObject(reply);
-
-	return { reply_type, reply_str };
+	return stats;
 }
@@ -11,46 +11,94 @@
 #include <base/common_types.h>
 #include <base/ovlibrary/ovlibrary.h>
 #include <base/ovlibrary/delay_queue.h>
-#include <hiredis/hiredis.h>
+
+#include <future>
+#include <unordered_map>
+
+#include "redis_async_client.h"
 
 // redis key expire time (sec)
 #define ORIGIN_MAP_STORE_KEY_EXPIRE_TIME 10
+// redis command timeout (msec)
+#define ORIGIN_MAP_STORE_COMMAND_TIMEOUT 3000
+// How long the result of GetOrigin() is reused (msec)
+#define ORIGIN_MAP_LOOKUP_CACHE_TTL 1000
+// Prefix of the keys of relay tiers
+#define ORIGIN_MAP_RELAY_KEY_PREFIX "relay/"
 
 // If Origins-Edges cluster uses OriginMapStore, app/stream must be unique in the cluster.
 class OriginMapClient
 {
 public:
+	struct Stats
+	{
+		uint64_t lookup_count = 0;
+		uint64_t lookup_cache_hit_count = 0;
+		// Lookups that waited for the same lookup of another thread
+		uint64_t lookup_coalesced_count = 0;
+		// Lookups sent to redis
+		uint64_t lookup_total_latency_usec = 0;
+		uint64_t lookup_max_latency_usec = 0;
+
+		// The last keep-alive batch
+		size_t keepalive_stream_count = 0;
+		uint64_t keepalive_latency_usec = 0;
+
+		RedisAsyncClient::Stats redis;
+	};
+
 	// redis_host: redis server host (ex: 192.168.0.160:6379)
 	// redis_password: redis server password (ex: password!@#)
 	OriginMapClient(const ov::String &redis_host, const ov::String &redis_password);
+	~OriginMapClient();
 
 	// Non-blocking request to register origin host
-	bool RequestRegister(const ov::String &app_stream_name, const ov::String &origin_host); 
+	bool RequestRegister(const ov::String &app_stream_name, const ov::String &origin_host);
 	bool RequestUnregister(const ov::String &app_stream_name);
 
+	// Concurrent lookups of the same app/stream share one redis query, and the result is reused for ORIGIN_MAP_LOOKUP_CACHE_TTL
 	CommonErrorCode GetOrigin(const ov::String &app_stream_name, ov::String &origin_host);
 
+	// Relay tiers
+	//
+	// A server of relay tier N (N > 0) that relays app/stream registers itself under
+	// "relay/<N>/<app/stream>", and pulls the stream from the nearest tier below it that has a relay,
+	// or from the origin. Only one server per tier and stream holds the key; the others keep retrying,
+	// and take over when the key expires.
+	static ov::String MakeRelayKey(const ov::String &app_stream_name, int relay_tier);
+	static bool IsRelayKey(const ov::String &key);
+
+	bool RequestRegisterRelay(const ov::String &app_stream_name, int relay_tier, const ov::String &relay_host);
+	bool RequestUnregisterRelay(const ov::String &app_stream_name, int relay_tier);
+
+	// Finds the server a server of <relay_tier> pulls app/stream from. With relay_tier 0, same as GetOrigin().
+	CommonErrorCode GetUpstream(const ov::String &app_stream_name, int relay_tier, ov::String &upstream_host);
+
+	Stats GetStats() const;
+
 private:
-	// if return false, it means that the app_stream_name is already registered from other origin server
-	// app_stream_name : app/stream name (ex: app/stream)
-	// origin_host : OVT provided origin host info (ex: 192.168.0.160:9000)
-	bool Register(const ov::String &app_stream_name, const ov::String &origin_host);
-	bool Update(const ov::String &app_stream_name, const ov::String &origin_host);
-	bool Unregister(const ov::String &app_stream_name);
+	using LookupResult = std::tuple<CommonErrorCode, ov::String>;
+	using Clock = std::chrono::steady_clock;
 
-	bool CheckConnection();
-	bool ConnectRedis();
+	struct CachedLookup
+	{
+		LookupResult result;
+		Clock::time_point expire_time;
+	};
 
+	// Each of them sends its commands to redis in one batch, and waits for the replies in the timer thread
 	bool NofifyStreamsAlive();
 	bool RetryRegister();
 	bool ProcessPendingUnregisters();
 
-	std::tuple<int, ov::String> CommandToRedis(const char *format, ...);
-
 	bool AddOriginMap(const ov::String &app_stream_name, const ov::String &origin_host);
 	bool AddOriginMapCandidate(const ov::String &app_stream_name, const ov::String &origin_host);
 	bool DeleteOriginMap(const ov::String &app_stream_name);
 
+	LookupResult LookupOrigin(const ov::String &app_stream_name);
+	void InvalidateLookup(const ov::String &app_stream_name);
+	void PurgeExpiredLookups();
+
 	ov::String _redis_ip;
 	uint16_t _redis_port;
 	ov::String _redis_password;
@@ -62,6 +110,18 @@ private:
 	std::deque<ov::String> _origin_map_remove_candidates;
 	std::recursive_mutex _origin_map_mutex;
 
-	redisContext *_redis_context = nullptr;
-	std::mutex _redis_context_mutex;
-};
\ No newline at end of file
+	std::shared_ptr<RedisAsyncClient> _redis_client;
+
+	mutable ov::Mutex _lookup_mutex;
+	std::unordered_map<ov::String, CachedLookup> _lookup_cache OV_GUARDED_BY(_lookup_mutex);
+	// Lookups in flight
+	std::unordered_map<ov::String, std::shared_future<LookupResult>> _pending_lookups OV_GUARDED_BY(_lookup_mutex);
+
+	std::atomic<uint64_t> _lookup_count{0};
+	std::atomic<uint64_t> _lookup_cache_hit_count{0};
+	std::atomic<uint64_t> _lookup_coalesced_count{0};
+	std::atomic<uint64_t> _lookup_total_latency_usec{0};
+	std::atomic<uint64_t> _lookup_max_latency_usec{0};
+	std::atomic<size_t> _keepalive_stream_count{0};
+	std::atomic<uint64_t> _keepalive_latency_usec{0};
+};
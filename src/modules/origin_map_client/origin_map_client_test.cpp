@@ -0,0 +1,450 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "origin_map_client.h"
+
+namespace
+{
+	// Speaks enough RESP to stand in for redis: AUTH, PING, GET, SET [EX n] [NX], DEL
+	class RespStubServer
+	{
+	public:
+		RespStubServer()
+		{
+			_listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+			int reuse = 1;
+			::setsockopt(_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+			sockaddr_in address{};
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+			::bind(_listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+			::listen(_listen_fd, 16);
+
+			socklen_t length = sizeof(address);
+			::getsockname(_listen_fd, reinterpret_cast<sockaddr *>(&address), &length);
+			_port = ntohs(address.sin_port);
+
+			_thread = std::thread(&RespStubServer::AcceptLoop, this);
+		}
+
+		~RespStubServer()
+		{
+			_stop = true;
+			_thread.join();
+			::close(_listen_fd);
+		}
+
+		ov::String GetHost() const
+		{
+			return ov::String::FormatString("127.0.0.1:%d", _port);
+		}
+
+		void SetGetDelay(int delay_msec)
+		{
+			_get_delay_msec = delay_msec;
+		}
+
+		void SetValue(const ov::String &key, const ov::String &value)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+			_values[key] = value;
+		}
+
+		std::optional<ov::String> GetValue(const ov::String &key)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			auto item = _values.find(key);
+			if (item == _values.end())
+			{
+				return std::nullopt;
+			}
+
+			return item->second;
+		}
+
+		int GetCommandCount(const ov::String &name)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+			return _command_counts[name];
+		}
+
+		// The largest number of commands that arrived in one read
+		int GetMaxPipelinedCount() const
+		{
+			return _max_pipelined_count;
+		}
+
+	private:
+		void AcceptLoop()
+		{
+			std::vector<std::thread> connections;
+
+			while (_stop == false)
+			{
+				pollfd poll_fd{_listen_fd, POLLIN, 0};
+				if (::poll(&poll_fd, 1, 50) <= 0)
+				{
+					continue;
+				}
+
+				int client_fd = ::accept(_listen_fd, nullptr, nullptr);
+				if (client_fd >= 0)
+				{
+					connections.emplace_back(&RespStubServer::Serve, this, client_fd);
+				}
+			}
+
+			for (auto &connection : connections)
+			{
+				connection.join();
+			}
+		}
+
+		// Returns the number of bytes of a complete command at the beginning of <buffer>, or 0
+		static size_t ParseCommand(const std::string &buffer, std::vector<std::string> &arguments)
+		{
+			size_t position = 0;
+
+			auto read_line = [&](std::string &line) -> bool {
+				auto end = buffer.find("\r\n", position);
+				if (end == std::string::npos)
+				{
+					return false;
+				}
+
+				line = buffer.substr(position, end - position);
+				position = end + 2;
+				return true;
+			};
+
+			std::string line;
+			if ((read_line(line) == false) || line.empty() || (line[0] != '*'))
+			{
+				return 0;
+			}
+
+			auto count = std::stoi(line.substr(1));
+			arguments.clear();
+
+			for (int index = 0; index < count; index++)
+			{
+				if ((read_line(line) == false) || line.empty() || (line[0] != '$'))
+				{
+					return 0;
+				}
+
+				size_t length = std::stoul(line.substr(1));
+				if (buffer.size() < position + length + 2)
+				{
+					return 0;
+				}
+
+				arguments.push_back(buffer.substr(position, length));
+				position += length + 2;
+			}
+
+			return position;
+		}
+
+		std::string Execute(const std::vector<std::string> &arguments)
+		{
+			auto name = ov::String(arguments[0].c_str()).UpperCaseString();
+
+			if (name == "GET")
+			{
+				for (int waited = 0; (waited < _get_delay_msec) && (_stop == false); waited += 10)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				}
+			}
+
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			_command_counts[name]++;
+
+			if ((name == "AUTH") || (name == "PING"))
+			{
+				return "+OK\r\n";
+			}
+
+			if ((name == "GET") && (arguments.size() == 2))
+			{
+				auto item = _values.find(arguments[1].c_str());
+				if (item == _values.end())
+				{
+					return "$-1\r\n";
+				}
+
+				return ov::String::FormatString("$%zu\r\n%s\r\n", item->second.GetLength(), item->second.CStr()).CStr();
+			}
+
+			if ((name == "SET") && (arguments.size() >= 3))
+			{
+				bool nx = std::find(arguments.begin(), arguments.end(), "NX") != arguments.end();
+
+				if (nx && (_values.find(arguments[1].c_str()) != _values.end()))
+				{
+					return "$-1\r\n";
+				}
+
+				_values[arguments[1].c_str()] = arguments[2].c_str();
+				return "+OK\r\n";
+			}
+
+			if ((name == "DEL") && (arguments.size() == 2))
+			{
+				return (_values.erase(arguments[1].c_str()) > 0) ? ":1\r\n" : ":0\r\n";
+			}
+
+			return "-ERR unknown command\r\n";
+		}
+
+		void Serve(int client_fd)
+		{
+			std::string buffer;
+			char data[4096];
+
+			while (_stop == false)
+			{
+				pollfd poll_fd{client_fd, POLLIN, 0};
+				if (::poll(&poll_fd, 1, 50) <= 0)
+				{
+					continue;
+				}
+
+				auto read_bytes = ::recv(client_fd, data, sizeof(data), 0);
+				if (read_bytes <= 0)
+				{
+					break;
+				}
+
+				buffer.append(data, read_bytes);
+
+				std::vector<std::string> arguments;
+				std::string responses;
+				int count = 0;
+
+				while (auto length = ParseCommand(buffer, arguments))
+				{
+					buffer.erase(0, length);
+					responses += Execute(arguments);
+					count++;
+				}
+
+				if (count > _max_pipelined_count)
+				{
+					_max_pipelined_count = count;
+				}
+
+				::send(client_fd, responses.data(), responses.size(), MSG_NOSIGNAL);
+			}
+
+			::close(client_fd);
+		}
+
+		int _listen_fd = -1;
+		int _port = 0;
+		std::thread _thread;
+		std::atomic<bool> _stop{false};
+		std::atomic<int> _get_delay_msec{0};
+		std::atomic<int> _max_pipelined_count{0};
+
+		std::mutex _mutex;
+		std::map<ov::String, ov::String> _values;
+		std::map<ov::String, int> _command_counts;
+	};
+
+	template <typename Tcondition>
+	bool WaitUntil(Tcondition condition, int timeout_msec = 5000)
+	{
+		for (int waited = 0; waited < timeout_msec; waited += 10)
+		{
+			if (condition())
+			{
+				return true;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+
+		return condition();
+	}
+}  // namespace
+
+TEST(OriginMapClient, RegisterLookupAndUnregister)
+{
+	RespStubServer server;
+	OriginMapClient client(server.GetHost(), "password");
+
+	ASSERT_TRUE(client.RequestRegister("app/stream", "192.168.0.160:9000"));
+	ASSERT_TRUE(WaitUntil([&] { return server.GetValue("app/stream").has_value(); }));
+	EXPECT_EQ(server.GetValue("app/stream").value(), "192.168.0.160:9000");
+	EXPECT_GE(server.GetCommandCount("AUTH"), 1);
+
+	ov::String origin_host;
+	EXPECT_EQ(client.GetOrigin("app/stream", origin_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(origin_host, "192.168.0.160:9000");
+	EXPECT_EQ(client.GetOrigin("app/unknown", origin_host), CommonErrorCode::NOT_FOUND);
+
+	ASSERT_TRUE(client.RequestUnregister("app/stream"));
+	EXPECT_TRUE(WaitUntil([&] { return server.GetValue("app/stream").has_value() == false; }));
+}
+
+// Registering a stream that another origin owns fails, and is retried
+TEST(OriginMapClient, RegisterConflict)
+{
+	RespStubServer server;
+	server.SetValue("app/stream", "10.0.0.1:9000");
+
+	OriginMapClient client(server.GetHost(), "");
+	client.RequestRegister("app/stream", "10.0.0.2:9000");
+
+	EXPECT_TRUE(WaitUntil([&] { return server.GetCommandCount("GET") >= 2; }));
+	EXPECT_EQ(server.GetValue("app/stream").value(), "10.0.0.1:9000");
+}
+
+// A relay pulls from the nearest lower tier that has a relay, or from the origin
+TEST(OriginMapClient, RelayTierUpstream)
+{
+	RespStubServer server;
+	server.SetValue("app/stream", "ovt://origin:9000/app/stream");
+
+	OriginMapClient client(server.GetHost(), "");
+	ov::String upstream_host;
+
+	EXPECT_EQ(client.GetUpstream("app/stream", 0, upstream_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(upstream_host, "ovt://origin:9000/app/stream");
+	EXPECT_EQ(client.GetUpstream("app/stream", 3, upstream_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(upstream_host, "ovt://origin:9000/app/stream");
+
+	ASSERT_TRUE(client.RequestRegisterRelay("app/stream", 1, "ovt://mid1:9000/app/stream"));
+	ASSERT_TRUE(WaitUntil([&] { return server.GetValue("relay/1/app/stream").has_value(); }));
+
+	// Lookups are cached for a while
+	std::this_thread::sleep_for(std::chrono::milliseconds(ORIGIN_MAP_LOOKUP_CACHE_TTL + 100));
+
+	// A relay of tier 1 still pulls from the origin
+	EXPECT_EQ(client.GetUpstream("app/stream", 1, upstream_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(upstream_host, "ovt://origin:9000/app/stream");
+	EXPECT_EQ(client.GetUpstream("app/stream", 3, upstream_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(upstream_host, "ovt://mid1:9000/app/stream");
+
+	// Only one relay of a tier holds the key
+	auto get_count = server.GetCommandCount("GET");
+	OriginMapClient standby_client(server.GetHost(), "");
+	standby_client.RequestRegisterRelay("app/stream", 1, "ovt://mid2:9000/app/stream");
+	EXPECT_TRUE(WaitUntil([&] { return server.GetCommandCount("GET") >= get_count + 2; }));
+	EXPECT_EQ(server.GetValue("relay/1/app/stream").value(), "ovt://mid1:9000/app/stream");
+
+	ASSERT_TRUE(client.RequestUnregisterRelay("app/stream", 1));
+	EXPECT_TRUE(WaitUntil([&] { return server.GetValue("relay/1/app/stream").value_or("") == "ovt://mid2:9000/app/stream"; }));
+}
+
+TEST(OriginMapClient, LookupIsCachedAndCoalesced)
+{
+	constexpr int THREAD_COUNT = 8;
+
+	RespStubServer server;
+	server.SetValue("app/stream", "10.0.0.1:9000");
+	server.SetGetDelay(200);
+
+	OriginMapClient client(server.GetHost(), "");
+
+	std::vector<std::thread> threads;
+	std::atomic<int> success_count{0};
+
+	for (int index = 0; index < THREAD_COUNT; index++)
+	{
+		threads.emplace_back([&] {
+			ov::String origin_host;
+			if ((client.GetOrigin("app/stream", origin_host) == CommonErrorCode::SUCCESS) && (origin_host == "10.0.0.1:9000"))
+			{
+				success_count++;
+			}
+		});
+	}
+
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ(success_count, THREAD_COUNT);
+	EXPECT_EQ(server.GetCommandCount("GET"), 1);
+
+	ov::String origin_host;
+	EXPECT_EQ(client.GetOrigin("app/stream", origin_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(server.GetCommandCount("GET"), 1);
+
+	auto stats = client.GetStats();
+	EXPECT_EQ(stats.lookup_count, static_cast<uint64_t>(THREAD_COUNT + 1));
+	EXPECT_EQ(stats.lookup_coalesced_count + stats.lookup_cache_hit_count, static_cast<uint64_t>(THREAD_COUNT));
+	EXPECT_GE(stats.lookup_max_latency_usec, 200000u);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(ORIGIN_MAP_LOOKUP_CACHE_TTL + 100));
+
+	EXPECT_EQ(client.GetOrigin("app/stream", origin_host), CommonErrorCode::SUCCESS);
+	EXPECT_EQ(server.GetCommandCount("GET"), 2);
+}
+
+// Keep-alives of all registered streams are sent in one batch
+TEST(OriginMapClient, KeepAlivesArePipelined)
+{
+	constexpr int STREAM_COUNT = 20;
+
+	RespStubServer server;
+	OriginMapClient client(server.GetHost(), "");
+
+	for (int index = 0; index < STREAM_COUNT; index++)
+	{
+		client.RequestRegister(ov::String::FormatString("app/stream%d", index), "10.0.0.1:9000");
+	}
+
+	EXPECT_TRUE(WaitUntil([&] { return client.GetStats().keepalive_stream_count == STREAM_COUNT; }));
+	EXPECT_GE(server.GetMaxPipelinedCount(), STREAM_COUNT);
+
+	auto stats = client.GetStats();
+	EXPECT_EQ(stats.redis.error_count, 0u);
+	EXPECT_GT(stats.redis.command_count, static_cast<uint64_t>(STREAM_COUNT * 2));
+}
+
+TEST(OriginMapClient, UnreachableServer)
+{
+	uint16_t port;
+
+	{
+		// A port nobody listens on
+		RespStubServer server;
+		port = ov::Converter::ToUInt16(server.GetHost().Split(":")[1]);
+	}
+
+	OriginMapClient client(ov::String::FormatString("127.0.0.1:%d", port), "");
+
+	ov::String origin_host;
+	EXPECT_EQ(client.GetOrigin("app/stream", origin_host), CommonErrorCode::ERROR);
+	EXPECT_GE(client.GetStats().redis.error_count, 1u);
+}
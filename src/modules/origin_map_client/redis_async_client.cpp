@@ -0,0 +1,563 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "redis_async_client.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <future>
+
+#define OV_LOG_TAG "RedisClient"
+
+// Commands sent while the server is unreachable fail immediately until this interval has passed
+#define REDIS_RECONNECT_INTERVAL_MSEC 1000
+#define REDIS_MAX_EPOLL_EVENTS 8
+
+RedisAsyncClient::RedisAsyncClient(const ov::String &ip, uint16_t port, const ov::String &password, uint32_t timeout_msec)
+	: _ip(ip),
+	  _port(port),
+	  _password(password),
+	  _timeout_msec(timeout_msec)
+{
+}
+
+RedisAsyncClient::~RedisAsyncClient()
+{
+	Stop();
+}
+
+bool RedisAsyncClient::Start()
+{
+	_epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+	_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if ((_epoll_fd < 0) || (_event_fd < 0))
+	{
+		logte("Could not create epoll/eventfd: %s", ov::Error::CreateErrorFromErrno()->What());
+		Stop();
+		return false;
+	}
+
+	epoll_event event{};
+	event.events = EPOLLIN;
+	event.data.fd = _event_fd;
+	::epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _event_fd, &event);
+
+	_stop = false;
+	_thread = std::thread(&RedisAsyncClient::Run, this);
+	pthread_setname_np(_thread.native_handle(), "RedisClient");
+
+	return true;
+}
+
+void RedisAsyncClient::Stop()
+{
+	if (_thread.joinable())
+	{
+		_stop = true;
+		Wakeup();
+		_thread.join();
+	}
+
+	if (_event_fd >= 0)
+	{
+		::close(_event_fd);
+		_event_fd = -1;
+	}
+
+	if (_epoll_fd >= 0)
+	{
+		::close(_epoll_fd);
+		_epoll_fd = -1;
+	}
+}
+
+void RedisAsyncClient::SendCommand(Command command, ReplyHandler handler)
+{
+	std::vector<QueuedCommand> commands;
+	commands.push_back({std::move(command), std::move(handler), Clock::now()});
+
+	Enqueue(std::move(commands));
+}
+
+void RedisAsyncClient::SendCommands(std::vector<Command> commands, BatchReplyHandler handler)
+{
+	if (commands.empty())
+	{
+		handler({});
+		return;
+	}
+
+	struct Batch
+	{
+		std::vector<Reply> replies;
+		size_t remaining;
+		BatchReplyHandler handler;
+	};
+
+	// Replies are handled in the loop thread only, so the batch doesn't need a lock
+	auto batch = std::make_shared<Batch>();
+	batch->replies.resize(commands.size());
+	batch->remaining = commands.size();
+	batch->handler = std::move(handler);
+
+	auto now = Clock::now();
+	std::vector<QueuedCommand> queued_commands;
+	queued_commands.reserve(commands.size());
+
+	for (size_t index = 0; index < commands.size(); index++)
+	{
+		queued_commands.push_back({std::move(commands[index]), [batch, index](const Reply &reply) {
+									   batch->replies[index] = reply;
+
+									   if (--batch->remaining == 0)
+									   {
+										   batch->handler(std::move(batch->replies));
+									   }
+								   },
+								   now});
+	}
+
+	Enqueue(std::move(queued_commands));
+}
+
+std::vector<RedisAsyncClient::Reply> RedisAsyncClient::SendCommandsAndWait(std::vector<Command> commands)
+{
+	auto count = commands.size();
+	// The replies may arrive after this function gave up waiting
+	auto promise = std::make_shared<std::promise<std::vector<Reply>>>();
+	auto future = promise->get_future();
+
+	SendCommands(std::move(commands), [promise](std::vector<Reply> replies) {
+		promise->set_value(std::move(replies));
+	});
+
+	// hiredis fails the commands after the timeout, this is a safety net for a stuck loop
+	if (future.wait_for(std::chrono::milliseconds(_timeout_msec * 2)) != std::future_status::ready)
+	{
+		std::vector<Reply> replies(count);
+
+		for (auto &reply : replies)
+		{
+			reply.str = "Timed out";
+		}
+
+		return replies;
+	}
+
+	return future.get();
+}
+
+RedisAsyncClient::Stats RedisAsyncClient::GetStats() const
+{
+	Stats stats;
+
+	stats.command_count = _command_count;
+	stats.error_count = _error_count;
+	stats.total_latency_usec = _total_latency_usec;
+	stats.max_latency_usec = _max_latency_usec;
+
+	return stats;
+}
+
+void RedisAsyncClient::Enqueue(std::vector<QueuedCommand> commands)
+{
+	bool need_wakeup;
+
+	{
+		ov::LockGuard lock_guard(_queue_mutex);
+
+		need_wakeup = _queue.empty();
+
+		if (need_wakeup)
+		{
+			_queue = std::move(commands);
+		}
+		else
+		{
+			std::move(commands.begin(), commands.end(), std::back_inserter(_queue));
+		}
+	}
+
+	if (need_wakeup)
+	{
+		Wakeup();
+	}
+}
+
+void RedisAsyncClient::Wakeup()
+{
+	uint64_t value = 1;
+	[[maybe_unused]] auto written = ::write(_event_fd, &value, sizeof(value));
+}
+
+void RedisAsyncClient::Run()
+{
+	epoll_event events[REDIS_MAX_EPOLL_EVENTS];
+
+	while (_stop == false)
+	{
+		int timeout_msec = -1;
+
+		if (_timer_deadline.has_value())
+		{
+			auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(_timer_deadline.value() - Clock::now()).count();
+			timeout_msec = std::max<int64_t>(remaining + 1, 0);
+		}
+
+		auto count = ::epoll_wait(_epoll_fd, events, REDIS_MAX_EPOLL_EVENTS, timeout_msec);
+
+		for (int index = 0; index < count; index++)
+		{
+			auto &event = events[index];
+
+			if (event.data.fd == _event_fd)
+			{
+				uint64_t value;
+				[[maybe_unused]] auto read_bytes = ::read(_event_fd, &value, sizeof(value));
+				continue;
+			}
+
+			if ((_context == nullptr) || (event.data.fd != _context_fd))
+			{
+				// The connection was closed while handling a previous event
+				continue;
+			}
+
+			if (event.events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+			{
+				redisAsyncHandleRead(_context);
+			}
+
+			if ((_context != nullptr) && (event.events & EPOLLOUT))
+			{
+				redisAsyncHandleWrite(_context);
+			}
+		}
+
+		if (_timer_deadline.has_value() && (_timer_deadline.value() <= Clock::now()))
+		{
+			_timer_deadline.reset();
+
+			if (_context != nullptr)
+			{
+				// Fails the commands waiting for a reply, and closes the connection
+				redisAsyncHandleTimeout(_context);
+			}
+		}
+
+		FlushQueue();
+	}
+
+	if (_context != nullptr)
+	{
+		// Commands waiting for a reply are completed with an error
+		redisAsyncFree(_context);
+	}
+
+	FlushQueue();
+}
+
+void RedisAsyncClient::FlushQueue()
+{
+	std::vector<QueuedCommand> queue;
+
+	{
+		ov::LockGuard lock_guard(_queue_mutex);
+		queue.swap(_queue);
+	}
+
+	if (queue.empty())
+	{
+		return;
+	}
+
+	if ((_stop == false) && Connect())
+	{
+		for (auto &queued_command : queue)
+		{
+			auto &command = queued_command.command;
+			std::vector<const char *> argv;
+			std::vector<size_t> argv_length;
+
+			argv.reserve(command.size());
+			argv_length.reserve(command.size());
+
+			for (auto &argument : command)
+			{
+				argv.push_back(argument.CStr());
+				argv_length.push_back(argument.GetLength());
+			}
+
+			auto pending_command = std::make_unique<PendingCommand>(PendingCommand{this, std::move(queued_command)});
+
+			if (redisAsyncCommandArgv(_context, OnReply, pending_command.get(), static_cast<int>(argv.size()), argv.data(), argv_length.data()) == REDIS_OK)
+			{
+				// Owned by hiredis until OnReply()
+				pending_command.release();
+			}
+			else
+			{
+				Complete(pending_command->queued_command, {REDIS_ERR, "Could not send the command"});
+			}
+		}
+
+		return;
+	}
+
+	for (auto &queued_command : queue)
+	{
+		Complete(queued_command, {REDIS_ERR, "Not connected to redis server"});
+	}
+}
+
+bool RedisAsyncClient::Connect()
+{
+	if (_context != nullptr)
+	{
+		return true;
+	}
+
+	auto now = Clock::now();
+
+	if (_last_connect_time.has_value() && ((now - _last_connect_time.value()) < std::chrono::milliseconds(REDIS_RECONNECT_INTERVAL_MSEC)))
+	{
+		return false;
+	}
+
+	_last_connect_time = now;
+
+	struct timeval timeout;
+	timeout.tv_sec = _timeout_msec / 1000;
+	timeout.tv_usec = (_timeout_msec % 1000) * 1000;
+
+	redisOptions options{};
+	REDIS_OPTIONS_SET_TCP(&options, _ip.CStr(), _port);
+	options.connect_timeout = &timeout;
+	options.command_timeout = &timeout;
+
+	auto context = redisAsyncConnectWithOptions(&options);
+	if (context == nullptr)
+	{
+		logte("Failed to connect to redis server. ip: %s, port: %d", _ip.CStr(), _port);
+		return false;
+	}
+
+	if (context->err)
+	{
+		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", _ip.CStr(), _port, context->errstr);
+		redisAsyncFree(context);
+		return false;
+	}
+
+	context->data = this;
+	context->ev.data = this;
+	context->ev.addRead = AddRead;
+	context->ev.delRead = DelRead;
+	context->ev.addWrite = AddWrite;
+	context->ev.delWrite = DelWrite;
+	context->ev.cleanup = Cleanup;
+	context->ev.scheduleTimer = ScheduleTimer;
+
+	redisAsyncSetConnectCallback(context, OnConnect);
+	redisAsyncSetDisconnectCallback(context, OnDisconnect);
+
+	_context = context;
+	_context_fd = context->c.fd;
+	_reading = false;
+	_writing = false;
+
+	epoll_event event{};
+	event.events = 0;
+	event.data.fd = _context_fd;
+	::epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _context_fd, &event);
+
+	if (_password.IsEmpty() == false)
+	{
+		// Sent before any other command of this connection
+		const char *argv[] = {"AUTH", _password.CStr()};
+		const size_t argv_length[] = {4, _password.GetLength()};
+
+		auto pending_command = std::make_unique<PendingCommand>();
+		pending_command->client = this;
+		pending_command->queued_command.queued_time = now;
+		pending_command->queued_command.handler = [this](const Reply &reply) {
+			if (reply.type == REDIS_REPLY_ERROR || reply.type == REDIS_ERR)
+			{
+				logte("Failed to auth to redis server. ip: %s, port: %d, err: %s", _ip.CStr(), _port, reply.str.CStr());
+			}
+		};
+
+		if (redisAsyncCommandArgv(_context, OnReply, pending_command.get(), 2, argv, argv_length) == REDIS_OK)
+		{
+			pending_command.release();
+		}
+	}
+
+	return true;
+}
+
+void RedisAsyncClient::UpdateEvents()
+{
+	if (_context_fd < 0)
+	{
+		return;
+	}
+
+	epoll_event event{};
+	event.events = (_reading ? EPOLLIN : 0) | (_writing ? EPOLLOUT : 0);
+	event.data.fd = _context_fd;
+	::epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, _context_fd, &event);
+}
+
+void RedisAsyncClient::Complete(QueuedCommand &queued_command, const Reply &reply)
+{
+	auto latency_usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - queued_command.queued_time).count());
+
+	_command_count++;
+	_total_latency_usec += latency_usec;
+
+	auto max_latency_usec = _max_latency_usec.load();
+	while ((latency_usec > max_latency_usec) && (_max_latency_usec.compare_exchange_weak(max_latency_usec, latency_usec) == false))
+	{
+	}
+
+	if ((reply.type == REDIS_ERR) || (reply.type == REDIS_REPLY_ERROR))
+	{
+		_error_count++;
+	}
+
+	if (queued_command.handler != nullptr)
+	{
+		queued_command.handler(reply);
+	}
+}
+
+RedisAsyncClient::Reply RedisAsyncClient::ToReply(const redisAsyncContext *context, const redisReply *reply)
+{
+	Reply result;
+
+	if (reply == nullptr)
+	{
+		result.type = REDIS_ERR;
+		result.str = ((context != nullptr) && (context->errstr != nullptr)) ? context->errstr : "Failed to execute command to redis";
+		return result;
+	}
+
+	result.type = reply->type;
+
+	switch (reply->type)
+	{
+		case REDIS_REPLY_STRING:
+		case REDIS_REPLY_STATUS:
+		case REDIS_REPLY_ERROR:
+			result.str = ov::String(reply->str, reply->len);
+			break;
+
+		case REDIS_REPLY_INTEGER:
+			result.str = ov::Converter::ToString(static_cast<int64_t>(reply->integer));
+			break;
+
+		case REDIS_REPLY_NIL:
+			result.str = "NIL";
+			break;
+
+		case REDIS_REPLY_ARRAY:
+			result.str = ov::Converter::ToString(static_cast<int>(reply->elements)) + " elements";
+			break;
+
+		default:
+			result.str = "Unknown type";
+			break;
+	}
+
+	return result;
+}
+
+void RedisAsyncClient::OnReply(redisAsyncContext *context, void *reply, void *privdata)
+{
+	std::unique_ptr<PendingCommand> pending_command(static_cast<PendingCommand *>(privdata));
+
+	pending_command->client->Complete(pending_command->queued_command, ToReply(context, static_cast<const redisReply *>(reply)));
+}
+
+void RedisAsyncClient::OnConnect(const redisAsyncContext *context, int status)
+{
+	auto client = static_cast<RedisAsyncClient *>(context->data);
+
+	if (status != REDIS_OK)
+	{
+		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", client->_ip.CStr(), client->_port, context->errstr);
+		return;
+	}
+
+	logti("Connected to redis server. ip: %s, port: %d", client->_ip.CStr(), client->_port);
+}
+
+void RedisAsyncClient::OnDisconnect(const redisAsyncContext *context, int status)
+{
+	auto client = static_cast<RedisAsyncClient *>(context->data);
+
+	if (status != REDIS_OK)
+	{
+		logtw("Disconnected from redis server. ip: %s, port: %d, err: %s", client->_ip.CStr(), client->_port, context->errstr);
+	}
+}
+
+void RedisAsyncClient::AddRead(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->_reading = true;
+	client->UpdateEvents();
+}
+
+void RedisAsyncClient::DelRead(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->_reading = false;
+	client->UpdateEvents();
+}
+
+void RedisAsyncClient::AddWrite(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->_writing = true;
+	client->UpdateEvents();
+}
+
+void RedisAsyncClient::DelWrite(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->_writing = false;
+	client->UpdateEvents();
+}
+
+void RedisAsyncClient::Cleanup(void *privdata)
+{
+	// Called when hiredis frees the context, before the socket is closed
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+
+	if (client->_context_fd >= 0)
+	{
+		::epoll_ctl(client->_epoll_fd, EPOLL_CTL_DEL, client->_context_fd, nullptr);
+	}
+
+	client->_context = nullptr;
+	client->_context_fd = -1;
+	client->_reading = false;
+	client->_writing = false;
+	client->_timer_deadline.reset();
+}
+
+void RedisAsyncClient::ScheduleTimer(void *privdata, struct timeval tv)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->_timer_deadline = Clock::now() + std::chrono::seconds(tv.tv_sec) + std::chrono::microseconds(tv.tv_usec);
+}
@@ -0,0 +1,131 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <hiredis/async.h>
+
+#include <chrono>
+#include <optional>
+#include <thread>
+
+// Non-blocking Redis client based on the async API of hiredis.
+//
+// The connection is driven by an epoll loop in its own thread, and hiredis is only called from
+// that thread. Commands sent from other threads are queued and handed to hiredis when the loop
+// wakes up, so commands sent together go out in one write (pipelining) and their replies are
+// read back in order.
+class RedisAsyncClient
+{
+public:
+	struct Reply
+	{
+		// REDIS_REPLY_* type, or REDIS_ERR if no reply was received
+		int type = REDIS_ERR;
+		ov::String str;
+	};
+
+	struct Stats
+	{
+		uint64_t command_count = 0;
+		// Commands that were not answered or were answered with an error
+		uint64_t error_count = 0;
+		// Time from queuing a command to receiving its reply
+		uint64_t total_latency_usec = 0;
+		uint64_t max_latency_usec = 0;
+	};
+
+	// Arguments of a command, such as {"SET", key, value}
+	using Command = std::vector<ov::String>;
+	// Called from the loop thread
+	using ReplyHandler = std::function<void(const Reply &reply)>;
+	using BatchReplyHandler = std::function<void(std::vector<Reply> replies)>;
+
+	RedisAsyncClient(const ov::String &ip, uint16_t port, const ov::String &password, uint32_t timeout_msec);
+	~RedisAsyncClient();
+
+	bool Start();
+	void Stop();
+
+	void SendCommand(Command command, ReplyHandler handler);
+	// <handler> is called once with the replies of all <commands>, in the same order
+	void SendCommands(std::vector<Command> commands, BatchReplyHandler handler);
+	// Must not be called from a ReplyHandler
+	std::vector<Reply> SendCommandsAndWait(std::vector<Command> commands);
+
+	Stats GetStats() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct QueuedCommand
+	{
+		Command command;
+		ReplyHandler handler;
+		Clock::time_point queued_time;
+	};
+
+	// Passed to hiredis as the privdata of a command
+	struct PendingCommand
+	{
+		RedisAsyncClient *client;
+		QueuedCommand queued_command;
+	};
+
+	void Enqueue(std::vector<QueuedCommand> commands);
+	void Wakeup();
+
+	// Loop thread
+	void Run();
+	void FlushQueue();
+	bool Connect();
+	void UpdateEvents();
+	void Complete(QueuedCommand &queued_command, const Reply &reply);
+
+	static Reply ToReply(const redisAsyncContext *context, const redisReply *reply);
+
+	// hiredis callbacks
+	static void OnReply(redisAsyncContext *context, void *reply, void *privdata);
+	static void OnConnect(const redisAsyncContext *context, int status);
+	static void OnDisconnect(const redisAsyncContext *context, int status);
+
+	// hiredis event hooks
+	static void AddRead(void *privdata);
+	static void DelRead(void *privdata);
+	static void AddWrite(void *privdata);
+	static void DelWrite(void *privdata);
+	static void Cleanup(void *privdata);
+	static void ScheduleTimer(void *privdata, struct timeval tv);
+
+	ov::String _ip;
+	uint16_t _port = 0;
+	ov::String _password;
+	uint32_t _timeout_msec = 0;
+
+	int _epoll_fd = -1;
+	int _event_fd = -1;
+	std::thread _thread;
+	std::atomic<bool> _stop{false};
+
+	ov::Mutex _queue_mutex;
+	std::vector<QueuedCommand> _queue OV_GUARDED_BY(_queue_mutex);
+
+	// Used only in the loop thread
+	redisAsyncContext *_context = nullptr;
+	int _context_fd = -1;
+	bool _reading = false;
+	bool _writing = false;
+	std::optional<Clock::time_point> _timer_deadline;
+	std::optional<Clock::time_point> _last_connect_time;
+
+	std::atomic<uint64_t> _command_count{0};
+	std::atomic<uint64_t> _error_count{0};
+	std::atomic<uint64_t> _total_latency_usec{0};
+	std::atomic<uint64_t> _max_latency_usec{0};
+};
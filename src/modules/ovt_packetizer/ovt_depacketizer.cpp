@@ -103,6 +103,11 @@ bool OvtDepacketizer::IsNextMessage()
 	return IsAvailableMessage();
 }
 
+void OvtDepacketizer::KeepMediaFragments(bool keep)
+{
+	_keep_media_fragments = keep;
+}
+
 bool OvtDepacketizer::AppendMessagePacket(const std::shared_ptr<OvtPacket> &packet)
 {
 	//TODO(Getroot): Need to validate packet
@@ -130,6 +135,11 @@ bool OvtDepacketizer::AppendMediaPacket(const std::shared_ptr<OvtPacket> &packet
 {
 	_media_packet_buffer.Append(packet->Payload(), packet->PayloadLength());
 
+	if(_keep_media_fragments)
+	{
+		_media_fragments.push_back(packet);
+	}
+
 	// The last packet of MediaPacket
 	if(packet->Marker())
 	{
@@ -138,24 +148,26 @@ bool OvtDepacketizer::AppendMediaPacket(const std::shared_ptr<OvtPacket> &packet
 		{
 			logte("Invalid media packet payload : payload size is less than header size");
 			_media_packet_buffer.Clear();
+			_media_fragments.clear();
 			return false;
 		}
 
 		auto buffer = _media_packet_buffer.GetDataAs<uint8_t>();
-		auto track_id = ByteReader<uint32_t>::ReadBigEndian(&buffer[0]);
-		auto pts = ByteReader<uint64_t>::ReadBigEndian(&buffer[4]);
-		auto dts = ByteReader<uint64_t>::ReadBigEndian(&buffer[12]);
-		auto duration = ByteReader<uint64_t>::ReadBigEndian(&buffer[20]);
-		auto media_type = static_cast<cmn::MediaType>(ByteReader<uint8_t>::ReadBigEndian(&buffer[28]));
-		auto media_flag = static_cast<MediaPacketFlag>(ByteReader<uint8_t>::ReadBigEndian(&buffer[29]));
-		auto bitstream_format = static_cast<cmn::BitstreamFormat>(ByteReader<uint8_t>::ReadBigEndian(&buffer[30]));
-		auto packet_type = static_cast<cmn::PacketType>(ByteReader<uint8_t>::ReadBigEndian(&buffer[31]));
-		auto data_size = ByteReader<uint32_t>::ReadBigEndian(&buffer[32]);
+		auto track_id = ByteReader<uint32_t>::ReadBigEndian(&buffer[MEDIA_PACKET_TRACK_ID_OFFSET]);
+		auto pts = ByteReader<uint64_t>::ReadBigEndian(&buffer[MEDIA_PACKET_PTS_OFFSET]);
+		auto dts = ByteReader<uint64_t>::ReadBigEndian(&buffer[MEDIA_PACKET_DTS_OFFSET]);
+		auto duration = ByteReader<uint64_t>::ReadBigEndian(&buffer[MEDIA_PACKET_DURATION_OFFSET]);
+		auto media_type = static_cast<cmn::MediaType>(ByteReader<uint8_t>::ReadBigEndian(&buffer[MEDIA_PACKET_MEDIA_TYPE_OFFSET]));
+		auto media_flag = static_cast<MediaPacketFlag>(ByteReader<uint8_t>::ReadBigEndian(&buffer[MEDIA_PACKET_MEDIA_FLAG_OFFSET]));
+		auto bitstream_format = static_cast<cmn::BitstreamFormat>(ByteReader<uint8_t>::ReadBigEndian(&buffer[MEDIA_PACKET_BITSTREAM_FORMAT_OFFSET]));
+		auto packet_type = static_cast<cmn::PacketType>(ByteReader<uint8_t>::ReadBigEndian(&buffer[MEDIA_PACKET_PACKET_TYPE_OFFSET]));
+		auto data_size = ByteReader<uint32_t>::ReadBigEndian(&buffer[MEDIA_PACKET_DATA_SIZE_OFFSET]);
 
 		if(data_size != _media_packet_buffer.GetLength() - MEDIA_PACKET_HEADER_SIZE)
 		{
 			logte("Invalid media packet payload : payload size is invalid");
 			_media_packet_buffer.Clear();
+			_media_fragments.clear();
 			return false;
 		}
 
@@ -171,6 +183,12 @@ bool OvtDepacketizer::AppendMediaPacket(const std::shared_ptr<OvtPacket> &packet
 		media_packet->SetFlag(media_flag);
 		media_packet->SetDuration(duration);
 
+		if(_keep_media_fragments)
+		{
+			media_packet->SetOvtRelayFragments(std::make_shared<OvtRelayFragments>(std::move(_media_fragments), media_packet->GetData()));
+			_media_fragments.clear();
+		}
+
 		_items.push(Item{ItemType::MediaPacket, nullptr, std::move(media_packet)});
 
 		_media_packet_buffer.Clear();
@@ -6,6 +6,7 @@
 #include <base/mediarouter/media_buffer.h>
 #include "ovt_packet.h"
 #include "ovt_packetizer_interface.h"
+#include "ovt_relay_fragments.h"
 
 #define INIT_PACKET_BUFFER_SIZE		65535
 #define INIT_PAYLOAD_BUFFER_SIZE	1024 * 1024 		// 1MB
@@ -31,6 +32,10 @@ public:
 	bool IsAvailable();
 	bool IsNextMessage();
 
+	// When enabled, each depacketized MediaPacket keeps the OVT packets it was received in
+	// (see MediaPacket::GetOvtRelayFragments()), so that an OVT relay can forward them as they are.
+	void KeepMediaFragments(bool keep);
+
 private:
 	bool ParsePacket();
 	bool AppendMessagePacket(const std::shared_ptr<OvtPacket> &packet);
@@ -57,6 +62,10 @@ private:
 	ov::Data									_message_buffer;
 	ov::Data									_media_packet_buffer;
 
+	bool										_keep_media_fragments = false;
+	// OVT packets of the MediaPacket in _media_packet_buffer
+	std::vector<std::shared_ptr<OvtPacket>>		_media_fragments;
+
 	// Completed items in on-wire parse order; front is the next item on the wire.
 	std::queue<Item>							_items;
 };
@@ -153,6 +153,17 @@
 // Using MediaPacket (De)Packetizer
 #define MEDIA_PACKET_HEADER_SIZE			(32+64+64+64+8+8+8+8+32)/8
 
+// Offsets of the fields in the MediaPacket header (see OvtPacketizer::PacketizeMediaPacket())
+#define MEDIA_PACKET_TRACK_ID_OFFSET			0
+#define MEDIA_PACKET_PTS_OFFSET					4
+#define MEDIA_PACKET_DTS_OFFSET					12
+#define MEDIA_PACKET_DURATION_OFFSET			20
+#define MEDIA_PACKET_MEDIA_TYPE_OFFSET			28
+#define MEDIA_PACKET_MEDIA_FLAG_OFFSET			29
+#define MEDIA_PACKET_BITSTREAM_FORMAT_OFFSET	30
+#define MEDIA_PACKET_PACKET_TYPE_OFFSET			31
+#define MEDIA_PACKET_DATA_SIZE_OFFSET			32
+
 class OvtPacket
 {
 public:
@@ -106,19 +106,19 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 
 	auto buffer = payload.GetWritableDataAs<uint8_t>();
 
-	ByteWriter<uint32_t>::WriteBigEndian(&buffer[0], media_packet->GetTrackId());
-	ByteWriter<uint64_t>::WriteBigEndian(&buffer[4], media_packet->GetPts());
-	ByteWriter<uint64_t>::WriteBigEndian(&buffer[12], media_packet->GetDts());
-	ByteWriter<uint64_t>::WriteBigEndian(&buffer[20], media_packet->GetDuration());
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[28], static_cast<int8_t>(media_packet->GetMediaType()));
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[29], static_cast<int8_t>(media_packet->GetFlag()));
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[30], static_cast<int8_t>(media_packet->GetBitstreamFormat()));
-	ByteWriter<uint8_t>::WriteBigEndian(&buffer[31], static_cast<int8_t>(media_packet->GetPacketType()));
-	ByteWriter<uint32_t>::WriteBigEndian(&buffer[32], media_packet->GetDataLength());
+	ByteWriter<uint32_t>::WriteBigEndian(&buffer[MEDIA_PACKET_TRACK_ID_OFFSET], media_packet->GetTrackId());
+	ByteWriter<uint64_t>::WriteBigEndian(&buffer[MEDIA_PACKET_PTS_OFFSET], media_packet->GetPts());
+	ByteWriter<uint64_t>::WriteBigEndian(&buffer[MEDIA_PACKET_DTS_OFFSET], media_packet->GetDts());
+	ByteWriter<uint64_t>::WriteBigEndian(&buffer[MEDIA_PACKET_DURATION_OFFSET], media_packet->GetDuration());
+	ByteWriter<uint8_t>::WriteBigEndian(&buffer[MEDIA_PACKET_MEDIA_TYPE_OFFSET], static_cast<int8_t>(media_packet->GetMediaType()));
+	ByteWriter<uint8_t>::WriteBigEndian(&buffer[MEDIA_PACKET_MEDIA_FLAG_OFFSET], static_cast<int8_t>(media_packet->GetFlag()));
+	ByteWriter<uint8_t>::WriteBigEndian(&buffer[MEDIA_PACKET_BITSTREAM_FORMAT_OFFSET], static_cast<int8_t>(media_packet->GetBitstreamFormat()));
+	ByteWriter<uint8_t>::WriteBigEndian(&buffer[MEDIA_PACKET_PACKET_TYPE_OFFSET], static_cast<int8_t>(media_packet->GetPacketType()));
+	ByteWriter<uint32_t>::WriteBigEndian(&buffer[MEDIA_PACKET_DATA_SIZE_OFFSET], media_packet->GetDataLength());
 
 	if (media_packet->GetData() != nullptr)
 	{
-		memcpy(&buffer[36], media_packet->GetData()->GetData(), media_packet->GetDataLength());
+		memcpy(&buffer[MEDIA_PACKET_HEADER_SIZE], media_packet->GetData()->GetData(), media_packet->GetDataLength());
 	}
 
 	size_t max_payload_size = OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE;
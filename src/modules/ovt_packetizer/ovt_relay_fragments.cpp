@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "ovt_relay_fragments.h"
+
+#include <base/ovlibrary/byte_io.h>
+
+OvtRelayFragments::OvtRelayFragments(std::vector<std::shared_ptr<OvtPacket>> packets, const std::shared_ptr<const ov::Data> &data)
+	: _packets(std::move(packets)),
+	  _data(data)
+{
+}
+
+std::vector<std::shared_ptr<OvtPacket>> OvtRelayFragments::GetPacketsFor(const MediaPacket &media_packet) const
+{
+	if (_packets.empty() || (_data == nullptr) || (media_packet.GetData() != _data))
+	{
+		return {};
+	}
+
+	auto &first_packet = _packets.front();
+	if (first_packet->PayloadLength() < MEDIA_PACKET_HEADER_SIZE)
+	{
+		return {};
+	}
+
+	// See OvtPacketizer::PacketizeMediaPacket() for the layout of the serialized MediaPacket header
+	auto header = first_packet->Payload();
+
+	if ((static_cast<cmn::MediaType>(ByteReader<uint8_t>::ReadBigEndian(&header[MEDIA_PACKET_MEDIA_TYPE_OFFSET])) != media_packet.GetMediaType()) ||
+		(static_cast<cmn::BitstreamFormat>(ByteReader<uint8_t>::ReadBigEndian(&header[MEDIA_PACKET_BITSTREAM_FORMAT_OFFSET])) != media_packet.GetBitstreamFormat()))
+	{
+		return {};
+	}
+
+	bool is_header_changed =
+		(ByteReader<uint32_t>::ReadBigEndian(&header[MEDIA_PACKET_TRACK_ID_OFFSET]) != media_packet.GetTrackId()) ||
+		(static_cast<int64_t>(ByteReader<uint64_t>::ReadBigEndian(&header[MEDIA_PACKET_PTS_OFFSET])) != media_packet.GetPts()) ||
+		(static_cast<int64_t>(ByteReader<uint64_t>::ReadBigEndian(&header[MEDIA_PACKET_DTS_OFFSET])) != media_packet.GetDts()) ||
+		(static_cast<MediaPacketFlag>(ByteReader<uint8_t>::ReadBigEndian(&header[MEDIA_PACKET_MEDIA_FLAG_OFFSET])) != media_packet.GetFlag());
+
+	if (is_header_changed == false)
+	{
+		return _packets;
+	}
+
+	ov::Data payload(first_packet->Payload(), first_packet->PayloadLength());
+	auto buffer = payload.GetWritableDataAs<uint8_t>();
+
+	ByteWriter<uint32_t>::WriteBigEndian(&buffer[MEDIA_PACKET_TRACK_ID_OFFSET], media_packet.GetTrackId());
+	ByteWriter<uint64_t>::WriteBigEndian(&buffer[MEDIA_PACKET_PTS_OFFSET], media_packet.GetPts());
+	ByteWriter<uint64_t>::WriteBigEndian(&buffer[MEDIA_PACKET_DTS_OFFSET], media_packet.GetDts());
+	ByteWriter<uint8_t>::WriteBigEndian(&buffer[MEDIA_PACKET_MEDIA_FLAG_OFFSET], static_cast<int8_t>(media_packet.GetFlag()));
+
+	auto rewritten_packet = std::make_shared<OvtPacket>();
+	rewritten_packet->SetSessionId(first_packet->SessionId());
+	rewritten_packet->SetPayloadType(first_packet->PayloadType());
+	rewritten_packet->SetMarker(first_packet->Marker());
+	rewritten_packet->SetTimestamp(first_packet->Timestamp());
+	rewritten_packet->SetSequenceNumber(first_packet->SequenceNumber());
+	rewritten_packet->SetPayload(buffer, payload.GetLength());
+
+	auto packets = _packets;
+	packets.front() = std::move(rewritten_packet);
+
+	return packets;
+}
@@ -0,0 +1,43 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_buffer.h>
+
+#include <vector>
+
+#include "ovt_packet.h"
+
+// The OVT packets a media packet was received in.
+//
+// A relay (a node that pulls a stream over OVT and serves it over OVT again) keeps them with the
+// media packet, so that its OVT publisher sends them downstream as they were received instead of
+// serializing and packetizing the media packet again. They are only reused while the media packet
+// still carries the data they arrived with. If the relay has re-based the timestamps or changed
+// the flag, the serialized header is rewritten in a copy of the first packet, and the other
+// packets are still sent as they are.
+class OvtRelayFragments
+{
+public:
+	OvtRelayFragments(std::vector<std::shared_ptr<OvtPacket>> packets, const std::shared_ptr<const ov::Data> &data);
+
+	// Returns the packets that carry <media_packet>, or an empty list if it does not carry the data
+	// these packets arrived with (e.g. the data has been converted by the relay)
+	std::vector<std::shared_ptr<OvtPacket>> GetPacketsFor(const MediaPacket &media_packet) const;
+
+	size_t GetPacketCount() const
+	{
+		return _packets.size();
+	}
+
+private:
+	std::vector<std::shared_ptr<OvtPacket>> _packets;
+	// The data of the media packet when it was depacketized
+	std::shared_ptr<const ov::Data> _data;
+};
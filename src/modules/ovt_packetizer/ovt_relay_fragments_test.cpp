@@ -0,0 +1,149 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include "ovt_depacketizer.h"
+#include "ovt_packetizer.h"
+#include "ovt_relay_fragments.h"
+
+namespace
+{
+	std::shared_ptr<MediaPacket> MakeMediaPacket(size_t data_size)
+	{
+		auto data = std::make_shared<ov::Data>(data_size);
+		data->SetLength(data_size);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		for (size_t index = 0; index < data_size; index++)
+		{
+			buffer[index] = static_cast<uint8_t>(index);
+		}
+
+		auto media_packet = std::make_shared<MediaPacket>(
+			cmn::MediaType::Video, 100, data,
+			90000, 87000, 3000,
+			MediaPacketFlag::Key,
+			cmn::BitstreamFormat::H264_ANNEXB,
+			cmn::PacketType::NALU);
+
+		return media_packet;
+	}
+
+	std::vector<std::shared_ptr<OvtPacket>> Packetize(const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		OvtPacketizer packetizer;
+		packetizer.PacketizeMediaPacket(media_packet->GetPts(), media_packet);
+
+		std::vector<std::shared_ptr<OvtPacket>> packets;
+		while (packetizer.IsAvailablePackets())
+		{
+			packets.push_back(packetizer.PopPacket());
+		}
+
+		return packets;
+	}
+
+	std::shared_ptr<MediaPacket> Depacketize(const std::vector<std::shared_ptr<OvtPacket>> &packets, bool keep_media_fragments)
+	{
+		OvtDepacketizer depacketizer;
+		depacketizer.KeepMediaFragments(keep_media_fragments);
+
+		for (const auto &packet : packets)
+		{
+			if (depacketizer.AppendPacket(packet->GetData()) == false)
+			{
+				return nullptr;
+			}
+		}
+
+		return depacketizer.PopMediaPacket();
+	}
+}  // namespace
+
+TEST(OvtRelayFragments, ForwardsPacketsAsReceived)
+{
+	auto packets = Packetize(MakeMediaPacket(100 * 1024));
+	ASSERT_GT(packets.size(), 1u);
+
+	EXPECT_EQ(Depacketize(packets, false)->GetOvtRelayFragments(), nullptr);
+
+	auto media_packet = Depacketize(packets, true);
+	ASSERT_NE(media_packet, nullptr);
+
+	auto fragments = media_packet->GetOvtRelayFragments();
+	ASSERT_NE(fragments, nullptr);
+	EXPECT_EQ(fragments->GetPacketCount(), packets.size());
+
+	auto relayed_packets = fragments->GetPacketsFor(*media_packet);
+	ASSERT_EQ(relayed_packets.size(), packets.size());
+
+	for (size_t index = 0; index < packets.size(); index++)
+	{
+		EXPECT_EQ(relayed_packets[index]->GetData()->GetLength(), packets[index]->GetData()->GetLength());
+		EXPECT_EQ(::memcmp(relayed_packets[index]->GetBuffer(), packets[index]->GetBuffer(), packets[index]->GetDataLength()), 0);
+	}
+
+	// Forwarding the same media packet again returns the same packets
+	EXPECT_EQ(fragments->GetPacketsFor(*media_packet), relayed_packets);
+}
+
+// A relay that re-bases timestamps only rewrites the serialized header in the first packet
+TEST(OvtRelayFragments, RewritesChangedHeader)
+{
+	auto source_packet = MakeMediaPacket(70 * 1024);
+	auto packets = Packetize(source_packet);
+
+	auto media_packet = Depacketize(packets, true);
+	ASSERT_NE(media_packet, nullptr);
+
+	auto fragments = media_packet->GetOvtRelayFragments();
+	auto relayed_packets = fragments->GetPacketsFor(*media_packet);
+
+	media_packet->SetPts(media_packet->GetPts() - 90000 + 3000);
+	media_packet->SetDts(media_packet->GetDts() - 87000);
+
+	auto rewritten_packets = fragments->GetPacketsFor(*media_packet);
+	ASSERT_EQ(rewritten_packets.size(), relayed_packets.size());
+
+	EXPECT_NE(rewritten_packets[0], relayed_packets[0]);
+	EXPECT_EQ(rewritten_packets[0]->SequenceNumber(), relayed_packets[0]->SequenceNumber());
+	EXPECT_EQ(rewritten_packets[0]->Marker(), relayed_packets[0]->Marker());
+
+	for (size_t index = 1; index < rewritten_packets.size(); index++)
+	{
+		EXPECT_EQ(rewritten_packets[index], relayed_packets[index]);
+	}
+
+	auto received_packet = Depacketize(rewritten_packets, false);
+	ASSERT_NE(received_packet, nullptr);
+
+	EXPECT_EQ(received_packet->GetTrackId(), source_packet->GetTrackId());
+	EXPECT_EQ(received_packet->GetPts(), 3000);
+	EXPECT_EQ(received_packet->GetDts(), 0);
+	EXPECT_EQ(received_packet->GetFlag(), MediaPacketFlag::Key);
+	EXPECT_EQ(received_packet->GetDataLength(), source_packet->GetDataLength());
+	EXPECT_EQ(::memcmp(received_packet->GetData()->GetData(), source_packet->GetData()->GetData(), source_packet->GetDataLength()), 0);
+}
+
+TEST(OvtRelayFragments, IgnoresConvertedData)
+{
+	auto media_packet = Depacketize(Packetize(MakeMediaPacket(4096)), true);
+	ASSERT_NE(media_packet, nullptr);
+
+	auto fragments = media_packet->GetOvtRelayFragments();
+	ASSERT_NE(fragments, nullptr);
+
+	std::shared_ptr<ov::Data> converted_data = media_packet->GetData()->Clone();
+	media_packet->SetData(converted_data);
+
+	EXPECT_TRUE(fragments->GetPacketsFor(*media_packet).empty());
+
+	// Cloned packets do not share the data, so they do not carry the fragments
+	EXPECT_EQ(media_packet->ClonePacket()->GetOvtRelayFragments(), nullptr);
+}
@@ -2,6 +2,9 @@
 
 #define OVT_SIGNALING_VERSION 0x12
 
+// Maximum number of servers a stream can be relayed through (see "relayPath")
+#define OVT_MAX_RELAY_DEPTH 8
+
 /*
 	"version": 0x12,
 	"stream" :
@@ -9,6 +12,9 @@
 		"appName" : "app",
 		"streamName" : "stream_720p",
 		"streamUUID" : "OvenMediaEngine_90b8b53e-3140-4e59-813d-9ace51c0e186/default/#default#app/stream",
+		# Optional, host UUIDs of the servers that have sent the stream over OVT, starting from the origin.
+		# A server refuses a stream whose path already includes itself (a relay loop).
+		"relayPath" : [ "OvenMediaEngine_90b8b53e-3140-4e59-813d-9ace51c0e186/#default#", ... ],
 		"playlists":[
 			{
 				"name" : "for llhls",
@@ -4,9 +4,25 @@
 
 bool FIR::Parse(const RtcpPacket &packet)
 {
-	// TODO(Getroot)
-	// Now, OME doesn't receive FIR packet, only request to webrtc sender
-	// It will be implemented later
+	const uint8_t *payload = packet.GetPayload();
+	size_t payload_size = packet.GetPayloadSize();
+
+	// Common feedback, and at least one FCI entry (RFC 5104 4.3.1)
+	if (payload_size < 8 + 8)
+	{
+		logtt("Payload is too small to parse FIR");
+		return false;
+	}
+
+	// The SSRC of media source is not used in FIR, the FCI entries carry it
+	SetSrcSsrc(ByteReader<uint32_t>::ReadBigEndian(&payload[0]));
+	SetMediaSsrc(ByteReader<uint32_t>::ReadBigEndian(&payload[4]));
+
+	for (size_t offset = 8; offset + 8 <= payload_size; offset += 8)
+	{
+		AddFirMessage(ByteReader<uint32_t>::ReadBigEndian(&payload[offset]), payload[offset + 4]);
+	}
+
 	return true;
 }
 
@@ -75,6 +75,12 @@ public:
 		return _fir_message.size();
 	}
 
+	// media ssrc, sequence number
+	const std::pair<uint32_t, uint8_t> &GetFirMessage(size_t index) const
+	{
+		return _fir_message[index];
+	}
+
 private:
 	// FEEDBACK
 	uint32_t _src_ssrc = 0;
@@ -4,9 +4,19 @@
 
 bool PLI::Parse(const RtcpPacket &packet)
 {
-	// TODO(Getroot)
-	// Now, OME doesn't receive PLI packet, only request to webrtc sender
-	// It will be implemented later
+	const uint8_t *payload = packet.GetPayload();
+	size_t payload_size = packet.GetPayloadSize();
+
+	// Common feedback only, PLI has no FCI (RFC 4585 6.3.1)
+	if (payload_size < 8)
+	{
+		logtt("Payload is too small to parse PLI");
+		return false;
+	}
+
+	SetSrcSsrc(ByteReader<uint32_t>::ReadBigEndian(&payload[0]));
+	SetMediaSsrc(ByteReader<uint32_t>::ReadBigEndian(&payload[4]));
+
 	return true;
 }
 
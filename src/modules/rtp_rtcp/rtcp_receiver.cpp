@@ -1,6 +1,8 @@
 #include "rtcp_receiver.h"
 
+#include "rtcp_info/fir.h"
 #include "rtcp_info/nack.h"
+#include "rtcp_info/pli.h"
 #include "rtcp_info/receiver_report.h"
 #include "rtcp_info/rtcp_private.h"
 #include "rtcp_info/sender_report.h"
@@ -64,6 +66,14 @@ bool RtcpReceiver::ParseCompoundPacket(const std::shared_ptr<const ov::Data>& pa
 				{
 					info = std::make_shared<REMB>();
 				}
+				else if (rtcp_packet.GetFMT() == static_cast<uint8_t>(PSFBFMT::PLI))
+				{
+					info = std::make_shared<PLI>();
+				}
+				else if (rtcp_packet.GetFMT() == static_cast<uint8_t>(PSFBFMT::FIR))
+				{
+					info = std::make_shared<FIR>();
+				}
 				else
 				{
 					logtt("Does not support PSFB format : %d", rtcp_packet.GetFMT());
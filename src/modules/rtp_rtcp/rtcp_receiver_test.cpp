@@ -0,0 +1,71 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include "rtcp_info/fir.h"
+#include "rtcp_info/pli.h"
+#include "rtcp_packet.h"
+#include "rtcp_receiver.h"
+
+namespace
+{
+	std::shared_ptr<RtcpInfo> BuildAndParse(const std::shared_ptr<RtcpInfo> &info)
+	{
+		RtcpPacket packet;
+		if (packet.Build(info) == false)
+		{
+			return nullptr;
+		}
+
+		RtcpReceiver receiver;
+		if (receiver.ParseCompoundPacket(packet.GetData()) == false)
+		{
+			return nullptr;
+		}
+
+		return receiver.PopRtcpInfo();
+	}
+}  // namespace
+
+TEST(RtcpReceiver, ParsesPli)
+{
+	auto pli = std::make_shared<PLI>();
+	pli->SetSrcSsrc(0x11223344);
+	pli->SetMediaSsrc(0x55667788);
+
+	auto info = BuildAndParse(pli);
+	ASSERT_NE(info, nullptr);
+	ASSERT_EQ(info->GetPacketType(), RtcpPacketType::PSFB);
+	ASSERT_EQ(info->GetCountOrFmt(), static_cast<uint8_t>(PSFBFMT::PLI));
+
+	auto parsed = std::static_pointer_cast<PLI>(info);
+	EXPECT_EQ(parsed->GetSrcSsrc(), 0x11223344u);
+	EXPECT_EQ(parsed->GetMediaSsrc(), 0x55667788u);
+}
+
+TEST(RtcpReceiver, ParsesFir)
+{
+	auto fir = std::make_shared<FIR>();
+	fir->SetSrcSsrc(0x11223344);
+	fir->AddFirMessage(0x55667788, 7);
+	fir->AddFirMessage(0x99AABBCC, 8);
+
+	auto info = BuildAndParse(fir);
+	ASSERT_NE(info, nullptr);
+	ASSERT_EQ(info->GetPacketType(), RtcpPacketType::PSFB);
+	ASSERT_EQ(info->GetCountOrFmt(), static_cast<uint8_t>(PSFBFMT::FIR));
+
+	auto parsed = std::static_pointer_cast<FIR>(info);
+	EXPECT_EQ(parsed->GetSrcSsrc(), 0x11223344u);
+	ASSERT_EQ(parsed->GetFirMessageCount(), 2u);
+	EXPECT_EQ(parsed->GetFirMessage(0).first, 0x55667788u);
+	EXPECT_EQ(parsed->GetFirMessage(0).second, 7);
+	EXPECT_EQ(parsed->GetFirMessage(1).first, 0x99AABBCCu);
+	EXPECT_EQ(parsed->GetFirMessage(1).second, 8);
+}
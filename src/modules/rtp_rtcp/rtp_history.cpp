@@ -10,9 +10,19 @@ RtpHistory::RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, ui
 	_history.reserve(_max_history_size);
 }
 
+void RtpHistory::SetMemoryAccount(const std::shared_ptr<ov::MemoryAccount> &account)
+{
+	_memory_account = account;
+}
+
 // Converting to RtxRtpPacket
 bool RtpHistory::StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet)
 {
+	if ((_memory_account != nullptr) && (packet->GetData() != nullptr))
+	{
+		packet->GetData()->ChargeMemoryTo(_memory_account);
+	}
+
 	std::lock_guard<std::shared_mutex> guard(_history_lock);
 
 	_history[GetIndex(packet->SequenceNumber())] = packet;
@@ -13,6 +13,9 @@ class RtpHistory
 public:
 	RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, uint32_t rtx_ssrc, uint32_t max_history_size = DEFAULT_MAX_HISTORY_CAPACITY);
 
+	// The stored packets are charged to <account>. Must be set before the first packet is stored.
+	void SetMemoryAccount(const std::shared_ptr<ov::MemoryAccount> &account);
+
 	// Converting to RtxRtpPacket
 	bool StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet);
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint16_t seq_no);
@@ -49,4 +52,6 @@ private:
 	uint32_t	_rtx_ssrc;
 	uint8_t		_rtx_paylod_type;
 	uint32_t	_max_history_size;
+
+	std::shared_ptr<ov::MemoryAccount> _memory_account;
 };
\ No newline at end of file
@@ -58,6 +58,7 @@ RtpPacket::RtpPacket(const RtpPacket &src)
 	_track_id = src._track_id;
 	_ntp_timestamp = src._ntp_timestamp;
 	_is_keyframe = src._is_keyframe;
+	_is_discardable = src._is_discardable;
 	_is_first_packet_of_frame = src._is_first_packet_of_frame;
 	_is_last_packet_of_frame = src._is_last_packet_of_frame;
 	_is_start_of_unit = src._is_start_of_unit;
@@ -131,6 +131,11 @@ public:
 	void		SetKeyframe(bool flag) {_is_keyframe = flag;}
 	bool		IsKeyframe() const {return _is_keyframe;}
 
+	// The packet belongs to a frame that no other frame references (H.264 nal_ref_idc 0, VP8
+	// without buffer updates, AV1 of the highest temporal layer). Set by the send packetizer.
+	void		SetDiscardable(bool flag) {_is_discardable = flag;}
+	bool		IsDiscardable() const {return _is_discardable;}
+
 	// The genuine first packet of the frame. Set by the send packetizer, and
 	// on receive by the Dependency Descriptor (S bit), which marks it
 	// authoritatively. Without DD the receive path can't know it per-packet
@@ -188,6 +193,7 @@ protected:
 	uint64_t	_ntp_timestamp = 0;
 	bool		_is_video_packet = false;
 	bool		_is_keyframe = false;
+	bool		_is_discardable = false;
 	bool		_is_first_packet_of_frame = false;
 	bool		_is_last_packet_of_frame = false;
 	bool		_is_start_of_unit = false;
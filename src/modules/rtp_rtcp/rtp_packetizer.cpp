@@ -6,6 +6,9 @@
 #include "rtp_packetizing_manager.h"
 #include "rtp_packetizer.h"
 
+#include <modules/bitstream/av1/av1_parser.h>
+#include <modules/bitstream/h264/h264_parser.h>
+
 #define OV_LOG_TAG "RtpRtcp"
 
 RtpPacketizer::RtpPacketizer(const std::shared_ptr<RtpPacketizerInterface> &session)
@@ -180,6 +183,8 @@ bool RtpPacketizer::PacketizeVideo(cmn::MediaCodecId video_type,
 		return false;
 	}
 
+	bool discardable = IsDiscardableFrame(video_type, frame_type, payload_data, payload_size, fragmentation, video_header);
+
 	for(size_t i = 0; i < num_packets; ++i)
 	{
 		bool last = (i + 1) == num_packets;
@@ -209,6 +214,11 @@ bool RtpPacketizer::PacketizeVideo(cmn::MediaCodecId video_type,
 			packet->SetKeyframe(true);
 			_framemarking_extension->SetIndependentFrame();
 		}
+		else if(discardable == true)
+		{
+			packet->SetDiscardable(true);
+			_framemarking_extension->SetDiscardableFrame();
+		}
 
 		packet->SetNTPTimestamp(ntp_timestamp);
 		packet->SetTrackId(_track_id);
@@ -233,6 +243,83 @@ bool RtpPacketizer::PacketizeVideo(cmn::MediaCodecId video_type,
 	return true;
 }
 
+bool RtpPacketizer::IsDiscardableFrame(cmn::MediaCodecId video_type,
+                                       FrameType frame_type,
+                                       const uint8_t *payload_data,
+                                       size_t payload_size,
+                                       const FragmentationHeader *fragmentation,
+                                       const RTPVideoHeader *video_header)
+{
+	if(frame_type == FrameType::VideoFrameKey)
+	{
+		return false;
+	}
+
+	switch(video_type)
+	{
+		case cmn::MediaCodecId::H264:
+		{
+			if(fragmentation == nullptr || fragmentation->GetCount() == 0)
+			{
+				return false;
+			}
+
+			// Every slice of the picture must have nal_ref_idc 0
+			bool has_slice = false;
+			for(size_t i = 0; i < fragmentation->GetCount(); ++i)
+			{
+				auto offset = fragmentation->fragmentation_offset[i];
+				auto length = fragmentation->fragmentation_length[i];
+				if(length == 0 || offset + length > payload_size)
+				{
+					return false;
+				}
+
+				H264NalUnitHeader header;
+				if(H264Parser::ParseNalUnitHeader(&payload_data[offset], length, header) == false)
+				{
+					return false;
+				}
+
+				if(header.IsVideoSlice() == false)
+				{
+					continue;
+				}
+
+				if(header.GetNalRefIdc() != 0)
+				{
+					return false;
+				}
+
+				has_slice = true;
+			}
+
+			return has_slice;
+		}
+
+		case cmn::MediaCodecId::Vp8:
+			// Filled from the frame header by the stream
+			return (video_header != nullptr) && video_header->codec_header.vp8.non_reference;
+
+		case cmn::MediaCodecId::Av1:
+		{
+			auto temporal_id = Av1Parser::GetFrameTemporalId(payload_data, payload_size);
+			if(temporal_id.has_value() == false)
+			{
+				return false;
+			}
+
+			_av1_max_temporal_id = std::max(_av1_max_temporal_id, temporal_id.value());
+
+			return (_av1_max_temporal_id > 0) && (temporal_id.value() == _av1_max_temporal_id);
+		}
+
+		default:
+			// H.265 sub-layer non-reference pictures may still be referenced by a higher sub-layer
+			return false;
+	}
+}
+
 bool RtpPacketizer::GenerateRedAndFecPackets(std::shared_ptr<RtpPacket> packet)
 {
 	// Send RED
@@ -60,6 +60,14 @@ private:
 
 	bool GenerateRedAndFecPackets(std::shared_ptr<RtpPacket> packet);
 
+	// Whether no other frame references the frame, so that a congested session can drop it
+	bool IsDiscardableFrame(cmn::MediaCodecId video_type,
+	                        FrameType frame_type,
+	                        const uint8_t *payload_data,
+	                        size_t payload_size,
+	                        const FragmentationHeader *fragmentation,
+	                        const RTPVideoHeader *video_header);
+
 	// Audio Pakcet Sender Interface
 	bool PacketizeAudio(FrameType frame_type,
 	                    uint32_t rtp_timestamp,
@@ -93,6 +101,9 @@ private:
 	uint64_t		_frame_count = 0;
 	uint64_t		_rtp_packet_count = 0;
 
+	// The highest AV1 temporal_id seen so far, no frame references the frames of that layer
+	uint8_t			_av1_max_temporal_id = 0;
+
 	RtpHeaderExtensions _rtp_extensions;
 	std::shared_ptr<RtpHeaderExtensionFrameMarking>	_framemarking_extension;
 	std::shared_ptr<RtpHeaderExtensionPlayoutDelay> _playout_delay_extension;
@@ -0,0 +1,33 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "./lane_pool.h"
+
+#include <config/config_manager.h>
+
+#define OV_LOG_TAG LANE_POOL_LOG_TAG
+
+namespace ov
+{
+	bool LoadLanePoolConfig(LanePoolConfig *config)
+	{
+		auto server_config = cfg::ConfigManager::GetInstance()->GetServer();
+		if (server_config == nullptr)
+		{
+			logte("Could not read the server configuration");
+			return false;
+		}
+
+		const auto &pool_config = server_config->GetModules().GetAppWorkerPool();
+
+		// Any negative value keeps the workers
+		config->idle_timeout_ms = std::max(pool_config.GetIdleTimeoutMs(), -1);
+
+		return true;
+	}
+}  // namespace ov
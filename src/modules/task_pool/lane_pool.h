@@ -0,0 +1,873 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/managed_queue.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/delay_queue.h>
+#include <modules/managed_queue/managed_queue.h>
+
+#include <chrono>
+#include <cinttypes>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#define LANE_POOL_LOG_TAG "LanePool"
+// Items of an application a lane handles before it moves on to the next application
+#define LANE_POOL_ITEMS_PER_TURN 16
+
+namespace ov
+{
+	struct LanePoolConfig
+	{
+		// A group whose lanes had no stream attached for this long stops its threads. A
+		// negative value keeps the threads until the pool stops.
+		int64_t idle_timeout_ms = 30 * 1000;
+	};
+
+	// Reads <Modules><AppWorkerPool> of the server configuration
+	bool LoadLanePoolConfig(LanePoolConfig *config);
+
+	// Worker threads ("lanes") that the applications of the process share, instead of every
+	// application starting threads of its own when it is created.
+	//
+	// Lanes are grouped by a key, such as the publisher type, and a group is shared by every
+	// application. A stream is attached to a lane of its group when it is created and stays
+	// there, so the items of a stream are handled in the order they were enqueued. The streams
+	// of an application are spread over up to <lane_count> lanes (its worker count), and a group
+	// grows up to as many lanes as there are CPUs (or the largest worker count). A group starts
+	// with the first stream attached to it, starts another lane only when every lane has a
+	// stream, and stops once no stream has been attached for the idle timeout.
+	//
+	// Every application has a queue of its own on each lane it uses, and a lane takes turns
+	// between the applications that have items, LANE_POOL_ITEMS_PER_TURN items at a time. A
+	// busy application therefore delays the others of its lane by one turn at most, and the
+	// queues are reported per application as they were when every application had its own
+	// workers.
+	//
+	// The queues are not bounded and only warn over the threshold, as the queues of the workers
+	// every application used to start did, so Enqueue() never blocks the producer, which may be
+	// the handler of another lane. It only drops an item once the group is stopped.
+	//
+	//     auto slot = pool->Attach(vhost_app_name, "AW-WebRTC", lane_count);
+	//     if (slot.Enqueue(item) == false) { ... }
+	//     ...
+	//     slot.Detach();
+	//
+	// With ov::ThreadPlacement enabled, a lane runs on the NUMA node of the thread that started it,
+	// and a stream is attached to a lane on the node of the thread that attaches it where it can,
+	// so the stream stays on the node it was received on.
+	//
+	// The handler runs on a lane thread, so it must not stop the pool.
+	template <typename T>
+	class LanePool
+	{
+	public:
+		using Handler = std::function<void(T &item)>;
+
+		class Group
+		{
+		public:
+			// The queue of an application on a lane
+			struct Tenant
+			{
+				Tenant(const info::VHostAppName &vhost_app_name, size_t lane_index)
+					: vhost_app_name(vhost_app_name),
+					  lane_index(lane_index)
+				{
+				}
+
+				const info::VHostAppName vhost_app_name;
+				const size_t lane_index;
+
+				// Holds the items back for the buffering delay of the group, if any
+				std::shared_ptr<ManagedQueue<T>> queue;
+
+				// In the ready list of the lane, or being handled by it
+				std::atomic<bool> scheduled{false};
+				// An urgent item arrived while the lane waits for the buffering delay
+				std::atomic<bool> expedited{false};
+
+				// Guarded by Group::_mutex
+				size_t stream_count = 0;
+			};
+
+			Group(const ov::String &key, const ov::String &queue_part, ThreadRole role, size_t max_lane_count, int buffering_delay_ms, size_t queue_threshold, const Handler &handler)
+				: _key(key),
+				  _queue_part(queue_part),
+				  _role(role),
+				  _buffering_delay_ms(buffering_delay_ms),
+				  _queue_threshold(queue_threshold),
+				  _handler(handler),
+				  _idle_since(std::chrono::steady_clock::now())
+			{
+				// Never resized, so Enqueue() can read a lane without the lock
+				_lanes.resize(std::max(max_lane_count, static_cast<size_t>(1)));
+			}
+
+			~Group()
+			{
+				Stop();
+			}
+
+			const ov::String &GetKey() const
+			{
+				return _key;
+			}
+
+			size_t GetLaneCount() const
+			{
+				return _lane_count.load();
+			}
+
+			size_t GetStreamCount() const
+			{
+				return _stream_count.load();
+			}
+
+			// Items enqueued after the group was stopped
+			uint64_t GetDropCount() const
+			{
+				return _drop_count.load();
+			}
+
+			// Returns false if the item is dropped
+			bool Enqueue(const std::shared_ptr<Tenant> &tenant, T item, bool urgent = false)
+			{
+				if (_stopped.load(std::memory_order_acquire))
+				{
+					_drop_count++;
+					return false;
+				}
+
+				tenant->queue->Enqueue(std::move(item), urgent);
+
+				Schedule(*_lanes[tenant->lane_index], tenant, urgent && (_buffering_delay_ms > 0));
+
+				return true;
+			}
+
+			void Detach(const std::shared_ptr<Tenant> &tenant)
+			{
+				LockGuard lock_guard(_mutex);
+
+				if (tenant->stream_count == 0)
+				{
+					return;
+				}
+
+				// A producer that still holds the tenant keeps it, and the lane still handles what
+				// it enqueues. Attach() takes it again while it is alive.
+				tenant->stream_count--;
+				_lanes[tenant->lane_index]->stream_count--;
+
+				if (--_stream_count == 0)
+				{
+					_idle_since = std::chrono::steady_clock::now();
+				}
+			}
+
+		protected:
+			friend class LanePool;
+
+			struct Lane
+			{
+				size_t index = 0;
+				// NUMA node the lane runs on, or -1 if it is not pinned
+				int node_id = -1;
+				std::thread thread;
+
+				std::atomic<bool> stop{false};
+
+				// Guarded by Group::_mutex
+				size_t stream_count = 0;
+
+				Mutex ready_mutex;
+				ConditionVariable ready_condition;
+				// Tenants with items, in the order they take their turns
+				std::deque<std::shared_ptr<Tenant>> ready_tenants OV_GUARDED_BY(ready_mutex);
+				// Tenants whose items are held back for the buffering delay, and when they are due
+				std::vector<std::pair<std::chrono::steady_clock::time_point, std::shared_ptr<Tenant>>> deferred_tenants OV_GUARDED_BY(ready_mutex);
+			};
+
+			// Returns the tenant of the application on the lane a new stream goes to. The streams
+			// of an application are spread over up to <lane_count> lanes, taking the least loaded
+			// lanes of the group. A lane is started only when every running lane already has a
+			// stream, up to the CPU count or <lane_count>, whichever is larger.
+			//
+			// <node_id> is the NUMA node of the stream, or -1 if the lanes are not pinned. The lanes
+			// of the node are taken first, and a new lane is started on the node before a lane of
+			// another node is taken.
+			std::shared_ptr<Tenant> Attach(const info::VHostAppName &vhost_app_name, size_t lane_count, int node_id)
+			{
+				LockGuard lock_guard(_mutex);
+
+				lane_count = std::min(std::max(lane_count, static_cast<size_t>(1)), _lanes.size());
+				auto group_lane_count = std::min(std::max(lane_count, static_cast<size_t>(std::thread::hardware_concurrency())), _lanes.size());
+
+				RemoveReleasedTenants();
+
+				auto &tenants = _tenant_map[vhost_app_name.ToString()];
+
+				// Lanes the streams of the application run on
+				std::vector<bool> used_lanes(_lanes.size(), false);
+				size_t used_lane_count = 0;
+
+				for (const auto &[lane_index, weak_tenant] : tenants)
+				{
+					auto tenant = weak_tenant.lock();
+					if ((tenant != nullptr) && (tenant->stream_count > 0))
+					{
+						used_lanes[lane_index] = true;
+						used_lane_count++;
+					}
+				}
+
+				auto started_count = _lane_count.load();
+				std::optional<size_t> selected_index;
+
+				if (used_lane_count >= lane_count)
+				{
+					// The application already uses as many lanes as it may
+					auto is_used = [&](size_t index) { return used_lanes[index]; };
+
+					selected_index = FindLeastLoadedLane(started_count, node_id, is_used);
+					if ((selected_index.has_value() == false) && (node_id >= 0))
+					{
+						selected_index = FindLeastLoadedLane(started_count, -1, is_used);
+					}
+				}
+				else
+				{
+					auto is_unused = [&](size_t index) { return used_lanes[index] == false; };
+
+					selected_index = FindLeastLoadedLane(started_count, node_id, is_unused);
+
+					bool need_lane = (selected_index.has_value() == false) || (_lanes[selected_index.value()]->stream_count > 0);
+
+					if (need_lane && (started_count < group_lane_count) && StartLane(started_count, node_id))
+					{
+						// Published after the lane is ready, for Enqueue() that does not lock
+						_lane_count.fetch_add(1, std::memory_order_release);
+						selected_index = started_count;
+					}
+
+					if ((selected_index.has_value() == false) && (node_id >= 0))
+					{
+						// Every lane runs on another node, and no more can be started
+						selected_index = FindLeastLoadedLane(started_count, -1, is_unused);
+					}
+
+					if (selected_index.has_value() == false)
+					{
+						// The application is on every lane already
+						selected_index = FindLeastLoadedLane(started_count, -1, [](size_t) { return true; });
+					}
+				}
+
+				if (selected_index.has_value() == false)
+				{
+					if (tenants.empty())
+					{
+						_tenant_map.erase(vhost_app_name.ToString());
+					}
+
+					return nullptr;
+				}
+
+				auto &lane = *_lanes[selected_index.value()];
+				auto &weak_tenant = tenants[lane.index];
+
+				// A tenant whose streams have been detached is reused while a producer holds it,
+				// so the application has one queue (and one URN) on the lane
+				auto tenant = weak_tenant.lock();
+				if (tenant == nullptr)
+				{
+					tenant = CreateTenant(vhost_app_name, lane.index);
+					weak_tenant = tenant;
+				}
+
+				tenant->stream_count++;
+				lane.stream_count++;
+				_stream_count++;
+
+				return tenant;
+			}
+
+			// Among the lanes on <node_id> (or all lanes if it is negative) that pass <filter>
+			template <typename Tfilter>
+			std::optional<size_t> FindLeastLoadedLane(size_t started_count, int node_id, Tfilter filter) OV_REQUIRES(_mutex)
+			{
+				std::optional<size_t> selected_index;
+
+				for (size_t index = 0; index < started_count; index++)
+				{
+					if (((node_id >= 0) && (_lanes[index]->node_id != node_id)) || (filter(index) == false))
+					{
+						continue;
+					}
+
+					if ((selected_index.has_value() == false) || (_lanes[index]->stream_count < _lanes[selected_index.value()]->stream_count))
+					{
+						selected_index = index;
+					}
+				}
+
+				return selected_index;
+			}
+
+			void RemoveReleasedTenants() OV_REQUIRES(_mutex)
+			{
+				for (auto app_it = _tenant_map.begin(); app_it != _tenant_map.end();)
+				{
+					auto &tenants = app_it->second;
+
+					for (auto it = tenants.begin(); it != tenants.end();)
+					{
+						it = it->second.expired() ? tenants.erase(it) : std::next(it);
+					}
+
+					app_it = tenants.empty() ? _tenant_map.erase(app_it) : std::next(app_it);
+				}
+			}
+
+			std::shared_ptr<Tenant> CreateTenant(const info::VHostAppName &vhost_app_name, size_t lane_index) OV_REQUIRES(_mutex)
+			{
+				auto tenant = std::make_shared<Tenant>(vhost_app_name, lane_index);
+				auto thread_name = ov::String::FormatString("%s-%zu", _key.CStr(), lane_index);
+
+				auto urn = std::make_shared<info::ManagedQueue::URN>(vhost_app_name, nullptr, _queue_part, thread_name.LowerCaseString());
+
+				tenant->queue = std::make_shared<ManagedQueue<T>>(urn, _queue_threshold);
+
+				if (_buffering_delay_ms > 0)
+				{
+					tenant->queue->SetBufferingDelay(_buffering_delay_ms);
+				}
+
+				return tenant;
+			}
+
+			bool IsIdleFor(std::chrono::steady_clock::time_point now, int64_t idle_timeout_ms)
+			{
+				LockGuard lock_guard(_mutex);
+
+				return (idle_timeout_ms >= 0) &&
+					   (_stream_count.load() == 0) &&
+					   ((now - _idle_since) >= std::chrono::milliseconds(idle_timeout_ms));
+			}
+
+			void Stop()
+			{
+				if (_stopped.exchange(true))
+				{
+					return;
+				}
+
+				// The lanes are never removed, so they are joined without the lock that
+				// Detach() of an item being handled may be waiting for
+				std::vector<std::shared_ptr<Tenant>> tenants;
+
+				for (size_t index = 0; index < _lane_count.load(std::memory_order_acquire); index++)
+				{
+					StopLane(*_lanes[index], tenants);
+				}
+
+				{
+					LockGuard lock_guard(_mutex);
+
+					for (const auto &[name, lane_tenants] : _tenant_map)
+					{
+						for (const auto &[lane_index, weak_tenant] : lane_tenants)
+						{
+							auto tenant = weak_tenant.lock();
+							if (tenant != nullptr)
+							{
+								tenants.push_back(tenant);
+							}
+						}
+					}
+
+					_tenant_map.clear();
+				}
+
+				for (const auto &tenant : tenants)
+				{
+					tenant->queue->Stop();
+					tenant->queue->Clear();
+				}
+			}
+
+			bool StartLane(size_t index, int node_id) OV_REQUIRES(_mutex)
+			{
+				auto lane = std::make_unique<Lane>();
+				auto thread_name = ov::String::FormatString("%s-%zu", _key.CStr(), index);
+
+				lane->index = index;
+				lane->node_id = node_id;
+
+				try
+				{
+					lane->thread = std::thread(&Group::LaneThread, this, lane.get());
+				}
+				catch (const std::system_error &e)
+				{
+					loge(LANE_POOL_LOG_TAG, "Could not start a lane of %s: %s", _key.CStr(), e.what());
+					return false;
+				}
+
+				// The name of a thread is limited to 15 characters
+				::pthread_setname_np(lane->thread.native_handle(), thread_name.Substring(0, 15).CStr());
+
+				_lanes[index] = std::move(lane);
+
+				return true;
+			}
+
+			// Collects the tenants left on the lane into <tenants>
+			void StopLane(Lane &lane, std::vector<std::shared_ptr<Tenant>> &tenants)
+			{
+				{
+					LockGuard lock_guard(lane.ready_mutex);
+					lane.stop = true;
+					lane.ready_condition.NotifyAll();
+				}
+
+				if (lane.thread.joinable())
+				{
+					lane.thread.join();
+				}
+
+				LockGuard lock_guard(lane.ready_mutex);
+
+				tenants.insert(tenants.end(), lane.ready_tenants.begin(), lane.ready_tenants.end());
+				lane.ready_tenants.clear();
+
+				for (const auto &[due_time, tenant] : lane.deferred_tenants)
+				{
+					tenants.push_back(tenant);
+				}
+				lane.deferred_tenants.clear();
+			}
+
+			// Gives the tenant a turn on the lane, unless it already has one coming
+			void Schedule(Lane &lane, const std::shared_ptr<Tenant> &tenant, bool expedite)
+			{
+				if (expedite)
+				{
+					tenant->expedited = true;
+				}
+
+				// Pairs with the fence in HandleTenant(): either the lane sees the item, or this sees
+				// that the tenant is no longer scheduled
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (tenant->scheduled.exchange(true) == false)
+				{
+					LockGuard lock_guard(lane.ready_mutex);
+					lane.ready_tenants.push_back(tenant);
+					lane.ready_condition.NotifyOne();
+				}
+				else if (expedite)
+				{
+					// The tenant may be waiting for the buffering delay
+					LockGuard lock_guard(lane.ready_mutex);
+					lane.ready_condition.NotifyOne();
+				}
+			}
+
+			// Handles up to LANE_POOL_ITEMS_PER_TURN items of the tenant, then puts it back in
+			// line if it has more
+			void HandleTenant(Lane &lane, const std::shared_ptr<Tenant> &tenant)
+			{
+				bool has_ready_item = true;
+
+				for (size_t count = 0; count < LANE_POOL_ITEMS_PER_TURN; count++)
+				{
+					auto item = tenant->queue->Dequeue(0);
+					if (item.has_value() == false)
+					{
+						has_ready_item = false;
+						break;
+					}
+
+					_handler(item.value());
+				}
+
+				tenant->scheduled = false;
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (tenant->queue->IsEmpty() || tenant->scheduled.exchange(true))
+				{
+					// Nothing left, or a producer has put the tenant back in line already
+					return;
+				}
+
+				LockGuard lock_guard(lane.ready_mutex);
+
+				if (has_ready_item || (_buffering_delay_ms == 0))
+				{
+					lane.ready_tenants.push_back(tenant);
+					return;
+				}
+
+				// The items left are held back for the buffering delay
+				auto remaining_ms = std::max(_buffering_delay_ms - tenant->queue->GetBufferedTimeMs(), 1);
+				lane.deferred_tenants.emplace_back(std::chrono::steady_clock::now() + std::chrono::milliseconds(remaining_ms), tenant);
+			}
+
+			// Returns the next tenant to handle, or nullptr if the lane is stopped
+			std::shared_ptr<Tenant> WaitForTenant(Lane &lane)
+			{
+				LockGuard lock_guard(lane.ready_mutex);
+
+				while (lane.stop == false)
+				{
+					auto now = std::chrono::steady_clock::now();
+					auto next_due_time = std::chrono::steady_clock::time_point::max();
+
+					for (auto it = lane.deferred_tenants.begin(); it != lane.deferred_tenants.end();)
+					{
+						if ((it->first <= now) || it->second->expedited.exchange(false))
+						{
+							lane.ready_tenants.push_back(std::move(it->second));
+							it = lane.deferred_tenants.erase(it);
+						}
+						else
+						{
+							next_due_time = std::min(next_due_time, it->first);
+							++it;
+						}
+					}
+
+					if (lane.ready_tenants.empty() == false)
+					{
+						auto tenant = std::move(lane.ready_tenants.front());
+						lane.ready_tenants.pop_front();
+						return tenant;
+					}
+
+					if (next_due_time == std::chrono::steady_clock::time_point::max())
+					{
+						lane.ready_condition.Wait(lock_guard);
+					}
+					else
+					{
+						lane.ready_condition.WaitUntil(lock_guard, next_due_time);
+					}
+				}
+
+				return nullptr;
+			}
+
+			void LaneThread(Lane *lane)
+			{
+				ov::logger::ThreadHelper thread_helper;
+
+				if (lane->node_id >= 0)
+				{
+					ThreadPlacement::GetInstance()->PlaceCurrentThreadOnNode(_role, lane->node_id);
+				}
+
+				while (true)
+				{
+					auto tenant = WaitForTenant(*lane);
+					if (tenant == nullptr)
+					{
+						break;
+					}
+
+					HandleTenant(*lane, tenant);
+				}
+			}
+
+			const ov::String _key;
+			const ov::String _queue_part;
+			const ThreadRole _role;
+			const int _buffering_delay_ms;
+			const size_t _queue_threshold;
+			const Handler _handler;
+
+			Mutex _mutex;
+			// Written under the lock, read by Enqueue() for the lanes below _lane_count
+			std::vector<std::unique_ptr<Lane>> _lanes;
+			std::atomic<size_t> _lane_count{0};
+
+			// Tenants by application and lane index. They are owned by the slots and the lanes, and
+			// removed once released.
+			std::map<ov::String, std::map<size_t, std::weak_ptr<Tenant>>> _tenant_map OV_GUARDED_BY(_mutex);
+
+			std::atomic<size_t> _stream_count{0};
+			std::chrono::steady_clock::time_point _idle_since OV_GUARDED_BY(_mutex);
+
+			std::atomic<bool> _stopped{false};
+			std::atomic<uint64_t> _drop_count{0};
+		};
+
+		// The lane a stream is attached to, and the queue of its application there
+		class Slot
+		{
+		public:
+			using Tenant = typename Group::Tenant;
+
+			Slot() = default;
+
+			Slot(const std::shared_ptr<Group> &group, const std::shared_ptr<Tenant> &tenant)
+				: _group(group),
+				  _tenant(tenant)
+			{
+			}
+
+			bool IsValid() const
+			{
+				return _group != nullptr;
+			}
+
+			size_t GetLaneIndex() const
+			{
+				return (_tenant != nullptr) ? _tenant->lane_index : 0;
+			}
+
+			// The queue of the application on the lane, shared by its streams there
+			std::shared_ptr<ManagedQueue<T>> GetQueue() const
+			{
+				return (_tenant != nullptr) ? _tenant->queue : nullptr;
+			}
+
+			// Returns false if the item is dropped, because the group is stopped
+			bool Enqueue(T item, bool urgent = false) const
+			{
+				if (_group == nullptr)
+				{
+					return false;
+				}
+
+				return _group->Enqueue(_tenant, std::move(item), urgent);
+			}
+
+			// The group is kept, so a producer that still holds the slot can enqueue without a
+			// check, but it is no longer counted as a stream of the lane
+			void Detach()
+			{
+				if ((_group != nullptr) && (_detached->exchange(true) == false))
+				{
+					_group->Detach(_tenant);
+				}
+			}
+
+		protected:
+			std::shared_ptr<Group> _group;
+			std::shared_ptr<Tenant> _tenant;
+			// Shared by the copies of the slot, so that the stream is detached only once
+			std::shared_ptr<std::atomic<bool>> _detached = std::make_shared<std::atomic<bool>>(false);
+		};
+
+		// <name> is the part of the queue URN and the name of the idle check thread, and <role> is
+		// what ov::ThreadPlacement pins the lanes as
+		LanePool(const char *name, ThreadRole role, size_t max_lane_count, size_t queue_threshold, Handler handler)
+			: _name(name),
+			  _role(role),
+			  _max_lane_count(max_lane_count),
+			  _queue_threshold(queue_threshold),
+			  _handler(std::move(handler)),
+			  _idle_timer(name)
+		{
+		}
+
+		virtual ~LanePool()
+		{
+			Stop();
+		}
+
+		// Applies the <AppWorkerPool> settings of the server configuration
+		bool Initialize()
+		{
+			LanePoolConfig config;
+
+			if (LoadLanePoolConfig(&config) == false)
+			{
+				return false;
+			}
+
+			Configure(config);
+
+			return true;
+		}
+
+		void Configure(const LanePoolConfig &config)
+		{
+			LockGuard lock_guard(_mutex);
+			_config = config;
+		}
+
+		// Attaches a new stream of the application to a lane of the group <key>. The group starts
+		// with its first stream, and the streams of the application are spread over up to
+		// <lane_count> lanes. Returns an invalid slot when no lane could be started.
+		Slot Attach(const info::VHostAppName &vhost_app_name, const ov::String &key, size_t lane_count, int buffering_delay_ms = 0)
+		{
+			LockGuard lock_guard(_mutex);
+
+			if (_stopped)
+			{
+				return {};
+			}
+
+			StartIdleTimer();
+
+			auto &group = _group_map[key];
+			if (group == nullptr)
+			{
+				group = std::make_shared<Group>(key, ov::String(_name).LowerCaseString(), _role, _max_lane_count, buffering_delay_ms, _queue_threshold, _handler);
+				logi(LANE_POOL_LOG_TAG, "%s has been activated", key.CStr());
+			}
+
+			auto tenant = group->Attach(vhost_app_name, lane_count, ThreadPlacement::GetInstance()->GetCurrentNode());
+			if (tenant == nullptr)
+			{
+				loge(LANE_POOL_LOG_TAG, "Could not attach a stream of %s to %s", vhost_app_name.CStr(), key.CStr());
+
+				if (group->GetLaneCount() == 0)
+				{
+					_group_map.erase(key);
+				}
+
+				return {};
+			}
+
+			return Slot(group, tenant);
+		}
+
+		size_t GetGroupCount() const
+		{
+			LockGuard lock_guard(_mutex);
+			return _group_map.size();
+		}
+
+		// Lanes running right now, which is zero until the first stream arrives
+		size_t GetLaneCount() const
+		{
+			LockGuard lock_guard(_mutex);
+
+			size_t lane_count = 0;
+			for (const auto &[key, group] : _group_map)
+			{
+				lane_count += group->GetLaneCount();
+			}
+
+			return lane_count;
+		}
+
+		// Items dropped by the running groups
+		uint64_t GetDropCount() const
+		{
+			LockGuard lock_guard(_mutex);
+
+			uint64_t drop_count = 0;
+			for (const auto &[key, group] : _group_map)
+			{
+				drop_count += group->GetDropCount();
+			}
+
+			return drop_count;
+		}
+
+		// Stops the groups that had no stream for the idle timeout
+		void StopIdleGroups()
+		{
+			std::vector<std::shared_ptr<Group>> idle_groups;
+			int64_t idle_timeout_ms = 0;
+
+			{
+				LockGuard lock_guard(_mutex);
+
+				idle_timeout_ms = _config.idle_timeout_ms;
+				auto now = std::chrono::steady_clock::now();
+
+				for (auto it = _group_map.begin(); it != _group_map.end();)
+				{
+					if (it->second->IsIdleFor(now, _config.idle_timeout_ms))
+					{
+						idle_groups.push_back(it->second);
+						it = _group_map.erase(it);
+					}
+					else
+					{
+						++it;
+					}
+				}
+			}
+
+			// Joined outside the lock, because a lane may be in the middle of an item that
+			// attaches a stream
+			for (const auto &group : idle_groups)
+			{
+				group->Stop();
+				logi(LANE_POOL_LOG_TAG, "%s has been deactivated after %" PRId64 "ms without a stream", group->GetKey().CStr(), idle_timeout_ms);
+			}
+		}
+
+		void Stop()
+		{
+			std::map<ov::String, std::shared_ptr<Group>> group_map;
+
+			{
+				LockGuard lock_guard(_mutex);
+
+				_stopped = true;
+				group_map = std::move(_group_map);
+				_group_map.clear();
+			}
+
+			_idle_timer.Stop();
+
+			for (const auto &[key, group] : group_map)
+			{
+				group->Stop();
+			}
+		}
+
+	protected:
+		void StartIdleTimer() OV_REQUIRES(_mutex)
+		{
+			if (_idle_timer_started)
+			{
+				return;
+			}
+
+			_idle_timer_started = true;
+
+			_idle_timer.Push(
+				[this](void *parameter) -> ov::DelayQueueAction {
+					StopIdleGroups();
+					return ov::DelayQueueAction::Repeat;
+				},
+				1000);
+			_idle_timer.Start();
+		}
+
+		const ov::String _name;
+		const ThreadRole _role;
+		const size_t _max_lane_count;
+		const size_t _queue_threshold;
+		const Handler _handler;
+
+		mutable Mutex _mutex;
+		LanePoolConfig _config OV_GUARDED_BY(_mutex);
+		std::map<ov::String, std::shared_ptr<Group>> _group_map OV_GUARDED_BY(_mutex);
+		bool _stopped OV_GUARDED_BY(_mutex) = false;
+
+		ov::DelayQueue _idle_timer;
+		bool _idle_timer_started OV_GUARDED_BY(_mutex) = false;
+	};
+}  // namespace ov
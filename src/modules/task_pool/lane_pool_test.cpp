@@ -0,0 +1,367 @@
+//==============================================================================
+//
+//  OvenMediaEngine - Unit Tests
+//
+//  src/modules/task_pool/lane_pool_test.cpp
+//  Covers: LanePool (lazy start, lane assignment, ordering, buffering delay,
+//          turns between applications, busy lanes, idle stop)
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <modules/task_pool/lane_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	constexpr auto kWaitTimeout = std::chrono::seconds(5);
+
+	struct Item
+	{
+		int stream_id = 0;
+		int sequence = 0;
+		std::chrono::steady_clock::time_point enqueued_time;
+	};
+
+	const info::VHostAppName kAppA("#default", "app_a");
+	const info::VHostAppName kAppB("#default", "app_b");
+
+	// Records the items in the order the lanes handle them
+	class ItemRecorder
+	{
+	public:
+		void Record(const Item &item)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			// Hold() keeps the lane busy with the item
+			_condition.wait(lock, [&]() {
+				return _held == false;
+			});
+
+			_items.push_back(item);
+			_handled_times.push_back(std::chrono::steady_clock::now());
+
+			_condition.notify_all();
+		}
+
+		bool WaitFor(size_t count)
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			return _condition.wait_for(lock, kWaitTimeout, [&]() {
+				return _items.size() >= count;
+			});
+		}
+
+		void Hold()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_held = true;
+		}
+
+		void Release()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_held = false;
+			_condition.notify_all();
+		}
+
+		std::vector<Item> GetItems()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			return _items;
+		}
+
+		std::vector<std::chrono::steady_clock::time_point> GetHandledTimes()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			return _handled_times;
+		}
+
+	private:
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		bool _held = false;
+		std::vector<Item> _items;
+		std::vector<std::chrono::steady_clock::time_point> _handled_times;
+	};
+
+	class TestLanePool : public ov::LanePool<Item>
+	{
+	public:
+		explicit TestLanePool(ItemRecorder &recorder, size_t max_lane_count = 4)
+			: ov::LanePool<Item>("TestLane", ov::ThreadRole::Routing, max_lane_count, 0, [&recorder](Item &item) { recorder.Record(item); })
+		{
+		}
+	};
+}  // namespace
+
+TEST(LanePool, StartsLanesWithTheFirstStream)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder);
+
+	EXPECT_EQ(pool.GetGroupCount(), 0u);
+	EXPECT_EQ(pool.GetLaneCount(), 0u);
+
+	auto slot = pool.Attach(kAppA, "TL-A", 2);
+	ASSERT_TRUE(slot.IsValid());
+	EXPECT_EQ(pool.GetGroupCount(), 1u);
+	EXPECT_EQ(pool.GetLaneCount(), 1u);
+
+	// A lane is added only when the running ones all have a stream
+	auto second_slot = pool.Attach(kAppA, "TL-A", 2);
+	ASSERT_TRUE(second_slot.IsValid());
+	EXPECT_EQ(pool.GetLaneCount(), 2u);
+
+	// The application already runs on as many lanes as its worker count
+	auto third_slot = pool.Attach(kAppA, "TL-A", 2);
+	ASSERT_TRUE(third_slot.IsValid());
+	EXPECT_EQ(pool.GetGroupCount(), 1u);
+	EXPECT_EQ(pool.GetLaneCount(), 2u);
+
+	pool.Stop();
+}
+
+TEST(LanePool, AttachesToTheLeastLoadedLane)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder);
+
+	auto first = pool.Attach(kAppA, "TL-B", 2);
+	auto second = pool.Attach(kAppA, "TL-B", 2);
+	ASSERT_TRUE(first.IsValid() && second.IsValid());
+	EXPECT_NE(first.GetLaneIndex(), second.GetLaneIndex());
+
+	// The lane freed by the first stream is taken by the next one
+	first.Detach();
+	auto third = pool.Attach(kAppA, "TL-B", 2);
+	EXPECT_EQ(third.GetLaneIndex(), first.GetLaneIndex());
+
+	// A larger worker count spreads the streams over more lanes
+	auto fourth = pool.Attach(kAppA, "TL-B", 3);
+	EXPECT_EQ(fourth.GetLaneIndex(), 2u);
+	EXPECT_EQ(pool.GetLaneCount(), 3u);
+
+	// The lane count is limited by the pool
+	pool.Attach(kAppA, "TL-B", 100);
+	EXPECT_EQ(pool.GetLaneCount(), 4u);
+
+	pool.Stop();
+}
+
+TEST(LanePool, SharesLanesBetweenApplications)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder, 1);
+
+	auto slot_a = pool.Attach(kAppA, "TL-H", 1);
+	auto slot_b = pool.Attach(kAppB, "TL-H", 1);
+	ASSERT_TRUE(slot_a.IsValid() && slot_b.IsValid());
+
+	EXPECT_EQ(pool.GetGroupCount(), 1u);
+	EXPECT_EQ(pool.GetLaneCount(), 1u);
+	EXPECT_EQ(slot_a.GetLaneIndex(), slot_b.GetLaneIndex());
+
+	pool.Stop();
+}
+
+TEST(LanePool, TakesTurnsBetweenApplications)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder, 1);
+
+	constexpr int kBusyItemCount = 200;
+
+	auto busy = pool.Attach(kAppA, "TL-I", 1);
+	auto quiet = pool.Attach(kAppB, "TL-I", 1);
+	ASSERT_TRUE(busy.IsValid() && quiet.IsValid());
+
+	// The lane is stuck on the first item of the busy application while the items queue up
+	recorder.Hold();
+
+	for (int sequence = 0; sequence < kBusyItemCount; sequence++)
+	{
+		ASSERT_TRUE(busy.Enqueue(Item{0, sequence, std::chrono::steady_clock::now()}));
+	}
+	ASSERT_TRUE(quiet.Enqueue(Item{1, 0, std::chrono::steady_clock::now()}));
+
+	recorder.Release();
+	ASSERT_TRUE(recorder.WaitFor(kBusyItemCount + 1));
+
+	// The quiet application waits for one turn of the busy one, not for all of its items
+	auto items = recorder.GetItems();
+	auto quiet_item = std::find_if(items.begin(), items.end(), [](const Item &item) {
+		return item.stream_id == 1;
+	});
+	ASSERT_NE(quiet_item, items.end());
+	EXPECT_LE(quiet_item - items.begin(), LANE_POOL_ITEMS_PER_TURN);
+
+	pool.Stop();
+}
+
+TEST(LanePool, NeverBlocksTheProducerOfABusyLane)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder, 1);
+
+	constexpr int kItemCount = 20000;
+
+	auto slot = pool.Attach(kAppA, "TL-J", 1);
+	ASSERT_TRUE(slot.IsValid());
+
+	// The lane is stuck on the first item, and the queue grows past its threshold instead of
+	// making the producer wait
+	recorder.Hold();
+
+	auto start = std::chrono::steady_clock::now();
+	for (int sequence = 0; sequence < kItemCount; sequence++)
+	{
+		ASSERT_TRUE(slot.Enqueue(Item{0, sequence, std::chrono::steady_clock::now()}));
+	}
+	EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+	recorder.Release();
+	ASSERT_TRUE(recorder.WaitFor(kItemCount));
+	EXPECT_EQ(pool.GetDropCount(), 0u);
+
+	pool.Stop();
+}
+
+TEST(LanePool, ReusesTheQueueOfAnApplicationAttachedAgain)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder, 1);
+
+	auto first = pool.Attach(kAppA, "TL-K", 1);
+	first.Detach();
+
+	// The first slot still holds the queue, so the application gets it again
+	auto second = pool.Attach(kAppA, "TL-K", 1);
+	ASSERT_TRUE(second.IsValid());
+	EXPECT_EQ(first.GetQueue(), second.GetQueue());
+
+	pool.Stop();
+}
+
+TEST(LanePool, KeepsTheOrderOfAStream)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder);
+
+	constexpr int kStreamCount = 4;
+	constexpr int kItemCount = 200;
+
+	std::vector<ov::LanePool<Item>::Slot> slots;
+	for (int stream_id = 0; stream_id < kStreamCount; stream_id++)
+	{
+		slots.push_back(pool.Attach(kAppA, "TL-C", 2));
+		ASSERT_TRUE(slots.back().IsValid());
+	}
+
+	for (int sequence = 0; sequence < kItemCount; sequence++)
+	{
+		for (int stream_id = 0; stream_id < kStreamCount; stream_id++)
+		{
+			slots[stream_id].Enqueue(Item{stream_id, sequence, std::chrono::steady_clock::now()});
+		}
+	}
+
+	ASSERT_TRUE(recorder.WaitFor(kStreamCount * kItemCount));
+
+	std::vector<int> next_sequences(kStreamCount, 0);
+	for (const auto &item : recorder.GetItems())
+	{
+		EXPECT_EQ(item.sequence, next_sequences[item.stream_id]);
+		next_sequences[item.stream_id] = item.sequence + 1;
+	}
+
+	pool.Stop();
+}
+
+TEST(LanePool, HoldsItemsBackForTheBufferingDelay)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder);
+
+	constexpr int kDelayMs = 200;
+
+	auto slot = pool.Attach(kAppA, "TL-D", 1, kDelayMs);
+	ASSERT_TRUE(slot.IsValid());
+
+	auto enqueued_time = std::chrono::steady_clock::now();
+	slot.Enqueue(Item{0, 0, enqueued_time});
+
+	ASSERT_TRUE(recorder.WaitFor(1));
+	EXPECT_GE(recorder.GetHandledTimes()[0] - enqueued_time, std::chrono::milliseconds(kDelayMs));
+
+	pool.Stop();
+}
+
+TEST(LanePool, StopsIdleGroups)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder);
+
+	ov::LanePoolConfig config;
+	config.idle_timeout_ms = 0;
+	pool.Configure(config);
+
+	auto busy = pool.Attach(kAppA, "TL-E", 2);
+	auto idle = pool.Attach(kAppA, "TL-F", 2);
+	ASSERT_TRUE(busy.IsValid() && idle.IsValid());
+	EXPECT_EQ(pool.GetLaneCount(), 2u);
+
+	idle.Detach();
+	// Detaching twice, such as from a copy of the slot, counts once
+	auto copy = busy;
+	copy.Detach();
+	busy.Detach();
+	auto still_busy = pool.Attach(kAppA, "TL-E", 2);
+
+	pool.StopIdleGroups();
+	EXPECT_EQ(pool.GetGroupCount(), 1u);
+	EXPECT_EQ(pool.GetLaneCount(), 1u);
+
+	// A stopped group drops what is enqueued to it
+	EXPECT_FALSE(idle.Enqueue(Item{}));
+
+	// and a new stream starts the group again
+	auto restarted = pool.Attach(kAppA, "TL-F", 2);
+	ASSERT_TRUE(restarted.IsValid());
+	EXPECT_EQ(pool.GetGroupCount(), 2u);
+
+	restarted.Enqueue(Item{1, 0, std::chrono::steady_clock::now()});
+	ASSERT_TRUE(recorder.WaitFor(1));
+	EXPECT_EQ(recorder.GetItems().size(), 1u);
+	EXPECT_EQ(recorder.GetItems()[0].stream_id, 1);
+
+	pool.Stop();
+}
+
+TEST(LanePool, KeepsGroupsWithoutIdleTimeout)
+{
+	ItemRecorder recorder;
+	TestLanePool pool(recorder);
+
+	ov::LanePoolConfig config;
+	config.idle_timeout_ms = -1;
+	pool.Configure(config);
+
+	auto slot = pool.Attach(kAppA, "TL-G", 1);
+	slot.Detach();
+
+	pool.StopIdleGroups();
+	EXPECT_EQ(pool.GetGroupCount(), 1u);
+
+	pool.Stop();
+	EXPECT_EQ(pool.GetGroupCount(), 0u);
+	EXPECT_FALSE(pool.Attach(kAppA, "TL-G", 1).IsValid());
+}
@@ -237,6 +237,31 @@ namespace mon::alrt
 			}
 		}
 
+		if (rules->GetStreamMemoryBudget() > 0)
+		{
+			// Check the memory the streams hold. A stream without any account left (e.g. deleted)
+			// is released by CleanupReleasedMessages() below.
+
+			type = NotificationData::Type::INTERNAL_MEMORY;
+
+			for (const auto &memory_stats : ov::MemoryAccounting::GetInstance()->GetReport().streams)
+			{
+				message_list.clear();
+
+				messages_key = MakeMessagesKey(type, memory_stats.stream_uri);
+				new_messages_keys.push_back(messages_key);
+
+				VerifyMemoryBudgetRules(*rules, memory_stats, message_list);
+
+				if (IsAlertNeeded(messages_key, message_list))
+				{
+					SendNotification(type, message_list, memory_stats.stream_uri, memory_stats);
+				}
+
+				PutVerifiedMessages(messages_key, message_list);
+			}
+		}
+
 		{
 			// Check streams
 
@@ -504,6 +529,20 @@ namespace mon::alrt
 		return true;
 	}
 
+	bool Alert::VerifyMemoryBudgetRules(const cfg::alrt::rule::Rules &rules, const ov::MemoryAccounting::StreamStats &memory_stats, std::vector<std::shared_ptr<Message>> &message_list)
+	{
+		auto budget = rules.GetStreamMemoryBudget();
+
+		if ((budget > 0) && (static_cast<int64_t>(memory_stats.live_bytes) > budget))
+		{
+			AddNonOkMessage<int64_t>(message_list, Message::Code::INTERNAL_MEMORY_BUDGET_EXCEEDED, budget, static_cast<int64_t>(memory_stats.live_bytes));
+
+			return false;
+		}
+
+		return true;
+	}
+
 	void Alert::VerifyIngressMetricRules(const cfg::alrt::rule::Rules &rules, const std::shared_ptr<StreamMetrics> &stream_metric, std::vector<std::shared_ptr<Message>> &message_list)
 	{
 		auto ingress = rules.GetIngress();
@@ -719,6 +758,12 @@ namespace mon::alrt
 		_queue_notification.Notify();
 	}
 
+	void Alert::SendNotification(const NotificationData::Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const ov::MemoryAccounting::StreamStats &memory_stats)
+	{
+		_notification_queue.Enqueue(std::make_shared<NotificationData>(type, message_list, source_uri, memory_stats));
+		_queue_notification.Notify();
+	}
+
 	void Alert::CleanupReleasedMessages(const std::vector<ov::String> &new_messages_keys)
 	{
 		// Find and cleanup the messages that have already been released among the alerts that were sent.
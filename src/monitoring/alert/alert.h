@@ -61,6 +61,7 @@ namespace mon::alrt
 		bool VerifyStreamEventRule(const cfg::alrt::rule::Rules &rules, Message::Code code);
 
 		bool VerifyQueueCongestionRules(const cfg::alrt::rule::Rules &rules, const std::shared_ptr<QueueMetrics> &queue_metric, std::vector<std::shared_ptr<Message>> &message_list);
+		bool VerifyMemoryBudgetRules(const cfg::alrt::rule::Rules &rules, const ov::MemoryAccounting::StreamStats &memory_stats, std::vector<std::shared_ptr<Message>> &message_list);
 		void VerifyIngressMetricRules(const cfg::alrt::rule::Rules &rules, const std::shared_ptr<StreamMetrics> &stream_metric, std::vector<std::shared_ptr<Message>> &message_list);
 		void VerifyVideoIngressRules(const cfg::alrt::rule::Ingress &ingress, const std::shared_ptr<const MediaTrack> &video_track, const std::shared_ptr<TrackStats> &stats, std::vector<std::shared_ptr<Message>> &message_list);
 		void VerifyAudioIngressRules(const cfg::alrt::rule::Ingress &ingress, const std::shared_ptr<const MediaTrack> &audio_track, const std::shared_ptr<TrackStats> &stats, std::vector<std::shared_ptr<Message>> &message_list);
@@ -68,6 +69,7 @@ namespace mon::alrt
 		bool IsAlertNeeded(const ov::String &messages_key, const std::vector<std::shared_ptr<Message>> &message_list);
 		void SendNotification(const NotificationData::Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const std::shared_ptr<StreamMetrics> &stream_metric);
 		void SendNotification(const NotificationData::Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const std::map<uint32_t, std::shared_ptr<QueueMetrics>> &queue_metric_list);
+		void SendNotification(const NotificationData::Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const ov::MemoryAccounting::StreamStats &memory_stats);
 
 		void CleanupReleasedMessages(const std::vector<ov::String> &new_messages_keys);
 		bool PutVerifiedMessages(const ov::String &messages_key, std::vector<std::shared_ptr<Message>> &message_list);
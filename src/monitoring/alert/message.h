@@ -23,6 +23,7 @@ namespace mon::alrt
 		constexpr static const uint32_t EGRESS_CODE_READY_MASK	   = EGRESS_CODE_MASK | 0x002000;
 		constexpr static const uint32_t EGRESS_CODE_TRANSCODE_MASK = EGRESS_CODE_MASK | 0x004000;
 		constexpr static const uint32_t INTERNAL_QUEUE_CODE_MASK   = 0x140000;
+		constexpr static const uint32_t INTERNAL_MEMORY_CODE_MASK  = 0x150000;
 
 		enum class Code : uint32_t
 		{
@@ -65,7 +66,10 @@ namespace mon::alrt
 			EGRESS_HLS_READY,
 
 			// Internal Codes
-			INTERNAL_QUEUE_CONGESTION = INTERNAL_QUEUE_CODE_MASK
+			INTERNAL_QUEUE_CONGESTION = INTERNAL_QUEUE_CODE_MASK,
+
+			// Internal Memory
+			INTERNAL_MEMORY_BUDGET_EXCEEDED = INTERNAL_MEMORY_CODE_MASK
 		};
 
 		static std::shared_ptr<Message> CreateMessage(Code code, const ov::String &description)
@@ -127,6 +131,7 @@ namespace mon::alrt
 				OV_CASE_RETURN_ENUM_STRING(Code, EGRESS_HLS_READY);
 
 				OV_CASE_RETURN_ENUM_STRING(Code, INTERNAL_QUEUE_CONGESTION);
+				OV_CASE_RETURN_ENUM_STRING(Code, INTERNAL_MEMORY_BUDGET_EXCEEDED);
 
 			}
 
@@ -191,6 +196,7 @@ namespace mon::alrt
 
 				// Internal Codes
 				RETURN_DESCRIPTION(Code::INTERNAL_QUEUE_CONGESTION, "Internal queue(s) is currently congested");
+				RETURN_DESCRIPTION(Code::INTERNAL_MEMORY_BUDGET_EXCEEDED, "The stream holds %.0f bytes of memory, more than the configured budget (%.0f bytes)", static_cast<double>(measured), static_cast<double>(config));
 			}
 
 			OV_ASSERT2(false);
@@ -28,6 +28,14 @@ namespace mon::alrt
 	{
 	}
 
+	NotificationData::NotificationData(const Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const ov::MemoryAccounting::StreamStats &memory_stats)
+		: _type(type),
+		  _message_list(message_list),
+		  _source_uri(source_uri),
+		  _memory_stats(std::make_shared<ov::MemoryAccounting::StreamStats>(memory_stats))
+	{
+	}
+
 	NotificationData::NotificationData(const Type &type, const std::vector<std::shared_ptr<Message>> &message_list)
 		: _type(type),
 		  _message_list(message_list)
@@ -102,6 +110,28 @@ namespace mon::alrt
 			jv_root["internalQueues"] = jv_queues;
 		}
 
+		if (_memory_stats != nullptr)
+		{
+			Json::Value jv_memory;
+			Json::Value jv_accounts = Json::arrayValue;
+
+			jv_memory["liveBytes"] = static_cast<Json::UInt64>(_memory_stats->live_bytes);
+
+			for (const auto &account : _memory_stats->accounts)
+			{
+				Json::Value jv_account;
+
+				jv_account["tag"] = ov::StringFromMemoryTag(account.tag);
+				jv_account["liveBytes"] = static_cast<Json::UInt64>(account.live_bytes);
+				jv_account["peakBytes"] = static_cast<Json::UInt64>(account.peak_bytes);
+
+				jv_accounts.append(jv_account);
+			}
+
+			jv_memory["accounts"] = jv_accounts;
+			jv_root["memory"] = jv_memory;
+		}
+
 		if (_parent_stream_metric != nullptr)
 		{
 			Json::Value jv_parent_source_info = ::serdes::JsonFromStream(_parent_stream_metric);
@@ -22,7 +22,8 @@ namespace mon::alrt
 		{
 			INGRESS,
 			EGRESS,
-			INTERNAL_QUEUE
+			INTERNAL_QUEUE,
+			INTERNAL_MEMORY
 		};
 
 		constexpr static const char *StringFromType(Type type)
@@ -32,6 +33,7 @@ namespace mon::alrt
 				OV_CASE_RETURN_ENUM_STRING(Type, INGRESS);
 				OV_CASE_RETURN_ENUM_STRING(Type, EGRESS);
 				OV_CASE_RETURN_ENUM_STRING(Type, INTERNAL_QUEUE);
+				OV_CASE_RETURN_ENUM_STRING(Type, INTERNAL_MEMORY);
 			}
 
 			OV_ASSERT2(false);
@@ -79,6 +81,9 @@ namespace mon::alrt
 
 				case Message::Code::INTERNAL_QUEUE_CONGESTION:
 					return Type::INTERNAL_QUEUE;
+
+				case Message::Code::INTERNAL_MEMORY_BUDGET_EXCEEDED:
+					return Type::INTERNAL_MEMORY;
 			}
 
 			OV_ASSERT2(false);
@@ -87,6 +92,7 @@ namespace mon::alrt
 
 		NotificationData(const Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String source_uri, const std::shared_ptr<StreamMetrics> &stream_metric);
 		NotificationData(const Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const std::map<uint32_t, std::shared_ptr<QueueMetrics>> &queue_metric_list);
+		NotificationData(const Type &type, const std::vector<std::shared_ptr<Message>> &message_list, const ov::String &source_uri, const ov::MemoryAccounting::StreamStats &memory_stats);
 		NotificationData(const Type &type, const std::vector<std::shared_ptr<Message>> &message_list);
 		ov::String ToJsonString(const Json::Value &server_info) const;
 
@@ -120,5 +126,7 @@ namespace mon::alrt
 		std::shared_ptr<ExtraData> _extra							  = nullptr;
 
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queue_metric_list;
+
+		std::shared_ptr<ov::MemoryAccounting::StreamStats> _memory_stats = nullptr;
 	};
 }  // namespace mon::alrt
@@ -15,6 +15,7 @@
 #include <monitoring/monitoring.h>
 
 #include <functional>
+#include <set>
 
 #include "orchestrator_private.h"
 
@@ -153,6 +154,13 @@ namespace ocst
 			_virtual_host_list.clear();
 			_virtual_host_map.clear();
 		}
+
+		if (_startup_pool != nullptr)
+		{
+			// Lets an OCSP prefetch still running finish
+			_startup_pool->Stop();
+		}
+
 		mon::Monitoring::GetInstance()->Release();
 
 		return Result::Succeeded;
@@ -160,19 +168,260 @@ namespace ocst
 
 	bool Orchestrator::CreateVirtualHosts(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list)
 	{
-		for (const auto &vhost_conf : vhost_conf_list)
+		ov::StopWatch total_watch;
+		ov::StopWatch phase_watch;
+
+		total_watch.Start();
+
+		// The certificates of the virtual hosts do not depend on each other, so they are loaded
+		// in parallel. The OCSP fetches are started as soon as the certificates are ready and run
+		// while the virtual hosts and applications are created.
+		auto thread_count = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(4));
+
+		_startup_pool = std::make_shared<ov::TaskPool>();
+		_startup_pool->Configure({thread_count, std::max(vhost_conf_list.size(), static_cast<size_t>(1))});
+
+		{
+			std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+			_startup_timings = {};
+			_startup_timings.vhost_count = vhost_conf_list.size();
+		}
+
+		phase_watch.Start();
+		auto host_info_list = LoadHostInfoList(vhost_conf_list);
+		auto certificate_ms = phase_watch.Elapsed();
+
+		size_t certificate_count = 0;
+		for (const auto &host_info : host_info_list)
 		{
-			// Create VirtualHost in Orchestrator
-			if (CreateVirtualHost(vhost_conf) != Result::Succeeded)
+			if (host_info->GetCertificate() != nullptr)
 			{
-				logte("Could not create VirtualHost(%s)", vhost_conf.GetName().CStr());
+				certificate_count++;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+			_startup_timings.certificate_count = certificate_count;
+			_startup_timings.certificate_ms = certificate_ms;
+		}
+
+		PrefetchOcspResponses(host_info_list);
+
+		phase_watch.Restart();
+		if (RegisterVirtualHosts(host_info_list) != Result::Succeeded)
+		{
+			return false;
+		}
+		auto vhost_ms = phase_watch.Elapsed();
+
+		// Applications are created one by one - module callbacks expect to run under
+		// `_late_module_registration_mutex` for the whole create flow of an application
+		phase_watch.Restart();
+		size_t application_count = 0;
+		for (const auto &host_info : host_info_list)
+		{
+			if (CreateApplications(*host_info, &application_count) != Result::Succeeded)
+			{
+				logte("Could not create VirtualHost(%s)", host_info->GetName().CStr());
 				return false;
 			}
 		}
+		auto application_ms = phase_watch.Elapsed();
+
+		std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+
+		_startup_timings.application_count = application_count;
+		_startup_timings.vhost_ms = vhost_ms;
+		_startup_timings.application_ms = application_ms;
+		_startup_timings.total_ms = total_watch.Elapsed();
+
+		logti("%zu virtual hosts and %zu applications are created in %" PRId64 "ms (certificates: %zu in %" PRId64 "ms, vhosts: %" PRId64 "ms, applications: %" PRId64 "ms, OCSP prefetch: %zu in background)",
+			  _startup_timings.vhost_count, _startup_timings.application_count, _startup_timings.total_ms,
+			  _startup_timings.certificate_count, _startup_timings.certificate_ms,
+			  _startup_timings.vhost_ms, _startup_timings.application_ms,
+			  _startup_timings.ocsp_count);
 
 		return true;
 	}
 
+	Orchestrator::StartupTimings Orchestrator::GetStartupTimings() const
+	{
+		std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+		return _startup_timings;
+	}
+
+	std::vector<std::shared_ptr<info::Host>> Orchestrator::LoadHostInfoList(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list)
+	{
+		auto server_name = _server_config->GetName();
+		auto server_id = _server_config->GetID();
+
+		std::vector<std::future<std::shared_ptr<info::Host>>> future_list;
+		future_list.reserve(vhost_conf_list.size());
+
+		for (const auto &vhost_conf : vhost_conf_list)
+		{
+			future_list.push_back(_startup_pool->Submit([server_name, server_id, &vhost_conf]() {
+				// The constructor loads the certificate
+				return std::make_shared<info::Host>(server_name, server_id, vhost_conf);
+			}));
+		}
+
+		std::vector<std::shared_ptr<info::Host>> host_info_list;
+		host_info_list.reserve(vhost_conf_list.size());
+
+		for (size_t index = 0; index < future_list.size(); index++)
+		{
+			try
+			{
+				host_info_list.push_back(future_list[index].get());
+			}
+			catch (const std::future_error &error)
+			{
+				// The pool could not run the task, so the certificate is loaded here instead
+				logtw("Could not load the certificate of %s in parallel: %s", vhost_conf_list[index].GetName().CStr(), error.what());
+				host_info_list.push_back(std::make_shared<info::Host>(server_name, server_id, vhost_conf_list[index]));
+			}
+		}
+
+		return host_info_list;
+	}
+
+	size_t Orchestrator::PrefetchOcspResponses(const std::vector<std::shared_ptr<info::Host>> &host_info_list)
+	{
+		std::vector<std::shared_ptr<info::Certificate>> certificate_list;
+
+		for (const auto &host_info : host_info_list)
+		{
+			if (host_info->GetCertificate() != nullptr)
+			{
+				certificate_list.push_back(host_info->GetCertificate());
+			}
+		}
+
+		if (certificate_list.empty())
+		{
+			std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+			_startup_timings.ocsp_completed = true;
+			return 0;
+		}
+
+		struct PrefetchState
+		{
+			std::atomic<size_t> remaining_count{0};
+			std::atomic<size_t> failed_count{0};
+			ov::StopWatch watch;
+		};
+
+		auto state = std::make_shared<PrefetchState>();
+		state->remaining_count = certificate_list.size();
+		state->watch.Start();
+
+		{
+			std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+			_startup_timings.ocsp_count = certificate_list.size();
+		}
+
+		// The Orchestrator outlives the pool, which is stopped in `Release()`
+		auto on_prefetched = [this, state](bool succeeded) {
+			if (succeeded == false)
+			{
+				state->failed_count++;
+			}
+
+			if (--state->remaining_count == 0)
+			{
+				std::lock_guard<std::mutex> lock(_startup_timings_mutex);
+
+				_startup_timings.ocsp_failed_count = state->failed_count;
+				_startup_timings.ocsp_completed = true;
+				_startup_timings.ocsp_ms = state->watch.Elapsed();
+
+				logti("OCSP responses of %zu certificates are prefetched in %" PRId64 "ms (failed: %zu)",
+					  _startup_timings.ocsp_count, _startup_timings.ocsp_ms, _startup_timings.ocsp_failed_count);
+			}
+		};
+
+		for (const auto &certificate : certificate_list)
+		{
+			auto posted = _startup_pool->Post([certificate, on_prefetched]() {
+				on_prefetched(ov::TlsContext::PrefetchOcspResponse(certificate->GetCertificate()));
+			});
+
+			if (posted == false)
+			{
+				// The response will be fetched by the first handshake instead
+				on_prefetched(false);
+			}
+		}
+
+		return certificate_list.size();
+	}
+
+	Result Orchestrator::RegisterVirtualHosts(const std::vector<std::shared_ptr<info::Host>> &host_info_list)
+	{
+		std::vector<std::shared_ptr<VirtualHost>> vhost_list;
+
+		{
+			// Serialize against late `RegisterModule()` and `DeleteVirtualHost()` as
+			// `CreateVirtualHost()` does, but for all virtual hosts at once
+			std::scoped_lock lock(_late_module_registration_mutex);
+
+			std::set<ov::String> vhost_name_set;
+
+			for (const auto &host_info : host_info_list)
+			{
+				if ((GetVirtualHost(host_info->GetName()) != nullptr) ||
+					(vhost_name_set.insert(host_info->GetName()).second == false))
+				{
+					logtc("Duplicate virtual host [%s] found. Please check the settings.", host_info->GetName().CStr());
+					return Result::Exists;
+				}
+			}
+
+			{
+				std::lock_guard<std::shared_mutex> guard(_virtual_host_mutex);
+
+				for (const auto &host_info : host_info_list)
+				{
+					auto vhost = std::make_shared<VirtualHost>(*host_info);
+
+					_virtual_host_map[host_info->GetName()] = vhost;
+					_virtual_host_list.push_back(vhost);
+				}
+			}
+
+			// Notification
+			auto module_list = GetModuleList();
+			for (auto &module : module_list)
+			{
+				auto module_interface = module.GetModuleInterface();
+
+				for (const auto &host_info : host_info_list)
+				{
+					logtt("Notifying %p (%s) for the create event (%s)", module_interface.get(), GetModuleTypeName(module_interface->GetModuleType()).CStr(), host_info->GetName().CStr());
+
+					if (module_interface->OnCreateHost(*host_info))
+					{
+						logtt("The module %p (%s) returns true", module_interface.get(), GetModuleTypeName(module_interface->GetModuleType()).CStr());
+					}
+					else
+					{
+						logte("The module %p (%s) returns error while creating the vhost [%s]",
+							module_interface.get(), GetModuleTypeName(module_interface->GetModuleType()).CStr(), host_info->GetName().CStr());
+					}
+				}
+			}
+		}
+
+		for (const auto &host_info : host_info_list)
+		{
+			mon::Monitoring::GetInstance()->OnHostCreated(*host_info);
+		}
+
+		return Result::Succeeded;
+	}
+
 	Result Orchestrator::CreateVirtualHost(const cfg::vhost::VirtualHost &vhost_cfg)
 	{
 		info::Host vhost_info(_server_config->GetName(), _server_config->GetID(), vhost_cfg);
@@ -198,7 +447,11 @@ namespace ocst
 				return result;
 		}
 
-		// Create Applications
+		return CreateApplications(vhost_info, nullptr);
+	}
+
+	Result Orchestrator::CreateApplications(const info::Host &vhost_info, size_t *created_count)
+	{
 		for (const auto &app_cfg : vhost_info.GetApplicationList())
 		{
 			if (app_cfg.GetName() == "*")
@@ -217,6 +470,11 @@ namespace ocst
 					DeleteVirtualHost(vhost_info);
 					return Result::Failed;
 				}
+
+				if (created_count != nullptr)
+				{
+					(*created_count)++;
+				}
 			}
 		}
 
@@ -972,7 +1230,7 @@ namespace ocst
 		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
 
 		ov::String url_str;
-		if (client->GetOrigin(app_stream_name, url_str) == CommonErrorCode::SUCCESS)
+		if (client->GetUpstream(app_stream_name, vhost->GetOriginMapRelayTier(), url_str) == CommonErrorCode::SUCCESS)
 		{
 			return ov::Url::Parse(url_str);
 		}
@@ -1044,6 +1302,82 @@ namespace ocst
 		return CommonErrorCode::ERROR;
 	}
 
+	int Orchestrator::GetOriginMapStoreRelayTier(const info::VHostAppName &vhost_app_name) const
+	{
+		auto vhost = GetVirtualHost(vhost_app_name);
+		if ((vhost == nullptr) || (vhost->IsOriginMapStoreEnabled() == false))
+		{
+			return 0;
+		}
+
+		return vhost->GetOriginMapRelayTier();
+	}
+
+	CommonErrorCode Orchestrator::RegisterRelayToOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		auto vhost = GetVirtualHost(vhost_app_name);
+		if (vhost == nullptr)
+		{
+			// Error
+			return CommonErrorCode::ERROR;
+		}
+
+		// A relay must be reachable by the next tier
+		if ((vhost->IsOriginMapStoreEnabled() == false) || (vhost->GetOriginMapRelayTier() <= 0) || vhost->GetOriginBaseUrl().IsEmpty())
+		{
+			// disabled by user
+			return CommonErrorCode::DISABLED;
+		}
+
+		auto client = vhost->GetOriginMapClient();
+		if (client == nullptr)
+		{
+			// Error
+			return CommonErrorCode::ERROR;
+		}
+
+		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+		auto ovt_url = ov::String::FormatString("%s/%s", vhost->GetOriginBaseUrl().CStr(), app_stream_name.CStr());
+		if (client->RequestRegisterRelay(app_stream_name, vhost->GetOriginMapRelayTier(), ovt_url) == true)
+		{
+			return CommonErrorCode::SUCCESS;
+		}
+
+		return CommonErrorCode::ERROR;
+	}
+
+	CommonErrorCode Orchestrator::UnregisterRelayFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		auto vhost = GetVirtualHost(vhost_app_name);
+		if (vhost == nullptr)
+		{
+			// Error
+			return CommonErrorCode::ERROR;
+		}
+
+		if ((vhost->IsOriginMapStoreEnabled() == false) || (vhost->GetOriginMapRelayTier() <= 0) || vhost->GetOriginBaseUrl().IsEmpty())
+		{
+			// disabled by user
+			return CommonErrorCode::DISABLED;
+		}
+
+		auto client = vhost->GetOriginMapClient();
+		if (client == nullptr)
+		{
+			// Error
+			return CommonErrorCode::ERROR;
+		}
+
+		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+
+		if (client->RequestUnregisterRelay(app_stream_name, vhost->GetOriginMapRelayTier()) == true)
+		{
+			return CommonErrorCode::SUCCESS;
+		}
+
+		return CommonErrorCode::ERROR;
+	}
+
 	bool Orchestrator::CheckIfStreamExist(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
 	{
 		auto stream = GetProviderStream(vhost_app_name, stream_name);
@@ -12,6 +12,7 @@
 #include <base/provider/provider.h>
 #include <base/publisher/publisher.h>
 #include <modules/http/http_error.h>
+#include <modules/task_pool/task_pool.h>
 
 #include "virtual_host.h"
 #include "module.h"
@@ -60,6 +61,30 @@ namespace ocst
 							public Application::CallbackInterface
 	{
 	public:
+		// Time spent in each phase of bringing up the virtual hosts of the configuration
+		struct StartupTimings
+		{
+			size_t vhost_count = 0;
+			size_t certificate_count = 0;
+			size_t application_count = 0;
+
+			// Loading the certificates of the virtual hosts, in parallel
+			int64_t certificate_ms = 0;
+			// Registering the virtual hosts and notifying the modules of them
+			int64_t vhost_ms = 0;
+			// Creating the applications and notifying the modules of them
+			int64_t application_ms = 0;
+			// All of the above, until the server is ready to take requests
+			int64_t total_ms = 0;
+
+			// OCSP responses are fetched in the background, so the server gets ready without
+			// waiting for the responders. ocsp_ms is set when the last one is done.
+			size_t ocsp_count = 0;
+			size_t ocsp_failed_count = 0;
+			bool ocsp_completed = false;
+			int64_t ocsp_ms = 0;
+		};
+
 		/// Register the module
 		///
 		/// @param module Module to register. May be called before or after `StartServer()`; in the
@@ -95,6 +120,8 @@ namespace ocst
 
 		bool CreateVirtualHosts(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list);
 
+		StartupTimings GetStartupTimings() const;
+
 		/// Create an application and notify the modules
 		///
 		/// @param vhost_name A name of VirtualHost
@@ -235,6 +262,12 @@ namespace ocst
 		std::shared_ptr<ov::Url> GetOriginUrlFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const;
 		CommonErrorCode RegisterStreamToOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 		CommonErrorCode UnregisterStreamFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		// Relay tiers (see OriginMapClient::MakeRelayKey())
+		// key : relay/<tier>/<app/stream>
+		// value : ovt://host:port/<app/stream>
+		int GetOriginMapStoreRelayTier(const info::VHostAppName &vhost_app_name) const;
+		CommonErrorCode RegisterRelayToOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		CommonErrorCode UnregisterRelayFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
 		// Mirror Stream
 		bool CheckIfStreamExist(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
@@ -274,6 +307,19 @@ namespace ocst
 		std::shared_ptr<const VirtualHost> GetVirtualHost(const info::VHostAppName &vhost_app_name) const;
 
 		Result CreateApplicationTemplate(const info::Host &host_info, const cfg::vhost::app::Application &app_config);
+		// Creates the applications in the configuration of the virtual host, and deletes the
+		// virtual host if one of them cannot be created
+		Result CreateApplications(const info::Host &vhost_info, size_t *created_count);
+
+		// Creates the host information of each virtual host on `_startup_pool`, which loads
+		// their certificates in parallel
+		std::vector<std::shared_ptr<info::Host>> LoadHostInfoList(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list);
+		// Fetches the OCSP responses of the certificates on `_startup_pool` without waiting for
+		// them, and returns how many fetches have been started
+		size_t PrefetchOcspResponses(const std::vector<std::shared_ptr<info::Host>> &host_info_list);
+		// Registers the virtual hosts, then notifies each module of all of them at once under a
+		// single hold of `_late_module_registration_mutex`
+		Result RegisterVirtualHosts(const std::vector<std::shared_ptr<info::Host>> &host_info_list);
 
 		std::shared_ptr<Application> GetApplication(const info::VHostAppName &vhost_app_name) const;
 		const info::Application &GetApplicationInfo(const ov::String &vhost_name, info::application_id_t app_id) const;
@@ -320,5 +366,12 @@ namespace ocst
 
 		// Module Timer : It is called periodically by the timer
 		ov::DelayQueue _timer{"Orchestrator"};
+
+		// Runs the certificate loading and OCSP prefetches of `StartServer()`, so that they do not
+		// wait behind the tasks other modules post to the shared TaskPool
+		std::shared_ptr<ov::TaskPool> _startup_pool;
+
+		mutable std::mutex _startup_timings_mutex;
+		StartupTimings _startup_timings;
 	};
 }  // namespace ocst
@@ -48,6 +48,12 @@ namespace ocst
 			{
 				logti("OriginMapStore::OriginHostName is not specified. This OriginMapStore can work only as a edge.");
 			}
+
+			_origin_map_relay_tier = std::max(store.GetRelayTier(), 0);
+			if (_origin_map_relay_tier > 0)
+			{
+				logti("OriginMapStore: This server relays streams at tier %d", _origin_map_relay_tier);
+			}
 		}
 	}
 
@@ -66,6 +72,11 @@ namespace ocst
 		return _origin_base_url;
 	}
 
+	int VirtualHost::GetOriginMapRelayTier() const
+	{
+		return _origin_map_relay_tier;
+	}
+
 	bool VirtualHost::LoadCertificate()
 	{
 		_host_info.LoadCertificate();
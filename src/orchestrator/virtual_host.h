@@ -49,6 +49,7 @@ namespace ocst
 		std::shared_ptr<OriginMapClient> GetOriginMapClient() const;
 
 		ov::String GetOriginBaseUrl() const;
+		int GetOriginMapRelayTier() const;
 	
 	private:
 		// Origin Host Info
@@ -88,6 +89,7 @@ namespace ocst
 		// OriginMapStore
 		bool _is_origin_map_store_enabled = false;
 		ov::String _origin_base_url;
+		int _origin_map_relay_tier = 0;
 		std::shared_ptr<OriginMapClient> _origin_map_client = nullptr;
 
 		// Template of dynamic application configuration
@@ -16,10 +16,9 @@
 // cannot monopolize the worker loop
 static constexpr int MULTIPLEX_MAX_DRAIN_PER_SOURCE = 128;
 
-// Idle sleep bounds for the worker loop; the sleep backs off on consecutive
-// empty rounds so an idle channel does not burn wakeups
-static constexpr int MULTIPLEX_IDLE_SLEEP_MIN_MS = 1;
-static constexpr int MULTIPLEX_IDLE_SLEEP_MAX_MS = 10;
+// The worker sleeps until a source tap signals a new packet; the timeout only bounds
+// how long an untapped source can go unnoticed while every source is silent
+static constexpr int MULTIPLEX_IDLE_WAIT_MAX_MS = 100;
 
 namespace pvd
 {
@@ -60,6 +59,7 @@ namespace pvd
         }
 
         _worker_thread_running.store(false);
+        _packet_arrived->SetEvent();
 
         if (_worker_thread.joinable())
         {
@@ -129,8 +129,6 @@ namespace pvd
         // The source list is fixed for the stream's lifetime; a profile change recreates the stream
         const auto &source_streams = _multiplex_profile->GetSourceStreams();
 
-        int idle_sleep_ms = MULTIPLEX_IDLE_SLEEP_MIN_MS;
-
         while (_worker_thread_running.load())
         {
             _mux_state = MuxState::Playing;
@@ -196,18 +194,9 @@ namespace pvd
 
             if (any_packet_popped == false)
             {
-                // Every tap was empty in this round
-                std::this_thread::sleep_for(std::chrono::milliseconds(idle_sleep_ms));
-
-                idle_sleep_ms *= 2;
-                if (idle_sleep_ms > MULTIPLEX_IDLE_SLEEP_MAX_MS)
-                {
-                    idle_sleep_ms = MULTIPLEX_IDLE_SLEEP_MAX_MS;
-                }
-            }
-            else
-            {
-                idle_sleep_ms = MULTIPLEX_IDLE_SLEEP_MIN_MS;
+                // Every tap was empty in this round. A packet pushed after a tap was drained
+                // leaves the event set, so this returns immediately instead of missing it.
+                _packet_arrived->Wait(MULTIPLEX_IDLE_WAIT_MAX_MS);
             }
         }
 
@@ -242,6 +231,9 @@ namespace pvd
             }
 
 			stream_tap->SetNeedPastData(true);
+			stream_tap->SetPacketNotifier([packet_arrived = _packet_arrived]() {
+				packet_arrived->SetEvent();
+			});
 			stream_tap->Start();
 
             if (stream_tap->GetState() != MediaRouterStreamTap::State::Tapped)
@@ -364,6 +356,8 @@ namespace pvd
                 continue;
             }
 
+            stream_tap->SetPacketNotifier(nullptr);
+
             if (stream_tap->GetState() != MediaRouterStreamTap::State::Tapped)
             {
                 continue;
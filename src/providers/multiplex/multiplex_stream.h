@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include <base/ovlibrary/event.h>
 #include <modules/ffmpeg/compat.h>
 #include <orchestrator/orchestrator.h>
 #include <mediarouter/mediarouter_stream_tap.h>
@@ -62,6 +63,9 @@ namespace pvd
         std::thread _worker_thread;
         std::atomic<bool> _worker_thread_running{false};
 
+        // Shared by every source tap, signalled when any of them buffers a packet
+        std::shared_ptr<ov::Event> _packet_arrived = std::make_shared<ov::Event>();
+
         MuxState _mux_state = MuxState::None;
         ov::String _pulling_state_msg;
 
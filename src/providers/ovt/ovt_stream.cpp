@@ -78,6 +78,10 @@ namespace pvd
 
 		_curr_url = url;
 
+		// A relay stream is sent to the publishers as it is received, so the OVT publisher can
+		// forward the packets it arrived in instead of packetizing it again
+		_depacketizer.KeepMediaFragments(GetRepresentationType() == StreamRepresentationType::Relay);
+
 		if (_packetizer == nullptr)
 		{
 			_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
@@ -322,6 +326,36 @@ namespace pvd
 			SetOriginStreamUUID(json_stream["originStreamUUID"].asString().c_str());
 		}
 
+		// Servers the stream has been relayed through, starting from the origin
+		if (json_stream["relayPath"].isArray())
+		{
+			auto host_uuid = GetApplicationInfo().GetHostInfo().GetUUID();
+			std::vector<ov::String> relay_path;
+
+			for (const auto &json_hop : json_stream["relayPath"])
+			{
+				ov::String hop = json_hop.asString().c_str();
+
+				if (hop == host_uuid)
+				{
+					logte("[%s/%s(%u)] Relay loop detected : the stream has already been relayed through this server (%s)",
+						  GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), host_uuid.CStr());
+					return false;
+				}
+
+				relay_path.push_back(hop);
+			}
+
+			if (relay_path.size() > OVT_MAX_RELAY_DEPTH)
+			{
+				logte("[%s/%s(%u)] The stream has been relayed through too many servers (%zu, max: %d)",
+					  GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), relay_path.size(), OVT_MAX_RELAY_DEPTH);
+				return false;
+			}
+
+			SetRelayPath(relay_path);
+		}
+
 		// Renditions
 
 		for (size_t i = 0; i < json_playlists.size(); i++)
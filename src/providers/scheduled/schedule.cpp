@@ -24,22 +24,24 @@ namespace pvd
 			return nullptr;
 		}
 
-		if (_format_context != nullptr)
+		ov::LockGuard lock(_file_context->mutex);
+
+		if (_file_context->format_context != nullptr)
 		{
 			struct stat current_stat;
 			if (stat(_file_path.CStr(), &current_stat) == 0)
 			{
 				// Check if the file has been modified
-				if (current_stat.st_mtime == _last_loaded_stat.st_mtime &&
-					current_stat.st_size == _last_loaded_stat.st_size)
+				if (current_stat.st_mtime == _file_context->last_loaded_stat.st_mtime &&
+					current_stat.st_size == _file_context->last_loaded_stat.st_size)
 				{
 					// Not modified
-					return _format_context;
+					return _file_context->format_context;
 				}
 				else
 				{
 					// Modified, close previous context
-					_format_context = nullptr;
+					_file_context->format_context = nullptr;
 					logti("LoadContext: File modified, reloading: %s", _file_path.CStr());
 				}
 			}
@@ -52,13 +54,13 @@ namespace pvd
 		{
 			char errbuf[AV_ERROR_MAX_STRING_SIZE] = {0};
 			::av_strerror(err, errbuf, sizeof(errbuf));
-			_format_context = nullptr;
+			_file_context->format_context = nullptr;
 			logte("LoadContext: Failed to open file %s. error (%d, %s)", _file_path.CStr(), err,  errbuf);
 			return nullptr;
 		}
 
 		ov::String file_path_copy = _file_path;
-		_format_context.reset(ctx, [file_path_copy](AVFormatContext *ctx) {
+		_file_context->format_context.reset(ctx, [file_path_copy](AVFormatContext *ctx) {
 			if (ctx)
 			{
 				logti("LoadContext: Closing format context : %s", file_path_copy.CStr());
@@ -66,27 +68,27 @@ namespace pvd
 			}
 		});
 
-		err = ::avformat_find_stream_info(_format_context.get(), nullptr);
+		err = ::avformat_find_stream_info(_file_context->format_context.get(), nullptr);
 		if (err < 0)
 		{
 			char errbuf[AV_ERROR_MAX_STRING_SIZE] = {0};
 			::av_strerror(err, errbuf, sizeof(errbuf));
-			_format_context = nullptr;
+			_file_context->format_context = nullptr;
 			logte("LoadContext: Failed to find stream info for file %s. error (%d, %s)", _file_path.CStr(), err,  errbuf);
 			return nullptr;
 		}
 
 		// Record last modified time
-		if (stat(_file_path.CStr(), &_last_loaded_stat) != 0)
+		if (stat(_file_path.CStr(), &_file_context->last_loaded_stat) != 0)
 		{
-			_format_context = nullptr;
+			_file_context->format_context = nullptr;
 			logte("LoadContext: Failed to get file stat for file %s.", _file_path.CStr());
 			return nullptr;
 		}
 
 		logti("LoadContext: File loaded successfully: %s (%" PRId64 " ms)", _file_path.CStr(), sw.Elapsed());
 
-		return _format_context;
+		return _file_context->format_context;
 	}
 
 	std::shared_ptr<Schedule::Item> Schedule::Program::GetFirstItemWithPosition()
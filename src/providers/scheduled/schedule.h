@@ -92,11 +92,19 @@ namespace pvd
 			int64_t _start_time_ms = 0;
 			int64_t _duration_ms	  = 0;
 
-			// File
+			// File. Opening the file may block, so a scheduled channel calls this from
+			// ScheduledChannelPool::Prepare() rather than from its step.
 			std::shared_ptr<AVFormatContext> LoadContext();
 		private:
-			std::shared_ptr<AVFormatContext> _format_context;
-			struct stat _last_loaded_stat;
+			// Shared by the copies of the item, which play the same file
+			struct FileContext
+			{
+				ov::Mutex mutex;
+				std::shared_ptr<AVFormatContext> format_context OV_GUARDED_BY(mutex);
+				struct stat last_loaded_stat OV_GUARDED_BY(mutex);
+			};
+
+			std::shared_ptr<FileContext> _file_context = std::make_shared<FileContext>();
 		};
 
 		class Stream
@@ -0,0 +1,464 @@
+//==============================================================================
+//
+//  ScheduledChannelPool
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+
+#include "scheduled_channel_pool.h"
+
+#include <algorithm>
+
+namespace pvd
+{
+	ScheduledChannelPool::ScheduledChannelPool()
+	{
+		auto worker_count = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_WORKER_COUNT);
+
+		for (size_t index = 0; index < worker_count; index++)
+		{
+			auto worker = std::make_unique<Worker>();
+			worker->index = index;
+
+			_workers.push_back(std::move(worker));
+		}
+	}
+
+	ScheduledChannelPool::~ScheduledChannelPool()
+	{
+		{
+			ov::LockGuard lock(_preparation_mutex);
+			_preparation_running = false;
+			_preparation_condition.NotifyAll();
+		}
+
+		for (auto &thread : _preparation_threads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+
+		for (auto &worker : _workers)
+		{
+			{
+				ov::LockGuard lock(worker->mutex);
+				worker->running = false;
+				worker->condition.NotifyOne();
+			}
+
+			if (worker->thread.joinable())
+			{
+				worker->thread.join();
+			}
+		}
+	}
+
+	size_t ScheduledChannelPool::GetWorkerCount() const
+	{
+		return _workers.size();
+	}
+
+	bool ScheduledChannelPool::Register(uint32_t channel_id, const ov::String &name, StepFunction step)
+	{
+		auto &worker = GetWorker(channel_id);
+
+		ov::LockGuard lock(worker.mutex);
+
+		if (worker.channel_map.find(channel_id) != worker.channel_map.end())
+		{
+			return false;
+		}
+
+		auto channel = std::make_shared<Channel>();
+		channel->id = channel_id;
+		channel->name = name;
+		channel->step = std::move(step);
+
+		worker.channel_map.emplace(channel_id, channel);
+
+		StartWorkerIfNeeded(worker);
+		MakeReady(worker, channel);
+
+		return true;
+	}
+
+	void ScheduledChannelPool::Unregister(uint32_t channel_id)
+	{
+		auto &worker = GetWorker(channel_id);
+
+		{
+			ov::LockGuard lock(worker.mutex);
+
+			auto it = worker.channel_map.find(channel_id);
+			if (it == worker.channel_map.end())
+			{
+				return;
+			}
+
+			// A pending timer or a ready entry of the channel is skipped by the worker from now on
+			auto channel = it->second;
+			channel->removed = true;
+			worker.channel_map.erase(it);
+
+			// When called from the step of the channel (or of another channel of this worker), the
+			// step cannot be waited for here
+			if (std::this_thread::get_id() != worker.thread.get_id())
+			{
+				worker.step_condition.Wait(lock, [&channel]() {
+					return channel->running == false;
+				});
+			}
+		}
+
+		// Prepare() no longer accepts the channel, since it has been removed from the worker
+		CancelPreparations(channel_id);
+	}
+
+	bool ScheduledChannelPool::Prepare(uint32_t channel_id, PreparationFunction preparation)
+	{
+		auto &worker = GetWorker(channel_id);
+
+		ov::LockGuard lock(worker.mutex);
+
+		if (worker.channel_map.find(channel_id) == worker.channel_map.end())
+		{
+			return false;
+		}
+
+		ov::LockGuard preparation_lock(_preparation_mutex);
+
+		StartPreparationThreadsIfNeeded();
+
+		_preparation_queue.push_back({channel_id, std::move(preparation)});
+		_preparation_condition.NotifyOne();
+
+		return true;
+	}
+
+	void ScheduledChannelPool::Wake(uint32_t channel_id)
+	{
+		auto &worker = GetWorker(channel_id);
+
+		ov::LockGuard lock(worker.mutex);
+
+		auto it = worker.channel_map.find(channel_id);
+		if (it == worker.channel_map.end())
+		{
+			return;
+		}
+
+		auto &channel = it->second;
+		if (channel->running)
+		{
+			channel->wake_pending = true;
+			return;
+		}
+
+		channel->timer_expired = false;
+		MakeReady(worker, channel);
+	}
+
+	bool ScheduledChannelPool::GetDriftStats(uint32_t channel_id, DriftStats &stats) const
+	{
+		auto &worker = GetWorker(channel_id);
+
+		ov::LockGuard lock(worker.mutex);
+
+		auto it = worker.channel_map.find(channel_id);
+		if (it == worker.channel_map.end())
+		{
+			return false;
+		}
+
+		stats = it->second->drift_stats;
+
+		return true;
+	}
+
+	std::vector<ScheduledChannelPool::ChannelStats> ScheduledChannelPool::GetStats() const
+	{
+		std::vector<ChannelStats> stats_list;
+
+		for (const auto &worker : _workers)
+		{
+			ov::LockGuard lock(worker->mutex);
+
+			for (const auto &[channel_id, channel] : worker->channel_map)
+			{
+				ChannelStats stats;
+
+				stats.channel_id = channel_id;
+				stats.name = channel->name;
+				stats.worker_index = worker->index;
+				stats.running = channel->running;
+				stats.idle = (channel->running == false) && (channel->ready == false) && (channel->timer_sequence == 0);
+				stats.drift_stats = channel->drift_stats;
+
+				stats_list.push_back(std::move(stats));
+			}
+		}
+
+		std::sort(stats_list.begin(), stats_list.end(), [](const ChannelStats &a, const ChannelStats &b) {
+			return a.channel_id < b.channel_id;
+		});
+
+		return stats_list;
+	}
+
+	size_t ScheduledChannelPool::GetChannelCount() const
+	{
+		size_t count = 0;
+
+		for (const auto &worker : _workers)
+		{
+			ov::LockGuard lock(worker->mutex);
+			count += worker->channel_map.size();
+		}
+
+		return count;
+	}
+
+	ScheduledChannelPool::Worker &ScheduledChannelPool::GetWorker(uint32_t channel_id) const
+	{
+		return *_workers[channel_id % _workers.size()];
+	}
+
+	void ScheduledChannelPool::StartWorkerIfNeeded(Worker &worker)
+	{
+		if (worker.running)
+		{
+			return;
+		}
+
+		worker.running = true;
+		worker.thread = std::thread(&ScheduledChannelPool::WorkerThread, this, &worker);
+
+		auto thread_name = ov::String::FormatString("SchedWorker%zu", worker.index);
+		pthread_setname_np(worker.thread.native_handle(), thread_name.CStr());
+	}
+
+	void ScheduledChannelPool::StartPreparationThreadsIfNeeded()
+	{
+		if (_preparation_running)
+		{
+			return;
+		}
+
+		_preparation_running = true;
+
+		for (size_t index = 0; index < PREPARATION_THREAD_COUNT; index++)
+		{
+			auto &thread = _preparation_threads.emplace_back(&ScheduledChannelPool::PreparationThread, this);
+
+			auto thread_name = ov::String::FormatString("SchedPrepare%zu", index);
+			pthread_setname_np(thread.native_handle(), thread_name.CStr());
+		}
+	}
+
+	void ScheduledChannelPool::CancelPreparations(uint32_t channel_id)
+	{
+		ov::LockGuard lock(_preparation_mutex);
+
+		_preparation_queue.erase(
+			std::remove_if(_preparation_queue.begin(), _preparation_queue.end(), [channel_id](const Preparation &preparation) {
+				return preparation.channel_id == channel_id;
+			}),
+			_preparation_queue.end());
+
+		while (_running_preparations.find(channel_id) != _running_preparations.end())
+		{
+			_preparation_done_condition.Wait(lock);
+		}
+	}
+
+	void ScheduledChannelPool::PreparationThread()
+	{
+		ov::logger::ThreadHelper thread_helper;
+
+		while (true)
+		{
+			Preparation preparation;
+
+			{
+				ov::LockGuard lock(_preparation_mutex);
+
+				while (_preparation_running && _preparation_queue.empty())
+				{
+					_preparation_condition.Wait(lock);
+				}
+
+				if (_preparation_running == false)
+				{
+					return;
+				}
+
+				preparation = std::move(_preparation_queue.front());
+				_preparation_queue.pop_front();
+
+				_running_preparations.insert(preparation.channel_id);
+			}
+
+			preparation.function();
+
+			// The channel takes the result in its next step
+			Wake(preparation.channel_id);
+
+			ov::LockGuard lock(_preparation_mutex);
+
+			_running_preparations.erase(_running_preparations.find(preparation.channel_id));
+			_preparation_done_condition.NotifyAll();
+		}
+	}
+
+	void ScheduledChannelPool::MakeReady(Worker &worker, const std::shared_ptr<Channel> &channel)
+	{
+		// A timer the channel was waiting for is now stale
+		channel->timer_sequence = 0;
+
+		if (channel->ready || channel->removed)
+		{
+			return;
+		}
+
+		channel->ready = true;
+		worker.ready_queue.push(channel);
+		worker.condition.NotifyOne();
+	}
+
+	void ScheduledChannelPool::WorkerThread(Worker *worker)
+	{
+		ov::logger::ThreadHelper thread_helper;
+
+		while (true)
+		{
+			std::shared_ptr<Channel> channel;
+			Clock::time_point deadline;
+			bool timed = false;
+
+			{
+				ov::LockGuard lock(worker->mutex);
+
+				while (channel == nullptr)
+				{
+					if (worker->running == false)
+					{
+						return;
+					}
+
+					auto now = Clock::now();
+
+					if ((worker->timer_queue.empty() == false) && (worker->timer_queue.top().deadline <= now))
+					{
+						// Run every channel whose deadline is due within the window in this wakeup
+						auto release_until = now + COALESCE_WINDOW;
+
+						while ((worker->timer_queue.empty() == false) && (worker->timer_queue.top().deadline <= release_until))
+						{
+							auto timer = worker->timer_queue.top();
+							worker->timer_queue.pop();
+
+							auto it = worker->channel_map.find(timer.channel_id);
+							if (it == worker->channel_map.end())
+							{
+								continue;
+							}
+
+							auto &timer_channel = it->second;
+							if (timer_channel->timer_sequence != timer.sequence)
+							{
+								// Woken, or the channel has already moved on to another timer
+								continue;
+							}
+
+							timer_channel->timer_expired = true;
+							MakeReady(*worker, timer_channel);
+						}
+					}
+
+					if (worker->ready_queue.empty() == false)
+					{
+						channel = worker->ready_queue.front();
+						worker->ready_queue.pop();
+
+						channel->ready = false;
+
+						if (channel->removed)
+						{
+							channel = nullptr;
+							continue;
+						}
+
+						channel->running = true;
+						deadline = channel->deadline;
+						timed = channel->timer_expired;
+						channel->timer_expired = false;
+
+						break;
+					}
+
+					if (worker->timer_queue.empty())
+					{
+						worker->condition.Wait(lock);
+					}
+					else
+					{
+						worker->condition.WaitUntil(lock, worker->timer_queue.top().deadline);
+					}
+				}
+			}
+
+			// Negative if the step was run early to coalesce wakeups
+			int64_t drift_us = 0;
+			if (timed)
+			{
+				drift_us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - deadline).count();
+			}
+
+			auto next_deadline = channel->step();
+
+			ov::LockGuard lock(worker->mutex);
+
+			auto &stats = channel->drift_stats;
+			stats.step_count++;
+
+			if (timed)
+			{
+				stats.timed_step_count++;
+				stats.last_drift_us = drift_us;
+				stats.max_drift_us = std::max(stats.max_drift_us, drift_us);
+				stats.total_drift_us += drift_us;
+			}
+
+			channel->running = false;
+			worker->step_condition.NotifyAll();
+
+			if (channel->removed)
+			{
+				continue;
+			}
+
+			channel->deadline = next_deadline;
+
+			if (channel->wake_pending)
+			{
+				channel->wake_pending = false;
+				MakeReady(*worker, channel);
+			}
+			else if (next_deadline <= Clock::now())
+			{
+				MakeReady(*worker, channel);
+			}
+			else if (next_deadline != Clock::time_point::max())
+			{
+				auto sequence = ++worker->last_sequence;
+
+				channel->timer_sequence = sequence;
+				worker->timer_queue.push({next_deadline, sequence, channel->id});
+			}
+		}
+	}
+}  // namespace pvd
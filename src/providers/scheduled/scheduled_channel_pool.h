@@ -0,0 +1,193 @@
+//==============================================================================
+//
+//  ScheduledChannelPool
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace pvd
+{
+	// Runs every scheduled channel on a bounded pool of demux workers, instead of a thread per
+	// channel.
+	//
+	// A channel is a step function. A step demuxes and sends what is due, and returns when the
+	// channel wants to run again: a deadline, or Clock::time_point::max() to sleep until Wake().
+	// A deadline that has already passed (e.g. Clock::time_point()) queues the next step behind the
+	// channels that are ready, and is not counted as drift. A step must not block for long, since
+	// the other channels of its worker wait for it. What may block, such as opening a file, is
+	// handed to Prepare() and its result is taken by a later step.
+	//
+	// A channel always runs on the same worker (by its id), so its steps never overlap. Every
+	// worker keeps its own deadline-ordered timer heap and lock, so there is no lock that all the
+	// channels contend on. Deadlines that fall within COALESCE_WINDOW of each other are run by the
+	// same wakeup of the worker.
+	class ScheduledChannelPool : public ov::Singleton<ScheduledChannelPool>
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+		using StepFunction = std::function<Clock::time_point()>;
+		using PreparationFunction = std::function<void()>;
+
+		static constexpr std::chrono::microseconds COALESCE_WINDOW{500};
+		// The pool has as many workers as CPUs, up to this many
+		static constexpr size_t MAX_WORKER_COUNT = 8;
+		// Threads that run the preparations of every channel, apart from the workers
+		static constexpr size_t PREPARATION_THREAD_COUNT = 4;
+
+		struct DriftStats
+		{
+			uint64_t step_count = 0;
+
+			// Steps that ran for a deadline
+			uint64_t timed_step_count = 0;
+			// How late a timed step started compared to its deadline, in microseconds
+			int64_t last_drift_us = 0;
+			int64_t max_drift_us = 0;
+			int64_t total_drift_us = 0;
+
+			int64_t GetAverageDriftUs() const
+			{
+				return (timed_step_count > 0) ? (total_drift_us / static_cast<int64_t>(timed_step_count)) : 0;
+			}
+		};
+
+		struct ChannelStats
+		{
+			uint32_t channel_id = 0;
+			ov::String name;
+			size_t worker_index = 0;
+			// Running a step right now
+			bool running = false;
+			// Sleeping until Wake(), without a deadline
+			bool idle = false;
+			DriftStats drift_stats;
+		};
+
+		ScheduledChannelPool();
+		~ScheduledChannelPool() override;
+
+		size_t GetWorkerCount() const;
+
+		// <name> identifies the channel in the stats (e.g. "#default#app/channel"). The first step
+		// runs as soon as possible. Returns false if the id is already registered.
+		bool Register(uint32_t channel_id, const ov::String &name, StepFunction step);
+
+		// Waits for a running step of the channel to return, so the step function is never called
+		// again once this returns. A step may unregister its own channel, in which case it is
+		// removed as soon as the step returns. Preparations of the channel that have not started
+		// are dropped, and a running one is waited for.
+		void Unregister(uint32_t channel_id);
+
+		// Runs <preparation> on a preparation thread instead of the worker of the channel, and wakes
+		// the channel once it returns. Preparations run in the order they were requested. Returns
+		// false if the channel is not registered.
+		bool Prepare(uint32_t channel_id, PreparationFunction preparation);
+
+		// Runs the next step of the channel as soon as possible, without waiting for its deadline.
+		// If a step is running, another one follows it.
+		void Wake(uint32_t channel_id);
+
+		bool GetDriftStats(uint32_t channel_id, DriftStats &stats) const;
+		// Snapshot of every registered channel, ordered by channel id
+		std::vector<ChannelStats> GetStats() const;
+		size_t GetChannelCount() const;
+
+	private:
+		struct Channel
+		{
+			uint32_t id = 0;
+			ov::String name;
+			StepFunction step;
+
+			// Sequence of the timer the channel is waiting for, 0 if it has none
+			uint64_t timer_sequence = 0;
+			Clock::time_point deadline = Clock::time_point::max();
+			// Made ready by its timer rather than by Wake(), so the drift is measured
+			bool timer_expired = false;
+
+			// In the ready queue of the worker
+			bool ready = false;
+			bool running = false;
+			// Woken while running
+			bool wake_pending = false;
+			bool removed = false;
+
+			DriftStats drift_stats;
+		};
+
+		struct Timer
+		{
+			Clock::time_point deadline;
+			uint64_t sequence;
+			uint32_t channel_id;
+
+			bool operator<(const Timer &timer) const
+			{
+				// Earliest deadline has the highest priority, followed by the sequence
+				return (deadline == timer.deadline) ? (sequence > timer.sequence) : (deadline > timer.deadline);
+			}
+		};
+
+		struct Worker
+		{
+			size_t index = 0;
+			std::thread thread;
+
+			mutable ov::Mutex mutex;
+			ov::ConditionVariable condition;
+			// Signalled when a step returns, for Unregister()
+			ov::ConditionVariable step_condition;
+
+			bool running OV_GUARDED_BY(mutex) = false;
+
+			std::unordered_map<uint32_t, std::shared_ptr<Channel>> channel_map OV_GUARDED_BY(mutex);
+			std::priority_queue<Timer> timer_queue OV_GUARDED_BY(mutex);
+			// Channels to run right away, in the order they became ready
+			std::queue<std::shared_ptr<Channel>> ready_queue OV_GUARDED_BY(mutex);
+			uint64_t last_sequence OV_GUARDED_BY(mutex) = 0;
+		};
+
+		struct Preparation
+		{
+			uint32_t channel_id = 0;
+			PreparationFunction function;
+		};
+
+		Worker &GetWorker(uint32_t channel_id) const;
+
+		void StartWorkerIfNeeded(Worker &worker) OV_REQUIRES(worker.mutex);
+		void MakeReady(Worker &worker, const std::shared_ptr<Channel> &channel) OV_REQUIRES(worker.mutex);
+		void WorkerThread(Worker *worker);
+
+		void StartPreparationThreadsIfNeeded() OV_REQUIRES(_preparation_mutex);
+		void CancelPreparations(uint32_t channel_id);
+		void PreparationThread();
+
+		std::vector<std::unique_ptr<Worker>> _workers;
+
+		// Lock order: the mutex of a worker, then _preparation_mutex
+		ov::Mutex _preparation_mutex;
+		ov::ConditionVariable _preparation_condition;
+		// Signalled when a preparation returns, for Unregister()
+		ov::ConditionVariable _preparation_done_condition;
+		bool _preparation_running OV_GUARDED_BY(_preparation_mutex) = false;
+		std::deque<Preparation> _preparation_queue OV_GUARDED_BY(_preparation_mutex);
+		// Channels of the preparations being run
+		std::multiset<uint32_t> _running_preparations OV_GUARDED_BY(_preparation_mutex);
+		std::vector<std::thread> _preparation_threads;
+	};
+}  // namespace pvd
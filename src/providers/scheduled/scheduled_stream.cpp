@@ -13,6 +13,18 @@
 
 #include <base/provider/application.h>
 
+// A file item is demuxed up to this far ahead of the realtime clock, so a slow read does not
+// delay the packets that are already due
+static constexpr double SCHEDULED_READAHEAD_MS = 500.0;
+static constexpr size_t SCHEDULED_READAHEAD_MAX_PACKETS = 512;
+
+// How long to wait before reading again when the demuxer has nothing yet (EAGAIN)
+static constexpr int SCHEDULED_READ_RETRY_MS = 10;
+
+// Upper bound of packets a step takes from a stream tap, so a busy source cannot monopolize the
+// worker that the channel shares with others
+static constexpr int SCHEDULED_MAX_DRAIN_PER_STEP = 128;
+
 namespace pvd
 {
     // Implementation of ScheduledStream
@@ -34,28 +46,31 @@ namespace pvd
 
     bool ScheduledStream::Start()
     {
-        // Create Worker
-        _worker_thread_running.store(true);
-        _worker_thread = std::thread(&ScheduledStream::WorkerThread, this);
-        pthread_setname_np(_worker_thread.native_handle(), "Scheduled");
+        _channel_running.store(true);
+
+        // The channel runs on the shared demux workers instead of a thread of its own
+        auto name = ov::String::FormatString("%s/%s", GetApplicationName(), GetName().CStr());
+        if (ScheduledChannelPool::GetInstance()->Register(GetId(), name, [this]() { return Run(); }) == false)
+        {
+            logte("Scheduled Channel %s/%s: Channel %u is already running", GetApplicationName(), GetName().CStr(), GetId());
+            _channel_running.store(false);
+            return false;
+        }
 
         return Stream::Start();
     }
 
     bool ScheduledStream::Stop()
     {
-        if (_worker_thread_running.load() == false)
+        if (_channel_running.exchange(false) == false)
         {
             return true;
         }
 
-        _worker_thread_running.store(false);
-        _schedule_updated.SetEvent();
+        // Waits for a running step, so nothing else touches the playback state after this
+        ScheduledChannelPool::GetInstance()->Unregister(GetId());
 
-        if (_worker_thread.joinable())
-        {
-            _worker_thread.join();
-        }
+        StopPlayback();
 
         return Stream::Stop();
     }
@@ -74,7 +89,6 @@ namespace pvd
     std::shared_ptr<Schedule> ScheduledStream::GetSchedule() const
     {
         std::shared_lock<std::shared_mutex> lock(_schedule_mutex);
-        _schedule_updated.Reset();
         return _schedule;
     }
 
@@ -90,10 +104,12 @@ namespace pvd
 
     bool ScheduledStream::UpdateSchedule(const std::shared_ptr<Schedule> &schedule)
     {
-        std::lock_guard<std::shared_mutex> lock(_schedule_mutex);
+        std::unique_lock<std::shared_mutex> lock(_schedule_mutex);
         _schedule = schedule;
+        lock.unlock();
 
-        _schedule_updated.SetEvent();
+        // Check the new schedule right away, instead of at the next deadline of the channel
+        ScheduledChannelPool::GetInstance()->Wake(GetId());
         return true;
     }
 
@@ -169,6 +185,17 @@ namespace pvd
             return false;
         }
 
+        // A file is checked by opening it, so the result of the check is taken by a later step
+        if ((_item_check != nullptr) && _item_check->done.load())
+        {
+            auto item_check = std::move(_item_check);
+
+            if ((item_check->item == _current_item) && item_check->available)
+            {
+                return true;
+            }
+        }
+
 		if (immediate == false)
 		{
 			// check every 1 seconds
@@ -187,14 +214,17 @@ namespace pvd
 
         if (_current_item->_file == true)
         {
-            return CheckFileItemAvailable(_current_item);
-        }
-        else
-        {
-            return CheckStreamItemAvailable(_current_item);
+            if (_item_check == nullptr)
+            {
+                _item_check = Prepare(_current_item, [this](Preparation &preparation) {
+                    preparation.available = CheckFileItemAvailable(preparation.item);
+                });
+            }
+
+            return false;
         }
 
-        return false;
+        return CheckStreamItemAvailable(_current_item);
     }
 
 	bool ScheduledStream::SetDurationToAllItems(const std::shared_ptr<Schedule::Program> &program)
@@ -243,273 +273,499 @@ namespace pvd
 		return true;
 	}
 
-    void ScheduledStream::WorkerThread()
+    ScheduledStream::Clock::time_point ScheduledStream::Run()
     {
-		ov::logger::ThreadHelper thread_helper;
+        if (_channel_running.load() == false)
+        {
+            return Clock::time_point::max();
+        }
 
-        while (_worker_thread_running.load())
+        switch (_phase)
         {
-            // Schedule
-            std::unique_lock<std::shared_mutex> guard(_current_mutex);
-            _current_schedule = GetSchedule();
-            _current_program = nullptr;
-            _current_item = nullptr;
-            _current_item_position_ms = 0;
-            guard.unlock();
+            case Phase::LoadSchedule:
+                return LoadSchedule();
 
-            if (_current_schedule == nullptr)
-            {
-                _realtime_clock.Pause();
-                // Wait for schedule update
-                _schedule_updated.Wait();
-                continue;
-            }
+            case Phase::PrepareProgram:
+                return ContinueProgramPreparation();
 
-            // Programs
-            guard.lock();
-            _current_program = _current_schedule->GetCurrentProgram();
-            _fallback_program = _current_schedule->GetFallbackProgram();
-            guard.unlock();
-            if (_current_program == nullptr)
-            {
-                PlayFallbackOrWait();
-                continue;
-            }
-			else
-			{
-				SetDurationToAllItems(_current_program);
-			}
+            case Phase::NextItem:
+                return PlayNextItem();
 
-            logti("Scheduled Channel %s/%s: Start %s program", GetApplicationName(), GetName().CStr(), _current_program->_name.CStr());
+            case Phase::NextFallbackItem:
+                return PlayNextFallbackItem();
 
-            // Items
-			bool first_item = true;
-            while (_worker_thread_running.load())
-            {
-                guard.lock();
-                _current_item = nullptr;
-                guard.unlock();
-                
-                if (CheckCurrentProgramChanged() == true)
-                {
-                    logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
-                    break;
-                }
+            case Phase::OpenFile:
+                return ContinueFileOpening();
 
-                guard.lock();
-				if (first_item == true)
-				{
-					_current_item = _current_program->GetFirstItemWithPosition();
-				}
-                else
-				{
-					_current_item = _current_program->GetNextItem();
-				}
-                guard.unlock();
+            case Phase::Playing:
+                return ContinuePlayback();
+        }
 
-                if (_current_item == nullptr)
-                {
-                    logti("Scheduled Channel %s/%s: Program ended", GetApplicationName(), GetName().CStr());
-                    break;
-                }
+        return Clock::time_point::max();
+    }
 
-				first_item = false;
-				bool exit_loop = false;
-                while (_worker_thread_running.load())
-                {
-                    auto result = PlayItem(_current_item);
-                    if (result == PlaybackResult::ERROR)
-                    {
-                        if (_current_item->_fallback_on_err == true)
-                        {
-							auto fallback_result = PlayFallbackOrWait();
-                            if (fallback_result == PlaybackResult::FAILBACK)
-                            {
-                                continue;
-                            }
-							else if (CheckCurrentFallbackProgramChanged() == true)
-							{
-								// Fallback program changed, should reset to _fallback_program
-								exit_loop = true;
-							}
-                        }
-                    }
+    ScheduledStream::Clock::time_point ScheduledStream::LoadSchedule()
+    {
+        // Schedule
+        std::unique_lock<std::shared_mutex> guard(_current_mutex);
+        _current_schedule = GetSchedule();
+        _current_program = nullptr;
+        _current_item = nullptr;
+        _current_item_position_ms = 0;
+        guard.unlock();
 
-					break;
-                }
+        if (_current_schedule == nullptr)
+        {
+            _realtime_clock.Pause();
+            // Sleep until UpdateSchedule() wakes the channel up
+            return Clock::time_point::max();
+        }
 
-				if (exit_loop == true)
-				{
-					break;
-				}
-            }
+        // Programs
+        guard.lock();
+        _current_program = _current_schedule->GetCurrentProgram();
+        _fallback_program = _current_schedule->GetFallbackProgram();
+        guard.unlock();
+        if (_current_program == nullptr)
+        {
+            EnterFallback(FallbackCaller::Schedule);
+            return Clock::time_point();
+        }
+
+        // Reading the durations of the file items may open them
+        auto program = _current_program;
+        _program_preparation = Prepare(nullptr, [this, program](Preparation &) {
+            SetDurationToAllItems(program);
+        });
+
+        _phase = Phase::PrepareProgram;
+
+        // Woken once the durations have been read
+        return Clock::time_point::max();
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::ContinueProgramPreparation()
+    {
+        if ((_program_preparation != nullptr) && (_program_preparation->done.load() == false))
+        {
+            // Woken by UpdateSchedule(), which is checked once the program is ready
+            return Clock::time_point::max();
+        }
+
+        _program_preparation.reset();
+
+        logti("Scheduled Channel %s/%s: Start %s program", GetApplicationName(), GetName().CStr(), _current_program->_name.CStr());
+
+        _first_item = true;
+        _phase = Phase::NextItem;
+
+        return Clock::time_point();
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::PlayNextItem()
+    {
+        std::unique_lock<std::shared_mutex> guard(_current_mutex);
+        _current_item = nullptr;
+        guard.unlock();
+
+        if (CheckCurrentProgramChanged() == true)
+        {
+            logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
+            _phase = Phase::LoadSchedule;
+            return Clock::time_point();
+        }
+
+        guard.lock();
+        if (_first_item == true)
+        {
+            _current_item = _current_program->GetFirstItemWithPosition();
+        }
+        else
+        {
+            _current_item = _current_program->GetNextItem();
+        }
+        guard.unlock();
+
+        if (_current_item == nullptr)
+        {
+            logti("Scheduled Channel %s/%s: Program ended", GetApplicationName(), GetName().CStr());
+            _phase = Phase::LoadSchedule;
+            return Clock::time_point();
         }
+
+        _first_item = false;
+
+        return StartPlayback(_current_item, false);
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayFallbackOrWait()
+    void ScheduledStream::EnterFallback(FallbackCaller caller)
     {
         logti("Scheduled Channel %s/%s: Start fallback program", GetApplicationName(), GetName().CStr());
 
-        PlaybackResult result = PlaybackResult::PLAY_NEXT_ITEM;
+        _fallback_caller = caller;
+        _first_fallback_item = true;
+        _fallback_result = PlaybackResult::PLAY_NEXT_ITEM;
+        _phase = Phase::NextFallbackItem;
+    }
 
-        // Fallback
-		bool fisrt = true;
-        while (_worker_thread_running.load())
+    ScheduledStream::Clock::time_point ScheduledStream::PlayNextFallbackItem()
+    {
+        if (CheckCurrentProgramChanged() == true)
         {
-            if (CheckCurrentProgramChanged() == true)
-            {
-                logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
-                break;
-            }
+            logti("Scheduled Channel %s/%s: Program changed", GetApplicationName(), GetName().CStr());
+            return FinishFallback(_fallback_result);
+        }
 
-            if (CheckCurrentFallbackProgramChanged() == true)
+        if (CheckCurrentFallbackProgramChanged() == true)
+        {
+            logti("Scheduled Channel %s/%s: Fallback program changed", GetApplicationName(), GetName().CStr());
+            return FinishFallback(_fallback_result);
+        }
+
+        if (_fallback_program == nullptr || _fallback_program->_items.empty() == true)
+        {
+            if (CheckCurrentItemAvailable(true) == true)
             {
-                logti("Scheduled Channel %s/%s: Fallback program changed", GetApplicationName(), GetName().CStr());
-                break;
+                return FinishFallback(PlaybackResult::FAILBACK);
             }
 
-            if (_fallback_program == nullptr || _fallback_program->_items.empty() == true)
-            {
-                if (CheckCurrentItemAvailable(true) == true)
-                {
-                    return PlaybackResult::FAILBACK;
-                }
+            _realtime_clock.Pause();
+            return Clock::now() + std::chrono::milliseconds(1000);
+        }
 
-                _realtime_clock.Pause();
-                _schedule_updated.Wait(1000);
+        std::shared_ptr<Schedule::Item> item = nullptr;
+        if (_first_fallback_item == true)
+        {
+            item = _fallback_program->GetItem(0);
+            _first_fallback_item = false;
+        }
+        else
+        {
+            item = _fallback_program->GetNextItem();
+        }
 
-                continue;
-            }
+        return StartPlayback(item, true);
+    }
 
-			std::shared_ptr<Schedule::Item> item = nullptr;
-			if (fisrt == true)
-			{
-				item = _fallback_program->GetItem(0);
-				fisrt = false;
-			}
-			else
-			{
-				item = _fallback_program->GetNextItem();
-			}
+    ScheduledStream::Clock::time_point ScheduledStream::FinishFallback(PlaybackResult result)
+    {
+        if (_fallback_caller == FallbackCaller::Schedule)
+        {
+            _phase = Phase::LoadSchedule;
+            return Clock::time_point();
+        }
+
+        if (result == PlaybackResult::FAILBACK)
+        {
+            // The item that failed is available again
+            return StartPlayback(_current_item, false);
+        }
+
+        if (CheckCurrentFallbackProgramChanged() == true)
+        {
+            // Fallback program changed, should reset to _fallback_program
+            _phase = Phase::LoadSchedule;
+            return Clock::time_point();
+        }
+
+        _phase = Phase::NextItem;
+        return Clock::time_point();
+    }
+
+    std::shared_ptr<ScheduledStream::Preparation> ScheduledStream::Prepare(const std::shared_ptr<Schedule::Item> &item, std::function<void(Preparation &preparation)> function)
+    {
+        auto preparation = std::make_shared<Preparation>();
+        preparation->item = item;
+
+        // The pool wakes the channel once the preparation is done
+        auto prepared = ScheduledChannelPool::GetInstance()->Prepare(GetId(), [preparation, function = std::move(function)]() {
+            function(*preparation);
+            preparation->done.store(true);
+        });
 
-            result = PlayItem(item, true);
-            if (result == PlaybackResult::FAILBACK)
+        return prepared ? preparation : nullptr;
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::StartPlayback(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    {
+        StopPlayback();
+
+        _playback = std::make_unique<Playback>();
+        _playback->item = item;
+        _playback->fallback_item = fallback_item;
+
+        if (item == nullptr)
+        {
+            return FinishPlayback(PlaybackResult::ERROR);
+        }
+
+        if (item->_file == true)
+        {
+            if (StartFilePlayback(item) == false)
             {
-                break;
+                return FinishPlayback(PlaybackResult::ERROR);
             }
-            else if (result == PlaybackResult::PLAY_NEXT_ITEM)
+
+            _phase = Phase::OpenFile;
+
+            // Woken once the file is opened
+            return Clock::time_point::max();
+        }
+
+        if (StartStreamPlayback(item) == false)
+        {
+            return FinishPlayback(PlaybackResult::ERROR);
+        }
+
+        return BeginPlaying();
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::BeginPlaying()
+    {
+        if (_realtime_clock.IsStart() == false)
+        {
+            _realtime_clock.Start();
+        }
+
+        if (_realtime_clock.IsPaused() == true)
+        {
+            _realtime_clock.Resume();
+        }
+
+        _phase = Phase::Playing;
+
+        return Clock::time_point();
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::ContinuePlayback()
+    {
+        if (CheckCurrentProgramChanged() == true)
+        {
+            return FinishPlayback(PlaybackResult::PLAY_NEXT_PROGRAM);
+        }
+
+        if (_playback->fallback_item)
+        {
+            if (CheckCurrentItemAvailable() == true)
             {
-                // Next fallback item
+                return FinishPlayback(PlaybackResult::FAILBACK);
             }
-            else if (result == PlaybackResult::PLAY_NEXT_PROGRAM)
+        }
+
+        if (_playback->item->_file == true)
+        {
+            return ContinueFilePlayback();
+        }
+
+        return ContinueStreamPlayback();
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::FinishPlayback(PlaybackResult result)
+    {
+        auto fallback_item = _playback->fallback_item;
+
+        StopPlayback();
+
+        if (fallback_item == false)
+        {
+            if (result == PlaybackResult::ERROR && _current_item->_fallback_on_err == true)
             {
-                break;
+                EnterFallback(FallbackCaller::Item);
+                return Clock::time_point();
             }
-            else if (result == PlaybackResult::ERROR)
-            {
-				logte("Scheduled Channel %s/%s: Playback error in fallback program. Try to play next item", GetApplicationName(), GetName().CStr());
 
-				if (CheckCurrentItemAvailable(true) == true)
+            _phase = Phase::NextItem;
+            return Clock::time_point();
+        }
+
+        _fallback_result = result;
+
+        switch (result)
+        {
+            case PlaybackResult::PLAY_NEXT_ITEM:
+                // Next fallback item
+                _phase = Phase::NextFallbackItem;
+                return Clock::time_point();
+
+            case PlaybackResult::FAILBACK:
+            case PlaybackResult::PLAY_NEXT_PROGRAM:
+                return FinishFallback(result);
+
+            case PlaybackResult::ERROR:
+                logte("Scheduled Channel %s/%s: Playback error in fallback program. Try to play next item", GetApplicationName(), GetName().CStr());
+
+                if (CheckCurrentItemAvailable(true) == true)
                 {
-                    return PlaybackResult::FAILBACK;
+                    return FinishFallback(PlaybackResult::FAILBACK);
                 }
 
                 _realtime_clock.Pause();
-                _schedule_updated.Wait(250);
-
-                continue;
-			}
-			else
-			{
-				logtc("Scheduled Channel %s/%s: Unknown playback result %d", GetApplicationName(), GetName().CStr(), static_cast<int>(result));
-				break;
-            }
+                _phase = Phase::NextFallbackItem;
+                return Clock::now() + std::chrono::milliseconds(250);
         }
 
-        return result;
+        logtc("Scheduled Channel %s/%s: Unknown playback result %d", GetApplicationName(), GetName().CStr(), static_cast<int>(result));
+        return FinishFallback(result);
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayItem(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    void ScheduledStream::StopPlayback()
     {
-        if (item == nullptr)
+        if (_playback == nullptr)
         {
-            return PlaybackResult::ERROR;
+            return;
         }
 
-        if (item->_file == true)
+        if (_playback->stream_tap != nullptr)
         {
-            return PlayFile(item, fallback_item);
+            _playback->stream_tap->SetPacketNotifier(nullptr);
+            ocst::Orchestrator::GetInstance()->UnmirrorStream(_playback->stream_tap);
         }
-        
-        return PlayStream(item, fallback_item);
+
+        if (_playback->context != nullptr)
+        {
+            ScheduledChannelPool::DriftStats drift_stats;
+            if (ScheduledChannelPool::GetInstance()->GetDriftStats(GetId(), drift_stats))
+            {
+                logtd("Scheduled Channel : %s/%s: Pacing drift (avg : %" PRId64 " us, max : %" PRId64 " us, timed steps : %" PRIu64 ")", GetApplicationName(), GetName().CStr(), drift_stats.GetAverageDriftUs(), drift_stats.max_drift_us, drift_stats.timed_step_count);
+            }
+        }
+
+        _playback.reset();
+
+        std::unique_lock<std::shared_mutex> lock(_current_mutex);
+        _current_item_position_ms = 0;
+        lock.unlock();
+
+        logti("Scheduled Channel : %s/%s: Playback stopped", GetApplicationName(), GetName().CStr());
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayFile(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    bool ScheduledStream::StartFilePlayback(const std::shared_ptr<Schedule::Item> &item)
     {
         logti("Scheduled Channel : %s/%s: Play file %s", GetApplicationName(), GetName().CStr(), item->_file_path.CStr());
 
-        ScheduledStream::PlaybackResult result = PlaybackResult::PLAY_NEXT_ITEM;
+        // Opening the file may block, so the channel takes the context in a later step
+        _playback->opening = Prepare(item, [](Preparation &preparation) {
+            preparation.context = preparation.item->LoadContext();
+        });
 
-		auto context = item->LoadContext();
-		if (context == nullptr)
-		{
-			logte("Scheduled Channel : %s/%s: Format context is null. Try to play next item", GetApplicationName(), GetName().CStr());
-			return PlaybackResult::ERROR;
-		}
+        return (_playback->opening != nullptr);
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::ContinueFileOpening()
+    {
+        if (CheckCurrentProgramChanged() == true)
+        {
+            // The file is closed once it has been opened, unless the item holds it
+            return FinishPlayback(PlaybackResult::PLAY_NEXT_PROGRAM);
+        }
+
+        auto opening = _playback->opening;
+        if (opening->done.load() == false)
+        {
+            return Clock::time_point::max();
+        }
+
+        _playback->opening.reset();
+
+        auto &context = opening->context;
+        if (context == nullptr)
+        {
+            logte("Scheduled Channel : %s/%s: Format context is null. Try to play next item", GetApplicationName(), GetName().CStr());
+            return FinishPlayback(PlaybackResult::ERROR);
+        }
 
-		if (PrepareFilePlayback(item) == false)
+        if (PrepareFilePlayback(_playback->item, context) == false)
         {
             logte("Scheduled Channel : %s/%s: Failed to prepare file playback. Try to play next item", GetApplicationName(), GetName().CStr());
-            return PlaybackResult::ERROR;
+            return FinishPlayback(PlaybackResult::ERROR);
         }
 
+        _playback->context = context;
+        _playback->is_mpegts = (std::strncmp(context->iformat->name, "mpegts", 6) == 0);
 
-        if (_realtime_clock.IsStart() == false)
+        return BeginPlaying();
+    }
+
+    ScheduledStream::Clock::time_point ScheduledStream::ContinueFilePlayback()
+    {
+        auto &playback = *_playback;
+
+        // Send what is due before reading more, so a slow read does not delay it. If the
+        // readahead was empty, what was just read may be due as well.
+        for (int pass = 0; pass < 2; pass++)
         {
-            _realtime_clock.Start();
+            while (playback.readahead.empty() == false && _realtime_clock.ElapsedUs() >= playback.send_at_us)
+            {
+                auto readahead_packet = std::move(playback.readahead.front());
+                playback.readahead.pop_front();
+
+                SendFilePacket(readahead_packet);
+
+                if (readahead_packet.ends_item == true)
+                {
+                    // End of item
+                    logti("Scheduled Channel : %s/%s: End of item (Current Pos : %.0f ms Duration : %" PRId64 " ms). Try to play next item", GetApplicationName(), GetName().CStr(), readahead_packet.position_ms, playback.item->_duration_ms);
+                    return FinishPlayback(PlaybackResult::PLAY_NEXT_ITEM);
+                }
+            }
+
+            if (pass == 0)
+            {
+                FillReadahead();
+            }
         }
 
-        if (_realtime_clock.IsPaused() == true)
+        int64_t elapsed = _realtime_clock.ElapsedUs();
+
+        if (playback.readahead.empty() == true)
         {
-            _realtime_clock.Resume();
+            if (playback.end_of_input == false)
+            {
+                // The demuxer had nothing to read yet
+                return Clock::now() + std::chrono::milliseconds(SCHEDULED_READ_RETRY_MS);
+            }
+
+            if (elapsed >= playback.send_at_us)
+            {
+                // The last packet has been played out
+                return FinishPlayback(PlaybackResult::PLAY_NEXT_ITEM);
+            }
         }
 
-        // Play
-        AVPacket packet = { 0 };
-        std::map<int, bool> track_first_packet_map;
-        std::map<int, int64_t> track_single_file_dts_offset_map;
-        std::map<int, bool> end_of_track_map;
+        // logti("Scheduled Channel : %s/%s: Current(%" PRId64 ") DTS(%" PRId64 ") Wait(%" PRId64 ")", GetApplicationName(), GetName().CStr(), elapsed, playback.send_at_us, playback.send_at_us - elapsed);
+        return Clock::now() + std::chrono::microseconds(playback.send_at_us - elapsed);
+    }
 
-        bool is_mpegts { std::strncmp(context->iformat->name, "mpegts", 6) == 0 };
+    void ScheduledStream::FillReadahead()
+    {
+        auto &playback = *_playback;
+        auto &context = playback.context;
+        AVPacket packet = { 0 };
 
-        while (_worker_thread_running.load())
+        while (playback.end_of_input == false)
         {
-            if (CheckCurrentProgramChanged() == true)
+            if (playback.readahead.size() >= SCHEDULED_READAHEAD_MAX_PACKETS)
             {
-                result = PlaybackResult::PLAY_NEXT_PROGRAM;
                 break;
             }
 
-            if (fallback_item)
+            if (playback.readahead.empty() == false &&
+                playback.readahead.back().position_ms - playback.readahead.front().position_ms >= SCHEDULED_READAHEAD_MS)
             {
-                if (CheckCurrentItemAvailable() == true)
-                {
-                    result = PlaybackResult::FAILBACK;
-                    break;
-                }
+                break;
             }
 
             int32_t ret = ::av_read_frame(context.get(), &packet);
             if (ret == AVERROR(EAGAIN))
             {
                 logtw("Scheduled Channel : %s/%s: Failed to read frame. Error (%d, %s)", GetApplicationName(), GetName().CStr(), ret, "EAGAIN");
-                continue;
+                break;
             }
             else if (ret == AVERROR_EOF || ::avio_feof(context->pb))
             {
                 // End of file
                 logti("Scheduled Channel : %s/%s: End of file. Try to play next item", GetApplicationName(), GetName().CStr());
-                result = PlaybackResult::PLAY_NEXT_ITEM;
+                playback.end_of_input = true;
                 break;
             }
             else if (ret < 0)
@@ -520,7 +776,7 @@ namespace pvd
 
                 logte("%s/%s: Failed to read frame. Error (%d, %s). Try to play next item", GetApplicationName(), GetName().CStr(), ret, errbuf);
 
-                result = PlaybackResult::PLAY_NEXT_ITEM;
+                playback.end_of_input = true;
                 break;
             }
 
@@ -532,6 +788,7 @@ namespace pvd
                 continue;
             }
 
+            auto &end_of_track_map = playback.end_of_track_map;
             if (end_of_track_map.find(track_id) != end_of_track_map.end())
             {
                 // End of track
@@ -555,36 +812,36 @@ namespace pvd
             }
 
             cmn::BitstreamFormat bitstream_format = cmn::BitstreamFormat::Unknown;
-			cmn::PacketType packet_type = cmn::PacketType::Unknown;
-			switch (track->GetCodecId())
-			{
-				case cmn::MediaCodecId::H264:
-					bitstream_format = (is_mpegts) ? cmn::BitstreamFormat::H264_ANNEXB : cmn::BitstreamFormat::H264_AVCC;
-					packet_type = cmn::PacketType::NALU;
-					break;
-				case cmn::MediaCodecId::H265:
-					bitstream_format = (is_mpegts) ? cmn::BitstreamFormat::H265_ANNEXB : cmn::BitstreamFormat::HVCC;
-					packet_type = cmn::PacketType::NALU;
-					break;
-				case cmn::MediaCodecId::Aac:
-					bitstream_format = (is_mpegts) ? cmn::BitstreamFormat::AAC_ADTS : cmn::BitstreamFormat::AAC_RAW;
-					packet_type = cmn::PacketType::RAW;
-					break;
-				case cmn::MediaCodecId::Opus:
-					bitstream_format = cmn::BitstreamFormat::OPUS;
-					packet_type = cmn::PacketType::RAW;
-					break;
+            cmn::PacketType packet_type = cmn::PacketType::Unknown;
+            switch (track->GetCodecId())
+            {
+                case cmn::MediaCodecId::H264:
+                    bitstream_format = (playback.is_mpegts) ? cmn::BitstreamFormat::H264_ANNEXB : cmn::BitstreamFormat::H264_AVCC;
+                    packet_type = cmn::PacketType::NALU;
+                    break;
+                case cmn::MediaCodecId::H265:
+                    bitstream_format = (playback.is_mpegts) ? cmn::BitstreamFormat::H265_ANNEXB : cmn::BitstreamFormat::HVCC;
+                    packet_type = cmn::PacketType::NALU;
+                    break;
+                case cmn::MediaCodecId::Aac:
+                    bitstream_format = (playback.is_mpegts) ? cmn::BitstreamFormat::AAC_ADTS : cmn::BitstreamFormat::AAC_RAW;
+                    packet_type = cmn::PacketType::RAW;
+                    break;
+                case cmn::MediaCodecId::Opus:
+                    bitstream_format = cmn::BitstreamFormat::OPUS;
+                    packet_type = cmn::PacketType::RAW;
+                    break;
                 case cmn::MediaCodecId::Mp3:
                     bitstream_format = cmn::BitstreamFormat::MP3;
                     packet_type = cmn::PacketType::RAW;
                     break;
-				default:
+                default:
                     logtw("Scheduled Channel : %s/%s: Unsupported codec %s", GetApplicationName(), GetName().CStr(), cmn::GetCodecIdString(track->GetCodecId()));
-					::av_packet_unref(&packet);
-					continue;
-			}
+                    ::av_packet_unref(&packet);
+                    continue;
+            }
 
-			auto media_packet = ffmpeg::compat::ToMediaPacket(track->GetId(), &packet, track->GetMediaType(), bitstream_format, packet_type);
+            auto media_packet = ffmpeg::compat::ToMediaPacket(track->GetId(), &packet, track->GetMediaType(), bitstream_format, packet_type);
 
             // Convert to fixed time base
             auto origin_tb = context->streams[packet.stream_index]->time_base;
@@ -594,65 +851,33 @@ namespace pvd
             auto pts = media_packet->GetPts();
             auto dts = media_packet->GetDts();
             auto duration = media_packet->GetDuration();
-			
-            // origin timebase to track timebase
-            // pts = static_cast<double>(pts) * (static_cast<double>(origin_tb.num) / static_cast<double>(origin_tb.den) * track->GetTimeBase().GetTimescale());
-            // dts = static_cast<double>(dts) * (static_cast<double>(origin_tb.num) / static_cast<double>(origin_tb.den) * track->GetTimeBase().GetTimescale());
-            // duration = static_cast<double>(duration) * (static_cast<double>(origin_tb.num) / static_cast<double>(origin_tb.den) * track->GetTimeBase().GetTimescale());
-
-			pts = Rescale(pts, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
-			dts = Rescale(dts, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
-			duration = Rescale(duration, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
 
-            if (track_first_packet_map.find(track_id) == track_first_packet_map.end())
-            {
-                track_first_packet_map[track_id] = true;
-                track_single_file_dts_offset_map[track_id] = dts;
-            }
-            auto single_file_dts = dts - track_single_file_dts_offset_map[track_id];
-           
-            AdjustTimestampByBase(track_id, pts, dts, std::numeric_limits<int64_t>::max(), duration);
-			logtt("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", duration %" PRId64 ", tb %f", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, duration, track->GetTimeBase().GetExpr());
-
-			int64_t dts_us = Rescale(dts, 1000000 * track->GetTimeBase().GetNum(), track->GetTimeBase().GetDen());
-			if (_global_track_offset_us_map.find(track_id) == _global_track_offset_us_map.end())
-			{
-				_global_track_offset_us_map[track_id] = dts_us;
-			}
-
-			int64_t global_zero_based_dts = dts_us - _global_track_offset_us_map[track_id];
+            // origin timebase to track timebase
+            pts = Rescale(pts, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
+            dts = Rescale(dts, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
+            duration = Rescale(duration, track->GetTimeBase().GetDen() * origin_tb.num, origin_tb.den * track->GetTimeBase().GetNum());
 
             media_packet->SetPts(pts);
             media_packet->SetDts(dts);
-            media_packet->SetDuration(-1); // Duration will be calculated in MediaRouter
+            media_packet->SetDuration(duration);
 
-			double time_ms = static_cast<double>(dts) * track->GetTimeBase().GetExpr() * 1000.0;
-
-            int64_t dts_gap = 0;
-            if (_last_packet_map.find(track_id) != _last_packet_map.end())
+            if (playback.track_single_file_dts_offset_map.find(track_id) == playback.track_single_file_dts_offset_map.end())
             {
-                auto last_packet = _last_packet_map.at(track_id);
-                dts_gap = media_packet->GetDts() - last_packet->GetDts();
+                playback.track_single_file_dts_offset_map[track_id] = dts;
             }
 
-            logtt("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", duration %" PRId64 ", tb %f, dts_ms %f, dts_gap %" PRId64 "", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, duration, track->GetTimeBase().GetExpr(), time_ms, dts_gap);
-
-            SendFrame(media_packet);
-
-            _last_packet_map[track_id] = media_packet;
+            ReadaheadPacket readahead_packet;
+            readahead_packet.packet = media_packet;
+            readahead_packet.single_file_dts = dts - playback.track_single_file_dts_offset_map[track_id];
 
             // dts to real time (ms)
-            auto single_file_dts_ms = static_cast<double>(single_file_dts) * track->GetTimeBase().GetExpr() * 1000.0;
-			auto single_file_duration_ms = single_file_dts_ms + static_cast<double>(duration) * track->GetTimeBase().GetExpr() * 1000.0;
-
-            std::unique_lock<std::shared_mutex> lock(_current_mutex);
-            _current_item_position_ms = single_file_duration_ms;
-            lock.unlock();
+            auto single_file_dts_ms = static_cast<double>(readahead_packet.single_file_dts) * track->GetTimeBase().GetExpr() * 1000.0;
+            readahead_packet.position_ms = single_file_dts_ms + static_cast<double>(duration) * track->GetTimeBase().GetExpr() * 1000.0;
 
-             // Get current play time
-            if (item->_duration_ms >= 0)
+            // Get current play time
+            if (playback.item->_duration_ms >= 0)
             {
-                if (single_file_duration_ms >= item->_duration_ms)
+                if (readahead_packet.position_ms >= playback.item->_duration_ms)
                 {
                     end_of_track_map[track_id] = true;
                 }
@@ -670,29 +895,71 @@ namespace pvd
 
                 if (all_tracks_ended == true)
                 {
-                    // End of item
-                    logti("Scheduled Channel : %s/%s: End of item (Current Pos : %.0f ms Duration : %" PRId64 " ms). Try to play next item", GetApplicationName(), GetName().CStr(), single_file_duration_ms, item->_duration_ms);
-                    result = PlaybackResult::PLAY_NEXT_ITEM;
-                    break;
+                    readahead_packet.ends_item = true;
+                    playback.end_of_input = true;
                 }
             }
-            
-            int64_t elapsed = _realtime_clock.ElapsedUs();
-            if (elapsed < global_zero_based_dts)
-            {
-                int64_t wait_time = global_zero_based_dts - elapsed;
-                // logti("Scheduled Channel : %s/%s: Track(%d) Current(%" PRId64 ") DTS(%" PRId64 ") Wait(%" PRId64 ")", GetApplicationName(), GetName().CStr(), track_id, elapsed, global_zero_based_dts, wait_time);
-                std::this_thread::sleep_for(std::chrono::microseconds(wait_time));
-            }
+
+            playback.readahead.push_back(std::move(readahead_packet));
         }
+    }
 
-        _current_item_position_ms = 0;
+    void ScheduledStream::SendFilePacket(const ReadaheadPacket &readahead_packet)
+    {
+        auto &media_packet = readahead_packet.packet;
+        auto track_id = media_packet->GetTrackId();
 
-        logti("Scheduled Channel : %s/%s: Playback stopped", GetApplicationName(), GetName().CStr());
+        auto track = GetTrack(track_id);
+        if (track == nullptr)
+        {
+            logtw("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), track_id);
+            return;
+        }
+
+        auto pts = media_packet->GetPts();
+        auto dts = media_packet->GetDts();
+        auto duration = media_packet->GetDuration();
+        auto single_file_dts = readahead_packet.single_file_dts;
+
+        AdjustTimestampByBase(track_id, pts, dts, std::numeric_limits<int64_t>::max(), duration);
+        logtt("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", duration %" PRId64 ", tb %f", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, duration, track->GetTimeBase().GetExpr());
+
+        int64_t dts_us = Rescale(dts, 1000000 * track->GetTimeBase().GetNum(), track->GetTimeBase().GetDen());
+        if (_global_track_offset_us_map.find(track_id) == _global_track_offset_us_map.end())
+        {
+            _global_track_offset_us_map[track_id] = dts_us;
+        }
+
+        int64_t global_zero_based_dts = dts_us - _global_track_offset_us_map[track_id];
+
+        media_packet->SetPts(pts);
+        media_packet->SetDts(dts);
+        media_packet->SetDuration(-1); // Duration will be calculated in MediaRouter
+
+        double time_ms = static_cast<double>(dts) * track->GetTimeBase().GetExpr() * 1000.0;
 
-        return result;
+        int64_t dts_gap = 0;
+        if (_last_packet_map.find(track_id) != _last_packet_map.end())
+        {
+            auto last_packet = _last_packet_map.at(track_id);
+            dts_gap = media_packet->GetDts() - last_packet->GetDts();
+        }
+
+        logtt("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", duration %" PRId64 ", tb %f, dts_ms %f, dts_gap %" PRId64 "", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, duration, track->GetTimeBase().GetExpr(), time_ms, dts_gap);
+
+        SendFrame(media_packet);
+
+        _last_packet_map[track_id] = media_packet;
+
+        std::unique_lock<std::shared_mutex> lock(_current_mutex);
+        _current_item_position_ms = readahead_packet.position_ms;
+        lock.unlock();
+
+        // The next packet is sent once the realtime clock reaches the dts of this one
+        _playback->send_at_us = global_zero_based_dts;
     }
 
+    // Runs on a preparation thread, since it opens the file
     bool ScheduledStream::CheckFileItemAvailable(const std::shared_ptr<Schedule::Item> &item)
     {
         if (item == nullptr || item->_file == false || item->_file_path.IsEmpty())
@@ -767,9 +1034,9 @@ namespace pvd
 		return duration_ms;
 	}
 
-    bool ScheduledStream::PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item)
+    bool ScheduledStream::PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item, const std::shared_ptr<AVFormatContext> &context)
     {
-		if (item == nullptr || item->LoadContext() == nullptr)
+		if (item == nullptr || context == nullptr)
 		{
 			logte("%s/%s: Format context is null for file %s", GetApplicationName(), GetName().CStr(), item->_file_path.CStr());
 			return false;
@@ -781,14 +1048,14 @@ namespace pvd
 		uint32_t audio_index = 0;
         int64_t total_duration_ms = 0;
         _origin_id_track_id_map.clear();
-        for (uint32_t track_id = 0; track_id < item->LoadContext()->nb_streams; track_id++)
+        for (uint32_t track_id = 0; track_id < context->nb_streams; track_id++)
         {
             if (video_track_needed == false && audio_track_needed == false)
             {
                 break;
             }
 
-            auto stream = item->LoadContext()->streams[track_id];
+            auto stream = context->streams[track_id];
             if (stream == nullptr)
             {
                 continue;
@@ -911,7 +1178,7 @@ namespace pvd
             int64_t seek_min = 0;
             int64_t seek_max = total_duration_ms * 1000;
 
-            int seek_ret = ::avformat_seek_file(item->LoadContext().get(), -1, seek_min, seek_target, seek_max, 0);
+            int seek_ret = ::avformat_seek_file(context.get(), -1, seek_min, seek_target, seek_max, 0);
             if (seek_ret < 0)
             {
 				logte("%s/%s: Failed to seek to start position %" PRId64 ", err:%d", GetApplicationName(), GetName().CStr(), item->_start_time_ms, seek_ret);
@@ -926,211 +1193,193 @@ namespace pvd
         return true;
     }
 
-    ScheduledStream::PlaybackResult ScheduledStream::PlayStream(const std::shared_ptr<Schedule::Item> &item, bool fallback_item)
+    bool ScheduledStream::StartStreamPlayback(const std::shared_ptr<Schedule::Item> &item)
     {
         logti("Scheduled Channel : %s/%s: Play stream %s", GetApplicationName(), GetName().CStr(), item->_url.CStr());
 
-        ScheduledStream::PlaybackResult result = PlaybackResult::PLAY_NEXT_ITEM;
-
         auto stream_tap = PrepareStreamPlayback(item);
         if (stream_tap == nullptr)
         {
             logte("Scheduled Channel : %s/%s: Failed to prepare stream playback. Try to play next item", GetApplicationName(), GetName().CStr());
-            return PlaybackResult::ERROR;
-        }
-
-        if (_realtime_clock.IsStart() == false)
-        {
-            _realtime_clock.Start();
+            return false;
         }
 
-        if (_realtime_clock.IsPaused() == true)
-        {
-            _realtime_clock.Resume();
-        }
+        _playback->stream_tap = stream_tap;
+        _playback->idle_clock.Start();
 
-        std::map<int, bool> track_first_packet_map;
-        std::map<int, int64_t> track_single_file_dts_offset_map;
-        std::map<int, bool> end_of_track_map;
+        return true;
+    }
 
-		// bool sent_keyframe = false;
+    ScheduledStream::Clock::time_point ScheduledStream::ContinueStreamPlayback()
+    {
+        auto &playback = *_playback;
+        auto &stream_tap = playback.stream_tap;
 
-        // Play
-        while (_worker_thread_running.load())
+        for (int count = 0; count < SCHEDULED_MAX_DRAIN_PER_STEP; count++)
         {
-            if (CheckCurrentProgramChanged() == true)
-            {
-                result = PlaybackResult::PLAY_NEXT_PROGRAM;
-                break;
-            }
-
-            if (fallback_item)
-            {
-                if (CheckCurrentItemAvailable() == true)
-                {
-                    result = PlaybackResult::FAILBACK;
-                    break;
-                }
-            }
-			
-            auto media_packet = stream_tap->Pop(_channel_info._error_tolerance_duration_ms);
+            auto media_packet = stream_tap->Pop(0);
             if (media_packet == nullptr)
             {
-                if (CheckCurrentProgramChanged() == true)
+                if (stream_tap->GetState() != MediaRouterStreamTap::State::Tapped)
                 {
-                    result = PlaybackResult::PLAY_NEXT_PROGRAM;
-                    break;
+                    logtw("Scheduled Channel : %s/%s: Stream tap state is %d. Try to play next item", GetApplicationName(), GetName().CStr(), static_cast<int>(stream_tap->GetState()));
+                    return FinishPlayback(PlaybackResult::ERROR);
                 }
-                else
-                {
-                    if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
-                    {
-                    	logtw("Scheduled Channel : %s/%s: Failed to pop packet until %" PRId64 " ms. Try to play next item", GetApplicationName(), GetName().CStr(), _channel_info._error_tolerance_duration_ms);
-                    }
-					else
-					{
-						logtw("Scheduled Channel : %s/%s: Stream tap state is %d. Try to play next item", GetApplicationName(), GetName().CStr(), static_cast<int>(stream_tap->GetState()));
-					}
-                    result = PlaybackResult::ERROR;
-                    break;
-                }
-            }
-			
-			auto origin_track_id = media_packet->GetTrackId();
-            auto track_id = FindTrackIdByOriginId(origin_track_id);
-            if (track_id < 0)
-            {
-                logtt("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), media_packet->GetTrackId());
-                continue;
-            }
 
-            if (end_of_track_map.find(track_id) != end_of_track_map.end())
-            {
-                // End of track
-                if (end_of_track_map.at(track_id) == true)
+                auto idle_ms = playback.idle_clock.Elapsed();
+                if (idle_ms >= _channel_info._error_tolerance_duration_ms)
                 {
-                    continue;
+                    logtw("Scheduled Channel : %s/%s: Failed to pop packet until %" PRId64 " ms. Try to play next item", GetApplicationName(), GetName().CStr(), _channel_info._error_tolerance_duration_ms);
+                    return FinishPlayback(PlaybackResult::ERROR);
                 }
-            }
-            else
-            {
-                end_of_track_map[track_id] = false;
+
+                // The tap wakes the channel up when a packet arrives
+                return Clock::now() + std::chrono::milliseconds(_channel_info._error_tolerance_duration_ms - idle_ms);
             }
 
-            // Transcoder will make bogus frame if it can't be decoded
-			// if (GetRepresentationType() == StreamRepresentationType::Relay && sent_keyframe == false)
-            // {
-			// 	if (media_packet->GetMediaType() == cmn::MediaType::Video)
-			// 	{
-			// 		if (media_packet->GetFlag() != MediaPacketFlag::Key)
-			// 		{
-			// 			// Skip until key frame
-			// 			continue;
-			// 		}
-			// 		else
-			// 		{
-			// 			sent_keyframe = true;
-			// 		}
-			// 	}
-			// 	else 
-			// 	{
-			// 		continue; // Skip until key frame
-			// 	}
-			// }
+            playback.idle_clock.Restart();
 
-            auto track = GetTrack(track_id);
-            if (track == nullptr)
+            if (SendStreamPacket(media_packet) == true)
             {
-                logtw("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), track_id);
-                continue;
+                return FinishPlayback(PlaybackResult::PLAY_NEXT_ITEM);
             }
+        }
 
-            auto origin_tb = stream_tap->GetStreamInfo()->GetTrack(origin_track_id)->GetTimeBase();
+        // More packets may be pending, let the other channels of the worker run first
+        return Clock::time_point();
+    }
 
-            media_packet->SetTrackId(track_id);
-            auto pts = media_packet->GetPts();
-            auto dts = media_packet->GetDts();
-            auto duration = media_packet->GetDuration();
+    bool ScheduledStream::SendStreamPacket(const std::shared_ptr<MediaPacket> &media_packet)
+    {
+        auto &playback = *_playback;
+        auto &item = playback.item;
 
-            // origin timebase to track timebase
-            //pts = (((double)pts * (double)origin_tb.GetNum()) / (double)origin_tb.GetDen()) * track->GetTimeBase().GetTimescale();
-            //dts = (((double)dts * (double)origin_tb.GetNum()) / (double)origin_tb.GetDen()) * track->GetTimeBase().GetTimescale();
-			//duration = static_cast<double>(duration) * (static_cast<double>(origin_tb.GetNum()) / static_cast<double>(origin_tb.GetDen()) * track->GetTimeBase().GetTimescale());
-			
-			// origin timebase to track timebase
-			pts = Rescale(pts, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
-			dts = Rescale(dts, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
-			duration = Rescale(duration, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
-
-			logtt("Scheduled Channel : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", duration %" PRId64 ", tb %f", GetApplicationName(), GetName().CStr(), track_id, dts, pts, dts, duration, track->GetTimeBase().GetExpr());
-
-            if (track_first_packet_map.find(track_id) == track_first_packet_map.end())
+        auto origin_track_id = media_packet->GetTrackId();
+        auto track_id = FindTrackIdByOriginId(origin_track_id);
+        if (track_id < 0)
+        {
+            logtt("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), media_packet->GetTrackId());
+            return false;
+        }
+
+        auto &end_of_track_map = playback.end_of_track_map;
+        if (end_of_track_map.find(track_id) != end_of_track_map.end())
+        {
+            // End of track
+            if (end_of_track_map.at(track_id) == true)
             {
-                track_first_packet_map[track_id] = true;
-                track_single_file_dts_offset_map[track_id] = dts;
+                return false;
             }
-            auto single_file_dts = dts - track_single_file_dts_offset_map[track_id];
+        }
+        else
+        {
+            end_of_track_map[track_id] = false;
+        }
+        // Transcoder will make bogus frame if it can't be decoded
+		// if (GetRepresentationType() == StreamRepresentationType::Relay && sent_keyframe == false)
+        // {
+		// 	if (media_packet->GetMediaType() == cmn::MediaType::Video)
+		// 	{
+		// 		if (media_packet->GetFlag() != MediaPacketFlag::Key)
+		// 		{
+		// 			// Skip until key frame
+		// 			continue;
+		// 		}
+		// 		else
+		// 		{
+		// 			sent_keyframe = true;
+		// 		}
+		// 	}
+		// 	else 
+		// 	{
+		// 		continue; // Skip until key frame
+		// 	}
+		// }
+
+        auto track = GetTrack(track_id);
+        if (track == nullptr)
+        {
+            logtw("Scheduled Channel : %s/%s: Failed to find track %d", GetApplicationName(), GetName().CStr(), track_id);
+            return false;
+        }
 
-            AdjustTimestampByBase(track_id, pts, dts, std::numeric_limits<int64_t>::max(), duration);
+        auto origin_tb = playback.stream_tap->GetStreamInfo()->GetTrack(origin_track_id)->GetTimeBase();
 
-			int64_t dts_us = Rescale(dts, 1000000 * track->GetTimeBase().GetNum(), track->GetTimeBase().GetDen());
-			if (_global_track_offset_us_map.find(track_id) == _global_track_offset_us_map.end())
-			{
-				_global_track_offset_us_map[track_id] = dts_us;
-			}
-            media_packet->SetPts(pts);
-            media_packet->SetDts(dts);
-			media_packet->SetDuration(-1); // It will be calculated in MediaRouter
+        media_packet->SetTrackId(track_id);
+        auto pts = media_packet->GetPts();
+        auto dts = media_packet->GetDts();
+        auto duration = media_packet->GetDuration();
 
-			double time_ms = (double)(dts * 1000.0 * track->GetTimeBase().GetExpr());
+        // origin timebase to track timebase
+        //pts = (((double)pts * (double)origin_tb.GetNum()) / (double)origin_tb.GetDen()) * track->GetTimeBase().GetTimescale();
+        //dts = (((double)dts * (double)origin_tb.GetNum()) / (double)origin_tb.GetDen()) * track->GetTimeBase().GetTimescale();
+		//duration = static_cast<double>(duration) * (static_cast<double>(origin_tb.GetNum()) / static_cast<double>(origin_tb.GetDen()) * track->GetTimeBase().GetTimescale());
+		
+		// origin timebase to track timebase
+		pts = Rescale(pts, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
+		dts = Rescale(dts, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
+		duration = Rescale(duration, track->GetTimeBase().GetDen() * origin_tb.GetNum(), origin_tb.GetDen() * track->GetTimeBase().GetNum());
 
-            logtt("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", tb %f, dts_ms %f", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, track->GetTimeBase().GetExpr(), time_ms);
+		logtt("Scheduled Channel : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", duration %" PRId64 ", tb %f", GetApplicationName(), GetName().CStr(), track_id, dts, pts, dts, duration, track->GetTimeBase().GetExpr());
 
-            SendFrame(media_packet);
+        if (playback.track_single_file_dts_offset_map.find(track_id) == playback.track_single_file_dts_offset_map.end())
+        {
+            playback.track_single_file_dts_offset_map[track_id] = dts;
+        }
+        auto single_file_dts = dts - playback.track_single_file_dts_offset_map[track_id];
 
-            // dts to real time (ms)
-            auto single_file_dts_ms = static_cast<double>(single_file_dts) * track->GetTimeBase().GetExpr() * static_cast<double>(1000);
+        AdjustTimestampByBase(track_id, pts, dts, std::numeric_limits<int64_t>::max(), duration);
 
-            std::unique_lock<std::shared_mutex> lock(_current_mutex);
-            _current_item_position_ms = single_file_dts_ms;
-            lock.unlock();
+		int64_t dts_us = Rescale(dts, 1000000 * track->GetTimeBase().GetNum(), track->GetTimeBase().GetDen());
+		if (_global_track_offset_us_map.find(track_id) == _global_track_offset_us_map.end())
+		{
+			_global_track_offset_us_map[track_id] = dts_us;
+		}
+        media_packet->SetPts(pts);
+        media_packet->SetDts(dts);
+		media_packet->SetDuration(-1); // It will be calculated in MediaRouter
 
-            // Get current play time
-            if (item->_duration_ms >= 0)
-            {
-                if (single_file_dts_ms > item->_duration_ms)
-                {
-                    end_of_track_map[track_id] = true;
-                }
+		double time_ms = (double)(dts * 1000.0 * track->GetTimeBase().GetExpr());
 
-                // all tracks should be ended
-                bool all_tracks_ended = true;
-                for (auto &end_of_track : end_of_track_map)
-                {
-                    if (end_of_track.second == false)
-                    {
-                        all_tracks_ended = false;
-                        break;
-                    }
-                }
+        logtt("Scheduled Channel Send Packet : %s/%s: Track %d, origin dts : %" PRId64 ", pts %" PRId64 ", dts %" PRId64 ", tb %f, dts_ms %f", GetApplicationName(), GetName().CStr(), track_id, single_file_dts, pts, dts, track->GetTimeBase().GetExpr(), time_ms);
 
-                if (all_tracks_ended == true)
+        SendFrame(media_packet);
+
+        // dts to real time (ms)
+        auto single_file_dts_ms = static_cast<double>(single_file_dts) * track->GetTimeBase().GetExpr() * static_cast<double>(1000);
+
+        std::unique_lock<std::shared_mutex> lock(_current_mutex);
+        _current_item_position_ms = single_file_dts_ms;
+        lock.unlock();
+
+        // Get current play time
+        if (item->_duration_ms >= 0)
+        {
+            if (single_file_dts_ms > item->_duration_ms)
+            {
+                end_of_track_map[track_id] = true;
+            }
+
+            // all tracks should be ended
+            bool all_tracks_ended = true;
+            for (auto &end_of_track : end_of_track_map)
+            {
+                if (end_of_track.second == false)
                 {
-                    // End of item
-                    logti("Scheduled Channel : %s/%s: End of item (Current Pos : %.0f ms Duration : %" PRId64 " ms). Try to play next item", GetApplicationName(), GetName().CStr(), single_file_dts_ms, item->_duration_ms);
-                    result = PlaybackResult::PLAY_NEXT_ITEM;
+                    all_tracks_ended = false;
                     break;
                 }
             }
-        }
 
-        _current_item_position_ms = 0;
-
-        ocst::Orchestrator::GetInstance()->UnmirrorStream(stream_tap);
-
-        logti("Scheduled Channel : %s/%s: Playback stopped", GetApplicationName(), GetName().CStr());
+            if (all_tracks_ended == true)
+            {
+                // End of item
+                logti("Scheduled Channel : %s/%s: End of item (Current Pos : %.0f ms Duration : %" PRId64 " ms). Try to play next item", GetApplicationName(), GetName().CStr(), single_file_dts_ms, item->_duration_ms);
+                return true;
+            }
+        }
 
-        return result;
+        return false;
     }
 
     bool ScheduledStream::CheckStreamItemAvailable(const std::shared_ptr<Schedule::Item> &item)
@@ -1349,6 +1598,10 @@ namespace pvd
 
         OnSourceChanged();
 
+        // Wake the channel up as soon as a packet arrives
+        stream_tap->SetPacketNotifier([channel_id = GetId()]() {
+            ScheduledChannelPool::GetInstance()->Wake(channel_id);
+        });
         stream_tap->Start();
 
         return stream_tap;
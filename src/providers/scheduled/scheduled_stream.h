@@ -13,7 +13,10 @@
 #include <mediarouter/mediarouter_stream_tap.h>
 #include <base/provider/stream.h>
 
+#include <deque>
+
 #include "schedule.h"
+#include "scheduled_channel_pool.h"
 
 namespace pvd
 {
@@ -44,7 +47,7 @@ namespace pvd
         bool GetCurrentProgram(std::shared_ptr<Schedule::Program> &curr_program, std::shared_ptr<Schedule::Item> &curr_item, int64_t &curr_item_pos) const;
 
     private:
-        void WorkerThread();
+        using Clock = ScheduledChannelPool::Clock;
 
         enum class PlaybackResult
         {
@@ -54,6 +57,89 @@ namespace pvd
             FAILBACK
         };
 
+        // The channel runs as steps on ScheduledChannelPool. Every step continues from the phase
+        // the previous one left, and returns when the channel wants to run again.
+        enum class Phase
+        {
+            // Take the latest schedule and its current program
+            LoadSchedule,
+            // Wait for the durations of the items of the program to be read
+            PrepareProgram,
+            // Play the next item of the current program
+            NextItem,
+            // Play the next item of the fallback program
+            NextFallbackItem,
+            // Wait for the file of the item to be opened
+            OpenFile,
+            // Send what is due from the item being played
+            Playing
+        };
+
+        // What may block the worker of the channel, such as opening a file, runs on
+        // ScheduledChannelPool::Prepare(). The step that started it takes the result once it is done.
+        struct Preparation
+        {
+            std::shared_ptr<Schedule::Item> item;
+
+            // Results
+            std::shared_ptr<AVFormatContext> context;
+            bool available = false;
+
+            std::atomic<bool> done{false};
+        };
+
+        // Who entered the fallback program, which decides where playback goes when it ends
+        enum class FallbackCaller
+        {
+            // There is no current program
+            Schedule,
+            // The current item failed
+            Item
+        };
+
+        // A packet demuxed ahead of the realtime clock. Its timestamps are still relative to the
+        // file; they are adjusted when it is sent, in demux order.
+        struct ReadaheadPacket
+        {
+            std::shared_ptr<MediaPacket> packet;
+            int64_t single_file_dts = 0;
+            // Position in the item once the packet is played
+            double position_ms = 0;
+            // The packet ends the item, because every track reached the duration of the item
+            bool ends_item = false;
+        };
+
+        // State of the item being played, kept across steps
+        struct Playback
+        {
+            std::shared_ptr<Schedule::Item> item;
+            bool fallback_item = false;
+
+            std::map<int, int64_t> track_single_file_dts_offset_map;
+            std::map<int, bool> end_of_track_map;
+
+            // File
+            std::shared_ptr<Preparation> opening;
+            std::shared_ptr<AVFormatContext> context;
+            bool is_mpegts = false;
+            std::deque<ReadaheadPacket> readahead;
+            // Nothing more is read: end of file, a read error, or the end of the item was read
+            bool end_of_input = false;
+            // The next packet is sent once the realtime clock reaches this
+            int64_t send_at_us = 0;
+
+            // Stream
+            std::shared_ptr<MediaRouterStreamTap> stream_tap;
+            ov::StopWatch idle_clock;
+        };
+
+        // Step function of the channel
+        Clock::time_point Run();
+
+        Clock::time_point LoadSchedule();
+        Clock::time_point ContinueProgramPreparation();
+        Clock::time_point PlayNextItem();
+
         // If there is no current program
         //      ==> Continue playing until the current program changes
         // If there is no current item
@@ -63,20 +149,34 @@ namespace pvd
 
         // If there is an error in the fallback
         //     ==> Keep attempting
-        // If the fallback ends (program change, item change, item duration ends)
-        //     ==> return true
         // If there is no fallback (not configured)
-        //     ==> return false
-        PlaybackResult PlayFallbackOrWait();
-
-        PlaybackResult PlayItem(const std::shared_ptr<Schedule::Item> &item, bool fallback_item = false);
-
-        PlaybackResult PlayFile(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
-        bool PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item);
-        
-        PlaybackResult PlayStream(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
+        //     ==> Wait until the current item is available again
+        void EnterFallback(FallbackCaller caller);
+        Clock::time_point PlayNextFallbackItem();
+        Clock::time_point FinishFallback(PlaybackResult result);
+
+        // Returns nullptr if the channel is stopping
+        std::shared_ptr<Preparation> Prepare(const std::shared_ptr<Schedule::Item> &item, std::function<void(Preparation &preparation)> function);
+
+        Clock::time_point StartPlayback(const std::shared_ptr<Schedule::Item> &item, bool fallback_item);
+        Clock::time_point BeginPlaying();
+        Clock::time_point ContinuePlayback();
+        Clock::time_point FinishPlayback(PlaybackResult result);
+        void StopPlayback();
+
+        bool StartFilePlayback(const std::shared_ptr<Schedule::Item> &item);
+        Clock::time_point ContinueFileOpening();
+        bool PrepareFilePlayback(const std::shared_ptr<Schedule::Item> &item, const std::shared_ptr<AVFormatContext> &context);
+        Clock::time_point ContinueFilePlayback();
+        void FillReadahead();
+        void SendFilePacket(const ReadaheadPacket &readahead_packet);
+
+        bool StartStreamPlayback(const std::shared_ptr<Schedule::Item> &item);
         std::shared_ptr<MediaRouterStreamTap> PrepareStreamPlayback(const std::shared_ptr<Schedule::Item> &item);
-        
+        Clock::time_point ContinueStreamPlayback();
+        // Returns true if the packet ends the item
+        bool SendStreamPacket(const std::shared_ptr<MediaPacket> &media_packet);
+
         std::shared_ptr<Schedule> GetSchedule() const;
         bool CheckCurrentProgramChanged();
         bool CheckCurrentFallbackProgramChanged();
@@ -93,10 +193,20 @@ namespace pvd
         std::shared_ptr<Schedule> _schedule;
         mutable std::shared_mutex _schedule_mutex;
 
-        std::thread _worker_thread;
-        std::atomic<bool> _worker_thread_running{false};
+        std::atomic<bool> _channel_running{false};
+
+        Phase _phase = Phase::LoadSchedule;
+        bool _first_item = true;
+
+        FallbackCaller _fallback_caller = FallbackCaller::Schedule;
+        bool _first_fallback_item = true;
+        PlaybackResult _fallback_result = PlaybackResult::PLAY_NEXT_ITEM;
+
+        std::shared_ptr<Preparation> _program_preparation;
+        // Whether the file of the current item can be played again, while the fallback program plays
+        std::shared_ptr<Preparation> _item_check;
 
-        mutable ov::Event _schedule_updated;
+        std::unique_ptr<Playback> _playback;
 
         // Current
         const Schedule::Stream _channel_info;
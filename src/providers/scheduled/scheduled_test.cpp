@@ -1,2 +1,390 @@
-// Placeholder — add tests here.
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
 #include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "scheduled_channel_pool.h"
+
+namespace
+{
+	using pvd::ScheduledChannelPool;
+	using Clock = ScheduledChannelPool::Clock;
+	using namespace std::chrono_literals;
+
+	// Ids that never collide with a real stream in this test binary
+	constexpr uint32_t TEST_CHANNEL_ID_BASE = 0xFFFF0000;
+
+	// The stats of a step are recorded once it returns, so wait for the channel to fall asleep
+	bool WaitForIdle(uint32_t channel_id)
+	{
+		auto pool = ScheduledChannelPool::GetInstance();
+
+		for (int retry = 0; retry < 1000; retry++)
+		{
+			for (const auto &stats : pool->GetStats())
+			{
+				if ((stats.channel_id == channel_id) && stats.idle)
+				{
+					return true;
+				}
+			}
+
+			std::this_thread::sleep_for(1ms);
+		}
+
+		return false;
+	}
+}  // namespace
+
+TEST(ScheduledChannelPool, RunsStepAtDeadline)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto channel_id = TEST_CHANNEL_ID_BASE;
+
+	std::atomic<int> step_count{0};
+	std::promise<Clock::duration> second_step;
+	Clock::time_point start;
+
+	ASSERT_TRUE(pool->Register(channel_id, "#default#app/channel", [&]() {
+		auto count = ++step_count;
+		if (count == 1)
+		{
+			start = Clock::now();
+			return start + 20ms;
+		}
+
+		if (count == 2)
+		{
+			second_step.set_value(Clock::now() - start);
+		}
+
+		return Clock::time_point::max();
+	}));
+
+	// Registering the same id twice is refused
+	EXPECT_FALSE(pool->Register(channel_id, "duplicated", []() { return Clock::time_point::max(); }));
+
+	auto elapsed = second_step.get_future();
+	ASSERT_EQ(elapsed.wait_for(1s), std::future_status::ready);
+	EXPECT_GE(elapsed.get(), 20ms - ScheduledChannelPool::COALESCE_WINDOW);
+	ASSERT_TRUE(WaitForIdle(channel_id));
+
+	ScheduledChannelPool::DriftStats stats;
+	ASSERT_TRUE(pool->GetDriftStats(channel_id, stats));
+	EXPECT_EQ(stats.step_count, 2u);
+	EXPECT_EQ(stats.timed_step_count, 1u);
+	EXPECT_GE(stats.last_drift_us, -ScheduledChannelPool::COALESCE_WINDOW.count());
+
+	// Sleeps without a deadline until woken up
+	auto stats_list = pool->GetStats();
+	auto it = std::find_if(stats_list.begin(), stats_list.end(), [&](const ScheduledChannelPool::ChannelStats &stats) {
+		return stats.channel_id == channel_id;
+	});
+	ASSERT_NE(it, stats_list.end());
+	EXPECT_EQ(it->name, "#default#app/channel");
+	EXPECT_EQ(it->worker_index, channel_id % pool->GetWorkerCount());
+	EXPECT_TRUE(it->idle);
+
+	pool->Unregister(channel_id);
+	EXPECT_FALSE(pool->GetDriftStats(channel_id, stats));
+}
+
+TEST(ScheduledChannelPool, WakeRunsStepBeforeDeadline)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto channel_id = TEST_CHANNEL_ID_BASE + 1;
+
+	std::atomic<int> step_count{0};
+
+	ASSERT_TRUE(pool->Register(channel_id, "wake", [&]() {
+		step_count++;
+		return Clock::now() + 10s;
+	}));
+
+	std::this_thread::sleep_for(20ms);
+	EXPECT_EQ(step_count, 1);
+
+	pool->Wake(channel_id);
+	std::this_thread::sleep_for(20ms);
+	EXPECT_EQ(step_count, 2);
+
+	// Woken steps are not timed, so they do not count as drift
+	ScheduledChannelPool::DriftStats stats;
+	ASSERT_TRUE(pool->GetDriftStats(channel_id, stats));
+	EXPECT_EQ(stats.step_count, 2u);
+	EXPECT_EQ(stats.timed_step_count, 0u);
+
+	pool->Unregister(channel_id);
+}
+
+TEST(ScheduledChannelPool, PastDeadlineRunsAgainWithoutDrift)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto channel_id = TEST_CHANNEL_ID_BASE + 4;
+
+	std::promise<void> done;
+	int step_count = 0;
+
+	ASSERT_TRUE(pool->Register(channel_id, "past", [&]() {
+		if (++step_count < 3)
+		{
+			// Run again right away
+			return Clock::time_point();
+		}
+
+		done.set_value();
+		return Clock::time_point::max();
+	}));
+
+	ASSERT_EQ(done.get_future().wait_for(1s), std::future_status::ready);
+	ASSERT_TRUE(WaitForIdle(channel_id));
+
+	ScheduledChannelPool::DriftStats stats;
+	ASSERT_TRUE(pool->GetDriftStats(channel_id, stats));
+	EXPECT_EQ(stats.step_count, 3u);
+	EXPECT_EQ(stats.timed_step_count, 0u);
+
+	pool->Unregister(channel_id);
+}
+
+TEST(ScheduledChannelPool, UnregisterWaitsForRunningStep)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto channel_id = TEST_CHANNEL_ID_BASE + 2;
+
+	std::atomic<bool> in_step{false};
+	std::atomic<bool> step_returned{false};
+	std::atomic<int> step_count{0};
+
+	ASSERT_TRUE(pool->Register(channel_id, "unregister", [&]() {
+		step_count++;
+		in_step = true;
+		std::this_thread::sleep_for(50ms);
+		step_returned = true;
+		return Clock::time_point();
+	}));
+
+	while (in_step == false)
+	{
+		std::this_thread::sleep_for(1ms);
+	}
+
+	pool->Unregister(channel_id);
+	EXPECT_TRUE(step_returned);
+
+	// Never called again, although the step asked to run right away
+	auto count = step_count.load();
+	std::this_thread::sleep_for(20ms);
+	EXPECT_EQ(step_count, count);
+}
+
+TEST(ScheduledChannelPool, StepCanUnregisterItsChannel)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto channel_id = TEST_CHANNEL_ID_BASE + 3;
+
+	std::atomic<int> step_count{0};
+
+	ASSERT_TRUE(pool->Register(channel_id, "self", [&]() {
+		step_count++;
+		ScheduledChannelPool::GetInstance()->Unregister(channel_id);
+		return Clock::time_point();
+	}));
+
+	std::this_thread::sleep_for(20ms);
+	EXPECT_EQ(step_count, 1);
+
+	ScheduledChannelPool::DriftStats stats;
+	EXPECT_FALSE(pool->GetDriftStats(channel_id, stats));
+
+	// The id can be used again
+	ASSERT_TRUE(pool->Register(channel_id, "self", []() { return Clock::time_point::max(); }));
+	pool->Unregister(channel_id);
+}
+
+TEST(ScheduledChannelPool, PrepareRunsOffWorkerAndWakesChannel)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto channel_id = TEST_CHANNEL_ID_BASE + 4;
+
+	std::atomic<int> step_count{0};
+	std::atomic<bool> prepared{false};
+	std::thread::id step_thread_id;
+	std::thread::id preparation_thread_id;
+	std::promise<void> woken;
+
+	ASSERT_TRUE(pool->Register(channel_id, "prepare", [&]() {
+		if (++step_count == 1)
+		{
+			step_thread_id = std::this_thread::get_id();
+
+			// The step does not wait for what it hands over, and sleeps until it is done
+			EXPECT_TRUE(ScheduledChannelPool::GetInstance()->Prepare(channel_id, [&]() {
+				preparation_thread_id = std::this_thread::get_id();
+				std::this_thread::sleep_for(20ms);
+				prepared = true;
+			}));
+		}
+		else if (prepared)
+		{
+			woken.set_value();
+		}
+
+		return Clock::time_point::max();
+	}));
+
+	ASSERT_EQ(woken.get_future().wait_for(1s), std::future_status::ready);
+	EXPECT_NE(preparation_thread_id, step_thread_id);
+	EXPECT_EQ(step_count, 2);
+
+	pool->Unregister(channel_id);
+
+	// Not accepted for a channel that is not registered
+	EXPECT_FALSE(pool->Prepare(channel_id, []() {}));
+}
+
+TEST(ScheduledChannelPool, UnregisterWaitsForRunningPreparation)
+{
+	auto pool = ScheduledChannelPool::GetInstance();
+
+	// Keep every preparation thread busy, so the preparations of the channel are queued behind them
+	std::atomic<bool> in_preparation{false};
+	std::atomic<bool> preparation_returned{false};
+	std::atomic<int> queued_count{0};
+
+	auto channel_id = TEST_CHANNEL_ID_BASE + 5;
+	ASSERT_TRUE(pool->Register(channel_id, "unregister-prepare", []() { return Clock::time_point::max(); }));
+
+	ASSERT_TRUE(pool->Prepare(channel_id, [&]() {
+		in_preparation = true;
+		std::this_thread::sleep_for(50ms);
+		preparation_returned = true;
+	}));
+
+	for (size_t index = 0; index < ScheduledChannelPool::PREPARATION_THREAD_COUNT * 2; index++)
+	{
+		ASSERT_TRUE(pool->Prepare(channel_id, [&]() {
+			std::this_thread::sleep_for(50ms);
+			queued_count++;
+		}));
+	}
+
+	while (in_preparation == false)
+	{
+		std::this_thread::sleep_for(1ms);
+	}
+
+	pool->Unregister(channel_id);
+	EXPECT_TRUE(preparation_returned);
+
+	// What had not started is dropped, and nothing runs after Unregister() returns
+	auto count = queued_count.load();
+	EXPECT_LT(count, static_cast<int>(ScheduledChannelPool::PREPARATION_THREAD_COUNT * 2));
+	std::this_thread::sleep_for(100ms);
+	EXPECT_EQ(queued_count, count);
+}
+
+TEST(ScheduledChannelPool, RunsManyChannelsInDeadlineOrder)
+{
+	constexpr int CHANNEL_COUNT = 16;
+
+	auto pool = ScheduledChannelPool::GetInstance();
+	auto start = Clock::now();
+
+	// Put every channel on the same worker, so the timers share one heap
+	auto worker_count = static_cast<uint32_t>(pool->GetWorkerCount());
+	auto channel_id_of = [&](int index) {
+		return TEST_CHANNEL_ID_BASE + 100 * worker_count + index * worker_count;
+	};
+
+	std::mutex order_mutex;
+	std::vector<int> order;
+
+	// Deadlines are 10ms apart so they never share a coalesced wakeup, and are registered in
+	// reverse so the heap has to reorder them
+	for (int index = CHANNEL_COUNT - 1; index >= 0; index--)
+	{
+		auto deadline = start + 50ms + std::chrono::milliseconds(10 * index);
+		auto first = std::make_shared<bool>(true);
+
+		ASSERT_TRUE(pool->Register(channel_id_of(index), "order", [&, index, deadline, first]() {
+			if (*first)
+			{
+				*first = false;
+				return deadline;
+			}
+
+			std::lock_guard<std::mutex> lock(order_mutex);
+			order.push_back(index);
+			return Clock::time_point::max();
+		}));
+	}
+
+	std::this_thread::sleep_for(50ms + std::chrono::milliseconds(10 * CHANNEL_COUNT) + 50ms);
+
+	{
+		std::lock_guard<std::mutex> lock(order_mutex);
+		ASSERT_EQ(order.size(), static_cast<size_t>(CHANNEL_COUNT));
+
+		for (int index = 0; index < CHANNEL_COUNT; index++)
+		{
+			EXPECT_EQ(order[index], index);
+		}
+	}
+
+	for (int index = 0; index < CHANNEL_COUNT; index++)
+	{
+		pool->Unregister(channel_id_of(index));
+	}
+}
+
+TEST(ScheduledChannelPool, ManyChannelsShareBoundedWorkers)
+{
+	constexpr int CHANNEL_COUNT = 200;
+
+	auto pool = ScheduledChannelPool::GetInstance();
+	EXPECT_LE(pool->GetWorkerCount(), ScheduledChannelPool::MAX_WORKER_COUNT);
+
+	std::mutex thread_mutex;
+	std::vector<std::thread::id> thread_ids;
+	std::atomic<int> step_count{0};
+
+	for (int index = 0; index < CHANNEL_COUNT; index++)
+	{
+		ASSERT_TRUE(pool->Register(TEST_CHANNEL_ID_BASE + 1000 + index, "many", [&]() {
+			{
+				std::lock_guard<std::mutex> lock(thread_mutex);
+				if (std::find(thread_ids.begin(), thread_ids.end(), std::this_thread::get_id()) == thread_ids.end())
+				{
+					thread_ids.push_back(std::this_thread::get_id());
+				}
+			}
+
+			step_count++;
+			return Clock::now() + 5ms;
+		}));
+	}
+
+	std::this_thread::sleep_for(100ms);
+
+	for (int index = 0; index < CHANNEL_COUNT; index++)
+	{
+		pool->Unregister(TEST_CHANNEL_ID_BASE + 1000 + index);
+	}
+
+	// Every channel kept running, on no more threads than the pool has
+	EXPECT_GE(step_count, CHANNEL_COUNT * 5);
+	EXPECT_LE(thread_ids.size(), pool->GetWorkerCount());
+}
@@ -976,6 +976,7 @@ bool HlsStream::CreatePackagers()
 			}
 
 			packager_config.stream_id_meta = ov::String::FormatString("%s_%s", GetApplicationName(), GetName().CStr());
+			packager_config.memory_account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::HlsSegment, GetUri());
 
 			auto packager = std::make_shared<mpegts::Packager>(variant_name, packager_config);
 			if (packager == nullptr)
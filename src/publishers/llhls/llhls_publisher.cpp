@@ -272,11 +272,6 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 
 		logtt("LLHLS requested(connection : %u): %s", connection->GetId(), request->GetUri().CStr());
 
-		auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
-
-		auto host_name = final_url->Host();
-		auto stream_name = final_url->Stream();
-
 		uint64_t session_life_time = 0;
 		bool access_control_enabled = IsAccessControlEnabled(final_url);
 
@@ -304,131 +299,253 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 			}
 
 			// Admission Webhooks
-			auto [webhooks_result, admission_webhooks] = VerifyByAdmissionWebhooks(request_info);
-			if (webhooks_result == AccessController::VerificationResult::Off)
+			// The exchange is suspended while the control server is queried, so the socket worker can serve other connections
+			VerifyByAdmissionWebhooksAsync(request_info, [this, exchange, requested_url, final_url, session_life_time](AccessController::VerificationResult webhooks_result, const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
+				auto next_handler = OnAdmissionWebhooksVerified(exchange, requested_url, final_url, session_life_time, webhooks_result, admission_webhooks);
+
+				if (next_handler != http::svr::NextHandler::DoNotCallAndDoNotResponse)
+				{
+					exchange->GetResponse()->Response();
+					exchange->Release();
+				}
+			});
+
+			return http::svr::NextHandler::DoNotCallAndDoNotResponse;
+		}
+
+		return HandleStreamRequest(exchange, requested_url, final_url, session_life_time, access_control_enabled);
+	});
+
+	// Set Close Handler
+	http_interceptor->SetCloseHandler([this](const std::shared_ptr<http::svr::HttpConnection> &connection, PhysicalPortDisconnectReason reason) -> void {
+		for (auto &user_data : connection->GetUserDataMap())
+		{
+			std::shared_ptr<LLHlsSession> session;
+
+			auto session_path_ptr = std::any_cast<info::Session::Path>(&user_data.second);
+			if (session_path_ptr == nullptr)
 			{
-				// Success
+				continue;
 			}
-			else if (webhooks_result == AccessController::VerificationResult::Pass)
+			
+			session = std::static_pointer_cast<LLHlsSession>(GetSession(*session_path_ptr));
+			if (session != nullptr)
 			{
-				// Lifetime
-				if (admission_webhooks->GetLifetime() != 0)
+				session->OnConnectionDisconnected(connection->GetId());
+				if (session->IsNoConnection())
 				{
-					// Choice smaller value
-					auto stream_expired_msec_from_webhooks = ov::Clock::NowMSec() + admission_webhooks->GetLifetime();
-					if (session_life_time == 0 || stream_expired_msec_from_webhooks < session_life_time)
+					logtt("llhls session is closed : %u", session->GetId());
+					// Remove session from stream
+					auto stream = session->GetStream();
+					if (stream != nullptr)
 					{
-						session_life_time = stream_expired_msec_from_webhooks;
-					}
-				}
+						auto requested_url = session->GetRequestedUrl();
+						auto final_url = session->GetFinalUrl();
+						auto request_info = std::make_shared<ac::RequestInfo>(requested_url, final_url, connection->GetSocket(), nullptr);
+						request_info->SetUserAgent(session->GetUserAgent());
+						SendCloseAdmissionWebhooks(request_info);
 
-				// Redirect URL
-				if (admission_webhooks->GetNewURL() != nullptr)
-				{
-					final_url = admission_webhooks->GetNewURL();
-					if (final_url->Port() == 0)
-					{
-						final_url->SetPort(request->GetRemote()->GetLocalAddress()->Port());
+						stream->RemoveSession(session->GetId());
 					}
-
-					vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
-					host_name = final_url->Host();
-					stream_name = final_url->Stream();
 				}
 			}
-			else if (webhooks_result == AccessController::VerificationResult::Error)
-			{
-				logtw("AdmissionWebhooks error : %s", final_url->ToUrlString().CStr());
-				response->SetStatusCode(http::StatusCode::Unauthorized);
-				return http::svr::NextHandler::DoNotCall;
-			}
-			else if (webhooks_result == AccessController::VerificationResult::Fail)
-			{
-				logtw("AdmissionWebhooks error : %s", admission_webhooks->GetErrReason().CStr());
-				response->SetStatusCode(http::StatusCode::Unauthorized);
-				return http::svr::NextHandler::DoNotCall;
-			}
 		}
+	});
 
-		if (vhost_app_name.IsValid() == false)
-		{
-			logte("Could not resolve application name from domain: %s", final_url->Host().CStr());
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;
-		}
+	return http_interceptor;
+}
 
-		auto application = std::static_pointer_cast<LLHlsApplication>(GetApplicationByName(vhost_app_name));
-		auto stream = std::static_pointer_cast<LLHlsStream>(GetStream(vhost_app_name, stream_name));
-		if (stream == nullptr)
+http::svr::NextHandler LLHlsPublisher::OnAdmissionWebhooksVerified(const std::shared_ptr<http::svr::HttpExchange> &exchange,
+	const std::shared_ptr<ov::Url> &requested_url,
+	std::shared_ptr<ov::Url> final_url,
+	uint64_t session_life_time,
+	AccessController::VerificationResult webhooks_result,
+	const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks)
+{
+	auto request = exchange->GetRequest();
+	auto response = exchange->GetResponse();
+
+	if (webhooks_result == AccessController::VerificationResult::Off)
+	{
+		// Success
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Pass)
+	{
+		// Lifetime
+		if (admission_webhooks->GetLifetime() != 0)
 		{
-			// PullStream may create the app from the wildcard template
-			stream = std::dynamic_pointer_cast<LLHlsStream>(PullStream(final_url, vhost_app_name, host_name, stream_name));
-			if (stream != nullptr)
+			// Choice smaller value
+			auto stream_expired_msec_from_webhooks = ov::Clock::NowMSec() + admission_webhooks->GetLifetime();
+			if (session_life_time == 0 || stream_expired_msec_from_webhooks < session_life_time)
 			{
-				if (application == nullptr)
-				{
-					application = std::static_pointer_cast<LLHlsApplication>(GetApplicationByName(vhost_app_name));
-				}
-				logti("URL %s is requested", stream->GetMediaSource().CStr());
+				session_life_time = stream_expired_msec_from_webhooks;
 			}
 		}
 
-		// Apply CORS once the application is known so error responses still carry the headers
-		if (application != nullptr)
+		// Redirect URL
+		if (admission_webhooks->GetNewURL() != nullptr)
 		{
-			application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response, {http::Method::Options, http::Method::Get, http::Method::Head});
+			final_url = admission_webhooks->GetNewURL();
+			if (final_url->Port() == 0)
+			{
+				final_url->SetPort(request->GetRemote()->GetLocalAddress()->Port());
+			}
 		}
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Error)
+	{
+		logtw("AdmissionWebhooks error : %s", final_url->ToUrlString().CStr());
+		response->SetStatusCode(http::StatusCode::Unauthorized);
+		return http::svr::NextHandler::DoNotCall;
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Fail)
+	{
+		logtw("AdmissionWebhooks error : %s", admission_webhooks->GetErrReason().CStr());
+		response->SetStatusCode(http::StatusCode::Unauthorized);
+		return http::svr::NextHandler::DoNotCall;
+	}
 
-		if (application == nullptr || stream == nullptr)
-		{
-			logte("Cannot find stream (%s/%s)", vhost_app_name.CStr(), stream_name.CStr());
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;
-		}
+	return HandleStreamRequest(exchange, requested_url, final_url, session_life_time, true);
+}
+
+http::svr::NextHandler LLHlsPublisher::HandleStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange,
+	const std::shared_ptr<ov::Url> &requested_url,
+	const std::shared_ptr<ov::Url> &final_url,
+	uint64_t session_life_time,
+	bool access_control_enabled)
+{
+	auto connection = exchange->GetConnection();
+	auto request = exchange->GetRequest();
+	auto response = exchange->GetResponse();
+
+	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
+	auto host_name = final_url->Host();
+	auto stream_name = final_url->Stream();
+
+	if (vhost_app_name.IsValid() == false)
+	{
+		logte("Could not resolve application name from domain: %s", final_url->Host().CStr());
+		response->SetStatusCode(http::StatusCode::NotFound);
+		return http::svr::NextHandler::DoNotCall;
+	}
 
-		// TODO(Getroot): Improve this so that the player's first request is played immediately. This policy was temporarily changed due to a performance issue at the edge.
-		if (stream->WaitUntilStart(0) == false)
+	auto application = std::static_pointer_cast<LLHlsApplication>(GetApplicationByName(vhost_app_name));
+	auto stream = std::static_pointer_cast<LLHlsStream>(GetStream(vhost_app_name, stream_name));
+	if (stream == nullptr)
+	{
+		// PullStream may create the app from the wildcard template
+		stream = std::dynamic_pointer_cast<LLHlsStream>(PullStream(final_url, vhost_app_name, host_name, stream_name));
+		if (stream != nullptr)
 		{
-			logtw("(%s/%s) stream has created but not started yet", vhost_app_name.CStr(), stream_name.CStr());
-			response->SetStatusCode(http::StatusCode::Created);
-			return http::svr::NextHandler::DoNotCall;
+			if (application == nullptr)
+			{
+				application = std::static_pointer_cast<LLHlsApplication>(GetApplicationByName(vhost_app_name));
+			}
+			logti("URL %s is requested", stream->GetMediaSource().CStr());
 		}
+	}
 
-		auto origin_mode = application->IsOriginMode();
+	// Apply CORS once the application is known so error responses still carry the headers
+	if (application != nullptr)
+	{
+		application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response, {http::Method::Options, http::Method::Get, http::Method::Head});
+	}
 
-		std::shared_ptr<LLHlsSession> session = nullptr;
+	if (application == nullptr || stream == nullptr)
+	{
+		logte("Cannot find stream (%s/%s)", vhost_app_name.CStr(), stream_name.CStr());
+		response->SetStatusCode(http::StatusCode::NotFound);
+		return http::svr::NextHandler::DoNotCall;
+	}
 
-		// Master playlist (.m3u8 and NOT *chunklist*.m3u8)
-		if (origin_mode == true)
+	// TODO(Getroot): Improve this so that the player's first request is played immediately. This policy was temporarily changed due to a performance issue at the edge.
+	if (stream->WaitUntilStart(0) == false)
+	{
+		logtw("(%s/%s) stream has created but not started yet", vhost_app_name.CStr(), stream_name.CStr());
+		response->SetStatusCode(http::StatusCode::Created);
+		return http::svr::NextHandler::DoNotCall;
+	}
+
+	auto origin_mode = application->IsOriginMode();
+
+	std::shared_ptr<LLHlsSession> session = nullptr;
+
+	// Master playlist (.m3u8 and NOT *chunklist*.m3u8)
+	if (origin_mode == true)
+	{
+		// Random session from pool
+		session = stream->GetSessionFromPool();
+		if (session == nullptr)
 		{
-			// Random session from pool
-			session = stream->GetSessionFromPool();
-			if (session == nullptr)
+			logtc("Could not get llhls origin session from pool for request: %s", request->ToString().CStr());
+			response->SetStatusCode(http::StatusCode::InternalServerError);
+			return http::svr::NextHandler::DoNotCall;
+		}
+	}
+	else
+	{
+		if (final_url->File().HasSuffix(".m3u8") == true && final_url->File().HasPrefix("chunklist") == false)
+		{
+			session_id_t session_id = connection->GetId();
+			auto session_path_ptr = std::any_cast<info::Session::Path>(connection->GetUserData(stream->GetStreamId()));
+			if (session_path_ptr != nullptr)
 			{
-				logtc("Could not get llhls origin session from pool for request: %s", request->ToString().CStr());
-				response->SetStatusCode(http::StatusCode::InternalServerError);
-				return http::svr::NextHandler::DoNotCall;
+				session = std::static_pointer_cast<LLHlsSession>(GetSession(*session_path_ptr));
+			}
+			else 
+			{
+				session = std::static_pointer_cast<LLHlsSession>(stream->GetSession(session_id));
+			}
+
+			if (session == nullptr || session->GetStream() != stream)
+			{
+				// New HTTP Connection
+				session = LLHlsSession::Create(session_id, origin_mode, "", stream->GetApplication(), stream, request->GetHeader("USER-AGENT"), session_life_time);
+				if (session == nullptr)
+				{
+					logte("Could not create llhls session for request: %s", request->ToString().CStr());
+					response->SetStatusCode(http::StatusCode::InternalServerError);
+					return http::svr::NextHandler::DoNotCall;
+				}
+				session->SetRequestedUrl(requested_url);
+				session->SetFinalUrl(final_url);
+
+				stream->AddSession(session);
 			}
 		}
+		// chunklist_x_x.m3u8?session=<session id>_<key>
+		// x_x_x.m4s?session=<session id>_<key>
 		else
 		{
-			if (final_url->File().HasSuffix(".m3u8") == true && final_url->File().HasPrefix("chunklist") == false)
+			session_id_t session_id = connection->GetId();
+			ov::String session_key;
+			// ?session=<session id>_<key>
+			// This collects them into one session even if one player connects through multiple connections.
+			auto query_string = final_url->GetQueryValue("session");
+			auto id_key = query_string.Split("_");
+			if (id_key.size() != 2)
 			{
-				session_id_t session_id = connection->GetId();
-				auto session_path_ptr = std::any_cast<info::Session::Path>(connection->GetUserData(stream->GetStreamId()));
-				if (session_path_ptr != nullptr)
-				{
-					session = std::static_pointer_cast<LLHlsSession>(GetSession(*session_path_ptr));
-				}
-				else 
+				logte("Invalid session key : %s", final_url->ToUrlString().CStr());
+				response->SetStatusCode(http::StatusCode::Unauthorized);
+				return http::svr::NextHandler::DoNotCall;
+			}
+
+			session_id = ov::Converter::ToUInt32(id_key[0].CStr());
+			session_key = id_key[1];
+
+			session = std::static_pointer_cast<LLHlsSession>(stream->GetSession(session_id));
+			if (session == nullptr)
+			{
+				if (access_control_enabled == true)
 				{
-					session = std::static_pointer_cast<LLHlsSession>(stream->GetSession(session_id));
+					logte("Invalid session_key : %s", final_url->ToUrlString().CStr());
+					response->SetStatusCode(http::StatusCode::Unauthorized);
+					return http::svr::NextHandler::DoNotCall;
 				}
-
-				if (session == nullptr || session->GetStream() != stream)
+				else
 				{
 					// New HTTP Connection
-					session = LLHlsSession::Create(session_id, origin_mode, "", stream->GetApplication(), stream, request->GetHeader("USER-AGENT"), session_life_time);
+					session = LLHlsSession::Create(session_id, origin_mode, session_key, stream->GetApplication(), stream, session_life_time);
 					if (session == nullptr)
 					{
 						logte("Could not create llhls session for request: %s", request->ToString().CStr());
@@ -441,107 +558,23 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 					stream->AddSession(session);
 				}
 			}
-			// chunklist_x_x.m3u8?session=<session id>_<key>
-			// x_x_x.m4s?session=<session id>_<key>
 			else
 			{
-				session_id_t session_id = connection->GetId();
-				ov::String session_key;
-				// ?session=<session id>_<key>
-				// This collects them into one session even if one player connects through multiple connections.
-				auto query_string = final_url->GetQueryValue("session");
-				auto id_key = query_string.Split("_");
-				if (id_key.size() != 2)
+				if (access_control_enabled == true && session_key != session->GetSessionKey())
 				{
-					logte("Invalid session key : %s", final_url->ToUrlString().CStr());
+					logte("Invalid session_key : %s", final_url->ToUrlString().CStr());
 					response->SetStatusCode(http::StatusCode::Unauthorized);
 					return http::svr::NextHandler::DoNotCall;
 				}
-
-				session_id = ov::Converter::ToUInt32(id_key[0].CStr());
-				session_key = id_key[1];
-
-				session = std::static_pointer_cast<LLHlsSession>(stream->GetSession(session_id));
-				if (session == nullptr)
-				{
-					if (access_control_enabled == true)
-					{
-						logte("Invalid session_key : %s", final_url->ToUrlString().CStr());
-						response->SetStatusCode(http::StatusCode::Unauthorized);
-						return http::svr::NextHandler::DoNotCall;
-					}
-					else
-					{
-						// New HTTP Connection
-						session = LLHlsSession::Create(session_id, origin_mode, session_key, stream->GetApplication(), stream, session_life_time);
-						if (session == nullptr)
-						{
-							logte("Could not create llhls session for request: %s", request->ToString().CStr());
-							response->SetStatusCode(http::StatusCode::InternalServerError);
-							return http::svr::NextHandler::DoNotCall;
-						}
-						session->SetRequestedUrl(requested_url);
-						session->SetFinalUrl(final_url);
-
-						stream->AddSession(session);
-					}
-				}
-				else
-				{
-					if (access_control_enabled == true && session_key != session->GetSessionKey())
-					{
-						logte("Invalid session_key : %s", final_url->ToUrlString().CStr());
-						response->SetStatusCode(http::StatusCode::Unauthorized);
-						return http::svr::NextHandler::DoNotCall;
-					}
-				}
 			}
-
-			// It will be used in CloseHandler
-			connection->AddUserData(stream->GetStreamId(), session->GetSessionPath());
-			session->UpdateLastRequest(connection->GetId());
 		}
 
-		stream->SendMessage(session, std::make_any<std::shared_ptr<http::svr::HttpExchange>>(exchange));
-
-		return http::svr::NextHandler::DoNotCallAndDoNotResponse;
-	});
-
-	// Set Close Handler
-	http_interceptor->SetCloseHandler([this](const std::shared_ptr<http::svr::HttpConnection> &connection, PhysicalPortDisconnectReason reason) -> void {
-		for (auto &user_data : connection->GetUserDataMap())
-		{
-			std::shared_ptr<LLHlsSession> session;
-
-			auto session_path_ptr = std::any_cast<info::Session::Path>(&user_data.second);
-			if (session_path_ptr == nullptr)
-			{
-				continue;
-			}
-			
-			session = std::static_pointer_cast<LLHlsSession>(GetSession(*session_path_ptr));
-			if (session != nullptr)
-			{
-				session->OnConnectionDisconnected(connection->GetId());
-				if (session->IsNoConnection())
-				{
-					logtt("llhls session is closed : %u", session->GetId());
-					// Remove session from stream
-					auto stream = session->GetStream();
-					if (stream != nullptr)
-					{
-						auto requested_url = session->GetRequestedUrl();
-						auto final_url = session->GetFinalUrl();
-						auto request_info = std::make_shared<ac::RequestInfo>(requested_url, final_url, connection->GetSocket(), nullptr);
-						request_info->SetUserAgent(session->GetUserAgent());
-						SendCloseAdmissionWebhooks(request_info);
+		// It will be used in CloseHandler
+		connection->AddUserData(stream->GetStreamId(), session->GetSessionPath());
+		session->UpdateLastRequest(connection->GetId());
+	}
 
-						stream->RemoveSession(session->GetId());
-					}
-				}
-			}
-		}
-	});
+	stream->SendMessage(session, std::make_any<std::shared_ptr<http::svr::HttpExchange>>(exchange));
 
-	return http_interceptor;
+	return http::svr::NextHandler::DoNotCallAndDoNotResponse;
 }
\ No newline at end of file
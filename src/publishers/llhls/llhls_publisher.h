@@ -52,6 +52,20 @@ private:
 	bool OnDeletePublisherApplication(const std::shared_ptr<pub::Application> &application) override;
 	std::shared_ptr<LLHlsHttpInterceptor> CreateInterceptor();
 
+	// Called when the AdmissionWebhooks query of a suspended exchange is completed
+	http::svr::NextHandler OnAdmissionWebhooksVerified(const std::shared_ptr<http::svr::HttpExchange> &exchange,
+													   const std::shared_ptr<ov::Url> &requested_url,
+													   std::shared_ptr<ov::Url> final_url,
+													   uint64_t session_life_time,
+													   AccessController::VerificationResult webhooks_result,
+													   const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks);
+	// Serves the request once access control has passed
+	http::svr::NextHandler HandleStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange,
+											   const std::shared_ptr<ov::Url> &requested_url,
+											   const std::shared_ptr<ov::Url> &final_url,
+											   uint64_t session_life_time,
+											   bool access_control_enabled);
+
 	std::mutex _http_server_list_mutex;
 	std::vector<std::shared_ptr<http::svr::HttpServer>> _http_server_list;
 	std::vector<std::shared_ptr<http::svr::HttpsServer>> _https_server_list;
@@ -729,8 +729,17 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 
 	auto response = exchange->GetResponse();
 
+	// A segment that only remains in the DVR storage is sent from its file, honoring the Range header
+	auto file_path = llhls_stream->GetSegmentFilePath(track_id, segment_number);
+
 	// Get the segment
-	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number);
+	auto result = LLHlsStream::RequestResult::Success;
+	std::vector<std::shared_ptr<const ov::Data>> segment;
+	if (file_path.IsEmpty())
+	{
+		std::tie(result, segment) = llhls_stream->GetSegment(track_id, segment_number);
+	}
+
 	if (result == LLHlsStream::RequestResult::Success)
 	{
 		// Send the segment
@@ -767,7 +776,18 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		if (file_path.IsEmpty() == false)
+		{
+			if (response->AppendFile(file_path, exchange->GetRequest()->GetHeader("Range")) == false)
+			{
+				response->SetStatusCode(http::StatusCode::NotFound);
+			}
+		}
+
+		for (const auto &data : segment)
+		{
+			response->AppendData(data);
+		}
 	}
 	else
 	{
@@ -826,7 +846,10 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(partial_segment);
+		for (const auto &data : partial_segment)
+		{
+			response->AppendData(data);
+		}
 	}
 	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
 	{
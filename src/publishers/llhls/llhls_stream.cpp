@@ -204,6 +204,7 @@ bool LLHlsStream::Start()
 	_storage_config.dvr_storage_path = dvr_config.GetTempStoragePath();
 	_storage_config.dvr_duration_sec = dvr_config.GetMaxDuration();
 	_storage_config.server_time_based_segment_numbering = llhls_config.IsServerTimeBasedSegmentNumbering();
+	_storage_config.memory_account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::Fmp4Storage, GetUri());
 
 	_configured_part_hold_back = llhls_config.GetPartHoldBack();
 	_preload_hint_enabled = llhls_config.IsPreloadHintEnabled();
@@ -1077,26 +1078,37 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, section};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
+std::tuple<LLHlsStream::RequestResult, std::vector<std::shared_ptr<const ov::Data>>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
 {
 	auto storage = GetStorage(track_id);
 	if (storage == nullptr)
 	{
 		logtw("Could not find storage for track_id = %d", track_id);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
 	auto segment = storage->GetSegment(segment_number);
 	if (segment == nullptr)
 	{
 		logtw("Could not find segment for track_id = %d, segment = %ld (last_segment = %ld)", track_id, segment_number, storage->GetLastSegmentNumber());
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
-	return {RequestResult::Success, segment->GetData()};
+	return {RequestResult::Success, segment->GetDataList()};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const
+ov::String LLHlsStream::GetSegmentFilePath(const int32_t &track_id, const int64_t &segment_number) const
+{
+	auto storage = GetFmp4Storage(track_id);
+	if (storage == nullptr)
+	{
+		return "";
+	}
+
+	return storage->GetDvrSegmentFilePath(segment_number);
+}
+
+std::tuple<LLHlsStream::RequestResult, std::vector<std::shared_ptr<const ov::Data>>> LLHlsStream::GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const
 {
 	logtt("LLHlsStream(%s) - GetChunk(%d, %ld, %ld)", GetName().CStr(), track_id, segment_number, partial_number);
 
@@ -1104,7 +1116,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	if (storage == nullptr)
 	{
 		logtw("Could not find storage for track_id = %d", track_id);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
 	auto [last_segment_number, last_partial_number] = storage->GetLastPartialSegmentNumber();
@@ -1113,7 +1125,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	{
 		logtt("Accepted chunk for track_id = %d, segment = %ld, chunk = %ld (last_segment = %ld, last_chunk = %ld)", track_id, segment_number, partial_number, last_segment_number, last_partial_number);
 		// Hold the request until a Playlist contains a Segment with the requested Sequence Number
-		return {RequestResult::Accepted, nullptr};
+		return {RequestResult::Accepted, {}};
 	}
 	else
 	{
@@ -1124,10 +1136,10 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	if (partial == nullptr)
 	{
 		logtw("Could not find partial segment for track_id = %d, segment = %ld, partial = %ld (last_segment = %ld, last_partial = %ld)", track_id, segment_number, partial_number, last_segment_number, last_partial_number);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}};
 	}
 
-	return {RequestResult::Success, partial->GetData()};
+	return {RequestResult::Success, partial->GetDataList()};
 }
 
 void LLHlsStream::BufferMediaPacketUntilReadyToPlay(const std::shared_ptr<MediaPacket> &media_packet)
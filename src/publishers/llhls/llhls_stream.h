@@ -79,8 +79,11 @@ public:
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id, uint32_t track_version) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
+	// Segments and partial segments are returned as the list of pieces they are stored in
+	std::tuple<RequestResult, std::vector<std::shared_ptr<const ov::Data>>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
+	// Path of the DVR file of a segment that is served from disk, or an empty string if it is in memory
+	ov::String GetSegmentFilePath(const int32_t &track_id, const int64_t &segment_number) const;
+	std::tuple<RequestResult, std::vector<std::shared_ptr<const ov::Data>>> GetPartial(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
 
 	//////////////////////////
 	// For Dump API
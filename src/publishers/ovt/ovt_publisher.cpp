@@ -295,7 +295,18 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 	ov::String msg;
 
 	auto stream = std::static_pointer_cast<OvtStream>(GetStream(vhost_app_name, stream_name));
-	if (stream == nullptr)
+	if ((stream == nullptr) && (orchestrator->GetOriginMapStoreRelayTier(vhost_app_name) > 0))
+	{
+		// A relay pulls the stream from its upstream (see Publisher::PullStream()) for the next tier
+		stream = std::static_pointer_cast<OvtStream>(PullStream(url, vhost_app_name, host_name, stream_name));
+		if (stream == nullptr)
+		{
+			msg.Format("There is no such stream (%s/%s)", vhost_app_name.CStr(), url->Stream().CStr());
+			ResponseResult(remote, 0, "describe", request_id, 404, msg);
+			return;
+		}
+	}
+	else if (stream == nullptr)
 	{
 		// If the stream does not exists, request to the provider
 		auto error = orchestrator->RequestPullStreamWithOriginMap(url, vhost_app_name, stream_name);
@@ -17,6 +17,14 @@ std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Applic
 	{
 		return nullptr;
 	}
+
+	auto budget = connector->GetSendQueueBudget();
+	budget.max_bytes = SEND_QUEUE_MAX_BYTES;
+	budget.high_watermark_bytes = SEND_QUEUE_HIGH_WATERMARK_BYTES;
+	budget.low_watermark_bytes = SEND_QUEUE_LOW_WATERMARK_BYTES;
+	connector->SetSendQueueObserver(session);
+	connector->SetSendQueueBudget(budget);
+
 	return session;
 }
 
@@ -50,6 +58,17 @@ bool OvtSession::Stop()
 {
 	logtt("OvtSession(%d) has stopped", GetId());
 	_connector->Close();
+
+	{
+		ov::ScopedLock lock(_track_set_filter_mutex);
+
+		if (_dropped_video_frame_count > 0)
+		{
+			logti("OvtSession(%u) dropped %" PRIu64 " video frames while %s was falling behind",
+				  GetId(), _dropped_video_frame_count, _connector->ToString().CStr());
+			_dropped_video_frame_count = 0;
+		}
+	}
 	
 	return Session::Stop();
 }
@@ -83,57 +102,27 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// TrackSet filter (applied only to media packets; signaling packets are payload type
-	// MESSAGE_RESPONSE and are sent via OvtPublisher::SendResponse, not this path).
+	// TrackSet filter and congestion control (applied only to media packets; signaling packets are
+	// payload type MESSAGE_RESPONSE and are sent via OvtPublisher::SendResponse, not this path).
+	if (session_packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
 	{
 		ov::ScopedLock lock(_track_set_filter_mutex);
 
-		if (_track_set_filter_enabled &&
-			session_packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+		if (_current_group_decision == GroupDecision::Pending)
 		{
-			if (_current_group_decision == GroupDecision::Pending)
-			{
-				if (session_packet->PayloadLength() >= 4 && session_packet->Payload() != nullptr)
-				{
-					uint32_t track_id = ByteReader<uint32_t>::ReadBigEndian(session_packet->Payload());
-					if (_allowed_track_ids.find(track_id) != _allowed_track_ids.end())
-					{
-						_current_group_decision = GroupDecision::Accept;
-					}
-					else
-					{
-						_current_group_decision = GroupDecision::Drop;
-					}
-				}
-				else
-				{
-					// Malformed first fragment; drop conservatively.
-					if (_warned_malformed_first_fragment == false)
-					{
-						_warned_malformed_first_fragment = true;
-						logtw(
-							"OvtSession(%u) received a malformed first fragment from %s "
-							"(payload_length=%u, payload=%s); dropping. Further occurrences will be suppressed.",
-							GetId(),
-							_connector != nullptr ? _connector->ToString().CStr() : "<unknown>",
-							session_packet->PayloadLength(),
-							session_packet->Payload() != nullptr ? "non-null" : "null");
-					}
-					_current_group_decision = GroupDecision::Drop;
-				}
-			}
+			_current_group_decision = DecideGroup(session_packet);
+		}
 
-			bool drop = (_current_group_decision == GroupDecision::Drop);
+		bool drop = (_current_group_decision == GroupDecision::Drop);
 
-			if (session_packet->Marker() == true)
-			{
-				_current_group_decision = GroupDecision::Pending;
-			}
+		if (session_packet->Marker() == true)
+		{
+			_current_group_decision = GroupDecision::Pending;
+		}
 
-			if (drop)
-			{
-				return;
-			}
+		if (drop)
+		{
+			return;
 		}
 	}
 
@@ -144,6 +133,92 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 	_connector->Send(copy_packet->GetData());
 }
 
+OvtSession::GroupDecision OvtSession::DecideGroup(const std::shared_ptr<OvtPacket> &first_fragment)
+{
+	auto payload = first_fragment->Payload();
+	auto payload_length = first_fragment->PayloadLength();
+
+	if (_track_set_filter_enabled)
+	{
+		if (payload_length >= 4 && payload != nullptr)
+		{
+			uint32_t track_id = ByteReader<uint32_t>::ReadBigEndian(payload);
+			if (_allowed_track_ids.find(track_id) == _allowed_track_ids.end())
+			{
+				return GroupDecision::Drop;
+			}
+		}
+		else
+		{
+			// Malformed first fragment; drop conservatively.
+			if (_warned_malformed_first_fragment == false)
+			{
+				_warned_malformed_first_fragment = true;
+				logtw(
+					"OvtSession(%u) received a malformed first fragment from %s "
+					"(payload_length=%u, payload=%s); dropping. Further occurrences will be suppressed.",
+					GetId(),
+					_connector != nullptr ? _connector->ToString().CStr() : "<unknown>",
+					payload_length,
+					payload != nullptr ? "non-null" : "null");
+			}
+			return GroupDecision::Drop;
+		}
+	}
+
+	// See OvtPacketizer for the layout of the serialized MediaPacket header
+	if ((payload_length < MEDIA_PACKET_HEADER_SIZE) || (payload == nullptr))
+	{
+		return GroupDecision::Accept;
+	}
+
+	auto media_type = static_cast<cmn::MediaType>(ByteReader<uint8_t>::ReadBigEndian(&payload[MEDIA_PACKET_MEDIA_TYPE_OFFSET]));
+	auto media_flag = static_cast<MediaPacketFlag>(ByteReader<uint8_t>::ReadBigEndian(&payload[MEDIA_PACKET_MEDIA_FLAG_OFFSET]));
+
+	// Audio and data are small, and a gap in them is not carried over to the following frames
+	if (media_type != cmn::MediaType::Video)
+	{
+		return GroupDecision::Accept;
+	}
+
+	if (_send_queue_congested)
+	{
+		// Whatever depends on this frame can no longer be decoded either
+		_skip_video_until_keyframe = true;
+		_dropped_video_frame_count++;
+		return GroupDecision::Drop;
+	}
+
+	if (_skip_video_until_keyframe)
+	{
+		if (media_flag != MediaPacketFlag::Key)
+		{
+			_dropped_video_frame_count++;
+			return GroupDecision::Drop;
+		}
+
+		_skip_video_until_keyframe = false;
+		logtd("OvtSession(%u) resumes video at a keyframe (%" PRIu64 " frames dropped so far)", GetId(), _dropped_video_frame_count);
+	}
+
+	return GroupDecision::Accept;
+}
+
+void OvtSession::OnSendQueueCongested(size_t queued_bytes)
+{
+	logtw("OvtSession(%u) is falling behind (%zu bytes queued) - Video will be dropped until it catches up (%s)",
+		  GetId(), queued_bytes, _connector->ToString().CStr());
+
+	_send_queue_congested = true;
+}
+
+void OvtSession::OnSendQueueDrained(size_t queued_bytes)
+{
+	logti("OvtSession(%u) has caught up (%zu bytes queued) - Video resumes at the next keyframe", GetId(), queued_bytes);
+
+	_send_queue_congested = false;
+}
+
 void OvtSession::SetAllowedTrackIds(const std::set<uint32_t> &allowed_track_ids)
 {
 	ov::ScopedLock lock(_track_set_filter_mutex);
@@ -3,10 +3,19 @@
 #include <base/info/media_track.h>
 #include <base/ovsocket/socket.h>
 #include <base/publisher/session.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
 
-class OvtSession : public pub::Session
+// The session watches the send queue of its connection. While the edge falls behind, video is
+// dropped in whole frames, and resumes at the next keyframe once the queue has drained.
+class OvtSession : public pub::Session, public ov::SocketSendQueueObserver
 {
 public:
+	// Per-connection send queue watermarks, and the hard bound at which an edge that cannot
+	// catch up is disconnected
+	static constexpr size_t SEND_QUEUE_MAX_BYTES = 32 * 1024 * 1024;
+	static constexpr size_t SEND_QUEUE_HIGH_WATERMARK_BYTES = 8 * 1024 * 1024;
+	static constexpr size_t SEND_QUEUE_LOW_WATERMARK_BYTES = 2 * 1024 * 1024;
+
 	static std::shared_ptr<OvtSession> Create(const std::shared_ptr<pub::Application> &application,
 											  const std::shared_ptr<pub::Stream> &stream,
 											  uint32_t ovt_session_id,
@@ -31,6 +40,12 @@ public:
 	// are dropped). If this is never called, no filtering is applied.
 	void SetAllowedTrackIds(const std::set<uint32_t> &allowed_track_ids);
 
+	//--------------------------------------------------------------------
+	// Implementation of ov::SocketSendQueueObserver
+	//--------------------------------------------------------------------
+	void OnSendQueueCongested(size_t queued_bytes) override;
+	void OnSendQueueDrained(size_t queued_bytes) override;
+
 private:
 	// Per-fragment-group filtering decision used by SendOutgoingData.
 	//
@@ -71,4 +86,13 @@ private:
 	GroupDecision _current_group_decision OV_GUARDED_BY(_track_set_filter_mutex) = GroupDecision::Pending;
 	// One-shot guard to avoid log spam when the first fragment is malformed.
 	bool _warned_malformed_first_fragment OV_GUARDED_BY(_track_set_filter_mutex) = false;
+
+	// Decides whether the fragment group starting with <first_fragment> is forwarded
+	GroupDecision DecideGroup(const std::shared_ptr<OvtPacket> &first_fragment) OV_REQUIRES(_track_set_filter_mutex);
+
+	// Set by the socket worker while the send queue is above the watermark
+	std::atomic<bool> _send_queue_congested{false};
+	// Video was dropped, so the next video frame sent must be a keyframe
+	bool _skip_video_until_keyframe OV_GUARDED_BY(_track_set_filter_mutex) = false;
+	uint64_t _dropped_video_frame_count OV_GUARDED_BY(_track_set_filter_mutex) = 0;
 };
@@ -11,6 +11,7 @@
 #include <base/ovlibrary/clock.h>
 #include <base/ovlibrary/json.h>
 #include <modules/ovt_packetizer/ovt_packet.h>
+#include <modules/ovt_packetizer/ovt_relay_fragments.h>
 #include <modules/ovt_packetizer/ovt_signaling.h>
 #include <orchestrator/orchestrator.h>
 
@@ -55,6 +56,15 @@ bool OvtStream::Start()
 			logtw("Failed to register stream to origin map store : %s/%s", GetApplicationName(), GetName().CStr());
 		}
 	}
+	else
+	{
+		// Serve the stream to the next relay tier, if this server is a relay
+		auto result = ocst::Orchestrator::GetInstance()->RegisterRelayToOriginMapStore(GetApplicationInfo().GetVHostAppName(), GetName());
+		if (result == CommonErrorCode::ERROR)
+		{
+			logtw("Failed to register relay to origin map store : %s/%s", GetApplicationName(), GetName().CStr());
+		}
+	}
 
 	if(!CreateStreamWorker(_worker_count))
 	{
@@ -76,6 +86,12 @@ bool OvtStream::Stop()
 
 	logtt("OvtStream(%u) has been stopped", GetId());
 
+	if(_relayed_frame_count > 0)
+	{
+		logti("OvtStream(%s/%s) relayed %" PRIu64 " frames as received, and packetized %" PRIu64 " frames",
+			  GetApplicationName(), GetName().CStr(), _relayed_frame_count.load(), _packetized_frame_count.load());
+	}
+
 	if (GetLinkedInputStream() != nullptr && GetLinkedInputStream()->IsFromOriginMapStore() == false)
 	{
 		// Unegister stream if OriginMapStore is enabled
@@ -86,6 +102,14 @@ bool OvtStream::Stop()
 			return false;
 		}
 	}
+	else if (GetLinkedInputStream() != nullptr)
+	{
+		auto result = ocst::Orchestrator::GetInstance()->UnregisterRelayFromOriginMapStore(GetApplicationInfo().GetVHostAppName(), GetName());
+		if (result == CommonErrorCode::ERROR)
+		{
+			logtw("Failed to unregister relay from origin map store : %s/%s", GetApplicationName(), GetName().CStr());
+		}
+	}
 
 	std::unique_lock<std::shared_mutex> mlock(_packetizer_lock);
 	if(_packetizer != nullptr)
@@ -120,6 +144,19 @@ bool OvtStream::GenerateDescription(Json::Value &out_description)
 		json_stream["originStreamUUID"] = GetUUID().CStr();
 	}
 
+	// Servers the stream has been sent over OVT by, including this one, so that a relay loop can be
+	// detected by the receiver
+	Json::Value json_relay_path(Json::arrayValue);
+	if (GetLinkedInputStream() != nullptr)
+	{
+		for (const auto &hop : GetLinkedInputStream()->GetRelayPath())
+		{
+			json_relay_path.append(hop.CStr());
+		}
+	}
+	json_relay_path.append(GetApplicationInfo().GetHostInfo().GetUUID().CStr());
+	json_stream["relayPath"] = json_relay_path;
+
 	for(const auto &[file_name, playlist] : GetPlaylists())
 	{
 		Json::Value json_playlist;
@@ -278,12 +315,7 @@ void OvtStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
 
 	//logti("Recv Video Frame : pts(%" PRId64 ") data_len(%" PRId64 ")", media_packet->GetPts(), media_packet->GetDataLength());
 
-	// Callback OnOvtPacketized()
-	std::shared_lock<std::shared_mutex> mlock(_packetizer_lock);
-	if(_packetizer != nullptr)
-	{
-		_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
-	}
+	SendMediaPacket(media_packet);
 }
 
 void OvtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
@@ -293,12 +325,49 @@ void OvtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
 		return;
 	}
 
-	// Callback OnOvtPacketized()
+	SendMediaPacket(media_packet);
+}
+
+void OvtStream::SendMediaPacket(const std::shared_ptr<MediaPacket> &media_packet)
+{
 	std::shared_lock<std::shared_mutex> mlock(_packetizer_lock);
-	if(_packetizer != nullptr)
+	if(_packetizer == nullptr)
+	{
+		return;
+	}
+
+	if(RelayMediaPacket(media_packet))
+	{
+		_relayed_frame_count++;
+		return;
+	}
+
+	// Callback OnOvtPacketized()
+	_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
+	_packetized_frame_count++;
+}
+
+bool OvtStream::RelayMediaPacket(const std::shared_ptr<MediaPacket> &media_packet)
+{
+	auto fragments = media_packet->GetOvtRelayFragments();
+	if(fragments == nullptr)
 	{
-		_packetizer->PacketizeMediaPacket(media_packet->GetPts(), media_packet);
+		return false;
 	}
+
+	auto packets = fragments->GetPacketsFor(*media_packet);
+	if(packets.empty())
+	{
+		return false;
+	}
+
+	// The packets are shared by the sessions and never modified, see OvtSession::SendOutgoingData()
+	for(auto &packet : packets)
+	{
+		OnOvtPacketized(packet);
+	}
+
+	return true;
 }
 
 bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
@@ -44,6 +44,11 @@ private:
 	// so a runtime change (codec, resolution, decoder config) is applied there.
 	void OnTrackChanged(int32_t track_id, const std::shared_ptr<const MediaTrack> &old_track, const std::shared_ptr<const MediaTrack> &new_track) override;
 
+	// Sends the OVT packets <media_packet> was received in, if this stream relays an OVT stream
+	// and the packet still carries the data they arrived with. Returns false otherwise.
+	bool RelayMediaPacket(const std::shared_ptr<MediaPacket> &media_packet);
+	void SendMediaPacket(const std::shared_ptr<MediaPacket> &media_packet);
+
 	bool GenerateDescription(Json::Value &out_description);
 	void GenerateTrackDescription(const std::shared_ptr<const MediaTrack> &track, Json::Value &out_json_track);
 	void FilterDescriptionByTrackIds(Json::Value &description, const std::set<uint32_t> &allowed_track_ids);
@@ -52,4 +57,8 @@ private:
 
 	std::shared_mutex					_packetizer_lock;
 	std::shared_ptr<OvtPacketizer>		_packetizer;
+
+	// Number of frames forwarded as received, and packetized again
+	std::atomic<uint64_t>				_relayed_frame_count{0};
+	std::atomic<uint64_t>				_packetized_frame_count{0};
 };
@@ -95,7 +95,14 @@ namespace pub
 			const size_t current  = _data_to_send->GetLength();
 			const size_t avail    = total - offset;
 
-			if (current + avail >= SRT_LIVE_DEF_PLSIZE)
+			if ((current == 0) && (avail >= SRT_LIVE_DEF_PLSIZE))
+			{
+				// The TS packets of a frame are written into one buffer by the packetizer,
+				// so a whole datagram is sent as a slice of it without copying
+				_sink->OnSrtPlaylistData(self, ts_data->Subdata(offset, SRT_LIVE_DEF_PLSIZE));
+				offset += SRT_LIVE_DEF_PLSIZE;
+			}
+			else if (current + avail >= SRT_LIVE_DEF_PLSIZE)
 			{
 				// Fill the current buffer to exactly SRT_LIVE_DEF_PLSIZE and send it
 				const size_t to_fill = SRT_LIVE_DEF_PLSIZE - current;
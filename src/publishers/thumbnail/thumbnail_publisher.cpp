@@ -96,6 +96,8 @@ bool ThumbnailPublisher::Start()
 		return true;
 	}
 
+	_image_wait_timer.Start();
+
 	return PrepareHttpServers(
 			   server_config.GetIPList(),
 			   is_port_configured, port_config.GetPort(),
@@ -116,6 +118,8 @@ bool ThumbnailPublisher::Stop()
 	manager->ReleaseServers(&http_server_list);
 	manager->ReleaseServers(&https_server_list);
 
+	_image_wait_timer.Stop();
+
 	return Publisher::Stop();
 }
 
@@ -217,10 +221,6 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		info::VHostAppName vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
-		ov::String host_name = request_url->Host();
-		ov::String stream_name = request_url->Stream();
-
 		// Don't validate vhost_app_name here, it can be changed by AdmissionWebhooks
 		// And the application may not exist here, it can be created by PullStream 
 
@@ -251,132 +251,21 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 			}
 
 			// Admission Webhooks
-			auto [webhooks_result, admission_webhooks] = VerifyByAdmissionWebhooks(request_info);
-			if (webhooks_result == AccessController::VerificationResult::Off)
-			{
-				// Success
-			}
-			else if (webhooks_result == AccessController::VerificationResult::Pass)
-			{
-				// Redirect URL
-				if (admission_webhooks->GetNewURL() != nullptr)
+			// The exchange is suspended while the control server is queried, so the socket worker can serve other connections
+			VerifyByAdmissionWebhooksAsync(request_info, [this, exchange, request_url](AccessController::VerificationResult webhooks_result, const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks) {
+				auto next_handler = OnAdmissionWebhooksVerified(exchange, request_url, webhooks_result, admission_webhooks);
+
+				if (next_handler != http::svr::NextHandler::DoNotCallAndDoNotResponse)
 				{
-					request_url = admission_webhooks->GetNewURL();
-					if (request_url->Port() == 0)
-					{
-						request_url->SetPort(request->GetRemote()->GetLocalAddress()->Port());
-					}
-
-					vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
-					host_name = request_url->Host();
-					stream_name = request_url->Stream();
+					exchange->GetResponse()->Response();
+					exchange->Release();
 				}
-			}
-			else if (webhooks_result == AccessController::VerificationResult::Error)
-			{
-				logtw("AdmissionWebhooks error : %s", request_url->ToUrlString().CStr());
-				response->AppendString(ov::String::FormatString("AdmissionWebhooks error"));
-				response->SetStatusCode(http::StatusCode::Unauthorized);
-				return http::svr::NextHandler::DoNotCall;
-			}
-			else if (webhooks_result == AccessController::VerificationResult::Fail)
-			{
-				logtw("AdmissionWebhooks error : %s", admission_webhooks->GetErrReason().CStr());
-				response->AppendString(ov::String::FormatString("Unauthorized"));
-				response->SetStatusCode(http::StatusCode::Unauthorized);
-				return http::svr::NextHandler::DoNotCall;
-			}
-		}
-
-		if (vhost_app_name.IsValid() == false)
-		{
-			logte("Could not resolve application name from domain: %s", request_url->Host().CStr());
-			response->AppendString("Could not resolve application name from domain");
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;
-		}
-
-		// PullStream may create the app from the wildcard template
-		auto application = std::static_pointer_cast<ThumbnailApplication>(GetApplicationByName(vhost_app_name));
-		auto stream = GetStream(vhost_app_name, request_url->Stream());
-		if (stream == nullptr)
-		{
-			stream = PullStream(request_url, vhost_app_name, host_name, stream_name);
-			if (stream != nullptr && application == nullptr)
-			{
-				application = std::static_pointer_cast<ThumbnailApplication>(GetApplicationByName(vhost_app_name));
-			}
-		}
-
-		// Apply CORS once the application is known so error responses still carry the headers
-		if (application != nullptr)
-		{
-			application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response);
-		}
-
-		if (application == nullptr || stream == nullptr)
-		{
-			logte("There is no stream or cannot pull a stream. stream(%s)", request_url->Stream().CStr());
-			response->AppendString("There is no stream or cannot pull a stream");
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;
-		}
+			});
 
-		if(stream->GetState() != pub::Stream::State::STARTED)
-		{
-			logte("The stream has not started. stream(%s)", request_url->Stream().CStr());
-			response->AppendString("The stream has not started");
-			response->SetStatusCode(http::StatusCode::NotFound);			
-			return http::svr::NextHandler::DoNotCall;
+			return http::svr::NextHandler::DoNotCallAndDoNotResponse;
 		}
 
-		// Check Extentions
-		auto media_codec_id = cmn::MediaCodecId::None;
-		if (request_url->File().LowerCaseString().IndexOf(".jpg") >= 0)
-		{
-			media_codec_id = cmn::MediaCodecId::Jpeg;
-		}
-		else if (request_url->File().LowerCaseString().IndexOf(".png") >= 0)
-		{
-			media_codec_id = cmn::MediaCodecId::Png;
-		}
-		else if (request_url->File().LowerCaseString().IndexOf(".avif") >= 0)
-		{
-			media_codec_id = cmn::MediaCodecId::Avif;
-		}
-		else if (request_url->File().LowerCaseString().IndexOf(".webp") >= 0)
-		{
-			media_codec_id = cmn::MediaCodecId::Webp;
-		}		
-		else 
-		{
-			response->AppendString(ov::String::FormatString("Unsupported file extension"));
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;	
-		}
-
-		// Do not wait here, this handler runs on the socket worker thread
-		// TODO(Keukhan): PullStream() and AdmissionWebhooks still block it, handle this on a worker thread
-		auto encoded_video_frame = std::static_pointer_cast<ThumbnailStream>(stream)->GetVideoFrameByCodecId(media_codec_id, 0);
-		if (encoded_video_frame == nullptr)
-		{
-			response->AppendString(ov::String::FormatString("There is no thumbnail image"));
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;
-		}
-
-		response->SetHeader("Content-Type", MimeTypeFromMediaCodecId(media_codec_id));
-		response->SetStatusCode(http::StatusCode::OK);
-		response->AppendData(encoded_video_frame);
-		auto sent_size = response->Response();
-		exchange->Release();
-
-		if (sent_size > 0)
-		{
-			MonitorInstance->IncreaseBytesOut(*stream, PublisherType::Thumbnail, sent_size);
-		}
-		
-		return http::svr::NextHandler::DoNotCall;
+		return HandleThumbnailRequest(exchange, request_url);
 	});
 
 	// Register Preflight interceptor
@@ -424,6 +313,200 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 	return http_interceptor;
 }
 
+http::svr::NextHandler ThumbnailPublisher::OnAdmissionWebhooksVerified(const std::shared_ptr<http::svr::HttpExchange> &exchange,
+	std::shared_ptr<ov::Url> request_url,
+	AccessController::VerificationResult webhooks_result,
+	const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks)
+{
+	auto request = exchange->GetRequest();
+	auto response = exchange->GetResponse();
+
+	if (webhooks_result == AccessController::VerificationResult::Off)
+	{
+		// Success
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Pass)
+	{
+		// Redirect URL
+		if (admission_webhooks->GetNewURL() != nullptr)
+		{
+			request_url = admission_webhooks->GetNewURL();
+			if (request_url->Port() == 0)
+			{
+				request_url->SetPort(request->GetRemote()->GetLocalAddress()->Port());
+			}
+		}
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Error)
+	{
+		logtw("AdmissionWebhooks error : %s", request_url->ToUrlString().CStr());
+		response->AppendString(ov::String::FormatString("AdmissionWebhooks error"));
+		response->SetStatusCode(http::StatusCode::Unauthorized);
+		return http::svr::NextHandler::DoNotCall;
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Fail)
+	{
+		logtw("AdmissionWebhooks error : %s", admission_webhooks->GetErrReason().CStr());
+		response->AppendString(ov::String::FormatString("Unauthorized"));
+		response->SetStatusCode(http::StatusCode::Unauthorized);
+		return http::svr::NextHandler::DoNotCall;
+	}
+
+	return HandleThumbnailRequest(exchange, request_url);
+}
+
+http::svr::NextHandler ThumbnailPublisher::HandleThumbnailRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const std::shared_ptr<ov::Url> &request_url)
+{
+	auto request = exchange->GetRequest();
+	auto response = exchange->GetResponse();
+
+	info::VHostAppName vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
+	ov::String host_name = request_url->Host();
+	ov::String stream_name = request_url->Stream();
+
+	if (vhost_app_name.IsValid() == false)
+	{
+		logte("Could not resolve application name from domain: %s", request_url->Host().CStr());
+		response->AppendString("Could not resolve application name from domain");
+		response->SetStatusCode(http::StatusCode::NotFound);
+		return http::svr::NextHandler::DoNotCall;
+	}
+
+	// PullStream may create the app from the wildcard template
+	auto application = std::static_pointer_cast<ThumbnailApplication>(GetApplicationByName(vhost_app_name));
+	auto stream = GetStream(vhost_app_name, request_url->Stream());
+	if (stream == nullptr)
+	{
+		stream = PullStream(request_url, vhost_app_name, host_name, stream_name);
+		if (stream != nullptr && application == nullptr)
+		{
+			application = std::static_pointer_cast<ThumbnailApplication>(GetApplicationByName(vhost_app_name));
+		}
+	}
+
+	// Apply CORS once the application is known so error responses still carry the headers
+	if (application != nullptr)
+	{
+		application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response);
+	}
+
+	if (application == nullptr || stream == nullptr)
+	{
+		logte("There is no stream or cannot pull a stream. stream(%s)", request_url->Stream().CStr());
+		response->AppendString("There is no stream or cannot pull a stream");
+		response->SetStatusCode(http::StatusCode::NotFound);
+		return http::svr::NextHandler::DoNotCall;
+	}
+
+	if(stream->GetState() != pub::Stream::State::STARTED)
+	{
+		logte("The stream has not started. stream(%s)", request_url->Stream().CStr());
+		response->AppendString("The stream has not started");
+		response->SetStatusCode(http::StatusCode::NotFound);			
+		return http::svr::NextHandler::DoNotCall;
+	}
+
+	// Check Extentions
+	auto media_codec_id = cmn::MediaCodecId::None;
+	if (request_url->File().LowerCaseString().IndexOf(".jpg") >= 0)
+	{
+		media_codec_id = cmn::MediaCodecId::Jpeg;
+	}
+	else if (request_url->File().LowerCaseString().IndexOf(".png") >= 0)
+	{
+		media_codec_id = cmn::MediaCodecId::Png;
+	}
+	else if (request_url->File().LowerCaseString().IndexOf(".avif") >= 0)
+	{
+		media_codec_id = cmn::MediaCodecId::Avif;
+	}
+	else if (request_url->File().LowerCaseString().IndexOf(".webp") >= 0)
+	{
+		media_codec_id = cmn::MediaCodecId::Webp;
+	}		
+	else 
+	{
+		response->AppendString(ov::String::FormatString("Unsupported file extension"));
+		response->SetStatusCode(http::StatusCode::NotFound);
+		return http::svr::NextHandler::DoNotCall;	
+	}
+
+	auto thumbnail_stream = std::static_pointer_cast<ThumbnailStream>(stream);
+
+	// On-demand mode: every request keeps the image encoder running, and the request that
+	// ends an idle period wakes it up
+	auto demand = info::ThumbnailDemand::GetInstance()->Request(vhost_app_name, stream->GetName(), media_codec_id);
+
+	// Do not wait here, this handler runs on the socket worker thread
+	auto encoded_video_frame = thumbnail_stream->GetVideoFrameByCodecId(media_codec_id, 0);
+
+	// The cached image predates the wakeup, so the request waits for the image being encoded.
+	// Requests arriving meanwhile join the wait instead of getting the stale image.
+	if ((demand == info::ThumbnailDemand::RequestResult::Activated) ||
+		((demand == info::ThumbnailDemand::RequestResult::Active) &&
+		 ((encoded_video_frame == nullptr) || thumbnail_stream->IsWaitingForVideoFrame(media_codec_id))))
+	{
+		std::weak_ptr<pub::Stream> weak_stream = stream;
+
+		auto waiter_id = thumbnail_stream->WaitForNextVideoFrame(media_codec_id, [this, exchange, weak_stream, media_codec_id](const std::shared_ptr<ov::Data> &image) {
+			SendThumbnailResponse(exchange, weak_stream.lock(), media_codec_id, image);
+		});
+
+		// If the encoder does not deliver in time, the request gets the cached image
+		std::weak_ptr<ThumbnailStream> weak_thumbnail_stream = thumbnail_stream;
+		_image_wait_timer.Push(
+			[weak_thumbnail_stream, media_codec_id, waiter_id](void *parameter) -> ov::DelayQueueAction {
+				auto thumbnail_stream = weak_thumbnail_stream.lock();
+				if (thumbnail_stream != nullptr)
+				{
+					thumbnail_stream->ExpireImageWaiter(media_codec_id, waiter_id);
+				}
+
+				return ov::DelayQueueAction::Stop;
+			},
+			application->GetConfig().GetPublishers().GetThumbnailPublisher().GetOnDemand().GetWaitTimeout());
+
+		return http::svr::NextHandler::DoNotCallAndDoNotResponse;
+	}
+
+	if (encoded_video_frame == nullptr)
+	{
+		response->AppendString(ov::String::FormatString("There is no thumbnail image"));
+		response->SetStatusCode(http::StatusCode::NotFound);
+		return http::svr::NextHandler::DoNotCall;
+	}
+
+	SendThumbnailResponse(exchange, stream, media_codec_id, encoded_video_frame);
+
+	return http::svr::NextHandler::DoNotCall;
+}
+
+void ThumbnailPublisher::SendThumbnailResponse(const std::shared_ptr<http::svr::HttpExchange> &exchange, const std::shared_ptr<pub::Stream> &stream,
+											   cmn::MediaCodecId media_codec_id, const std::shared_ptr<ov::Data> &image)
+{
+	auto response = exchange->GetResponse();
+
+	if (image == nullptr)
+	{
+		response->AppendString(ov::String::FormatString("There is no thumbnail image"));
+		response->SetStatusCode(http::StatusCode::NotFound);
+	}
+	else
+	{
+		response->SetHeader("Content-Type", MimeTypeFromMediaCodecId(media_codec_id));
+		response->SetStatusCode(http::StatusCode::OK);
+		response->AppendData(image);
+	}
+
+	auto sent_size = response->Response();
+	exchange->Release();
+
+	if ((sent_size > 0) && (stream != nullptr))
+	{
+		MonitorInstance->IncreaseBytesOut(*stream, PublisherType::Thumbnail, sent_size);
+	}
+}
+
 ov::String ThumbnailPublisher::MimeTypeFromMediaCodecId(const cmn::MediaCodecId &type)
 {
 	switch (type)
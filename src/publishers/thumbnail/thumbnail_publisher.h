@@ -5,6 +5,7 @@
 
 #include "base/common_types.h"
 #include "base/info/record.h"
+#include "base/info/thumbnail_demand.h"
 #include "base/mediarouter/mediarouter_application_interface.h"
 #include "base/ovlibrary/url.h"
 #include "base/publisher/publisher.h"
@@ -52,7 +53,21 @@ private:
 private:
 	std::shared_ptr<ThumbnailInterceptor> CreateInterceptor();
 
+	// Called when the AdmissionWebhooks query of a suspended exchange is completed
+	http::svr::NextHandler OnAdmissionWebhooksVerified(const std::shared_ptr<http::svr::HttpExchange> &exchange,
+													   std::shared_ptr<ov::Url> request_url,
+													   AccessController::VerificationResult webhooks_result,
+													   const std::shared_ptr<const AdmissionWebhooks> &admission_webhooks);
+	// Serves the thumbnail once access control has passed
+	http::svr::NextHandler HandleThumbnailRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const std::shared_ptr<ov::Url> &request_url);
+	// Responds with the image (404 if nullptr) and releases the exchange
+	void SendThumbnailResponse(const std::shared_ptr<http::svr::HttpExchange> &exchange, const std::shared_ptr<pub::Stream> &stream,
+							   cmn::MediaCodecId media_codec_id, const std::shared_ptr<ov::Data> &image);
+
 	std::mutex _http_server_list_mutex;
 	std::vector<std::shared_ptr<http::svr::HttpServer>> _http_server_list;
 	std::vector<std::shared_ptr<http::svr::HttpsServer>> _https_server_list;
+
+	// Bounds how long an on-demand request waits for the encoder
+	ov::DelayQueue _image_wait_timer{"ThumbWait"};
 };
@@ -62,6 +62,20 @@ bool ThumbnailStream::Stop()
 {
 	logtt("ThumbnailStream(%u) has been stopped", GetId());
 
+	std::map<cmn::MediaCodecId, std::map<uint64_t, ImageHandler>> image_waiters;
+	{
+		std::lock_guard<std::mutex> lock(_image_waiter_mutex);
+		image_waiters.swap(_image_waiters);
+	}
+
+	for (auto &[codec_id, waiters] : image_waiters)
+	{
+		for (auto &[waiter_id, handler] : waiters)
+		{
+			handler(nullptr);
+		}
+	}
+
 	return Stream::Stop();
 }
 
@@ -89,10 +103,32 @@ void ThumbnailStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_p
 		return;
 	}
 
-	std::lock_guard<std::shared_mutex> lock(_encoded_frame_mutex);
-	if (media_packet->GetData() != nullptr)
+	if (media_packet->GetData() == nullptr)
+	{
+		return;
+	}
+
+	auto image = media_packet->GetData()->Clone();
 	{
-		_encoded_frames[track->GetCodecId()] = media_packet->GetData()->Clone();
+		std::lock_guard<std::shared_mutex> lock(_encoded_frame_mutex);
+		_encoded_frames[track->GetCodecId()] = image;
+	}
+
+	std::map<uint64_t, ImageHandler> waiters;
+	{
+		std::lock_guard<std::mutex> lock(_image_waiter_mutex);
+
+		auto item = _image_waiters.find(track->GetCodecId());
+		if (item != _image_waiters.end())
+		{
+			waiters.swap(item->second);
+			_image_waiters.erase(item);
+		}
+	}
+
+	for (auto &[waiter_id, handler] : waiters)
+	{
+		handler(image);
 	}
 }
 
@@ -143,4 +179,51 @@ std::shared_ptr<ov::Data> ThumbnailStream::GetVideoFrameByCodecId(cmn::MediaCode
 	} while (true);
 
 	return nullptr;
-}
\ No newline at end of file
+}
+uint64_t ThumbnailStream::WaitForNextVideoFrame(cmn::MediaCodecId codec_id, ImageHandler handler)
+{
+	std::lock_guard<std::mutex> lock(_image_waiter_mutex);
+
+	auto waiter_id = ++_last_image_waiter_id;
+	_image_waiters[codec_id].emplace(waiter_id, std::move(handler));
+
+	return waiter_id;
+}
+
+bool ThumbnailStream::IsWaitingForVideoFrame(cmn::MediaCodecId codec_id)
+{
+	std::lock_guard<std::mutex> lock(_image_waiter_mutex);
+
+	return _image_waiters.find(codec_id) != _image_waiters.end();
+}
+
+void ThumbnailStream::ExpireImageWaiter(cmn::MediaCodecId codec_id, uint64_t waiter_id)
+{
+	ImageHandler handler;
+	{
+		std::lock_guard<std::mutex> lock(_image_waiter_mutex);
+
+		auto item = _image_waiters.find(codec_id);
+		if (item == _image_waiters.end())
+		{
+			return;
+		}
+
+		auto waiter = item->second.find(waiter_id);
+		if (waiter == item->second.end())
+		{
+			// Already answered
+			return;
+		}
+
+		handler = std::move(waiter->second);
+		item->second.erase(waiter);
+
+		if (item->second.empty())
+		{
+			_image_waiters.erase(item);
+		}
+	}
+
+	handler(GetVideoFrameByCodecId(codec_id, 0));
+}
@@ -23,11 +23,27 @@ public:
 	// Returns nullptr immediately if the stream has no track for codec_id, or if no image is
 	// cached by the time timeout_ms elapses (timeout_ms = 0 checks the cache once and returns)
 	std::shared_ptr<ov::Data> GetVideoFrameByCodecId(cmn::MediaCodecId codec_id, int64_t timeout_ms = 0);
+
+	// Called with the image, or with nullptr if the stream has stopped
+	using ImageHandler = std::function<void(const std::shared_ptr<ov::Data> &image)>;
+
+	// On-demand mode: queues <handler> until the next image of codec_id is cached. All the
+	// requests queued for an image are answered by the one encode that produces it.
+	// Returns the id to pass to ExpireImageWaiter()
+	uint64_t WaitForNextVideoFrame(cmn::MediaCodecId codec_id, ImageHandler handler);
+	bool IsWaitingForVideoFrame(cmn::MediaCodecId codec_id);
+	// Answers the waiter with the cached (stale) image if it is still waiting
+	void ExpireImageWaiter(cmn::MediaCodecId codec_id, uint64_t waiter_id);
+
 private:
 	bool Start() override;
 	bool Stop() override;
 
 	std::shared_mutex _encoded_frame_mutex;
 	std::map<cmn::MediaCodecId, std::shared_ptr<ov::Data>> _encoded_frames;
+
+	std::mutex _image_waiter_mutex;
+	uint64_t _last_image_waiter_id = 0;
+	std::map<cmn::MediaCodecId, std::map<uint64_t, ImageHandler>> _image_waiters;
 	std::shared_ptr<mon::StreamMetrics> _stream_metrics;
 };
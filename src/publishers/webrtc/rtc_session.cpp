@@ -11,7 +11,9 @@
 #include <utility>
 
 #include "base/info/stream.h"
+#include "modules/rtp_rtcp/rtcp_info/fir.h"
 #include "modules/rtp_rtcp/rtcp_info/nack.h"
+#include "modules/rtp_rtcp/rtcp_info/pli.h"
 #include "modules/rtp_rtcp/rtcp_info/remb.h"
 #include "modules/rtp_rtcp/rtcp_info/transport_cc.h"
 #include "rtc_application.h"
@@ -20,6 +22,12 @@
 #include "rtc_stream.h"
 #include "webrtc_publisher.h"
 
+// Cached GOP packets sent for every packet the stream delivers while a GOP burst is in progress.
+// The burst catches up with the live packets in about 1/8 of the GOP duration.
+static constexpr size_t kGopBurstPacketsPerSend = 8;
+// Temporal thinning lasts at least this long after the last OverUse signal
+static constexpr int64_t kTemporalThinningHoldMs = 5000;
+
 std::shared_ptr<RtcSession> RtcSession::Create(const std::shared_ptr<WebRtcPublisher> &publisher,
 											   const std::shared_ptr<pub::Application> &application,
 											   const std::shared_ptr<pub::Stream> &stream,
@@ -191,6 +199,8 @@ bool RtcSession::Start()
 	_auto_abr = _playlist->IsWebRtcAutoAbr();
 	_current_rendition = _playlist->GetFirstRendition();
 
+	_temporal_thinning_enabled = std::static_pointer_cast<RtcStream>(GetStream())->IsTemporalThinningEnabled();
+
 	auto current_video_track = _current_rendition->GetVideoTrack();
 	auto current_audio_track = _current_rendition->GetAudioTrack();
 
@@ -219,6 +229,8 @@ bool RtcSession::Start()
 	RegisterNextNode(nullptr);
 	ov::Node::Start();
 
+	_start_time = std::chrono::steady_clock::now();
+
 	return Session::Start();
 }
 
@@ -344,13 +356,17 @@ bool RtcSession::SetAutoAbr(bool auto_abr)
 
 void RtcSession::OnSignal(const std::shared_ptr<RtcBandwidthEstimatorSignal> &signal)
 {
-	if (_auto_abr == false)
-	{
-		return;
-	}
+	bool has_lower_rendition = _auto_abr && (_playlist->GetNextLowerBitrateRendition(GetCurrentRendition()) != nullptr);
 
 	if (signal->GetState() == RtcBandwidthEstimatorSignal::State::OverUse)
 	{
+		if (has_lower_rendition == false)
+		{
+			// A single bitrate stream can only be lightened by dropping frames
+			StartTemporalThinning();
+			return;
+		}
+
 		if (RequestChangeRendition(SwitchOver::LOWER) == true)
 		{
 			logtd("Bandwidth OverUse detected. Requested to lower the rendition.");
@@ -363,9 +379,16 @@ void RtcSession::OnSignal(const std::shared_ptr<RtcBandwidthEstimatorSignal> &si
 	}
 	else if (signal->GetState() == RtcBandwidthEstimatorSignal::State::Stable)
 	{
+		StopTemporalThinning(false);
 	}
 	else if (signal->GetState() == RtcBandwidthEstimatorSignal::State::UnderUse)
 	{
+		// Restore the full frame rate before switching to a higher rendition
+		if (StopTemporalThinning(true) == true || _auto_abr == false)
+		{
+			return;
+		}
+
 		if (RequestChangeRendition(SwitchOver::HIGHER) == true)
 		{
 			logtd("Bandwidth UnderUse detected. Requested to higher the rendition.");
@@ -378,6 +401,83 @@ void RtcSession::OnSignal(const std::shared_ptr<RtcBandwidthEstimatorSignal> &si
 	}
 }
 
+bool RtcSession::StartTemporalThinning()
+{
+	if (_temporal_thinning_enabled == false)
+	{
+		logtd("Bandwidth OverUse detected. But there is no lower rendition.");
+		return false;
+	}
+
+	_last_overuse_time = std::chrono::steady_clock::now();
+
+	if (_temporal_thinning.exchange(true) == false)
+	{
+		logtd("RtcSession(%u) - Bandwidth OverUse detected. Drops non-reference frames as there is no lower rendition.", GetId());
+	}
+
+	return true;
+}
+
+bool RtcSession::StopTemporalThinning(bool force)
+{
+	if (_temporal_thinning == false)
+	{
+		return false;
+	}
+
+	if (force == false)
+	{
+		auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _last_overuse_time).count();
+		if (elapsed_ms < kTemporalThinningHoldMs)
+		{
+			return false;
+		}
+	}
+
+	_temporal_thinning = false;
+
+	logtd("RtcSession(%u) - Bandwidth recovered. Stops dropping non-reference frames (%" PRIu64 " frames dropped so far).", GetId(), _thinned_frame_count.load());
+
+	return true;
+}
+
+bool RtcSession::IsThinnedPacket(const std::shared_ptr<const RtpPacket> &rtp_packet)
+{
+	if (rtp_packet->IsVideoPacket() == false)
+	{
+		return false;
+	}
+
+	// Decided at the first packet of the frame, so a frame is either sent or dropped as a whole.
+	// RED and FEC packets carry the timestamp of the frame they belong to.
+	if (rtp_packet->IsFirstPacketOfFrame())
+	{
+		bool thinned = (_temporal_thinning == true) && rtp_packet->IsDiscardable();
+		bool new_frame = (_thinned_frame.has_value() == false) ||
+						 (_thinned_frame->first != rtp_packet->GetTrackId()) ||
+						 (_thinned_frame->second != rtp_packet->Timestamp());
+
+		if (thinned == false)
+		{
+			_thinned_frame.reset();
+			return false;
+		}
+
+		if (new_frame)
+		{
+			_thinned_frame = std::make_pair(rtp_packet->GetTrackId(), rtp_packet->Timestamp());
+			_thinned_frame_count++;
+		}
+
+		return true;
+	}
+
+	return _thinned_frame.has_value() &&
+		   (_thinned_frame->first == rtp_packet->GetTrackId()) &&
+		   (_thinned_frame->second == rtp_packet->Timestamp());
+}
+
 uint64_t RtcSession::GetCurrentBitrateBps() const
 {
 	auto current_bitrate = GetCurrentRendition()->GetBitrates();
@@ -562,13 +662,16 @@ bool RtcSession::IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_pa
 		return false;
 	}
 
-	uint32_t rtp_payload_type = rtp_packet->PayloadType();
+	return IsSelectedPayloadType(rtp_packet->PayloadType());
+}
 
-	if (rtp_payload_type == _audio_payload_type ||
+bool RtcSession::IsSelectedPayloadType(uint8_t payload_type) const
+{
+	if (payload_type == _audio_payload_type ||
 		// if RED is disabled, origin RTP packet is selected
-		(_red_enabled == false && rtp_payload_type == _video_payload_type) ||
+		(_red_enabled == false && payload_type == _video_payload_type) ||
 		// if RED is enabled, RED packet is selected
-		(_red_enabled == true && rtp_payload_type == static_cast<uint8_t>(FixedRtcPayloadType::RED_PAYLOAD_TYPE)))
+		(_red_enabled == true && payload_type == static_cast<uint8_t>(FixedRtcPayloadType::RED_PAYLOAD_TYPE)))
 	{
 		return true;
 	}
@@ -610,12 +713,49 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
+	// Packets cannot be protected until the DTLS handshake has set the SRTP keys
+	if (_srtp_transport->IsReady() == false)
+	{
+		return;
+	}
+
+	if (_fast_start_checked == false)
+	{
+		_fast_start_checked = true;
+		BeginGopBurst();
+	}
+
 	// Check the packet is selected.
-	if (IsSelectedPacket(session_packet) == false)
+	bool is_selected = IsSelectedPacket(session_packet) && (IsSentInGopBurst(session_packet) == false);
+
+	// The sequence numbers are assigned per session, so the player does not see the dropped frames
+	if (is_selected && IsThinnedPacket(session_packet))
+	{
+		is_selected = false;
+	}
+
+	if (_gop_burst_packets.empty() == false)
+	{
+		if (is_selected && session_packet->GetTrackId() == _gop_burst_track_id)
+		{
+			// Sent after the cached GOP
+			_gop_burst_packets.push_back(session_packet);
+			is_selected = false;
+		}
+
+		SendGopBurstPackets();
+	}
+
+	if (is_selected == false)
 	{
 		return;
 	}
 
+	SendSessionPacket(session_packet, false);
+}
+
+void RtcSession::SendSessionPacket(const std::shared_ptr<RtpPacket> &session_packet, bool from_gop_cache)
+{
 	// RTP Session must be copied and sent because data is altered due to SRTP.
 	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
 
@@ -652,6 +792,114 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 	}
 
 	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetDataLength());
+
+	if (_time_to_first_frame_ms < 0)
+	{
+		CheckFirstFrameSent(session_packet, from_gop_cache);
+	}
+}
+
+bool RtcSession::BeginGopBurst()
+{
+	auto stream = std::static_pointer_cast<RtcStream>(GetStream());
+	if (stream == nullptr || stream->IsGopCacheEnabled() == false)
+	{
+		return false;
+	}
+
+	auto video_track = GetCurrentRendition()->GetVideoTrack();
+	if (video_track == nullptr)
+	{
+		return false;
+	}
+
+	_gop_burst_packets.clear();
+	_gop_burst_last_sequence_numbers.clear();
+
+	for (const auto &packet : stream->GetGopCache(video_track->GetId()))
+	{
+		if (IsSelectedPayloadType(packet->PayloadType()) == false)
+		{
+			continue;
+		}
+
+		_gop_burst_packets.push_back(packet);
+		_gop_burst_last_sequence_numbers[packet->PayloadType()] = packet->SequenceNumber();
+	}
+
+	if (_gop_burst_packets.empty())
+	{
+		logtd("RtcSession(%u) - There is no cached GOP of track(%u), waiting for the next keyframe", GetId(), video_track->GetId());
+		return false;
+	}
+
+	_gop_burst_track_id = video_track->GetId();
+
+	logtd("RtcSession(%u) - Starts with the cached GOP of track(%u): %zu packets", GetId(), _gop_burst_track_id, _gop_burst_packets.size());
+
+	return true;
+}
+
+bool RtcSession::IsSentInGopBurst(const std::shared_ptr<const RtpPacket> &rtp_packet)
+{
+	if (_gop_burst_last_sequence_numbers.empty() || rtp_packet->GetTrackId() != _gop_burst_track_id)
+	{
+		return false;
+	}
+
+	auto it = _gop_burst_last_sequence_numbers.find(rtp_packet->PayloadType());
+	if (it == _gop_burst_last_sequence_numbers.end())
+	{
+		return false;
+	}
+
+	// Not newer than the last packet of the burst
+	if (static_cast<uint16_t>(it->second - rtp_packet->SequenceNumber()) < 0x8000)
+	{
+		return true;
+	}
+
+	// The live packets have caught up with the burst
+	_gop_burst_last_sequence_numbers.erase(it);
+
+	return false;
+}
+
+void RtcSession::SendGopBurstPackets()
+{
+	auto video_track = GetCurrentRendition()->GetVideoTrack();
+	if (video_track == nullptr || video_track->GetId() != _gop_burst_track_id)
+	{
+		// The rendition has been changed at a keyframe of the new one
+		_gop_burst_packets.clear();
+		return;
+	}
+
+	for (size_t count = 0; (count < kGopBurstPacketsPerSend) && (_gop_burst_packets.empty() == false); count++)
+	{
+		auto packet = std::move(_gop_burst_packets.front());
+		_gop_burst_packets.pop_front();
+
+		SendSessionPacket(packet, true);
+	}
+}
+
+void RtcSession::CheckFirstFrameSent(const std::shared_ptr<const RtpPacket> &rtp_packet, bool from_gop_cache)
+{
+	if (GetCurrentRendition()->GetVideoTrack() != nullptr)
+	{
+		// The last packet of a keyframe
+		if (rtp_packet->IsVideoPacket() == false || rtp_packet->IsKeyframe() == false || rtp_packet->Marker() == false)
+		{
+			return;
+		}
+	}
+
+	_time_to_first_frame_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start_time).count();
+
+	logti("RtcSession(%u) - Time to first frame of %s/%s: %" PRId64 "ms (%s)",
+		  GetId(), GetApplication()->GetVHostAppName().CStr(), GetStream()->GetName().CStr(),
+		  _time_to_first_frame_ms.load(), from_gop_cache ? "GOP cache" : "live");
 }
 
 bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
@@ -768,6 +1016,26 @@ void RtcSession::OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info)
 			// Process
 			ProcessRemb(rtcp_info);
 		}
+		else if (rtcp_info->GetCountOrFmt() == static_cast<uint8_t>(PSFBFMT::PLI))
+		{
+			auto pli = std::static_pointer_cast<PLI>(rtcp_info);
+			if (pli->GetMediaSsrc() == _video_ssrc)
+			{
+				ProcessKeyframeRequest("PLI");
+			}
+		}
+		else if (rtcp_info->GetCountOrFmt() == static_cast<uint8_t>(PSFBFMT::FIR))
+		{
+			auto fir = std::static_pointer_cast<FIR>(rtcp_info);
+			for (size_t i = 0; i < fir->GetFirMessageCount(); i++)
+			{
+				if (fir->GetFirMessage(i).first == _video_ssrc)
+				{
+					ProcessKeyframeRequest("FIR");
+					break;
+				}
+			}
+		}
 	}
 
 	//rtcp_info->DebugPrint();
@@ -843,6 +1111,47 @@ bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 	return true;
 }
 
+bool RtcSession::ProcessKeyframeRequest(const char *request_name)
+{
+	auto stream = std::static_pointer_cast<RtcStream>(GetStream());
+	if (stream == nullptr)
+	{
+		return false;
+	}
+
+	auto video_track = GetCurrentRendition()->GetVideoTrack();
+	if (video_track == nullptr)
+	{
+		return false;
+	}
+
+	if (_time_to_first_frame_ms < 0)
+	{
+		// The player has not got a keyframe yet
+		if (_gop_burst_packets.empty() == false)
+		{
+			logtt("RtcSession(%u) - %s received while the cached GOP is being sent", GetId(), request_name);
+			return true;
+		}
+
+		if (BeginGopBurst() == true)
+		{
+			logtd("RtcSession(%u) - %s received, starts with the cached GOP", GetId(), request_name);
+			return true;
+		}
+	}
+
+	// A player that is already playing cannot go back to the cached keyframe, the encoder has to make a new one
+	auto result = stream->RequestKeyframe(video_track->GetId());
+
+	logtd("RtcSession(%u) - %s received, keyframe of track(%u) %s", GetId(), request_name, video_track->GetId(),
+		  (result == info::KeyframeRequest::RequestResult::Forwarded)	  ? "has been requested"
+		  : (result == info::KeyframeRequest::RequestResult::RateLimited) ? "has already been requested"
+																		  : "cannot be requested");
+
+	return true;
+}
+
 bool RtcSession::ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info)
 {
 	if (_bandwidth_estimator == nullptr)
@@ -10,6 +10,8 @@
 #include <modules/http/server/web_socket/web_socket_session.h>
 #include <monitoring/monitoring.h>
 
+#include <deque>
+#include <optional>
 #include <unordered_set>
 
 #include "base/info/media_track.h"
@@ -103,12 +105,22 @@ public:
 		return _ice_session_id;
 	}
 
+	// From Start() until the first complete frame (a keyframe, or audio for audio-only
+	// renditions) has been sent, -1 until then
+	int64_t GetTimeToFirstFrameMs() const
+	{
+		return _time_to_first_frame_ms;
+	}
+
 private:
 	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info);
+	bool ProcessKeyframeRequest(const char *request_name);
 	bool IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_packet);
+	bool IsSelectedPayloadType(uint8_t payload_type) const;
+	void SendSessionPacket(const std::shared_ptr<RtpPacket> &session_packet, bool from_gop_cache);
 
 	uint8_t GetOriginPayloadTypeFromRedRtpPacket(const std::shared_ptr<const RedRtpPacket> &red_rtp_packet);
 
@@ -196,6 +208,45 @@ private:
 	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
 	/////////////////////////////// For NACK
 
+	///////////////////////////////
+	// For fast start
+	// A new session starts with the GOP cached by the stream, so that the player does not wait
+	// for the next keyframe. The cached packets are sent a few at a time for every packet the
+	// stream delivers, and the live packets of the track are queued behind them.
+	bool BeginGopBurst();
+	bool IsSentInGopBurst(const std::shared_ptr<const RtpPacket> &rtp_packet);
+	void SendGopBurstPackets();
+	void CheckFirstFrameSent(const std::shared_ptr<const RtpPacket> &rtp_packet, bool from_gop_cache);
+
+	bool _fast_start_checked = false;
+	uint32_t _gop_burst_track_id = 0;
+	std::deque<std::shared_ptr<RtpPacket>> _gop_burst_packets;
+	// Payload type : the last origin sequence number in the GOP burst. Live packets up to it are
+	// still in the stream worker queue, and have already been sent in the burst.
+	std::map<uint8_t, uint16_t> _gop_burst_last_sequence_numbers;
+
+	std::chrono::steady_clock::time_point _start_time;
+	std::atomic<int64_t> _time_to_first_frame_ms{-1};
+	/////////////////////////////// For fast start
+
+	///////////////////////////////
+	// For temporal thinning
+	// While the network is congested and there is no lower rendition to switch to, the frames that
+	// no other frame references are dropped, halving the frame rate of a typical temporal layered
+	// stream without re-encoding.
+	bool StartTemporalThinning();
+	// Unless forced, thinning is kept for a while after the last OverUse signal
+	bool StopTemporalThinning(bool force);
+	bool IsThinnedPacket(const std::shared_ptr<const RtpPacket> &rtp_packet);
+
+	bool _temporal_thinning_enabled = false;
+	std::atomic<bool> _temporal_thinning{false};
+	std::chrono::steady_clock::time_point _last_overuse_time;
+	// Track ID, RTP timestamp of the frame being dropped
+	std::optional<std::pair<uint32_t, uint32_t>> _thinned_frame;
+	std::atomic<uint64_t> _thinned_frame_count{0};
+	/////////////////////////////// For temporal thinning
+
 	// RTP Header Extension Setters
 	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
 	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
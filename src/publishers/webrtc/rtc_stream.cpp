@@ -11,6 +11,7 @@
 #include <base/info/media_extradata.h>
 #include <modules/bitstream/h264/h264_decoder_configuration_record.h>
 #include <modules/bitstream/nalu/nal_stream_converter.h>
+#include <modules/bitstream/vp8/vp8_parser.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_abs_send_time.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_framemarking.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_playout_delay.h>
@@ -143,6 +144,17 @@ bool RtcStream::Start()
 
 	_pacer_enabled = webrtc_config.IsJitterBufferEnabled();
 
+	_gop_cache_enabled		  = webrtc_config.GetFastStart().IsGopCacheEnabled();
+	_keyframe_request_enabled = webrtc_config.GetFastStart().IsKeyframeRequestEnabled();
+
+	if (_gop_cache_enabled == true)
+	{
+		_gop_cache_max_bytes	  = static_cast<size_t>(std::max(webrtc_config.GetFastStart().GetGopCacheMaxSize(), 0));
+		_gop_cache_memory_account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::GopCache, GetUri());
+	}
+
+	_temporal_thinning_enabled = webrtc_config.IsTemporalThinningEnabled();
+
 	if (_pacer_enabled)
 	{
 		_pacer_scheduler = std::make_shared<ov::DelayQueue>("FramePacer");
@@ -280,13 +292,16 @@ bool RtcStream::Start()
 		}
 	}
 
-	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) PlayoutDelay(%s min:%d max:%d) JitterBuffer(%s)",
+	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) PlayoutDelay(%s min:%d max:%d) JitterBuffer(%s) GopCache(%s) KeyframeRequest(%s) TemporalThinning(%s)",
 		  GetName().CStr(), GetId(),
 		  ov::Converter::ToString(_rtx_enabled).CStr(),
 		  ov::Converter::ToString(_ulpfec_enabled).CStr(),
 		  ov::Converter::ToString(_playout_delay_enabled).CStr(),
 		  _playout_delay_min, _playout_delay_max,
-		  ov::Converter::ToString(_pacer_enabled).CStr());
+		  ov::Converter::ToString(_pacer_enabled).CStr(),
+		  ov::Converter::ToString(_gop_cache_enabled).CStr(),
+		  ov::Converter::ToString(_keyframe_request_enabled).CStr(),
+		  ov::Converter::ToString(_temporal_thinning_enabled).CStr());
 
 	return Stream::Start();
 }
@@ -308,6 +323,15 @@ bool RtcStream::Stop()
 	}
 	_pacer_scheduler.reset();
 
+	{
+		std::lock_guard<std::shared_mutex> lock(_gop_cache_lock);
+		for (auto &[track_id, gop_cache] : _gop_caches)
+		{
+			ClearGopCache(track_id);
+		}
+		_gop_caches.clear();
+	}
+
 	std::lock_guard<std::shared_mutex> lock(_packetizers_lock);
 	_packetizers.clear();
 
@@ -727,6 +751,13 @@ std::shared_ptr<PayloadAttr> RtcStream::MakeRtxPayloadAttr(const std::shared_ptr
 
 bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 {
+	// Cache before broadcasting, so that a session that takes the GOP cache has already got
+	// every packet it has not received yet
+	if (_gop_cache_enabled == true && packet->IsVideoPacket())
+	{
+		CacheGopPacket(packet);
+	}
+
 	auto stream_packet = std::make_any<std::shared_ptr<RtpPacket>>(packet);
 	BroadcastPacket(stream_packet);
 
@@ -743,6 +774,102 @@ bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 	return true;
 }
 
+void RtcStream::CacheGopPacket(const std::shared_ptr<RtpPacket> &packet)
+{
+	std::lock_guard<std::shared_mutex> lock(_gop_cache_lock);
+
+	auto &gop_cache = _gop_caches[packet->GetTrackId()];
+
+	// The first packet of a keyframe starts a new GOP. Its RED copy follows it with the same timestamp.
+	if (packet->IsKeyframe() && packet->IsFirstPacketOfFrame() &&
+		(gop_cache.packets.empty() || gop_cache.packets.front()->Timestamp() != packet->Timestamp()))
+	{
+		ClearGopCache(packet->GetTrackId());
+	}
+	else if (gop_cache.packets.empty())
+	{
+		// Wait for the next keyframe
+		return;
+	}
+
+	auto data = packet->GetData();
+	auto bytes = (data != nullptr) ? data->GetLength() : 0;
+
+	if (gop_cache.bytes + bytes > _gop_cache_max_bytes)
+	{
+		logtd("RtcStream(%s/%s) - The GOP of track(%u) exceeds %zu bytes, it is not cached",
+			  GetApplication()->GetVHostAppName().CStr(), GetName().CStr(), packet->GetTrackId(), _gop_cache_max_bytes);
+		ClearGopCache(packet->GetTrackId());
+		return;
+	}
+
+	// The packets also stored for retransmission are charged to the RTP history, which takes them over
+	if (data != nullptr)
+	{
+		data->ClaimMemoryFor(_gop_cache_memory_account);
+	}
+
+	gop_cache.packets.push_back(packet);
+	gop_cache.bytes += bytes;
+}
+
+// Must be called with _gop_cache_lock held
+void RtcStream::ClearGopCache(uint32_t track_id)
+{
+	auto it = _gop_caches.find(track_id);
+	if (it == _gop_caches.end())
+	{
+		return;
+	}
+
+	auto &gop_cache = it->second;
+
+	for (const auto &packet : gop_cache.packets)
+	{
+		auto data = packet->GetData();
+		if (data != nullptr)
+		{
+			data->UnclaimMemoryFor(_gop_cache_memory_account);
+		}
+	}
+
+	gop_cache.packets.clear();
+	gop_cache.bytes = 0;
+}
+
+bool RtcStream::IsGopCacheEnabled() const
+{
+	return _gop_cache_enabled;
+}
+
+bool RtcStream::IsTemporalThinningEnabled() const
+{
+	return _temporal_thinning_enabled;
+}
+
+std::vector<std::shared_ptr<RtpPacket>> RtcStream::GetGopCache(uint32_t track_id)
+{
+	std::shared_lock<std::shared_mutex> lock(_gop_cache_lock);
+
+	auto it = _gop_caches.find(track_id);
+	if (it == _gop_caches.end())
+	{
+		return {};
+	}
+
+	return it->second.packets;
+}
+
+info::KeyframeRequest::RequestResult RtcStream::RequestKeyframe(uint32_t track_id)
+{
+	if (_keyframe_request_enabled == false)
+	{
+		return info::KeyframeRequest::RequestResult::NotRegistered;
+	}
+
+	return info::KeyframeRequest::GetInstance()->Request(GetApplication()->GetVHostAppName(), GetName(), track_id);
+}
+
 void RtcStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
 {
 	// Capture arrival time at the very top so that any subsequent processing
@@ -869,6 +996,13 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 		// Structure for future expansion.
 		// In the future, when OME uses codec-specific features, certain information is obtained from media_packet.
 		codec_info.codec_specific.vp8 = CodecSpecificInfoVp8();
+
+		// Sets the N bit of the payload descriptor, and lets congested sessions drop the frame
+		bool non_reference = false;
+		if (VP8Parser::ParseNonReference(media_packet->GetData()->GetDataAs<uint8_t>(), media_packet->GetDataLength(), non_reference) == true)
+		{
+			codec_info.codec_specific.vp8.non_reference = non_reference;
+		}
 	}
 	else if (codec_info.codec_type == MediaCodecId::H264 ||
 			 codec_info.codec_type == MediaCodecId::H265)
@@ -1074,7 +1208,10 @@ void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
 		return;
 	}
 
+	auto memory_account = ov::MemoryAccounting::GetInstance()->GetAccount(ov::MemoryTag::RtpHistory, GetUri());
+
 	auto history															= std::make_shared<RtpHistory>(origin_payload_type, rtx_payload_type, _video_rtx_ssrc, MAX_RTP_RECORDS);
+	history->SetMemoryAccount(memory_account);
 	_rtp_history_map[GetRtpHistoryKey(track->GetId(), origin_payload_type)] = history;
 
 	if (_ulpfec_enabled == true)
@@ -1082,6 +1219,7 @@ void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
 		auto red_pt												   = static_cast<uint8_t>(FixedRtcPayloadType::RED_PAYLOAD_TYPE);
 		auto red_rtx_pt											   = static_cast<uint8_t>(FixedRtcPayloadType::RED_RTX_PAYLOAD_TYPE);
 		auto red_history										   = std::make_shared<RtpHistory>(red_pt, red_rtx_pt, _video_rtx_ssrc, MAX_RTP_RECORDS);
+		red_history->SetMemoryAccount(memory_account);
 
 		_rtp_history_map[GetRtpHistoryKey(track->GetId(), red_pt)] = red_history;
 	}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <base/common_types.h>
+#include <base/info/keyframe_request.h>
 #include <base/info/stream.h>
 #include <base/ovcrypto/certificate.h>
 #include <base/publisher/stream.h>
@@ -52,6 +53,17 @@ public:
 
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number);
 
+	// Fast start (<FastStart> of the WebRTC Publisher)
+	bool IsGopCacheEnabled() const;
+	// The RTP packets of the current GOP of the track, starting with its keyframe, in the order
+	// they were packetized. Empty if no keyframe has been packetized yet.
+	std::vector<std::shared_ptr<RtpPacket>> GetGopCache(uint32_t track_id);
+	// Asks the encoder of the track for a keyframe, if the track comes from the transcoder
+	info::KeyframeRequest::RequestResult RequestKeyframe(uint32_t track_id);
+
+	// <TemporalThinning> of the WebRTC Publisher
+	bool IsTemporalThinningEnabled() const;
+
 	// RtpRtcpPacketizerInterface Implementation
 	bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override;
 
@@ -78,6 +90,8 @@ private:
 	uint16_t AllocateVP8PictureID(uint32_t track_id);
 
 	bool StorePacketForRTX(std::shared_ptr<RtpPacket> &packet);
+	void CacheGopPacket(const std::shared_ptr<RtpPacket> &packet);
+	void ClearGopCache(uint32_t track_id);
 
 	bool PushToPacer(const std::shared_ptr<MediaPacket> &media_packet,
 					 std::chrono::steady_clock::time_point arrival_time);
@@ -126,6 +140,24 @@ private:
 	bool _transport_cc_enabled = false;
 	bool _remb_enabled		   = false;
 
+	bool _gop_cache_enabled		   = false;
+	bool _keyframe_request_enabled = false;
+
+	bool _temporal_thinning_enabled = false;
+
+	struct GopCache
+	{
+		// RTP packets of the current GOP (including RED and FEC packets)
+		std::vector<std::shared_ptr<RtpPacket>> packets;
+		size_t bytes = 0;
+	};
+
+	// Track ID : GopCache
+	std::map<uint32_t, GopCache> _gop_caches;
+	std::shared_mutex _gop_cache_lock;
+	size_t _gop_cache_max_bytes = 0;
+	std::shared_ptr<ov::MemoryAccount> _gop_cache_memory_account;
+
 	uint32_t _worker_count = 0;
 
 	// Per-stream scheduler shared by all FramePacers (one worker thread).
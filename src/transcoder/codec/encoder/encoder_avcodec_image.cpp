@@ -147,6 +147,11 @@ bool AVCodecImageEncoder::Initialize()
 		_track->SetCodecStatus(result ? cmn::CodecStatus::Ready : cmn::CodecStatus::Failed);
 	}
 
+	if (result)
+	{
+		RegisterDemand();
+	}
+
 	return result;
 }
 
@@ -156,6 +161,75 @@ void AVCodecImageEncoder::Uninitialize()
 	_codec.Reset();
 }
 
+void AVCodecImageEncoder::Stop()
+{
+	TranscodeEncoder::Stop();
+
+	// The codec thread uses the entry until it has been joined
+	UnregisterDemand();
+}
+
+void AVCodecImageEncoder::RegisterDemand()
+{
+	// Initialize() also runs on reinitialization
+	if (_demand != nullptr)
+	{
+		return;
+	}
+
+	const auto &on_demand_config = _stream_info.GetApplicationInfo().GetConfig().GetPublishers().GetThumbnailPublisher().GetOnDemand();
+	if (on_demand_config.IsEnabled() == false)
+	{
+		return;
+	}
+
+	_demand = info::ThumbnailDemand::GetInstance()->Register(
+		_stream_info.GetApplicationInfo().GetVHostAppName(), _stream_info.GetName(), _codec_id,
+		on_demand_config.GetIdleTimeout(),
+		[this]() {
+			_input_buffer.InjectWakeup();
+		});
+}
+
+void AVCodecImageEncoder::UnregisterDemand()
+{
+	if (_demand == nullptr)
+	{
+		return;
+	}
+
+	info::ThumbnailDemand::GetInstance()->Unregister(
+		_stream_info.GetApplicationInfo().GetVHostAppName(), _stream_info.GetName(), _codec_id, _demand);
+	_demand = nullptr;
+}
+
+std::shared_ptr<const MediaFrame> AVCodecImageEncoder::SelectFrameToEncode(std::shared_ptr<const MediaFrame> frame)
+{
+	if (_demand == nullptr)
+	{
+		return frame;
+	}
+
+	if (frame != nullptr)
+	{
+		_held_frame = std::move(frame);
+		_held_frame_encoded = false;
+	}
+
+	// Idle: keep the frame for the next request. Decoding and scaling still run upstream,
+	// the encode is what is saved here.
+	if ((_demand->IsActive() == false) || (_held_frame == nullptr) || _held_frame_encoded)
+	{
+		return nullptr;
+	}
+
+	// A new frame while requested, or the held one when a request has just woken us up
+	_held_frame_encoded = true;
+	_demand->OnEncoded();
+
+	return _held_frame;
+}
+
 EncodeResult AVCodecImageEncoder::SendFrame(const std::shared_ptr<const MediaFrame> &frame, bool force_keyframe)
 {
 	// Flush the encoder if the frame is nullptr.
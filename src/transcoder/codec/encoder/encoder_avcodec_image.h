@@ -9,12 +9,17 @@
 #pragma once
 
 #include "../../transcoder_encoder.h"
+#include <base/info/thumbnail_demand.h>
 #include <modules/ffmpeg/ffmpeg_codec.h>
 
 // AVCodecImageEncoder handles the software FFmpeg image encoders: JPEG, PNG, WEBP, AVIF.
 //
 // JPEG/PNG/WEBP encoder output is already the file format.
 // AVIF is not. libaom-av1 emits the AV1 bitstream only, so ReceivePacket() wraps each still with avif::Packager.
+//
+// When the Thumbnail Publisher of the application runs on demand, the encoder registers with
+// info::ThumbnailDemand and encodes only while its image is requested. In between it keeps the
+// last frame, which is encoded as soon as a request wakes the encoder up.
 class AVCodecImageEncoder : public TranscodeEncoder
 {
 public:
@@ -23,7 +28,11 @@ public:
 	{
 	}
 
-	~AVCodecImageEncoder() override { Uninitialize(); }
+	~AVCodecImageEncoder() override
+	{
+		UnregisterDemand();
+		Uninitialize();
+	}
 
 	// ----- Codec info -----
 	cmn::MediaCodecId GetCodecID() const noexcept override { return _codec_id; }
@@ -66,10 +75,13 @@ public:
 		}
 	}
 
+	void Stop() override;
+
 protected:
 	// ----- Encoder interface -----
 	bool Initialize() override;
 	void Uninitialize() override;
+	std::shared_ptr<const MediaFrame> SelectFrameToEncode(std::shared_ptr<const MediaFrame> frame) override;
 	EncodeResult SendFrame(const std::shared_ptr<const MediaFrame> &frame, bool force_keyframe) override;
 	EncodeResult ReceivePacket() override;
 
@@ -81,10 +93,18 @@ private:
 	bool SetParamsPng();
 	bool SetParamsWebp();
 	bool SetParamsAvif();
+	void RegisterDemand();
+	void UnregisterDemand();
 
 	// ----- Members -----
 	cmn::MediaCodecId _codec_id;
 	ffmpeg::FFmpegCodec _codec;
 	cmn::BitstreamFormat _bitstream_format = cmn::BitstreamFormat::Unknown;
 	cmn::PacketType _packet_type = cmn::PacketType::Unknown;
+
+	// On-demand mode only. Registered by the codec thread, unregistered after it has been joined
+	std::shared_ptr<info::ThumbnailDemand::Entry> _demand;
+	// The latest frame, and whether it has been encoded
+	std::shared_ptr<const MediaFrame> _held_frame;
+	bool _held_frame_encoded = false;
 };
@@ -12,12 +12,16 @@
 
 #include "encoder_whisper.h"
 #include "../../transcoder_private.h"
+#include "../../transcoder_whisper_inference_service.h"
 #include "../../transcoder_whisper_model_registry.h"
 #include "../../transcoder_gpu.h"
 
 EncoderWhisper::EncoderWhisper(const info::Stream &stream_info)
 	: TranscodeEncoder(stream_info)
 {
+#ifdef HWACCELS_NVIDIA_ENABLED
+	_use_gpu = TranscodeGPU::GetInstance()->GetDeviceCount(cmn::MediaCodecModuleId::NVENC) > 0;
+#endif
 }
 
 EncoderWhisper::~EncoderWhisper()
@@ -31,16 +35,10 @@ bool EncoderWhisper::SetCodecParams()
 
 bool EncoderWhisper::Configure(std::shared_ptr<MediaTrack> context)
 {
-#ifdef HWACCELS_NVIDIA_ENABLED
-	if (TranscodeGPU::GetInstance()->GetDeviceCount(cmn::MediaCodecModuleId::NVENC) == 0)
+	if (_use_gpu == false)
 	{
-		logtw("Whisper STT requires an NVIDIA GPU, but no NVIDIA device is available. STT track will be disabled.");
-		return false;
+		logti("No NVIDIA device is available. Whisper STT will run on the CPU. A small quantized model is recommended. model=%s", context->GetModel().CStr());
 	}
-#else
-	logtw("Whisper STT requires an NVIDIA GPU, but this build does not include NVIDIA support. STT track will be disabled.");
-	return false;
-#endif
 
 	auto parent_stream_info = _stream_info.GetLinkedInputStream();
 	if (parent_stream_info == nullptr)
@@ -94,11 +92,19 @@ bool EncoderWhisper::Initialize()
 	// Resolve and cache the CUDA device index for this encoder instance.
 	// _track->GetCodecDeviceId() returns the OME device index (from <Modules>nv:N</Modules>).
 	// TranscodeGPU maps it to the actual CUDA device index.
-	_cuda_id = TranscodeGPU::GetInstance()->GetExternalDeviceId(cmn::MediaCodecModuleId::NVENC, _track->GetCodecDeviceId());
-	if (_cuda_id < 0)
+	if (_use_gpu)
+	{
+		_cuda_id = TranscodeGPU::GetInstance()->GetExternalDeviceId(cmn::MediaCodecModuleId::NVENC, _track->GetCodecDeviceId());
+		if (_cuda_id < 0)
+		{
+			_cuda_id = 0;
+		}
+	}
+	else
 	{
-		_cuda_id = 0;
+		_cuda_id = WhisperModelRegistry::CPU_DEVICE_ID;
 	}
+	_model_key = WhisperModelRegistry::MakeModelKey(_track->GetModel(), _cuda_id);
 
 	// Acquire the shared model context from the registry. The model stays loaded for
 	// the encoder's lifetime; only the per-instance whisper_state is allocated dynamically.
@@ -161,6 +167,101 @@ void EncoderWhisper::FreeWhisperState()
 	}
 }
 
+// Runs one window on WhisperInferenceService, which batches the windows of all streams using the
+// same model and bounds the total number of inference threads. This thread waits for the result.
+bool EncoderWhisper::RunInference(const std::vector<float> &pcmf32, const std::vector<whisper_token> &prompt_tokens, int64_t new_audio_ms, int &detected_lang_id, float &detected_lang_prob)
+{
+	const bool detect_language = (_source_language == "auto" && _translate == false);
+
+	WhisperInferenceService::Job job;
+	job.model_key = _model_key;
+	job.audio_duration_ms = new_audio_ms;
+	// The next window of this stream is due after one step
+	job.deadline = WhisperInferenceService::Clock::now() + std::chrono::milliseconds(_step_ms);
+	job.run = [&](int32_t n_threads) -> bool {
+		ov::String language = _translate ? ov::String("en") : _source_language;
+
+		// Auto detect language if needed.
+		if (detect_language)
+		{
+			if (whisper_pcm_to_mel_with_state(_whisper_ctx.get(), _whisper_state, pcmf32.data(), pcmf32.size(), n_threads) != 0)
+			{
+				logte("Failed to process audio samples for language detection with Whisper");
+				return false;
+			}
+
+			std::vector<float> probs(whisper_lang_max_id() + 1, 0.0f);
+			detected_lang_id = whisper_lang_auto_detect_with_state(_whisper_ctx.get(), _whisper_state, 0, n_threads, probs.data());
+			if (detected_lang_id < 0)
+			{
+				logte("Failed to detect language with Whisper");
+				return false;
+			}
+
+			detected_lang_prob = probs[detected_lang_id];
+			if (detected_lang_prob > 0.9f)
+			{
+				language = whisper_lang_str(detected_lang_id);
+			}
+		}
+
+		// Size the encoder audio context to the actual window instead of the full
+		// 30 s, so the encoder does not run over the zero-padding. Each context
+		// position spans 320 samples (20 ms); a margin avoids truncating the
+		// window tail. audio_ctx 0 means the full default context.
+		int32_t audio_ctx = static_cast<int32_t>((pcmf32.size() + 319) / 320) + 64;
+		if (audio_ctx >= 1500)
+		{
+			audio_ctx = 0;
+		}
+
+		whisper_full_params wparams = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
+		wparams.print_progress   = false;
+		wparams.print_special    = false;
+		wparams.print_realtime   = false;
+		wparams.print_timestamps = true;
+		wparams.translate        = _translate;
+		wparams.single_segment   = false;
+		wparams.max_tokens       = 0; 
+		wparams.language         = language.CStr();
+		wparams.n_threads        = n_threads;
+		wparams.beam_search.beam_size = -1; // disable beam search
+		wparams.greedy.best_of = 1; // disable best_of
+		wparams.temperature_inc = 0.0f;
+		wparams.audio_ctx        = audio_ctx;
+		wparams.tdrz_enable      = false;
+		wparams.prompt_tokens    = prompt_tokens.data();
+		wparams.prompt_n_tokens  = static_cast<int>(prompt_tokens.size());
+		wparams.token_timestamps = false;
+		wparams.split_on_word	 = true;
+		wparams.thold_pt		 = 0.01f;
+		wparams.thold_ptsum		 = 0.01f;
+		wparams.max_len			 = 0;
+
+		if (whisper_full_with_state(_whisper_ctx.get(), _whisper_state, wparams, pcmf32.data(), pcmf32.size()) != 0)
+		{
+			logte("Failed to process audio samples with Whisper");
+			return false;
+		}
+
+		return true;
+	};
+
+	auto result = WhisperInferenceService::GetInstance()->Run(std::move(job));
+	if (result == WhisperInferenceService::Result::Expired)
+	{
+		// The audio is kept in the rolling window, so the next window covers it
+		logtd("Whisper window was dropped because the inference service is behind. stream=%s, label=%s",
+			  _stream_info.GetName().CStr(), _output_track_label.CStr());
+	}
+	else if (result == WhisperInferenceService::Result::Cancelled)
+	{
+		logtw("Whisper inference service is not running. stream=%s, label=%s", _stream_info.GetName().CStr(), _output_track_label.CStr());
+	}
+
+	return result == WhisperInferenceService::Result::Completed;
+}
+
 void EncoderWhisper::ThreadLoop()
 {
 	ov::logger::ThreadHelper thread_helper;
@@ -333,36 +434,32 @@ void EncoderWhisper::ThreadLoop()
 		int64_t buffer_end_cs = new_buffer_end_cs;
 
 
-		// Auto detect language if needed.
-		if (_source_language == "auto" && _translate == false)
-		{
-			if (whisper_pcm_to_mel_with_state(_whisper_ctx.get(), _whisper_state, pcmf32_buffer.data(), pcmf32_buffer.size(), 4) != 0)
-			{
-				logte("Failed to process audio samples for language detection with Whisper");
-				continue;
-			}
+		int detected_lang_id = -1;
+		float detected_lang_prob = 0.0f;
+		const int64_t new_audio_ms = static_cast<int64_t>(n_samples_new) * 1000 / WHISPER_SAMPLE_RATE;
 
-			std::vector<float> probs(whisper_lang_max_id() + 1, 0.0f);
-			const auto lang_id = whisper_lang_auto_detect_with_state(_whisper_ctx.get(), _whisper_state, 0, 4, probs.data());
-			if (lang_id < 0)
-			{
-				logte("Failed to detect language with Whisper");
-				continue;
-			}
+		logtt("Starting Whisper processing with %d samples", static_cast<int>(pcmf32_buffer.size()));
+		logtt("Audio buffer time range for Whisper: %" PRId64 " ~ %" PRId64 " (last_commit_end_cs=%" PRId64 ")",
+			buffer_start_cs, buffer_end_cs, last_commit_end_cs);
+		if (RunInference(pcmf32_buffer, prompt_tokens, new_audio_ms, detected_lang_id, detected_lang_prob) == false)
+		{
+			continue;
+		}
 
-			auto lang_str = whisper_lang_str(lang_id);
-			auto lang_prob = probs[lang_id];
+		if (_source_language == "auto" && _translate == false)
+		{
+			auto lang_str = whisper_lang_str(detected_lang_id);
 
-			if (lang_prob > 0.9f)
+			if (detected_lang_prob > 0.9f)
 			{
 				// _source_language = lang_str;
-				logti("Set source language [label : %s] to %s with high confidence (id=%d) with probabilities:[%f]", _track->GetOutputTrackLabel().CStr(), lang_str, lang_id, lang_prob);
+				logti("Set source language [label : %s] to %s with high confidence (id=%d) with probabilities:[%f]", _track->GetOutputTrackLabel().CStr(), lang_str, detected_lang_id, detected_lang_prob);
 
 				SendLangDetectionEvent(_track->GetOutputTrackLabel(), lang_str);
 			}
 			else
 			{
-				logtw("Detected language [label : %s] is not confident enough. Detected %s (id=%d) with probabilities:[%f]. Keep auto-detection. Please consider setting source_language manually.", _track->GetOutputTrackLabel().CStr(), lang_str, lang_id, lang_prob);
+				logtw("Detected language [label : %s] is not confident enough. Detected %s (id=%d) with probabilities:[%f]. Keep auto-detection. Please consider setting source_language manually.", _track->GetOutputTrackLabel().CStr(), lang_str, detected_lang_id, detected_lang_prob);
 			}
 		}
 		else if (_source_language == "auto" && _translate == true)
@@ -370,48 +467,6 @@ void EncoderWhisper::ThreadLoop()
 			SendLangDetectionEvent(_track->GetOutputTrackLabel(), "en");
 			logti("Translation enabled. Set source language [label : %s] to English for Whisper processing.", _track->GetOutputTrackLabel().CStr());
 		}
-
-		// Size the encoder audio context to the actual window instead of the full
-		// 30 s, so the encoder does not run over the zero-padding. Each context
-		// position spans 320 samples (20 ms); a margin avoids truncating the
-		// window tail. audio_ctx 0 means the full default context.
-		int32_t audio_ctx = static_cast<int32_t>((pcmf32_buffer.size() + 319) / 320) + 64;
-		if (audio_ctx >= 1500)
-		{
-			audio_ctx = 0;
-		}
-
-		whisper_full_params wparams = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
-		wparams.print_progress   = false;
-		wparams.print_special    = false;
-		wparams.print_realtime   = false;
-		wparams.print_timestamps = true;
-		wparams.translate        = _translate;
-		wparams.single_segment   = false;
-		wparams.max_tokens       = 0; 
-		wparams.language         = _translate ? "en" : _source_language.CStr();
-		wparams.n_threads        = std::min(4, (int32_t) std::thread::hardware_concurrency());
-		wparams.beam_search.beam_size = -1; // disable beam search
-		wparams.greedy.best_of = 1; // disable best_of
-		wparams.temperature_inc = 0.0f;
-		wparams.audio_ctx        = audio_ctx;
-		wparams.tdrz_enable      = false;
-		wparams.prompt_tokens    = prompt_tokens.data();
-		wparams.prompt_n_tokens  = static_cast<int>(prompt_tokens.size());
-		wparams.token_timestamps = false;
-		wparams.split_on_word	 = true;
-		wparams.thold_pt		 = 0.01f;
-		wparams.thold_ptsum		 = 0.01f;
-		wparams.max_len			 = 0;
-
-		logtt("Starting Whisper processing with %d samples", static_cast<int>(pcmf32_buffer.size()));
-		logtt("Audio buffer time range for Whisper: %" PRId64 " ~ %" PRId64 " (last_commit_end_cs=%" PRId64 ")",
-			buffer_start_cs, buffer_end_cs, last_commit_end_cs);
-		if (whisper_full_with_state(_whisper_ctx.get(), _whisper_state, wparams, pcmf32_buffer.data(), pcmf32_buffer.size()) != 0)
-		{
-			logte("Failed to process audio samples with Whisper");
-			continue;
-		}
 		logtt("Whisper processing completed");
 
 		ov::String result_text;
@@ -30,7 +30,7 @@ public:
 
 	cmn::MediaCodecModuleId GetModuleID() const noexcept override
 	{
-		return cmn::MediaCodecModuleId::NVENC;
+		return _use_gpu ? cmn::MediaCodecModuleId::NVENC : cmn::MediaCodecModuleId::DEFAULT;
 	}
 
 	cmn::MediaType GetMediaType() const noexcept override
@@ -40,7 +40,7 @@ public:
 
 	bool IsHWAccel() const noexcept override
 	{
-		return true;
+		return _use_gpu;
 	}
 
 	// ----- Supported formats -----
@@ -82,6 +82,7 @@ public:
 		info.properties["model"]       = _track ? _track->GetModel() : "";
 		info.properties["language"]    = _source_language;
 		info.properties["translation"] = _translate ? "true" : "false";
+		info.properties["device"]      = _use_gpu ? ov::String::FormatString("cuda:%d", _cuda_id) : ov::String("cpu");
 		return info;
 	}
 
@@ -97,9 +98,16 @@ private:
 	bool AllocWhisperState();
 	void FreeWhisperState();
 
+	// Detects the language (if needed) and transcribes <pcmf32> on a thread of WhisperInferenceService.
+	// Returns false if the window failed or was dropped for missing its deadline.
+	bool RunInference(const std::vector<float> &pcmf32, const std::vector<whisper_token> &prompt_tokens, int64_t new_audio_ms, int &detected_lang_id, float &detected_lang_prob);
+
 	// ----- Members -----
 	std::atomic<bool> _audio_muted{false};
 
+	// Runs on the CUDA device if an NVIDIA device is available, otherwise on the ggml CPU backend.
+	bool _use_gpu = false;
+
 	int32_t _step_ms = 2000;
 	int32_t _length_ms = 10000;
 	int32_t _keep_ms = 1500;
@@ -108,8 +116,10 @@ private:
         // Per-instance inference state: isolates all mutable buffers from other instances.
         // Allocated lazily on enable, released on disable (see CodecThread).
         struct whisper_state * _whisper_state = nullptr;
-        // CUDA device index resolved in InitCodec, reused for lazy state allocation.
+        // CUDA device index resolved in InitCodec (or WhisperModelRegistry::CPU_DEVICE_ID), reused for lazy state allocation.
         int32_t _cuda_id = 0;
+        // Jobs of all streams with the same key are batched by WhisperInferenceService
+        ov::String _model_key;
         // Throttles whisper_state allocation retries after a failure (e.g. GPU OOM).
         std::chrono::steady_clock::time_point _last_state_alloc_fail_ts;
 
@@ -16,6 +16,7 @@
 #include "config/config_manager.h"
 #include "transcoder.h"
 #include "transcoder_gpu.h"
+#include "transcoder_whisper_inference_service.h"
 #include "transcoder_whisper_model_registry.h"
 #include "transcoder_private.h"
 
@@ -69,6 +70,13 @@ bool Transcoder::Start()
 		{
 			ov::String resolved = ov::GetFilePath(entry.GetPath(), config_path);
 
+			// Without an NVIDIA device, <Devices> is ignored and the model is loaded for CPU inference.
+			if (TranscodeGPU::GetInstance()->GetDeviceCount(cmn::MediaCodecModuleId::NVENC) == 0)
+			{
+				preload_models.emplace_back(std::move(resolved), std::vector<int32_t>{WhisperModelRegistry::CPU_DEVICE_ID});
+				continue;
+			}
+
 			// Parse <Devices> as OME device indices (the same namespace as
 			// <Modules>nv:N), then map each to its CUDA device id. This keeps the
 			// preloaded context and the per-stream STT encoder on the same GPU,
@@ -130,6 +138,8 @@ bool Transcoder::Start()
 			preload_models.emplace_back(std::move(resolved), std::move(device_ids));
 		}
 		WhisperModelRegistry::GetInstance()->Preload(preload_models);
+
+		WhisperInferenceService::GetInstance()->Start(std::max(0, whisper_cfg.GetMaxBatchSize()), whisper_cfg.GetThreads());
 	}
 
 	return true;
@@ -139,6 +149,7 @@ bool Transcoder::Stop()
 {
 	logtt("Transcoder has been stopped");
 
+	WhisperInferenceService::GetInstance()->Stop();
 	WhisperModelRegistry::GetInstance()->Uninitialize();
 	TranscodeGPU::GetInstance()->Uninitialize();
 
@@ -282,6 +282,9 @@ void TranscodeDecoder::ThreadLoop()
 {
 	ov::logger::ThreadHelper thread_helper;
 
+	// Stays on the node of the thread that created the stream
+	ov::ThreadPlacement::GetInstance()->PlaceCurrentThreadOnNode(ov::ThreadRole::Codec, -1);
+
 	// Initialize the codec (and bitstream framer) and notify the main thread.
 	if (_codec_init_event.Submit(Initialize()) == false)
 	{
@@ -263,6 +263,8 @@ TranscodeEncoder::TranscodeEncoder(info::Stream stream_info)
 
 TranscodeEncoder::~TranscodeEncoder()
 {
+	UnregisterKeyframeRequest();
+
 	_input_buffer.Clear();
 }
 
@@ -329,6 +331,8 @@ bool TranscodeEncoder::Configure(std::shared_ptr<MediaTrack> output_track, size_
 		return false;
 	}
 
+	RegisterKeyframeRequest();
+
 	return true;
 }
 
@@ -407,6 +411,8 @@ void TranscodeEncoder::Stop()
 		logtt("encoder %s thread has ended", cmn::GetCodecIdString(GetCodecID()));
 	}
 
+	UnregisterKeyframeRequest();
+
 	tc::TranscodeModules::GetInstance()->OnDeleted(true, GetCodecID(), GetModuleID(), GetDeviceID());
 }
 
@@ -459,6 +465,70 @@ void TranscodeEncoder::ArmKeyframeGridRestore()
 	_keyframe_grid_restore_armed = true;
 }
 
+void TranscodeEncoder::RequestKeyframe()
+{
+	_keyframe_requested = true;
+}
+
+bool TranscodeEncoder::ComputeKeyframeRequest()
+{
+	if (_keyframe_requested.exchange(false) == false)
+	{
+		return false;
+	}
+
+	auto track = GetRefTrack();
+	if (track == nullptr || track->GetMediaType() != cmn::MediaType::Video)
+	{
+		return false;
+	}
+
+	logtd("Keyframe has been requested. track(%d)", track->GetId());
+
+	// In FRAME mode the codec counts its keyframe interval from the requested keyframe, so
+	// restore the cadence at the next original position. In TIME mode the forced keyframes
+	// are counted here and do not shift.
+	if (track->GetKeyFrameIntervalTypeByConfig() != cmn::KeyFrameIntervalType::TIME)
+	{
+		ArmKeyframeGridRestore();
+	}
+
+	return true;
+}
+
+void TranscodeEncoder::RegisterKeyframeRequest()
+{
+	if (_keyframe_request_entry != nullptr || _track == nullptr || _track->GetMediaType() != cmn::MediaType::Video)
+	{
+		return;
+	}
+
+	const auto &fast_start_config = _stream_info.GetApplicationInfo().GetConfig().GetPublishers().GetWebrtcPublisher().GetFastStart();
+	if (fast_start_config.IsKeyframeRequestEnabled() == false)
+	{
+		return;
+	}
+
+	_keyframe_request_entry = info::KeyframeRequest::GetInstance()->Register(
+		_stream_info.GetApplicationInfo().GetVHostAppName(), _stream_info.GetName(), _track->GetId(),
+		fast_start_config.GetKeyframeRequestInterval(),
+		[this]() {
+			RequestKeyframe();
+		});
+}
+
+void TranscodeEncoder::UnregisterKeyframeRequest()
+{
+	if (_keyframe_request_entry == nullptr)
+	{
+		return;
+	}
+
+	info::KeyframeRequest::GetInstance()->Unregister(
+		_stream_info.GetApplicationInfo().GetVHostAppName(), _stream_info.GetName(), _track->GetId(), _keyframe_request_entry);
+	_keyframe_request_entry = nullptr;
+}
+
 bool TranscodeEncoder::ComputeKeyframeGridRestore(const std::shared_ptr<const MediaFrame> &frame)
 {
 	auto track = GetRefTrack();
@@ -575,6 +645,9 @@ void TranscodeEncoder::ThreadLoop()
 {
 	ov::logger::ThreadHelper thread_helper;
 
+	// Stays on the node of the thread that created the stream
+	ov::ThreadPlacement::GetInstance()->PlaceCurrentThreadOnNode(ov::ThreadRole::Codec, -1);
+
 	// Initialize the codec and notify the main thread.
 	if (_codec_init_event.Submit(Initialize()) == false)
 	{
@@ -587,13 +660,14 @@ void TranscodeEncoder::ThreadLoop()
 	while (!_kill_flag)
 	{
 		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
+
+		// nullopt: woken up by InjectWakeup() or stopped
+		auto media_frame = SelectFrameToEncode(obj.has_value() ? std::move(obj.value()) : nullptr);
+		if (media_frame == nullptr)
 		{
 			continue;
 		}
 
-		auto media_frame = std::move(obj.value());
-
 		// Reinitialize the codec if the current frame requires it (e.g. XVBM source change).
 		if (NeedReinitForFrame(media_frame) == true)
 		{
@@ -636,6 +710,10 @@ void TranscodeEncoder::ThreadLoop()
 		// change, forces one keyframe there so the cadence does not shift
 		force_keyframe = ComputeKeyframeGridRestore(media_frame) || force_keyframe;
 
+		// Requested by a publisher; checked after the cadence mirror so that the restore it
+		// arms is not consumed by this frame
+		force_keyframe = ComputeKeyframeRequest() || force_keyframe;
+
 		auto sent = SendFrame(media_frame, force_keyframe);
 		if (sent.result == TranscodeResult::DataReady)
 		{
@@ -12,6 +12,7 @@
 
 #include "base/info/stream.h"
 #include "base/info/codec.h"
+#include "base/info/keyframe_request.h"
 #include "codec/codec_base.h"
 
 // Outcome of an encode step (SendFrame / ReceivePacket).
@@ -68,6 +69,9 @@ public:
 	// one, then the codec continues from there. FRAME mode mirrors the codec's
 	// own frame counting; TIME mode projects from the last keyframe timestamp.
 	void ArmKeyframeGridRestore();
+	// Asks for a keyframe at the next frame (e.g. a WebRTC viewer has sent PLI/FIR). Publishers
+	// call this through info::KeyframeRequest, which limits how often it is called.
+	void RequestKeyframe();
 	std::shared_ptr<MediaTrack> &GetRefTrack();
 	cmn::Timebase GetTimebase() const;
 
@@ -125,6 +129,13 @@ protected:
 		return EncodeResult::NoOutput();
 	}
 	virtual EncodeResult ReceivePacket() { return EncodeResult::NoOutput(); }
+	// Called by ThreadLoop() for every dequeued frame, and with nullptr when the input queue was
+	// woken up without a frame. Returns the frame to encode, or nullptr to encode nothing.
+	// Encoders that hold frames back (e.g. on-demand image encoding) override this.
+	virtual std::shared_ptr<const MediaFrame> SelectFrameToEncode(std::shared_ptr<const MediaFrame> frame)
+	{
+		return frame;
+	}
 	virtual bool NeedReinitForFrame(const std::shared_ptr<const MediaFrame> &frame)
 	{
 		(void)frame;
@@ -136,6 +147,9 @@ protected:
 	bool ComputeKeyframeGridRestore(const std::shared_ptr<const MediaFrame> &frame);
 	bool ComputeTimeModeGridRestore(const std::shared_ptr<const MediaFrame> &frame, const std::shared_ptr<MediaTrack> &track);
 	bool ComputeFrameModeGridRestore(const std::shared_ptr<MediaTrack> &track);
+	bool ComputeKeyframeRequest();
+	void RegisterKeyframeRequest();
+	void UnregisterKeyframeRequest();
 
 protected:
 	int32_t _encoder_id = -1;
@@ -168,4 +182,9 @@ protected:
 	// cadence cycle including its opening keyframe, so it rests at N right
 	// before the next cadence position.
 	int32_t _frames_since_cadence_keyframe = 0;
+
+	// Keyframes requested by the publishers, registered when the WebRTC Publisher of the
+	// application enables <FastStart><KeyframeRequest>
+	std::shared_ptr<info::KeyframeRequest::Entry> _keyframe_request_entry;
+	std::atomic<bool> _keyframe_requested{false};
 };
@@ -208,6 +208,9 @@ void TranscodeFilter::ThreadLoop()
 {
 	ov::logger::ThreadHelper thread_helper;
 
+	// Stays on the node of the thread that created the stream
+	ov::ThreadPlacement::GetInstance()->PlaceCurrentThreadOnNode(ov::ThreadRole::Codec, -1);
+
 	if (_codec_init_event.Submit(Initialize()) == false)
 	{
 		return;
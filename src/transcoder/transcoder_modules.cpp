@@ -58,6 +58,11 @@ namespace tc
 						   {cmn::MediaCodecId::Opus},
 						   true, false, true, false));
 
+		// Used when no NVIDIA device is available (see EncoderWhisper)
+		Register(info::CodecModule("whisper.cpp ggml CPU", cmn::MediaType::Audio, cmn::MediaCodecModuleId::DEFAULT, 0, "-",
+						   {cmn::MediaCodecId::Whisper},
+						   false, false, true, false));
+
 		// --------------------------------------------------------------------------
 		// Image Codecs
 		// --------------------------------------------------------------------------
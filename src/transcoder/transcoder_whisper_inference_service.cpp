@@ -0,0 +1,334 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_whisper_inference_service.h"
+
+#include <algorithm>
+
+#include "transcoder_private.h"
+
+WhisperInferenceService::~WhisperInferenceService()
+{
+	Stop();
+}
+
+bool WhisperInferenceService::Start(size_t worker_count, int32_t thread_budget)
+{
+	{
+		ov::LockGuard lock(_queue_mutex);
+
+		if (_running)
+		{
+			return true;
+		}
+
+		_running = true;
+	}
+
+	_thread_budget = (thread_budget > 0) ? thread_budget : std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+	_worker_count = (worker_count > 0) ? worker_count : std::max<size_t>(1, _thread_budget / 2);
+
+	{
+		ov::LockGuard lock(_batch_mutex);
+		_stop_workers = false;
+	}
+
+	{
+		ov::LockGuard lock(_stats_mutex);
+		_stats.worker_count = _worker_count;
+		_stats.thread_budget = _thread_budget;
+	}
+
+	for (size_t index = 0; index < _worker_count; index++)
+	{
+		_worker_threads.emplace_back(&WhisperInferenceService::WorkerLoop, this);
+		pthread_setname_np(_worker_threads.back().native_handle(), ov::String::FormatString("WhisperInf%zu", index).CStr());
+	}
+
+	_schedule_thread = std::thread(&WhisperInferenceService::ScheduleLoop, this);
+	pthread_setname_np(_schedule_thread.native_handle(), "WhisperSched");
+
+	logti("Whisper inference service has started. workers=%zu, threads=%d", _worker_count, _thread_budget);
+
+	return true;
+}
+
+void WhisperInferenceService::Stop()
+{
+	{
+		ov::LockGuard lock(_queue_mutex);
+
+		if (_running == false)
+		{
+			return;
+		}
+
+		_running = false;
+	}
+	_queue_condition.NotifyAll();
+
+	// The scheduler returns after the batch in progress is done
+	if (_schedule_thread.joinable())
+	{
+		_schedule_thread.join();
+	}
+
+	{
+		ov::LockGuard lock(_batch_mutex);
+		_stop_workers = true;
+	}
+	_batch_condition.NotifyAll();
+
+	for (auto &worker_thread : _worker_threads)
+	{
+		if (worker_thread.joinable())
+		{
+			worker_thread.join();
+		}
+	}
+	_worker_threads.clear();
+
+	std::vector<std::shared_ptr<QueuedJob>> cancelled_jobs;
+	{
+		ov::LockGuard lock(_queue_mutex);
+		cancelled_jobs.swap(_queue);
+	}
+
+	for (auto &queued_job : cancelled_jobs)
+	{
+		queued_job->promise.set_value(Result::Cancelled);
+	}
+
+	logti("Whisper inference service has stopped. (%zu jobs cancelled)", cancelled_jobs.size());
+}
+
+WhisperInferenceService::Result WhisperInferenceService::Run(Job job)
+{
+	auto queued_job = std::make_shared<QueuedJob>();
+	queued_job->job = std::move(job);
+	queued_job->queued_time = Clock::now();
+
+	auto future = queued_job->promise.get_future();
+
+	{
+		ov::LockGuard lock(_queue_mutex);
+
+		if (_running == false)
+		{
+			return Result::Cancelled;
+		}
+
+		_queue.push_back(queued_job);
+	}
+	_queue_condition.NotifyAll();
+
+	{
+		ov::LockGuard lock(_stats_mutex);
+		_stats.submitted_count++;
+	}
+
+	return future.get();
+}
+
+std::vector<std::shared_ptr<WhisperInferenceService::QueuedJob>> WhisperInferenceService::NextBatch()
+{
+	std::vector<std::shared_ptr<QueuedJob>> batch;
+
+	{
+		ov::LockGuard lock(_queue_mutex);
+
+		while (batch.empty())
+		{
+			_queue_condition.Wait(lock, [this]() OV_REQUIRES(_queue_mutex) {
+				return (_running == false) || (_queue.empty() == false);
+			});
+
+			if (_running == false)
+			{
+				break;
+			}
+
+			// Drop the jobs that can no longer start in time
+			auto now = Clock::now();
+			auto expired_begin = std::stable_partition(_queue.begin(), _queue.end(), [now](const auto &queued_job) {
+				return queued_job->job.deadline >= now;
+			});
+			if (expired_begin != _queue.end())
+			{
+				{
+					ov::LockGuard stats_lock(_stats_mutex);
+					_stats.expired_count += std::distance(expired_begin, _queue.end());
+				}
+
+				for (auto it = expired_begin; it != _queue.end(); ++it)
+				{
+					(*it)->promise.set_value(Result::Expired);
+				}
+
+				_queue.erase(expired_begin, _queue.end());
+			}
+
+			if (_queue.empty())
+			{
+				continue;
+			}
+
+			// The model of the most urgent job is run in this round, with as many of its jobs as there are workers
+			std::stable_sort(_queue.begin(), _queue.end(), [](const auto &a, const auto &b) {
+				return a->job.deadline < b->job.deadline;
+			});
+
+			const auto model_key = _queue.front()->job.model_key;
+
+			for (auto it = _queue.begin(); (it != _queue.end()) && (batch.size() < _worker_count);)
+			{
+				if ((*it)->job.model_key == model_key)
+				{
+					batch.push_back(*it);
+					it = _queue.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+	}
+
+	return batch;
+}
+
+void WhisperInferenceService::ScheduleLoop()
+{
+	while (true)
+	{
+		auto batch = NextBatch();
+		if (batch.empty())
+		{
+			break;
+		}
+
+		const auto batch_size = batch.size();
+		const auto n_threads = std::clamp(_thread_budget / static_cast<int32_t>(batch_size), 1, MAX_THREADS_PER_JOB);
+
+		{
+			ov::LockGuard lock(_stats_mutex);
+			_stats.batch_count++;
+			_stats.batched_job_count += batch_size;
+			_stats.max_batch_size = std::max(_stats.max_batch_size, batch_size);
+		}
+
+		{
+			ov::LockGuard lock(_batch_mutex);
+			_batch = std::move(batch);
+			_batch_n_threads = n_threads;
+			_next_batch_index = 0;
+			_finished_batch_count = 0;
+		}
+		_batch_condition.NotifyAll();
+
+		// Wait until every job of the batch is done before the next round
+		{
+			ov::LockGuard lock(_batch_mutex);
+			_batch_condition.Wait(lock, [this]() OV_REQUIRES(_batch_mutex) {
+				return _finished_batch_count == _batch.size();
+			});
+			_batch.clear();
+		}
+	}
+}
+
+void WhisperInferenceService::WorkerLoop()
+{
+	while (true)
+	{
+		std::shared_ptr<QueuedJob> queued_job;
+		int32_t n_threads = 1;
+
+		{
+			ov::LockGuard lock(_batch_mutex);
+			_batch_condition.Wait(lock, [this]() OV_REQUIRES(_batch_mutex) {
+				return _stop_workers || (_next_batch_index < _batch.size());
+			});
+
+			if (_stop_workers)
+			{
+				break;
+			}
+
+			queued_job = _batch[_next_batch_index++];
+			n_threads = _batch_n_threads;
+		}
+
+		RunJob(queued_job, n_threads);
+
+		{
+			ov::LockGuard lock(_batch_mutex);
+			_finished_batch_count++;
+		}
+		_batch_condition.NotifyAll();
+	}
+}
+
+void WhisperInferenceService::RunJob(const std::shared_ptr<QueuedJob> &queued_job, int32_t n_threads)
+{
+	auto &job = queued_job->job;
+
+	auto start_time = Clock::now();
+	bool succeeded = (job.run != nullptr) && job.run(n_threads);
+	auto end_time = Clock::now();
+
+	auto queue_wait_usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(start_time - queued_job->queued_time).count());
+	auto inference_usec = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count());
+
+	{
+		ov::LockGuard lock(_stats_mutex);
+
+		_stats.total_queue_wait_usec += queue_wait_usec;
+		_stats.max_queue_wait_usec = std::max(_stats.max_queue_wait_usec, queue_wait_usec);
+
+		if (succeeded)
+		{
+			_stats.completed_count++;
+
+			if (end_time > job.deadline)
+			{
+				_stats.deadline_miss_count++;
+			}
+
+			for (auto model_stats : {&_stats.total, &_stats.models[job.model_key]})
+			{
+				model_stats->job_count++;
+				model_stats->total_audio_ms += std::max<int64_t>(0, job.audio_duration_ms);
+				model_stats->total_inference_usec += inference_usec;
+			}
+		}
+		else
+		{
+			_stats.failed_count++;
+		}
+	}
+
+	queued_job->promise.set_value(succeeded ? Result::Completed : Result::Failed);
+}
+
+WhisperInferenceService::Stats WhisperInferenceService::GetStats() const
+{
+	size_t queue_length = 0;
+	{
+		ov::LockGuard lock(_queue_mutex);
+		queue_length = _queue.size();
+	}
+
+	ov::LockGuard lock(_stats_mutex);
+
+	auto stats = _stats;
+	stats.queue_length = queue_length;
+
+	return stats;
+}
@@ -0,0 +1,145 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <map>
+#include <thread>
+
+// Runs the speech-to-text inference of all Whisper encoders on a bounded set of threads.
+//
+// Each EncoderWhisper submits one job per audio window and waits for it. The scheduler works in
+// rounds: it takes the model of the job with the earliest deadline, and runs every queued job of
+// that model (up to the worker count) in parallel as one batch. The thread budget is split among
+// the jobs of the batch, so the number of inference threads never exceeds the budget, however
+// many streams are transcribed. Jobs that could not start before their deadline are dropped, since
+// the next window of the stream is already due and carries the same audio.
+class WhisperInferenceService : public ov::Singleton<WhisperInferenceService>
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	// whisper.cpp does not scale well beyond this many threads for one window
+	static constexpr int32_t MAX_THREADS_PER_JOB = 4;
+
+	enum class Result
+	{
+		Completed,
+		Failed,
+		// Dropped because it could not start before its deadline
+		Expired,
+		// The service is not running
+		Cancelled
+	};
+
+	struct Job
+	{
+		// Jobs with the same key use the same loaded model (see WhisperModelRegistry::MakeModelKey())
+		ov::String model_key;
+		// Length of the new audio in the window, used for the real-time factor
+		int64_t audio_duration_ms = 0;
+		// The result is no longer useful after this time
+		Clock::time_point deadline;
+		// Runs the inference with <n_threads> threads, and returns false if it failed
+		std::function<bool(int32_t n_threads)> run;
+	};
+
+	struct ModelStats
+	{
+		uint64_t job_count = 0;
+		uint64_t total_audio_ms = 0;
+		uint64_t total_inference_usec = 0;
+
+		// Inference time / audio time. Must stay below 1.0 to keep up with live audio.
+		double GetRealTimeFactor() const
+		{
+			return (total_audio_ms > 0) ? (static_cast<double>(total_inference_usec) / 1000.0) / static_cast<double>(total_audio_ms) : 0.0;
+		}
+	};
+
+	struct Stats
+	{
+		size_t worker_count = 0;
+		int32_t thread_budget = 0;
+		size_t queue_length = 0;
+
+		uint64_t submitted_count = 0;
+		uint64_t completed_count = 0;
+		uint64_t failed_count = 0;
+		uint64_t expired_count = 0;
+		// Jobs that completed after their deadline
+		uint64_t deadline_miss_count = 0;
+
+		uint64_t batch_count = 0;
+		uint64_t batched_job_count = 0;
+		size_t max_batch_size = 0;
+
+		// Time from submission to the start of the inference
+		uint64_t total_queue_wait_usec = 0;
+		uint64_t max_queue_wait_usec = 0;
+
+		// Completed jobs only
+		ModelStats total;
+		std::map<ov::String, ModelStats> models;
+	};
+
+	~WhisperInferenceService() override;
+
+	// worker_count: the maximum batch size (0 = half of the thread budget)
+	// thread_budget: the maximum number of inference threads (0 = number of CPU cores)
+	bool Start(size_t worker_count = 0, int32_t thread_budget = 0);
+	void Stop();
+
+	// Blocks until the job has run or has been dropped
+	Result Run(Job job);
+
+	Stats GetStats() const;
+
+private:
+	struct QueuedJob
+	{
+		Job job;
+		Clock::time_point queued_time;
+		std::promise<Result> promise;
+	};
+
+	void ScheduleLoop();
+	void WorkerLoop();
+
+	// Takes the batch of the next round out of the queue. Returns an empty batch after Stop().
+	std::vector<std::shared_ptr<QueuedJob>> NextBatch();
+	void RunJob(const std::shared_ptr<QueuedJob> &queued_job, int32_t n_threads);
+
+	size_t _worker_count = 0;
+	int32_t _thread_budget = 0;
+
+	mutable ov::Mutex _queue_mutex;
+	ov::ConditionVariable _queue_condition;
+	bool _running OV_GUARDED_BY(_queue_mutex) = false;
+	std::vector<std::shared_ptr<QueuedJob>> _queue OV_GUARDED_BY(_queue_mutex);
+
+	std::thread _schedule_thread;
+	std::vector<std::thread> _worker_threads;
+
+	// The batch being run by the workers
+	ov::Mutex _batch_mutex;
+	ov::ConditionVariable _batch_condition;
+	std::vector<std::shared_ptr<QueuedJob>> _batch OV_GUARDED_BY(_batch_mutex);
+	int32_t _batch_n_threads OV_GUARDED_BY(_batch_mutex) = 1;
+	size_t _next_batch_index OV_GUARDED_BY(_batch_mutex) = 0;
+	size_t _finished_batch_count OV_GUARDED_BY(_batch_mutex) = 0;
+	bool _stop_workers OV_GUARDED_BY(_batch_mutex) = false;
+
+	mutable ov::Mutex _stats_mutex;
+	Stats _stats OV_GUARDED_BY(_stats_mutex);
+};
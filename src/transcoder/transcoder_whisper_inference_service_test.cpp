@@ -0,0 +1,281 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2026 OvenMediaLabs. All rights reserved.
+//
+//==============================================================================
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "transcoder_whisper_inference_service.h"
+
+namespace
+{
+	using Clock = WhisperInferenceService::Clock;
+	using Result = WhisperInferenceService::Result;
+
+	// Keeps the workers busy until Release() is called
+	class Gate
+	{
+	public:
+		void Wait()
+		{
+			_entered = true;
+
+			while (_released == false)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+
+		void WaitEntered()
+		{
+			while (_entered == false)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+
+		void Release()
+		{
+			_released = true;
+		}
+
+	private:
+		std::atomic<bool> _entered{false};
+		std::atomic<bool> _released{false};
+	};
+
+	WhisperInferenceService::Job MakeJob(const ov::String &model_key, int64_t deadline_msec, std::function<bool(int32_t)> run)
+	{
+		WhisperInferenceService::Job job;
+
+		job.model_key = model_key;
+		job.audio_duration_ms = 2000;
+		job.deadline = Clock::now() + std::chrono::milliseconds(deadline_msec);
+		job.run = std::move(run);
+
+		return job;
+	}
+
+	// Occupies the service with a job of <model_key> that runs until <gate> is released
+	std::thread Block(WhisperInferenceService &service, Gate &gate, const ov::String &model_key = "blocker")
+	{
+		std::thread thread([&service, &gate, model_key] {
+			service.Run(MakeJob(model_key, 10000, [&gate](int32_t) {
+				gate.Wait();
+				return true;
+			}));
+		});
+
+		gate.WaitEntered();
+
+		return thread;
+	}
+
+	void WaitForQueueLength(WhisperInferenceService &service, size_t queue_length)
+	{
+		while (service.GetStats().queue_length < queue_length)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+}  // namespace
+
+TEST(WhisperInferenceService, RunAndMeasure)
+{
+	WhisperInferenceService service;
+	ASSERT_TRUE(service.Start(2, 4));
+
+	for (int index = 0; index < 3; index++)
+	{
+		auto result = service.Run(MakeJob("base@-1", 10000, [](int32_t n_threads) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			return n_threads > 0;
+		}));
+		EXPECT_EQ(result, Result::Completed);
+	}
+
+	EXPECT_EQ(service.Run(MakeJob("base@-1", 10000, [](int32_t) { return false; })), Result::Failed);
+
+	auto stats = service.GetStats();
+	EXPECT_EQ(stats.submitted_count, 4u);
+	EXPECT_EQ(stats.completed_count, 3u);
+	EXPECT_EQ(stats.failed_count, 1u);
+	EXPECT_EQ(stats.deadline_miss_count, 0u);
+	EXPECT_EQ(stats.models["base@-1"].job_count, 3u);
+	EXPECT_EQ(stats.models["base@-1"].total_audio_ms, 6000u);
+
+	// 20 ms of inference per 2000 ms of audio
+	EXPECT_GT(stats.total.GetRealTimeFactor(), 0.009);
+	EXPECT_LT(stats.total.GetRealTimeFactor(), 0.5);
+}
+
+// The queued windows of a model are run together, and share the thread budget
+TEST(WhisperInferenceService, WindowsOfModelAreBatched)
+{
+	constexpr int STREAM_COUNT = 4;
+
+	WhisperInferenceService service;
+	ASSERT_TRUE(service.Start(STREAM_COUNT, 8));
+
+	Gate gate;
+	auto blocker = Block(service, gate);
+
+	std::atomic<int> running_count{0};
+	std::atomic<int> max_running_count{0};
+	std::vector<int32_t> thread_counts;
+	std::mutex thread_counts_mutex;
+
+	std::vector<std::thread> streams;
+	for (int index = 0; index < STREAM_COUNT; index++)
+	{
+		streams.emplace_back([&] {
+			auto result = service.Run(MakeJob("small@0", 10000, [&](int32_t n_threads) {
+				auto running = ++running_count;
+				for (auto max = max_running_count.load(); (running > max) && (max_running_count.compare_exchange_weak(max, running) == false);)
+				{
+				}
+
+				{
+					std::lock_guard<std::mutex> lock_guard(thread_counts_mutex);
+					thread_counts.push_back(n_threads);
+				}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+				running_count--;
+				return true;
+			}));
+
+			EXPECT_EQ(result, Result::Completed);
+		});
+	}
+
+	WaitForQueueLength(service, STREAM_COUNT);
+	gate.Release();
+
+	for (auto &stream : streams)
+	{
+		stream.join();
+	}
+	blocker.join();
+
+	auto stats = service.GetStats();
+	EXPECT_EQ(stats.batch_count, 2u);
+	EXPECT_EQ(stats.max_batch_size, static_cast<size_t>(STREAM_COUNT));
+	EXPECT_EQ(max_running_count, STREAM_COUNT);
+
+	// 8 threads for 4 windows
+	ASSERT_EQ(thread_counts.size(), static_cast<size_t>(STREAM_COUNT));
+	for (auto n_threads : thread_counts)
+	{
+		EXPECT_EQ(n_threads, 2);
+	}
+}
+
+TEST(WhisperInferenceService, EarliestDeadlineFirst)
+{
+	WhisperInferenceService service;
+	ASSERT_TRUE(service.Start(1, 1));
+
+	Gate gate;
+	auto blocker = Block(service, gate);
+
+	std::mutex order_mutex;
+	std::vector<ov::String> order;
+
+	std::vector<std::thread> streams;
+	int queued_count = 0;
+	for (auto deadline_msec : {3000, 1000, 2000})
+	{
+		auto name = ov::String::FormatString("model%d", deadline_msec);
+
+		streams.emplace_back([&, name, deadline_msec] {
+			service.Run(MakeJob(name, deadline_msec, [&, name](int32_t) {
+				std::lock_guard<std::mutex> lock_guard(order_mutex);
+				order.push_back(name);
+				return true;
+			}));
+		});
+
+		WaitForQueueLength(service, ++queued_count);
+	}
+
+	gate.Release();
+
+	for (auto &stream : streams)
+	{
+		stream.join();
+	}
+	blocker.join();
+
+	ASSERT_EQ(order.size(), 3u);
+	EXPECT_EQ(order[0], "model1000");
+	EXPECT_EQ(order[1], "model2000");
+	EXPECT_EQ(order[2], "model3000");
+}
+
+// A window that could not start before its deadline is dropped
+TEST(WhisperInferenceService, ExpiredWindowIsDropped)
+{
+	WhisperInferenceService service;
+	ASSERT_TRUE(service.Start(1, 1));
+
+	Gate gate;
+	auto blocker = Block(service, gate);
+
+	std::atomic<bool> ran{false};
+	std::thread stream([&] {
+		auto result = service.Run(MakeJob("base@-1", 20, [&](int32_t) {
+			ran = true;
+			return true;
+		}));
+
+		EXPECT_EQ(result, Result::Expired);
+	});
+
+	WaitForQueueLength(service, 1);
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	gate.Release();
+
+	stream.join();
+	blocker.join();
+
+	EXPECT_FALSE(ran);
+	EXPECT_EQ(service.GetStats().expired_count, 1u);
+}
+
+TEST(WhisperInferenceService, StopCancelsQueuedWindows)
+{
+	WhisperInferenceService service;
+	ASSERT_TRUE(service.Start(1, 1));
+
+	Gate gate;
+	auto blocker = Block(service, gate);
+
+	std::thread stream([&] {
+		EXPECT_EQ(service.Run(MakeJob("other", 10000, [](int32_t) { return true; })), Result::Cancelled);
+	});
+
+	WaitForQueueLength(service, 1);
+
+	std::thread stopper([&] {
+		service.Stop();
+	});
+
+	// Stop() waits for the job in progress
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	gate.Release();
+
+	stopper.join();
+	stream.join();
+	blocker.join();
+
+	EXPECT_EQ(service.Run(MakeJob("other", 10000, [](int32_t) { return true; })), Result::Cancelled);
+}
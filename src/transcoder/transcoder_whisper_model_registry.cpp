@@ -16,22 +16,28 @@
 #include "transcoder_whisper_model_registry.h"
 #include "transcoder_private.h"
 
+ov::String WhisperModelRegistry::MakeModelKey(const ov::String &model_path, int32_t device_id)
+{
+	return ov::String::FormatString("%s@%d", model_path.CStr(), device_id);
+}
+
 bool WhisperModelRegistry::Preload(const std::vector<std::pair<ov::String, std::vector<int32_t>>> &models)
 {
 	ov::LockGuard<ov::Mutex> lock(_mutex);
 
-#ifdef HWACCELS_NVIDIA_ENABLED
 	int device_count = 0;
-	if (cudaGetDeviceCount(&device_count) != cudaSuccess || device_count == 0)
+#ifdef HWACCELS_NVIDIA_ENABLED
+	if (cudaGetDeviceCount(&device_count) != cudaSuccess)
 	{
-		logtw("Whisper STT requires an NVIDIA GPU, but no NVIDIA device is available. Whisper models will not be loaded.");
-		return false;
+		device_count = 0;
 	}
-#else // HWACCELS_NVIDIA_ENABLED
-	logtw("Whisper requires NVIDIA GPU support (rebuild with OME_HWACCEL_NVIDIA=ON). Whisper models will not be loaded.");
-	return false;
 #endif // HWACCELS_NVIDIA_ENABLED
 
+	if (device_count == 0)
+	{
+		logti("No NVIDIA device is available. Whisper models will be loaded for CPU inference.");
+	}
+
 	// Sort models by file size descending within each device so the largest model
 	// claims GPU memory first, leaving smaller models to fill whatever remains.
 	auto sorted_models = models;
@@ -44,7 +50,12 @@ bool WhisperModelRegistry::Preload(const std::vector<std::pair<ov::String, std::
 
 	for (const auto &[path, device_ids] : sorted_models)
 	{
-#ifdef HWACCELS_NVIDIA_ENABLED
+		if (device_count == 0)
+		{
+			LoadModel(path, CPU_DEVICE_ID);
+			continue;
+		}
+
 		if (device_ids.empty())
 		{
 			// "all" — load on every available CUDA device.
@@ -57,6 +68,12 @@ bool WhisperModelRegistry::Preload(const std::vector<std::pair<ov::String, std::
 		{
 			for (int32_t dev : device_ids)
 			{
+				if (dev == CPU_DEVICE_ID)
+				{
+					LoadModel(path, dev);
+					continue;
+				}
+
 				if (dev < 0 || dev >= device_count)
 				{
 					logtw("Whisper preload: CUDA device %d does not exist (device_count=%d), skipping. path=%s", dev, device_count, path.CStr());
@@ -65,7 +82,6 @@ bool WhisperModelRegistry::Preload(const std::vector<std::pair<ov::String, std::
 				LoadModel(path, dev);
 			}
 		}
-#endif
 	}
 
 	return true;
@@ -74,23 +90,44 @@ bool WhisperModelRegistry::Preload(const std::vector<std::pair<ov::String, std::
 // Caller must hold _mutex.
 void WhisperModelRegistry::LoadModel(const ov::String &path, int32_t cuda_device_id)
 {
-	const std::string key = ov::String::FormatString("%s@%d", path.CStr(), cuda_device_id).CStr();
+	const std::string key = MakeModelKey(path, cuda_device_id).CStr();
 
 	if (_models.count(key) > 0)
 	{
 		logtw("Whisper model already loaded on device %d, skipping duplicate. path=%s", cuda_device_id, path.CStr());
 		return;
 	}
-	// Whisper requires a GPU for real-time live transcription.
-	// CPU inference is too slow (several times slower than real-time) and is not supported.
-#ifndef HWACCELS_NVIDIA_ENABLED
-	logte("Whisper requires NVIDIA GPU support. Rebuild with OME_HWACCEL_NVIDIA=ON. path=%s", path.CStr());
-	return;
-#endif
 
 	struct whisper_context_params cparams = whisper_context_default_params();
 	cparams.flash_attn = true;
 
+	if (cuda_device_id == CPU_DEVICE_ID)
+	{
+		// ggml CPU backend. Quantized models (e.g. ggml-base-q5_1.bin) keep CPU inference
+		// within real time; no warmup is needed since there is no lazy cuBLAS initialization.
+		cparams.use_gpu = false;
+
+		auto raw_ctx = whisper_init_from_file_with_params(path.CStr(), cparams);
+		if (raw_ctx == nullptr)
+		{
+			logte("Failed to load Whisper model for CPU. path=%s", path.CStr());
+			return;
+		}
+
+		_models[key] = std::shared_ptr<whisper_context>(raw_ctx, [](whisper_context *c) {
+			whisper_free(c);
+		});
+		_state_memory_bytes[key] = 0;
+
+		logti("Whisper model loaded successfully for CPU inference. path=%s", path.CStr());
+		return;
+	}
+
+#ifndef HWACCELS_NVIDIA_ENABLED
+	logte("Whisper GPU inference requires NVIDIA GPU support. Rebuild with OME_HWACCEL_NVIDIA=ON. device=%d, path=%s", cuda_device_id, path.CStr());
+	return;
+#endif
+
 	// Check free GPU memory before calling whisper_init_from_file_with_params().
 	// ggml calls abort() on CUDA OOM instead of returning an error, so we must
 	// pre-flight check. Required: model file size * 2 (weights + kv cache + compute buffers).
@@ -201,7 +238,7 @@ std::shared_ptr<whisper_context> WhisperModelRegistry::GetModelContext(const ov:
 {
 	ov::LockGuard<ov::Mutex> lock(_mutex);
 
-	const std::string key = ov::String::FormatString("%s@%d", model_path.CStr(), cuda_device_id).CStr();
+	const std::string key = MakeModelKey(model_path, cuda_device_id).CStr();
 
 	auto it = _models.find(key);
 	if (it != _models.end())
@@ -227,7 +264,7 @@ whisper_state *WhisperModelRegistry::NewState(const ov::String &model_path, int3
 {
 	ov::LockGuard<ov::Mutex> lock(_mutex);
 
-	const std::string key = ov::String::FormatString("%s@%d", model_path.CStr(), cuda_device_id).CStr();
+	const std::string key = MakeModelKey(model_path, cuda_device_id).CStr();
 
 	auto model_it = _models.find(key);
 	if (model_it == _models.end())
@@ -239,10 +276,11 @@ whisper_state *WhisperModelRegistry::NewState(const ov::String &model_path, int3
 #ifdef HWACCELS_NVIDIA_ENABLED
 	// Check GPU memory before calling whisper_init_state to prevent ggml crash.
 	// The mutex ensures serialize check+alloc across all encoder threads.
-	cudaSetDevice(cuda_device_id);
 	auto mem_it = _state_memory_bytes.find(key);
-	if (mem_it != _state_memory_bytes.end() && mem_it->second > 0)
+	if (cuda_device_id != CPU_DEVICE_ID && mem_it != _state_memory_bytes.end() && mem_it->second > 0)
 	{
+		cudaSetDevice(cuda_device_id);
+
 		size_t required = mem_it->second;
 		size_t free_mem = 0, total_mem = 0;
 		if (cudaMemGetInfo(&free_mem, &total_mem) == cudaSuccess && free_mem < required)
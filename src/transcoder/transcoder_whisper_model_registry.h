@@ -20,21 +20,29 @@
 class WhisperModelRegistry : public ov::Singleton<WhisperModelRegistry>
 {
 public:
+	// Device id of a model loaded for the ggml CPU backend
+	static constexpr int32_t CPU_DEVICE_ID = -1;
+
+	// Identifies a loaded model: one whisper_context exists per key and is shared by all streams
+	static ov::String MakeModelKey(const ov::String &model_path, int32_t device_id);
+
 // Eagerly load the given models. Optional — call at server start to preload.
         // Each entry is a (resolved_path, cuda_device_ids) pair.
         // An empty device_ids list means "all available CUDA devices" (from <Devices>all</Devices>).
         // A single-element list {0} means the default (omitted <Devices>).
+        // CPU_DEVICE_ID loads the model for CPU inference, which is also used for every model
+        // when no CUDA device is available.
         bool Preload(const std::vector<std::pair<ov::String, std::vector<int32_t>>> &models);
 
 	// Release all loaded models. Called at server stop.
 	void Uninitialize();
 
-// Return a shared_ptr to the whisper_context for the given model path and CUDA device.
+// Return a shared_ptr to the whisper_context for the given model path and CUDA device (or CPU_DEVICE_ID).
         // If the model is not yet loaded on that device it will be loaded on-demand and cached.
         std::shared_ptr<whisper_context> GetModelContext(const ov::String &model_path, int32_t cuda_device_id = 0);
 
         // Allocate a per-encoder whisper_state for the given model and CUDA device.
-        // Checks GPU memory availability before allocation to prevent ggml crash.
+        // Checks GPU memory availability before allocation to prevent ggml crash (GPU models only).
         // Returns nullptr if the model is not loaded or GPU memory is insufficient.
         whisper_state *NewState(const ov::String &model_path, int32_t cuda_device_id = 0);
 
@@ -42,7 +50,7 @@ public:
         void DeleteState(whisper_state *state);
 
 private:
-        // Load a single model on the specified CUDA device and cache it. Caller must hold _mutex.
+        // Load a single model on the specified CUDA device (or CPU_DEVICE_ID) and cache it. Caller must hold _mutex.
         void LoadModel(const ov::String &model_path, int32_t cuda_device_id = 0) OV_REQUIRES(_mutex);
 
 	ov::Mutex _mutex;